@@ -0,0 +1,209 @@
+#include "harness.h"
+/* Дополнительные модули */
+#include <vi/pool.h>
+#include <vi/arena.h>
+#include <vi/nullptr.h>
+#include <vi/allocator.h>
+
+#include <stdlib.h>
+
+/**
+ * @def VI_BENCH_ALLOCATOR_OBJECT_SIZE
+ * @brief Размер объекта в замерах выделения одиночных объектов.
+ */
+#define VI_BENCH_ALLOCATOR_OBJECT_SIZE 64
+
+/**
+ * @def VI_BENCH_ALLOCATOR_ARENA_SIZE
+ * @brief Размер блока в замерах арены.
+ */
+#define VI_BENCH_ALLOCATOR_ARENA_SIZE 32
+
+/**
+ * @def VI_BENCH_ALLOCATOR_ARENA_SPAN
+ * @brief Количество выделений арены между восстановлениями маркера.
+ */
+#define VI_BENCH_ALLOCATOR_ARENA_SPAN 1024
+
+/**
+ * @def VI_BENCH_ALLOCATOR_BATCH
+ * @brief Количество одновременно живых объектов в пакетных замерах.
+ */
+#define VI_BENCH_ALLOCATOR_BATCH 64
+
+static void
+vi_bench_allocator_stdlib(vi_ptr_t arg, vi_usize_t iterations)
+{
+    const vi_allocator_t *const allocator = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_ptr_t ptr = vi_allocator_allocate(allocator, VI_BENCH_ALLOCATOR_OBJECT_SIZE);
+
+        vi_bench_clobber(ptr);
+        vi_allocator_free(allocator, ptr, VI_BENCH_ALLOCATOR_OBJECT_SIZE);
+    }
+}
+
+static void
+vi_bench_allocator_libc(vi_ptr_t arg, vi_usize_t iterations)
+{
+    (void)arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        void *ptr = malloc(VI_BENCH_ALLOCATOR_OBJECT_SIZE);
+
+        vi_bench_clobber(ptr);
+        free(ptr);
+    }
+}
+
+static void
+vi_bench_allocator_libc_batch(vi_ptr_t arg, vi_usize_t iterations)
+{
+    void *objects[VI_BENCH_ALLOCATOR_BATCH];
+
+    (void)arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        for (vi_usize_t j = 0; j < VI_BENCH_ALLOCATOR_BATCH; ++j)
+        {
+            objects[j] = malloc(VI_BENCH_ALLOCATOR_OBJECT_SIZE);
+        }
+
+        vi_bench_clobber(objects);
+
+        for (vi_usize_t j = 0; j < VI_BENCH_ALLOCATOR_BATCH; ++j)
+        {
+            free(objects[j]);
+        }
+    }
+}
+
+static void
+vi_bench_allocator_arena(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_arena_t *const arena        = arg;
+    const vi_arena_marker_t marker = vi_arena_save(arena);
+
+    // Маркер указывает в уже выделенный участок, поэтому восстановление только
+    // возвращает указатель и новые участки не выделяются.
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        if (i % VI_BENCH_ALLOCATOR_ARENA_SPAN == VI_BENCH_ALLOCATOR_ARENA_SPAN - 1)
+        {
+            vi_arena_restore(arena, marker);
+        }
+
+        vi_bench_clobber(vi_arena_allocate(arena, VI_BENCH_ALLOCATOR_ARENA_SIZE));
+    }
+
+    vi_arena_restore(arena, marker);
+}
+
+static void
+vi_bench_allocator_pool(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_pool_t *const pool = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_ptr_t ptr = vi_pool_allocate(pool);
+
+        vi_bench_clobber(ptr);
+        vi_pool_free(pool, ptr);
+    }
+}
+
+static void
+vi_bench_allocator_pool_batch(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_pool_t *const pool = arg;
+    vi_ptr_t objects[VI_BENCH_ALLOCATOR_BATCH];
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        for (vi_usize_t j = 0; j < VI_BENCH_ALLOCATOR_BATCH; ++j)
+        {
+            objects[j] = vi_pool_allocate(pool);
+        }
+
+        vi_bench_clobber(objects);
+
+        for (vi_usize_t j = 0; j < VI_BENCH_ALLOCATOR_BATCH; ++j)
+        {
+            vi_pool_free(pool, objects[j]);
+        }
+    }
+}
+
+void
+vi_bench_suite_allocator(vi_bench_t *bench)
+{
+    const vi_allocator_t *const allocator = vi_allocator_stdlib();
+
+    vi_bench_run(bench,
+                 "allocator_stdlib",
+                 VI_BENCH_ALLOCATOR_OBJECT_SIZE,
+                 0,
+                 vi_bench_allocator_stdlib,
+                 (vi_ptr_t)allocator);
+    vi_bench_run(bench,
+                 "libc_malloc_free",
+                 VI_BENCH_ALLOCATOR_OBJECT_SIZE,
+                 0,
+                 vi_bench_allocator_libc,
+                 nullptr);
+    vi_bench_run(bench,
+                 "libc_malloc_free_batch",
+                 VI_BENCH_ALLOCATOR_BATCH,
+                 0,
+                 vi_bench_allocator_libc_batch,
+                 nullptr);
+
+    vi_arena_t arena;
+
+    // Инициализация со стандартным распределителем не завершается ошибкой; первое
+    // выделение создает участок, в который затем указывает маркер замера.
+    vi_arena_init(&arena, allocator, 0);
+
+    if (vi_arena_allocate(&arena, 1))
+    {
+        vi_bench_run(bench,
+                     "arena_allocate",
+                     VI_BENCH_ALLOCATOR_ARENA_SIZE,
+                     0,
+                     vi_bench_allocator_arena,
+                     &arena);
+    }
+    else
+    {
+        fputs("vi_bench: arena skipped, out of memory\n", stderr);
+    }
+
+    vi_arena_destroy(&arena);
+
+    vi_pool_t *const pool = vi_pool_create(allocator, VI_BENCH_ALLOCATOR_OBJECT_SIZE);
+
+    if (!pool)
+    {
+        fputs("vi_bench: pool skipped, out of memory\n", stderr);
+        return;
+    }
+
+    vi_bench_run(bench,
+                 "pool_allocate_free",
+                 VI_BENCH_ALLOCATOR_OBJECT_SIZE,
+                 0,
+                 vi_bench_allocator_pool,
+                 pool);
+    vi_bench_run(bench,
+                 "pool_allocate_free_batch",
+                 VI_BENCH_ALLOCATOR_BATCH,
+                 0,
+                 vi_bench_allocator_pool_batch,
+                 pool);
+    vi_pool_destroy(pool);
+}
@@ -0,0 +1,520 @@
+#include "harness.h"
+/* Дополнительные модули */
+#include <vi/bitset.h>
+#include <vi/nullptr.h>
+#include <vi/hash_map.h>
+#include <vi/allocator.h>
+#include <vi/array_size.h>
+#include <vi/memory_copy.h>
+#include <vi/dynamic_block.h>
+
+/**
+ * @def VI_BENCH_CONTAINER_STRIDE
+ * @brief Нечетный шаг обхода ключей: соседние обращения попадают в разные ячейки таблицы.
+ */
+#define VI_BENCH_CONTAINER_STRIDE 40503
+
+/**
+ * @def VI_BENCH_CONTAINER_BLOCK_SIZE
+ * @brief Количество элементов динамического блока в замерах вставки и удаления.
+ */
+#define VI_BENCH_CONTAINER_BLOCK_SIZE 1024
+
+/**
+ * @brief Состояние замеров хеш-таблицы.
+ */
+typedef struct vi_bench_hash_map_t
+{
+    /**
+     * @brief Таблица с ключами `keys[head]` ... `keys[head + count - 1]` (по модулю `2 * count`).
+     */
+    vi_hash_map_t map;
+
+    /**
+     * @brief Таблица, заполняемая замером вставки.
+     */
+    vi_hash_map_t fill;
+
+    /**
+     * @brief Копия таблицы `fill` со всеми ключами `keys[0]` ... `keys[count - 1]`:
+     *        управляющие байты и ячейки.
+     */
+    vi_u8_t *snapshot;
+
+    /**
+     * @brief Запас вставок `fill` до перестройки в момент снятия копии `snapshot`.
+     */
+    vi_usize_t snapshot_growth_left;
+
+    /**
+     * @brief Различные ключи; вторая половина отсутствует в `map` в начале замеров.
+     */
+    vi_u64_t *keys;
+
+    /**
+     * @brief Количество ключей в таблице; степень двойки.
+     */
+    vi_usize_t count;
+
+    /**
+     * @brief Номер первого ключа `map` при замене ключей.
+     */
+    vi_usize_t head;
+
+    /**
+     * @brief Количество ключей в `fill` при вставке или удаленных из `fill` ключей
+     *        при удалении.
+     */
+    vi_usize_t filled;
+} vi_bench_hash_map_t;
+
+/**
+ * @brief Состояние замеров набора битов.
+ */
+typedef struct vi_bench_bitset_t
+{
+    /**
+     * @brief Набор, в котором сброшен только последний бит.
+     */
+    vi_bitset_t full;
+
+    /**
+     * @brief Набор, в котором сброшен каждый 64-й бит.
+     */
+    vi_bitset_t sparse;
+
+    /**
+     * @brief Номер бита, с которого начинается следующий поиск в `sparse`.
+     */
+    vi_usize_t hint;
+} vi_bench_bitset_t;
+
+static void
+vi_bench_hash_map_find_hit(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_hash_map_t *const h = arg;
+    const vi_usize_t mask        = h->count - 1;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        const vi_usize_t index =
+            (h->head + ((i * VI_BENCH_CONTAINER_STRIDE) & mask)) & (2 * mask + 1);
+        vi_bench_consume(vi_hash_map_find(&h->map, &h->keys[index]));
+    }
+}
+
+static void
+vi_bench_hash_map_find_miss(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_hash_map_t *const h = arg;
+    const vi_usize_t mask        = h->count - 1;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        const vi_usize_t index =
+            (h->head + h->count + ((i * VI_BENCH_CONTAINER_STRIDE) & mask)) & (2 * mask + 1);
+        vi_bench_consume(vi_hash_map_find(&h->map, &h->keys[index]));
+    }
+}
+
+static void
+vi_bench_hash_map_insert(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_hash_map_t *const h = arg;
+
+    // Таблица очищается после заполнения; очистка сбрасывает только управляющие байты
+    // и распределяется на `count` вставок.
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        if (h->filled == h->count)
+        {
+            vi_hash_map_clear(&h->fill);
+            h->filled = 0;
+        }
+
+        vi_bench_consume(vi_hash_map_insert(&h->fill, &h->keys[h->filled], &i, nullptr));
+        ++h->filled;
+    }
+}
+
+static void
+vi_bench_hash_map_replace(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_hash_map_t *const h = arg;
+    const vi_usize_t mask        = 2 * h->count - 1;
+
+    // Каждая операция удаляет самый старый ключ и добавляет новый: размер таблицы
+    // постоянен, а удаленные ячейки накапливаются, как при работе кэша.
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_hash_map_erase(&h->map, &h->keys[h->head]);
+        vi_hash_map_insert(&h->map, &h->keys[(h->head + h->count) & mask], &i, nullptr);
+        h->head = (h->head + 1) & mask;
+    }
+}
+
+/**
+ * @brief Возвращает размер таблицы хеш-таблицы `map` в байтах: управляющие байты и ячейки.
+ */
+static vi_usize_t
+vi_bench_hash_map_table_size(const vi_hash_map_t *map)
+{
+    return map->capacity * (map->slot_size + 1);
+}
+
+static void
+vi_bench_hash_map_erase(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_hash_map_t *const h = arg;
+    const vi_usize_t mask        = h->count - 1;
+
+    // Ключи удаляются в порядке обхода с шагом, пока таблица не опустеет; затем таблица
+    // восстанавливается из копии. Копирование распределяется на `count` удалений
+    // и добавляет к каждому около `(slot_size + 1) * capacity / count` байтов записи.
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        if (h->filled == h->count)
+        {
+            vi_memory_copy_unsafe(h->fill.ctrl,
+                                  h->snapshot,
+                                  vi_bench_hash_map_table_size(&h->fill));
+            h->fill.size        = h->count;
+            h->fill.growth_left = h->snapshot_growth_left;
+            h->filled           = 0;
+        }
+
+        const vi_usize_t index = (h->filled * VI_BENCH_CONTAINER_STRIDE) & mask;
+        vi_hash_map_erase(&h->fill, &h->keys[index]);
+        ++h->filled;
+    }
+}
+
+static void
+vi_bench_bitset_find_first_clear(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_bitset_t *const b = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_bitset_find_first_clear(&b->full, 0));
+    }
+}
+
+static void
+vi_bench_bitset_count(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_bitset_t *const b = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_bitset_count(&b->full, 0, vi_bitset_size(&b->full)));
+    }
+}
+
+static void
+vi_bench_bitset_xor(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_bitset_t *const b = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_bitset_xor(&b->sparse, &b->full));
+    }
+}
+
+static void
+vi_bench_bitset_acquire(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_bitset_t *const b = arg;
+
+    // Занятый бит сразу освобождается, поэтому каждый поиск проходит до следующего
+    // сброшенного бита, в среднем 64 бита.
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        const vi_usize_t index = vi_bitset_acquire(&b->sparse, b->hint);
+
+        vi_bitset_release(&b->sparse, index);
+        b->hint = index + 1;
+    }
+}
+
+/**
+ * @brief Замеры хеш-таблицы, выполняемые для каждого количества ключей.
+ */
+static const vi_bench_case_t vi_bench_hash_map_cases[] = {
+    {"hash_map_find_hit", vi_bench_hash_map_find_hit},
+    {"hash_map_find_miss", vi_bench_hash_map_find_miss},
+    {"hash_map_insert", vi_bench_hash_map_insert},
+    {"hash_map_replace", vi_bench_hash_map_replace},
+};
+
+/**
+ * @brief Замеры набора битов, обрабатывающие весь набор.
+ */
+static const vi_bench_case_t vi_bench_bitset_cases[] = {
+    {"bitset_find_first_clear", vi_bench_bitset_find_first_clear},
+    {"bitset_count", vi_bench_bitset_count},
+    {"bitset_xor", vi_bench_bitset_xor},
+};
+
+/**
+ * @brief Количество элементов контейнеров; степени двойки.
+ *
+ * Количества больше `max_entries` пропускаются; по умолчанию выполняются
+ * замеры до 1M элементов.
+ */
+static const vi_usize_t vi_bench_container_sizes[] = {
+    1024,
+    65536,
+    1024 * 1024,
+    16 * 1024 * 1024,
+    128 * 1024 * 1024,
+};
+
+/**
+ * @brief Освобождает таблицы и буферы состояния замеров хеш-таблицы.
+ */
+static void
+vi_bench_hash_map_destroy(vi_bench_hash_map_t *h)
+{
+    const vi_allocator_t *const allocator = vi_allocator_stdlib();
+    const vi_usize_t key_size             = sizeof(vi_u64_t);
+
+    if (h->snapshot)
+    {
+        vi_allocator_free(allocator, h->snapshot, vi_bench_hash_map_table_size(&h->fill));
+    }
+
+    vi_hash_map_destroy(&h->map);
+    vi_hash_map_destroy(&h->fill);
+
+    if (h->keys)
+    {
+        vi_allocator_free(allocator, h->keys, 2 * h->count * key_size);
+    }
+}
+
+/**
+ * @brief Выполняет замеры хеш-таблицы с `count` ключами.
+ */
+static void
+vi_bench_hash_map(vi_bench_t *bench, vi_usize_t count)
+{
+    const vi_allocator_t *const allocator = vi_allocator_stdlib();
+    const vi_usize_t key_size             = sizeof(vi_u64_t);
+    vi_bench_hash_map_t h;
+
+    // Инициализация со стандартным распределителем не выделяет память и не завершается ошибкой.
+    vi_hash_map_init(&h.map, allocator, key_size, sizeof(vi_u64_t), nullptr, nullptr);
+    vi_hash_map_init(&h.fill, allocator, key_size, sizeof(vi_u64_t), nullptr, nullptr);
+    h.snapshot = nullptr;
+    h.keys     = vi_allocator_allocate(allocator, 2 * count * key_size);
+    h.count    = count;
+    h.head     = 0;
+    h.filled   = 0;
+
+    bool ok = h.keys && vi_hash_map_reserve(&h.map, count) && vi_hash_map_reserve(&h.fill, count);
+
+    for (vi_usize_t i = 0; ok && i < 2 * count; ++i)
+    {
+        h.keys[i] = (vi_u64_t)i * 0x9E3779B97F4A7C15ULL + 1;
+    }
+
+    for (vi_usize_t i = 0; ok && i < count; ++i)
+    {
+        ok = vi_hash_map_insert(&h.map, &h.keys[i], &i, nullptr) != nullptr;
+    }
+
+    if (!ok)
+    {
+        fputs("vi_bench: hash_map skipped, out of memory\n", stderr);
+        vi_bench_hash_map_destroy(&h);
+        return;
+    }
+
+    vi_bench_report(bench,
+                    "hash_map_bytes_per_entry",
+                    count,
+                    (double)vi_bench_hash_map_table_size(&h.map) / (double)count,
+                    "B/entry");
+
+    for (vi_usize_t c = 0; c < vi_array_size(vi_bench_hash_map_cases); ++c)
+    {
+        vi_bench_run(bench,
+                     vi_bench_hash_map_cases[c].name,
+                     count,
+                     0,
+                     vi_bench_hash_map_cases[c].fn,
+                     &h);
+    }
+
+    // Замер удаления начинается с полной таблицы `fill`, копия которой восстанавливает
+    // таблицу после удаления всех ключей.
+    vi_hash_map_clear(&h.fill);
+
+    for (vi_usize_t i = 0; i < count; ++i)
+    {
+        vi_hash_map_insert(&h.fill, &h.keys[i], &i, nullptr);
+    }
+
+    h.snapshot = vi_allocator_allocate(allocator, vi_bench_hash_map_table_size(&h.fill));
+
+    if (h.snapshot)
+    {
+        vi_memory_copy_unsafe(h.snapshot, h.fill.ctrl, vi_bench_hash_map_table_size(&h.fill));
+        h.snapshot_growth_left = h.fill.growth_left;
+        h.filled               = 0;
+        vi_bench_run(bench, "hash_map_erase", count, 0, vi_bench_hash_map_erase, &h);
+    }
+    else
+    {
+        fputs("vi_bench: hash_map_erase skipped, out of memory\n", stderr);
+    }
+
+    vi_bench_hash_map_destroy(&h);
+}
+
+/**
+ * @brief Выполняет замеры набора из `size` битов.
+ */
+static void
+vi_bench_bitset(vi_bench_t *bench, vi_usize_t size)
+{
+    const vi_allocator_t *const allocator = vi_allocator_stdlib();
+    vi_bench_bitset_t b;
+
+    b.hint = 0;
+
+    if (!vi_bitset_init(&b.full, allocator, size))
+    {
+        fputs("vi_bench: bitset skipped, out of memory\n", stderr);
+        return;
+    }
+
+    if (!vi_bitset_init(&b.sparse, allocator, size))
+    {
+        fputs("vi_bench: bitset skipped, out of memory\n", stderr);
+        vi_bitset_destroy(&b.full);
+        return;
+    }
+
+    vi_bitset_fill(&b.full, 0, size - 1, true);
+    vi_bitset_fill(&b.sparse, 0, size, true);
+
+    for (vi_usize_t i = 0; i < size; i += 64)
+    {
+        vi_bitset_clear(&b.sparse, i);
+    }
+
+    for (vi_usize_t c = 0; c < vi_array_size(vi_bench_bitset_cases); ++c)
+    {
+        vi_bench_run(bench,
+                     vi_bench_bitset_cases[c].name,
+                     size,
+                     size / 8,
+                     vi_bench_bitset_cases[c].fn,
+                     &b);
+    }
+
+    // Две операции XOR с одним набором возвращают `sparse` к исходному виду,
+    // но количество замеров может быть нечетным: восстанавливаем набор явно.
+    vi_bitset_fill(&b.sparse, 0, size, true);
+
+    for (vi_usize_t i = 0; i < size; i += 64)
+    {
+        vi_bitset_clear(&b.sparse, i);
+    }
+
+    vi_bench_run(bench, "bitset_acquire", size, 0, vi_bench_bitset_acquire, &b);
+    vi_bitset_destroy(&b.full);
+    vi_bitset_destroy(&b.sparse);
+}
+
+static void
+vi_bench_dynamic_block_push(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_dynamic_block_t *const block = arg;
+
+    // Блок очищается после заполнения, поэтому память выделяется только в первом вызове.
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        if (block->size == VI_BENCH_CONTAINER_BLOCK_SIZE)
+        {
+            vi_dynamic_block_clear(block);
+        }
+
+        vi_bench_consume(vi_dynamic_block_push(block, &i));
+    }
+}
+
+static void
+vi_bench_dynamic_block_insert_erase(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_dynamic_block_t *const block = arg;
+    const vi_usize_t middle         = block->size / 2;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_dynamic_block_insert(block, middle, &i, 1);
+        vi_dynamic_block_erase(block, middle, 1);
+    }
+}
+
+/**
+ * @brief Выполняет замеры динамического блока из 8-байтовых элементов.
+ */
+static void
+vi_bench_dynamic_block(vi_bench_t *bench)
+{
+    vi_dynamic_block_t block;
+
+    if (!vi_dynamic_block_init(&block, vi_allocator_stdlib(), sizeof(vi_u64_t)) ||
+        !vi_dynamic_block_reserve(&block, VI_BENCH_CONTAINER_BLOCK_SIZE + 1))
+    {
+        fputs("vi_bench: dynamic_block skipped, out of memory\n", stderr);
+        vi_dynamic_block_destroy(&block);
+        return;
+    }
+
+    vi_bench_run(bench,
+                 "dynamic_block_push",
+                 VI_BENCH_CONTAINER_BLOCK_SIZE,
+                 sizeof(vi_u64_t),
+                 vi_bench_dynamic_block_push,
+                 &block);
+
+    for (vi_u64_t i = block.size; i < VI_BENCH_CONTAINER_BLOCK_SIZE; ++i)
+    {
+        vi_dynamic_block_push(&block, &i);
+    }
+
+    vi_bench_run(bench,
+                 "dynamic_block_insert_erase",
+                 VI_BENCH_CONTAINER_BLOCK_SIZE,
+                 0,
+                 vi_bench_dynamic_block_insert_erase,
+                 &block);
+    vi_dynamic_block_destroy(&block);
+}
+
+void
+vi_bench_suite_container(vi_bench_t *bench)
+{
+    for (vi_usize_t s = 0; s < vi_array_size(vi_bench_container_sizes); ++s)
+    {
+        if (vi_bench_container_sizes[s] <= bench->max_entries)
+        {
+            vi_bench_hash_map(bench, vi_bench_container_sizes[s]);
+        }
+    }
+
+    for (vi_usize_t s = 0; s < vi_array_size(vi_bench_container_sizes); ++s)
+    {
+        if (vi_bench_container_sizes[s] <= bench->max_entries)
+        {
+            vi_bench_bitset(bench, vi_bench_container_sizes[s]);
+        }
+    }
+
+    vi_bench_dynamic_block(bench);
+}
@@ -0,0 +1,474 @@
+#include "harness.h"
+/* Дополнительные модули */
+#include <vi/allocator.h>
+#include <vi/array_size.h>
+#include <vi/memory_copy.h>
+#include <vi/memory_set.h>
+#include <vi/memory_compare.h>
+#include <vi/memory_find.h>
+#include <vi/memory_range_type.h>
+
+#include <string.h>
+
+/**
+ * @def VI_BENCH_MEMORY_MAX
+ * @brief Наибольший размер участка памяти в замерах.
+ *
+ * Участки от 4 МиБ заполняются и копируются потоковыми записями в обход кэша,
+ * поэтому размеры доходят до 64 МиБ, заведомо больших кэша последнего уровня.
+ */
+#define VI_BENCH_MEMORY_MAX (64 * 1024 * 1024)
+
+/**
+ * @def VI_BENCH_MEMORY_PADDING
+ * @brief Запас до и после участков, нужный перекрывающемуся перемещению
+ *        и границам открытых диапазонов.
+ */
+#define VI_BENCH_MEMORY_PADDING 64
+
+/**
+ * @def VI_BENCH_MEMORY_ABSENT
+ * @brief Байт, которого нет в исходных данных: поиск просматривает весь участок.
+ */
+#define VI_BENCH_MEMORY_ABSENT 0xFF
+
+/**
+ * @brief Буферы и размер участка для замеров функций работы с памятью.
+ */
+typedef struct vi_bench_memory_t
+{
+    /**
+     * @brief Участок, в который выполняется запись.
+     */
+    vi_u8_t *dst;
+
+    /**
+     * @brief Исходные данные.
+     */
+    vi_u8_t *src;
+
+    /**
+     * @brief Копия исходных данных для сравнения.
+     */
+    vi_u8_t *copy;
+
+    /**
+     * @brief Размер участка.
+     */
+    vi_usize_t size;
+} vi_bench_memory_t;
+
+/**
+ * @brief Вычисляет границы диапазона из `size` байтов по адресу `ptr` для `VI_MEMORY_RANGE_TYPE`.
+ */
+static void
+vi_bench_memory_range(vi_u8_t *ptr, vi_usize_t size, vi_u8_t **begin, vi_u8_t **end)
+{
+#if VI_MEMORY_RANGE_TYPE == VI_MEMORY_RANGE_TYPE_CLOSED
+    *begin = ptr;
+    *end   = ptr + size - 1;
+#elif VI_MEMORY_RANGE_TYPE == VI_MEMORY_RANGE_TYPE_LEFT_OPENED
+    *begin = ptr - 1;
+    *end   = ptr + size - 1;
+#elif VI_MEMORY_RANGE_TYPE == VI_MEMORY_RANGE_TYPE_RIGHT_OPENED
+    *begin = ptr;
+    *end   = ptr + size;
+#else
+    *begin = ptr - 1;
+    *end   = ptr + size;
+#endif // VI_MEMORY_RANGE_TYPE == VI_MEMORY_RANGE_TYPE_CLOSED
+}
+
+static void
+vi_bench_memory_copy_unsafe(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_memory_t *const m = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_memory_copy_unsafe(m->dst, m->src, m->size);
+        vi_bench_clobber(m->dst);
+    }
+}
+
+static void
+vi_bench_memory_move_unsafe(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_memory_t *const m = arg;
+
+    // Участки перекрываются и приемник правее источника: копирование идет с конца.
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_memory_move_unsafe(m->dst + 1, m->dst, m->size);
+        vi_bench_clobber(m->dst);
+    }
+}
+
+static void
+vi_bench_memory_set_unsafe(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_memory_t *const m = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_memory_set_unsafe(m->dst, m->size, (vi_u8_t)i);
+        vi_bench_clobber(m->dst);
+    }
+}
+
+static void
+vi_bench_memory_zero_unsafe(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_memory_t *const m = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_memory_zero_unsafe(m->dst, m->size);
+        vi_bench_clobber(m->dst);
+    }
+}
+
+static void
+vi_bench_memory_compare_unsafe(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_memory_t *const m = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_memory_compare_unsafe(m->src, m->copy, m->size));
+    }
+}
+
+static void
+vi_bench_memory_equal_unsafe(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_memory_t *const m = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_memory_equal_unsafe(m->src, m->copy, m->size));
+    }
+}
+
+static void
+vi_bench_memory_find_byte_unsafe(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_memory_t *const m = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_memory_find_byte_unsafe(m->src, m->size, VI_BENCH_MEMORY_ABSENT));
+    }
+}
+
+static void
+vi_bench_memory_find_last_byte_unsafe(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_memory_t *const m = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(
+            vi_memory_find_last_byte_unsafe(m->src, m->size, VI_BENCH_MEMORY_ABSENT));
+    }
+}
+
+static void
+vi_bench_memory_copy(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_memory_t *const m = arg;
+    vi_u8_t *dst_begin, *dst_end, *src_begin, *src_end;
+
+    vi_bench_memory_range(m->dst, m->size, &dst_begin, &dst_end);
+    vi_bench_memory_range(m->src, m->size, &src_begin, &src_end);
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_memory_copy(dst_begin, dst_end, src_begin, src_end);
+        vi_bench_clobber(m->dst);
+    }
+}
+
+static void
+vi_bench_memory_move(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_memory_t *const m = arg;
+    vi_u8_t *dst_begin, *dst_end, *src_begin, *src_end;
+
+    vi_bench_memory_range(m->dst + 1, m->size, &dst_begin, &dst_end);
+    vi_bench_memory_range(m->dst, m->size, &src_begin, &src_end);
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_memory_move(dst_begin, dst_end, src_begin, src_end);
+        vi_bench_clobber(m->dst);
+    }
+}
+
+static void
+vi_bench_memory_set(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_memory_t *const m = arg;
+    vi_u8_t *begin, *end;
+
+    vi_bench_memory_range(m->dst, m->size, &begin, &end);
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_memory_set(begin, end, (vi_u8_t)i);
+        vi_bench_clobber(m->dst);
+    }
+}
+
+static void
+vi_bench_memory_zero(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_memory_t *const m = arg;
+    vi_u8_t *begin, *end;
+
+    vi_bench_memory_range(m->dst, m->size, &begin, &end);
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_memory_zero(begin, end);
+        vi_bench_clobber(m->dst);
+    }
+}
+
+static void
+vi_bench_memory_compare(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_memory_t *const m = arg;
+    vi_u8_t *lhs_begin, *lhs_end, *rhs_begin, *rhs_end;
+
+    vi_bench_memory_range(m->src, m->size, &lhs_begin, &lhs_end);
+    vi_bench_memory_range(m->copy, m->size, &rhs_begin, &rhs_end);
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_memory_compare(lhs_begin, lhs_end, rhs_begin, rhs_end));
+    }
+}
+
+static void
+vi_bench_memory_equal(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_memory_t *const m = arg;
+    vi_u8_t *lhs_begin, *lhs_end, *rhs_begin, *rhs_end;
+
+    vi_bench_memory_range(m->src, m->size, &lhs_begin, &lhs_end);
+    vi_bench_memory_range(m->copy, m->size, &rhs_begin, &rhs_end);
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_memory_equal(lhs_begin, lhs_end, rhs_begin, rhs_end));
+    }
+}
+
+static void
+vi_bench_memory_find_byte(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_memory_t *const m = arg;
+    vi_u8_t *begin, *end;
+
+    vi_bench_memory_range(m->src, m->size, &begin, &end);
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_memory_find_byte(begin, end, VI_BENCH_MEMORY_ABSENT));
+    }
+}
+
+static void
+vi_bench_memory_find_last_byte(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_memory_t *const m = arg;
+    vi_u8_t *begin, *end;
+
+    vi_bench_memory_range(m->src, m->size, &begin, &end);
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_memory_find_last_byte(begin, end, VI_BENCH_MEMORY_ABSENT));
+    }
+}
+
+static void
+vi_bench_libc_memcpy(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_memory_t *const m = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        memcpy(m->dst, m->src, m->size);
+        vi_bench_clobber(m->dst);
+    }
+}
+
+static void
+vi_bench_libc_memmove(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_memory_t *const m = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        memmove(m->dst + 1, m->dst, m->size);
+        vi_bench_clobber(m->dst);
+    }
+}
+
+static void
+vi_bench_libc_memset(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_memory_t *const m = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        memset(m->dst, (int)(i & 0xFF), m->size);
+        vi_bench_clobber(m->dst);
+    }
+}
+
+static void
+vi_bench_libc_memcmp(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_memory_t *const m = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(memcmp(m->src, m->copy, m->size));
+        vi_bench_clobber(m->src);
+    }
+}
+
+static void
+vi_bench_libc_memchr(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_memory_t *const m = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(memchr(m->src, VI_BENCH_MEMORY_ABSENT, m->size));
+        vi_bench_clobber(m->src);
+    }
+}
+
+/**
+ * @brief Замеры, выполняемые на всех размерах, в порядке вывода.
+ */
+static const vi_bench_case_t vi_bench_memory_cases[] = {
+    {"memory_copy_unsafe", vi_bench_memory_copy_unsafe},
+    {"memory_move_unsafe", vi_bench_memory_move_unsafe},
+    {"memory_set_unsafe", vi_bench_memory_set_unsafe},
+    {"memory_zero_unsafe", vi_bench_memory_zero_unsafe},
+    {"memory_compare_unsafe", vi_bench_memory_compare_unsafe},
+    {"memory_equal_unsafe", vi_bench_memory_equal_unsafe},
+    {"memory_find_byte_unsafe", vi_bench_memory_find_byte_unsafe},
+    {"memory_find_last_byte_unsafe", vi_bench_memory_find_last_byte_unsafe},
+    {"libc_memcpy", vi_bench_libc_memcpy},
+    {"libc_memmove", vi_bench_libc_memmove},
+    {"libc_memset", vi_bench_libc_memset},
+    {"libc_memcmp", vi_bench_libc_memcmp},
+    {"libc_memchr", vi_bench_libc_memchr},
+};
+
+/**
+ * @brief Замеры функций с проверкой диапазонов; их отличие от вариантов `_unsafe`
+ *        постоянно, поэтому они измеряются на части размеров.
+ */
+static const vi_bench_case_t vi_bench_memory_checked_cases[] = {
+    {"memory_copy", vi_bench_memory_copy},
+    {"memory_move", vi_bench_memory_move},
+    {"memory_set", vi_bench_memory_set},
+    {"memory_zero", vi_bench_memory_zero},
+    {"memory_compare", vi_bench_memory_compare},
+    {"memory_equal", vi_bench_memory_equal},
+    {"memory_find_byte", vi_bench_memory_find_byte},
+    {"memory_find_last_byte", vi_bench_memory_find_last_byte},
+};
+
+/**
+ * @brief Размеры участков.
+ */
+static const vi_usize_t vi_bench_memory_sizes[] = {
+    1,
+    16,
+    64,
+    256,
+    1024,
+    4096,
+    65536,
+    1024 * 1024,
+    4 * 1024 * 1024,
+    16 * 1024 * 1024,
+    VI_BENCH_MEMORY_MAX,
+};
+
+/**
+ * @brief Размеры участков для функций с проверкой диапазонов.
+ */
+static const vi_usize_t vi_bench_memory_checked_sizes[] = {16, 256, 4096};
+
+/**
+ * @brief Выполняет замеры таблицы `cases` на каждом размере из `sizes`.
+ */
+static void
+vi_bench_memory_sweep(vi_bench_t *bench,
+                      vi_bench_memory_t *m,
+                      const vi_bench_case_t *cases,
+                      vi_usize_t case_count,
+                      const vi_usize_t *sizes,
+                      vi_usize_t size_count)
+{
+    for (vi_usize_t c = 0; c < case_count; ++c)
+    {
+        for (vi_usize_t s = 0; s < size_count; ++s)
+        {
+            m->size = sizes[s];
+            vi_bench_run(bench, cases[c].name, m->size, m->size, cases[c].fn, m);
+        }
+    }
+}
+
+void
+vi_bench_suite_memory(vi_bench_t *bench)
+{
+    const vi_allocator_t *const allocator = vi_allocator_stdlib();
+    const vi_usize_t buffer_size          = VI_BENCH_MEMORY_MAX + 2 * VI_BENCH_MEMORY_PADDING;
+    vi_u8_t *const buffers =
+        vi_allocator_aligned_allocate(allocator, 3 * buffer_size, VI_BENCH_MEMORY_PADDING);
+
+    if (!buffers)
+    {
+        fputs("vi_bench: memory suite skipped, out of memory\n", stderr);
+        return;
+    }
+
+    vi_bench_memory_t m;
+
+    m.dst  = buffers + VI_BENCH_MEMORY_PADDING;
+    m.src  = m.dst + buffer_size;
+    m.copy = m.src + buffer_size;
+
+    for (vi_usize_t i = 0; i < VI_BENCH_MEMORY_MAX; ++i)
+    {
+        m.src[i] = (vi_u8_t)((i * 7 + 1) & 0x7F);
+    }
+
+    memset(m.dst, 0, VI_BENCH_MEMORY_MAX + 1);
+    memcpy(m.copy, m.src, VI_BENCH_MEMORY_MAX);
+
+    vi_bench_memory_sweep(bench,
+                          &m,
+                          vi_bench_memory_cases,
+                          vi_array_size(vi_bench_memory_cases),
+                          vi_bench_memory_sizes,
+                          vi_array_size(vi_bench_memory_sizes));
+    vi_bench_memory_sweep(bench,
+                          &m,
+                          vi_bench_memory_checked_cases,
+                          vi_array_size(vi_bench_memory_checked_cases),
+                          vi_bench_memory_checked_sizes,
+                          vi_array_size(vi_bench_memory_checked_sizes));
+    vi_allocator_aligned_free(allocator, buffers, 3 * buffer_size, VI_BENCH_MEMORY_PADDING);
+}
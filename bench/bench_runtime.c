@@ -0,0 +1,850 @@
+#include "harness.h"
+/* Дополнительные модули */
+#include <vi/nullptr.h>
+#include <vi/allocator.h>
+#include <vi/spsc_ring.h>
+#include <vi/mpmc_queue.h>
+#include <vi/thread_pool.h>
+#include <vi/runtime_frame.h>
+
+#include <stdatomic.h>
+
+#if !defined(__STDC_NO_THREADS__)
+#    include <threads.h>
+#endif // !defined(__STDC_NO_THREADS__)
+
+/**
+ * @def VI_BENCH_RUNTIME_CAPACITY
+ * @brief Емкость очередей в замерах.
+ */
+#define VI_BENCH_RUNTIME_CAPACITY 1024
+
+/**
+ * @def VI_BENCH_RUNTIME_BATCH
+ * @brief Количество элементов или задач в пакетных замерах.
+ */
+#define VI_BENCH_RUNTIME_BATCH 64
+
+/**
+ * @def VI_BENCH_RUNTIME_THREADS_MAX
+ * @brief Наибольшее количество производителей (и потребителей) в замере конкуренции.
+ */
+#define VI_BENCH_RUNTIME_THREADS_MAX 32
+
+/**
+ * @def VI_BENCH_RUNTIME_SUM_SIZE
+ * @brief Количество элементов массива в замере параллельного суммирования.
+ */
+#define VI_BENCH_RUNTIME_SUM_SIZE (1024 * 1024)
+
+/**
+ * @def VI_BENCH_RUNTIME_FOR_SIZE
+ * @brief Количество индексов в замере накладных расходов параллельного цикла.
+ */
+#define VI_BENCH_RUNTIME_FOR_SIZE 1024
+
+/**
+ * @def VI_BENCH_RUNTIME_SPIN
+ * @brief Количество безуспешных опросов очереди, после которых поток уступает процессор.
+ *
+ * Опрос без уступки дает наименьшую задержку, когда у потоков есть свои ядра;
+ * уступка не дает замеру зависнуть на одном процессоре.
+ */
+#define VI_BENCH_RUNTIME_SPIN 1024
+
+/**
+ * @brief Состояние замеров передачи элементов между потоками.
+ */
+typedef struct vi_bench_runtime_transfer_t
+{
+    /**
+     * @brief Очередь: `vi_spsc_ring_t` или `vi_mpmc_queue_t`.
+     */
+    vi_ptr_t queue;
+
+    /**
+     * @brief Общее количество элементов, запрошенных у производителя.
+     */
+    atomic_size_t requested;
+
+    /**
+     * @brief Признак завершения производителя.
+     */
+    atomic_bool stop;
+} vi_bench_runtime_transfer_t;
+
+/**
+ * @brief Состояние замера задержки передачи элемента туда и обратно между двумя потоками.
+ */
+typedef struct vi_bench_runtime_ping_pong_t
+{
+    /**
+     * @brief Кольцо от вызывающего потока к отвечающему.
+     */
+    vi_spsc_ring_t *ping;
+
+    /**
+     * @brief Кольцо от отвечающего потока к вызывающему.
+     */
+    vi_spsc_ring_t *pong;
+
+    /**
+     * @brief Признак завершения отвечающего потока.
+     */
+    atomic_bool stop;
+} vi_bench_runtime_ping_pong_t;
+
+/**
+ * @brief Состояние замера очереди с несколькими производителями и потребителями.
+ */
+typedef struct vi_bench_runtime_contention_t
+{
+    /**
+     * @brief Очередь.
+     */
+    vi_mpmc_queue_t *queue;
+
+    /**
+     * @brief Общее количество элементов, запрошенных у производителей.
+     */
+    atomic_size_t requested;
+
+    /**
+     * @brief Количество элементов, взятых производителями на добавление.
+     */
+    atomic_size_t claimed;
+
+    /**
+     * @brief Количество извлеченных элементов.
+     */
+    atomic_size_t consumed;
+
+    /**
+     * @brief Признак завершения потоков.
+     */
+    atomic_bool stop;
+} vi_bench_runtime_contention_t;
+
+/**
+ * @brief Состояние замеров пула потоков.
+ */
+typedef struct vi_bench_runtime_pool_t
+{
+    /**
+     * @brief Пул потоков.
+     */
+    vi_thread_pool_t *pool;
+
+    /**
+     * @brief Суммируемый массив.
+     */
+    vi_u64_t *values;
+
+    /**
+     * @brief Сумма, накапливаемая задачами.
+     */
+    atomic_ullong sum;
+} vi_bench_runtime_pool_t;
+
+static void
+vi_bench_spsc_ring_roundtrip(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_spsc_ring_t *const ring = arg;
+    vi_u64_t value             = 0;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        value = i;
+        vi_spsc_ring_push(ring, &value);
+        vi_spsc_ring_pop(ring, &value);
+    }
+
+    vi_bench_consume(value);
+}
+
+static void
+vi_bench_spsc_ring_batch(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_spsc_ring_t *const ring = arg;
+    vi_u64_t values[VI_BENCH_RUNTIME_BATCH];
+
+    for (vi_usize_t i = 0; i < VI_BENCH_RUNTIME_BATCH; ++i)
+    {
+        values[i] = i;
+    }
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_spsc_ring_push_n(ring, values, VI_BENCH_RUNTIME_BATCH);
+        vi_spsc_ring_pop_n(ring, values, VI_BENCH_RUNTIME_BATCH);
+    }
+
+    vi_bench_clobber(values);
+}
+
+static void
+vi_bench_mpmc_queue_roundtrip(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_mpmc_queue_t *const queue = arg;
+    vi_u64_t value               = 0;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        value = i;
+        vi_mpmc_queue_try_push(queue, &value);
+        vi_mpmc_queue_try_pop(queue, &value);
+    }
+
+    vi_bench_consume(value);
+}
+
+static void
+vi_bench_mpmc_queue_batch(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_mpmc_queue_t *const queue = arg;
+    vi_u64_t values[VI_BENCH_RUNTIME_BATCH];
+
+    for (vi_usize_t i = 0; i < VI_BENCH_RUNTIME_BATCH; ++i)
+    {
+        values[i] = i;
+    }
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_mpmc_queue_try_push_n(queue, values, VI_BENCH_RUNTIME_BATCH);
+        vi_mpmc_queue_try_pop_n(queue, values, VI_BENCH_RUNTIME_BATCH);
+    }
+
+    vi_bench_clobber(values);
+}
+
+#if !defined(__STDC_NO_THREADS__)
+
+static int
+vi_bench_spsc_ring_producer(void *arg)
+{
+    vi_bench_runtime_transfer_t *const transfer = arg;
+    vi_u64_t produced                           = 0;
+
+    while (!atomic_load_explicit(&transfer->stop, memory_order_acquire))
+    {
+        if (produced == atomic_load_explicit(&transfer->requested, memory_order_acquire))
+        {
+            thrd_yield();
+        }
+        else if (vi_spsc_ring_push(transfer->queue, &produced))
+        {
+            ++produced;
+        }
+        else
+        {
+            thrd_yield();
+        }
+    }
+
+    return 0;
+}
+
+static void
+vi_bench_spsc_ring_transfer(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_runtime_transfer_t *const transfer = arg;
+    vi_u64_t value                              = 0;
+
+    atomic_fetch_add_explicit(&transfer->requested, iterations, memory_order_release);
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        while (!vi_spsc_ring_pop(transfer->queue, &value))
+        {
+            thrd_yield();
+        }
+    }
+
+    vi_bench_consume(value);
+}
+
+/**
+ * @brief Учитывает безуспешный опрос очереди и уступает процессор
+ *        после `VI_BENCH_RUNTIME_SPIN` опросов подряд.
+ */
+static void
+vi_bench_runtime_idle(vi_usize_t *idle)
+{
+    if (++*idle == VI_BENCH_RUNTIME_SPIN)
+    {
+        *idle = 0;
+        thrd_yield();
+    }
+}
+
+static int
+vi_bench_spsc_ring_echo(void *arg)
+{
+    vi_bench_runtime_ping_pong_t *const p = arg;
+    vi_u64_t value                        = 0;
+    vi_usize_t idle                       = 0;
+
+    // В кольце `pong` не больше одного элемента, поэтому добавление всегда успешно.
+    while (!atomic_load_explicit(&p->stop, memory_order_acquire))
+    {
+        if (vi_spsc_ring_pop(p->ping, &value))
+        {
+            vi_spsc_ring_push(p->pong, &value);
+            idle = 0;
+        }
+        else
+        {
+            vi_bench_runtime_idle(&idle);
+        }
+    }
+
+    return 0;
+}
+
+static void
+vi_bench_spsc_ring_ping_pong(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_runtime_ping_pong_t *const p = arg;
+    vi_u64_t value                        = 0;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_usize_t idle = 0;
+
+        vi_spsc_ring_push(p->ping, &i);
+
+        while (!vi_spsc_ring_pop(p->pong, &value))
+        {
+            vi_bench_runtime_idle(&idle);
+        }
+    }
+
+    vi_bench_consume(value);
+}
+
+static int
+vi_bench_mpmc_queue_producer(void *arg)
+{
+    vi_bench_runtime_transfer_t *const transfer = arg;
+    vi_u64_t produced                           = 0;
+
+    while (!atomic_load_explicit(&transfer->stop, memory_order_acquire))
+    {
+        if (produced == atomic_load_explicit(&transfer->requested, memory_order_acquire))
+        {
+            thrd_yield();
+        }
+        else
+        {
+            vi_mpmc_queue_push(transfer->queue, &produced);
+            ++produced;
+        }
+    }
+
+    return 0;
+}
+
+static void
+vi_bench_mpmc_queue_transfer(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_runtime_transfer_t *const transfer = arg;
+    vi_u64_t value                              = 0;
+
+    atomic_fetch_add_explicit(&transfer->requested, iterations, memory_order_release);
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_mpmc_queue_pop(transfer->queue, &value);
+    }
+
+    vi_bench_consume(value);
+}
+
+static int
+vi_bench_mpmc_queue_contention_producer(void *arg)
+{
+    vi_bench_runtime_contention_t *const c = arg;
+    vi_u64_t produced                      = 0;
+
+    while (!atomic_load_explicit(&c->stop, memory_order_acquire))
+    {
+        vi_usize_t claimed = atomic_load_explicit(&c->claimed, memory_order_relaxed);
+
+        if (claimed == atomic_load_explicit(&c->requested, memory_order_acquire))
+        {
+            thrd_yield();
+        }
+        else if (atomic_compare_exchange_weak_explicit(&c->claimed,
+                                                       &claimed,
+                                                       claimed + 1,
+                                                       memory_order_relaxed,
+                                                       memory_order_relaxed))
+        {
+            vi_mpmc_queue_push(c->queue, &produced);
+            ++produced;
+        }
+    }
+
+    return 0;
+}
+
+static int
+vi_bench_mpmc_queue_contention_consumer(void *arg)
+{
+    vi_bench_runtime_contention_t *const c = arg;
+    vi_u64_t value;
+
+    while (!atomic_load_explicit(&c->stop, memory_order_acquire))
+    {
+        if (vi_mpmc_queue_try_pop(c->queue, &value))
+        {
+            atomic_fetch_add_explicit(&c->consumed, 1, memory_order_release);
+        }
+        else
+        {
+            thrd_yield();
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Запрашивает `iterations` элементов и извлекает их вместе с потоками-потребителями.
+ *
+ * Вызывающий поток является одним из потребителей и возвращается, когда извлечены
+ * все запрошенные элементы, поэтому между вызовами очередь пуста.
+ */
+static void
+vi_bench_mpmc_queue_contention(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_runtime_contention_t *const c = arg;
+    const vi_usize_t target =
+        atomic_fetch_add_explicit(&c->requested, iterations, memory_order_release) + iterations;
+    vi_u64_t value = 0;
+
+    while (atomic_load_explicit(&c->consumed, memory_order_acquire) < target)
+    {
+        if (vi_mpmc_queue_try_pop(c->queue, &value))
+        {
+            atomic_fetch_add_explicit(&c->consumed, 1, memory_order_release);
+        }
+        else
+        {
+            thrd_yield();
+        }
+    }
+
+    vi_bench_consume(value);
+}
+
+/**
+ * @brief Выполняет замер очереди с равным количеством производителей и потребителей.
+ *
+ * Количество потоков удваивается от 1 до `VI_BENCH_RUNTIME_THREADS_MAX`; вызывающий
+ * поток является одним из потребителей. Потоки запускаются один раз на каждое
+ * количество, поэтому время их запуска не входит в замер.
+ */
+static void
+vi_bench_runtime_contention(vi_bench_t *bench, vi_mpmc_queue_t *queue)
+{
+    for (vi_usize_t threads = 1; threads <= VI_BENCH_RUNTIME_THREADS_MAX; threads *= 2)
+    {
+        vi_bench_runtime_contention_t c;
+        thrd_t handles[2 * VI_BENCH_RUNTIME_THREADS_MAX];
+        vi_usize_t started = 0;
+
+        c.queue = queue;
+        atomic_init(&c.requested, 0);
+        atomic_init(&c.claimed, 0);
+        atomic_init(&c.consumed, 0);
+        atomic_init(&c.stop, false);
+
+        for (; started < 2 * threads - 1; ++started)
+        {
+            const thrd_start_t start = started < threads
+                                           ? vi_bench_mpmc_queue_contention_producer
+                                           : vi_bench_mpmc_queue_contention_consumer;
+
+            if (thrd_create(&handles[started], start, &c) != thrd_success)
+            {
+                break;
+            }
+        }
+
+        if (started == 2 * threads - 1)
+        {
+            vi_bench_run(bench,
+                         "mpmc_queue_contention",
+                         threads,
+                         0,
+                         vi_bench_mpmc_queue_contention,
+                         &c);
+        }
+        else
+        {
+            fputs("vi_bench: mpmc_queue_contention skipped, thread creation failed\n", stderr);
+        }
+
+        atomic_store_explicit(&c.stop, true, memory_order_release);
+
+        for (vi_usize_t i = 0; i < started; ++i)
+        {
+            thrd_join(handles[i], nullptr);
+        }
+
+        if (started != 2 * threads - 1)
+        {
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Выполняет замер передачи элементов из потока-производителя в вызывающий поток.
+ *
+ * Производитель запускается один раз на весь замер, поэтому время запуска
+ * потока не входит во время передачи.
+ */
+static void
+vi_bench_runtime_transfer(vi_bench_t *bench,
+                          const char *name,
+                          vi_ptr_t queue,
+                          thrd_start_t producer,
+                          vi_bench_fn_t consumer)
+{
+    vi_bench_runtime_transfer_t transfer;
+    thrd_t thread;
+
+    transfer.queue = queue;
+    atomic_init(&transfer.requested, 0);
+    atomic_init(&transfer.stop, false);
+
+    if (thrd_create(&thread, producer, &transfer) != thrd_success)
+    {
+        fprintf(stderr, "vi_bench: %s skipped, thread creation failed\n", name);
+        return;
+    }
+
+    vi_bench_run(bench, name, 1, 0, consumer, &transfer);
+    atomic_store_explicit(&transfer.stop, true, memory_order_release);
+    thrd_join(thread, nullptr);
+}
+
+/**
+ * @brief Выполняет замер задержки: элемент проходит через `ring` к отвечающему потоку
+ *        и возвращается через второе кольцо; время операции — полный круг.
+ */
+static void
+vi_bench_runtime_ping_pong(vi_bench_t *bench, vi_spsc_ring_t *ring)
+{
+    vi_bench_runtime_ping_pong_t p;
+    thrd_t thread;
+
+    p.ping = ring;
+    p.pong = vi_spsc_ring_create(vi_allocator_stdlib(), sizeof(vi_u64_t), 2);
+    atomic_init(&p.stop, false);
+
+    if (!p.pong)
+    {
+        fputs("vi_bench: spsc_ring_ping_pong skipped, out of memory\n", stderr);
+        return;
+    }
+
+    if (thrd_create(&thread, vi_bench_spsc_ring_echo, &p) != thrd_success)
+    {
+        fputs("vi_bench: spsc_ring_ping_pong skipped, thread creation failed\n", stderr);
+        vi_spsc_ring_destroy(p.pong);
+        return;
+    }
+
+    vi_bench_run(bench, "spsc_ring_ping_pong", 1, 0, vi_bench_spsc_ring_ping_pong, &p);
+    atomic_store_explicit(&p.stop, true, memory_order_release);
+    thrd_join(thread, nullptr);
+    vi_spsc_ring_destroy(p.pong);
+}
+
+#endif // !defined(__STDC_NO_THREADS__)
+
+static void
+vi_bench_thread_pool_task(vi_ptr_t arg)
+{
+    vi_bench_runtime_pool_t *const p = arg;
+
+    atomic_fetch_add_explicit(&p->sum, 1, memory_order_relaxed);
+}
+
+static void
+vi_bench_thread_pool_range(vi_ptr_t arg, vi_usize_t begin, vi_usize_t end)
+{
+    vi_bench_runtime_pool_t *const p = arg;
+    vi_u64_t sum                     = 0;
+
+    for (vi_usize_t i = begin; i < end; ++i)
+    {
+        sum += p->values[i];
+    }
+
+    atomic_fetch_add_explicit(&p->sum, sum, memory_order_relaxed);
+}
+
+static void
+vi_bench_thread_pool_empty_range(vi_ptr_t arg, vi_usize_t begin, vi_usize_t end)
+{
+    vi_bench_runtime_pool_t *const p = arg;
+
+    atomic_fetch_add_explicit(&p->sum, end - begin, memory_order_relaxed);
+}
+
+static void
+vi_bench_thread_pool_submit_wait(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_runtime_pool_t *const p = arg;
+
+    // Время включает передачу задачи рабочему потоку и пробуждение ожидающего потока.
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_thread_pool_submit(p->pool, vi_bench_thread_pool_task, p);
+        vi_thread_pool_wait(p->pool);
+    }
+}
+
+static void
+vi_bench_thread_pool_submit_batch(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_runtime_pool_t *const p = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        for (vi_usize_t j = 0; j < VI_BENCH_RUNTIME_BATCH; ++j)
+        {
+            vi_thread_pool_submit(p->pool, vi_bench_thread_pool_task, p);
+        }
+
+        vi_thread_pool_wait(p->pool);
+    }
+}
+
+static void
+vi_bench_thread_pool_parallel_for(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_runtime_pool_t *const p = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_thread_pool_parallel_for(p->pool,
+                                    0,
+                                    VI_BENCH_RUNTIME_FOR_SIZE,
+                                    0,
+                                    vi_bench_thread_pool_empty_range,
+                                    p);
+    }
+}
+
+static void
+vi_bench_thread_pool_parallel_sum(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_runtime_pool_t *const p = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_thread_pool_parallel_for(p->pool,
+                                    0,
+                                    VI_BENCH_RUNTIME_SUM_SIZE,
+                                    0,
+                                    vi_bench_thread_pool_range,
+                                    p);
+    }
+
+    vi_bench_consume(atomic_load_explicit(&p->sum, memory_order_relaxed));
+}
+
+/**
+ * @brief Добавляет и удаляет кадр без перехода.
+ *
+ * Кадры замеров создаются в отдельных функциях: счетчик цикла, изменяемый после
+ * `setjmp` в той же функции, пришлось бы объявить `volatile`.
+ */
+static vi_return_t
+vi_bench_runtime_frame_enter(void)
+{
+    vi_runtime_frame_t frame;
+
+    vi_runtime_frame_try(&frame)
+    {
+        vi_runtime_frame_pop(&frame);
+        return 0;
+    }
+
+    return vi_runtime_frame_code(&frame);
+}
+
+/**
+ * @brief Переходит в кадр и возвращает код ошибки.
+ */
+static vi_return_t
+vi_bench_runtime_frame_catch(void)
+{
+    vi_runtime_frame_t frame;
+
+    vi_runtime_frame_try(&frame)
+    {
+        vi_runtime_frame_throw(1);
+    }
+
+    return vi_runtime_frame_code(&frame);
+}
+
+static void
+vi_bench_runtime_frame_try(vi_ptr_t arg, vi_usize_t iterations)
+{
+    (void)arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_bench_runtime_frame_enter());
+    }
+}
+
+static void
+vi_bench_runtime_frame_throw(vi_ptr_t arg, vi_usize_t iterations)
+{
+    (void)arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_bench_runtime_frame_catch());
+    }
+}
+
+/**
+ * @brief Выполняет замеры кольцевого буфера и очереди.
+ */
+static void
+vi_bench_runtime_queues(vi_bench_t *bench)
+{
+    const vi_allocator_t *const allocator = vi_allocator_stdlib();
+    const vi_usize_t size                 = sizeof(vi_u64_t);
+    const vi_usize_t capacity             = VI_BENCH_RUNTIME_CAPACITY;
+    vi_spsc_ring_t *const ring            = vi_spsc_ring_create(allocator, size, capacity);
+    vi_mpmc_queue_t *const queue          = vi_mpmc_queue_create(allocator, size, capacity);
+
+    if (ring)
+    {
+        vi_bench_run(bench, "spsc_ring_roundtrip", 1, 0, vi_bench_spsc_ring_roundtrip, ring);
+        vi_bench_run(bench,
+                     "spsc_ring_batch",
+                     VI_BENCH_RUNTIME_BATCH,
+                     0,
+                     vi_bench_spsc_ring_batch,
+                     ring);
+#if !defined(__STDC_NO_THREADS__)
+        vi_bench_runtime_transfer(bench,
+                                  "spsc_ring_transfer",
+                                  ring,
+                                  vi_bench_spsc_ring_producer,
+                                  vi_bench_spsc_ring_transfer);
+        vi_bench_runtime_ping_pong(bench, ring);
+#endif // !defined(__STDC_NO_THREADS__)
+        vi_spsc_ring_destroy(ring);
+    }
+    else
+    {
+        fputs("vi_bench: spsc_ring skipped, out of memory\n", stderr);
+    }
+
+    if (queue)
+    {
+        vi_bench_run(bench, "mpmc_queue_roundtrip", 1, 0, vi_bench_mpmc_queue_roundtrip, queue);
+        vi_bench_run(bench,
+                     "mpmc_queue_batch",
+                     VI_BENCH_RUNTIME_BATCH,
+                     0,
+                     vi_bench_mpmc_queue_batch,
+                     queue);
+#if !defined(__STDC_NO_THREADS__)
+        vi_bench_runtime_transfer(bench,
+                                  "mpmc_queue_transfer",
+                                  queue,
+                                  vi_bench_mpmc_queue_producer,
+                                  vi_bench_mpmc_queue_transfer);
+        vi_bench_runtime_contention(bench, queue);
+#endif // !defined(__STDC_NO_THREADS__)
+        vi_mpmc_queue_destroy(queue);
+    }
+    else
+    {
+        fputs("vi_bench: mpmc_queue skipped, out of memory\n", stderr);
+    }
+}
+
+/**
+ * @brief Выполняет замеры пула потоков с рабочим потоком на каждый процессор.
+ */
+static void
+vi_bench_runtime_thread_pool(vi_bench_t *bench)
+{
+    const vi_allocator_t *const allocator = vi_allocator_stdlib();
+    const vi_usize_t values_size          = VI_BENCH_RUNTIME_SUM_SIZE * sizeof(vi_u64_t);
+    vi_bench_runtime_pool_t p;
+
+    p.pool   = vi_thread_pool_create(allocator, 0);
+    p.values = vi_allocator_allocate(allocator, values_size);
+    atomic_init(&p.sum, 0);
+
+    if (p.pool && p.values)
+    {
+        for (vi_usize_t i = 0; i < VI_BENCH_RUNTIME_SUM_SIZE; ++i)
+        {
+            p.values[i] = i;
+        }
+
+        const vi_usize_t workers = vi_thread_pool_size(p.pool);
+
+        vi_bench_run(bench,
+                     "thread_pool_submit_wait",
+                     workers,
+                     0,
+                     vi_bench_thread_pool_submit_wait,
+                     &p);
+        vi_bench_run(bench,
+                     "thread_pool_submit_batch",
+                     VI_BENCH_RUNTIME_BATCH,
+                     0,
+                     vi_bench_thread_pool_submit_batch,
+                     &p);
+        vi_bench_run(bench,
+                     "thread_pool_parallel_for",
+                     VI_BENCH_RUNTIME_FOR_SIZE,
+                     0,
+                     vi_bench_thread_pool_parallel_for,
+                     &p);
+        vi_bench_run(bench,
+                     "thread_pool_parallel_sum",
+                     VI_BENCH_RUNTIME_SUM_SIZE,
+                     values_size,
+                     vi_bench_thread_pool_parallel_sum,
+                     &p);
+    }
+    else
+    {
+        fputs("vi_bench: thread_pool skipped, creation failed\n", stderr);
+    }
+
+    vi_thread_pool_destroy(p.pool);
+
+    if (p.values)
+    {
+        vi_allocator_free(allocator, p.values, values_size);
+    }
+}
+
+void
+vi_bench_suite_runtime(vi_bench_t *bench)
+{
+    vi_bench_runtime_queues(bench);
+    vi_bench_runtime_thread_pool(bench);
+    vi_bench_run(bench, "runtime_frame_try", 1, 0, vi_bench_runtime_frame_try, nullptr);
+    vi_bench_run(bench, "runtime_frame_throw", 1, 0, vi_bench_runtime_frame_throw, nullptr);
+}
@@ -0,0 +1,765 @@
+#include "harness.h"
+/* Дополнительные модули */
+#include <vi/hex.h>
+#include <vi/utf.h>
+#include <vi/hash.h>
+#include <vi/ascii.h>
+#include <vi/base64.h>
+#include <vi/nullptr.h>
+#include <vi/str_raw.h>
+#include <vi/allocator.h>
+#include <vi/array_size.h>
+#include <vi/numeric_convert.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @def VI_BENCH_TEXT_MAX
+ * @brief Наибольшая длина строки в замерах.
+ */
+#define VI_BENCH_TEXT_MAX 65536
+
+/**
+ * @def VI_BENCH_TEXT_NEEDLE
+ * @brief Подстрока, которая встречается только в конце строки.
+ */
+#define VI_BENCH_TEXT_NEEDLE "0123456789"
+
+/**
+ * @def VI_BENCH_TEXT_NEEDLE_LENGTH
+ * @brief Длина `VI_BENCH_TEXT_NEEDLE`.
+ */
+#define VI_BENCH_TEXT_NEEDLE_LENGTH (sizeof(VI_BENCH_TEXT_NEEDLE) - 1)
+
+/**
+ * @def VI_BENCH_TEXT_NUMBERS
+ * @brief Количество чисел в замерах преобразования чисел; степень двойки.
+ */
+#define VI_BENCH_TEXT_NUMBERS 1024
+
+/**
+ * @brief Числа и их десятичные записи для замеров преобразования чисел.
+ */
+typedef struct vi_bench_numbers_t
+{
+    /**
+     * @brief Числа с равномерно распределенным количеством цифр.
+     */
+    vi_u64_t values[VI_BENCH_TEXT_NUMBERS];
+
+    /**
+     * @brief Десятичные записи `values` с завершающим нулем.
+     */
+    vi_char_t text[VI_BENCH_TEXT_NUMBERS][VI_NUMERIC_FORMAT_U64_SIZE];
+
+    /**
+     * @brief Длины записей `text`.
+     */
+    vi_usize_t lengths[VI_BENCH_TEXT_NUMBERS];
+} vi_bench_numbers_t;
+
+/**
+ * @brief Буферы для замеров шестнадцатеричного кодирования и Base64.
+ */
+typedef struct vi_bench_codec_t
+{
+    /**
+     * @brief Исходные байты.
+     */
+    vi_u8_t *bytes;
+
+    /**
+     * @brief Шестнадцатеричная запись `bytes`.
+     */
+    vi_u8_t *hex;
+
+    /**
+     * @brief Запись `bytes` в Base64.
+     */
+    vi_u8_t *base64;
+
+    /**
+     * @brief Приемник декодированных байтов.
+     */
+    vi_u8_t *decoded;
+
+    /**
+     * @brief Количество исходных байтов.
+     */
+    vi_usize_t size;
+
+    /**
+     * @brief Длина записи в Base64.
+     */
+    vi_usize_t base64_size;
+} vi_bench_codec_t;
+
+/**
+ * @brief Буферы для замеров проверки и преобразования UTF-8.
+ */
+typedef struct vi_bench_utf_t
+{
+    /**
+     * @brief Текст UTF-8.
+     */
+    vi_char_t *text;
+
+    /**
+     * @brief Единицы UTF-16 текста `text`.
+     */
+    vi_uchar16_t *units;
+
+    /**
+     * @brief Приемник результатов `vi_utf16_to_utf8`.
+     */
+    vi_char_t *decoded;
+
+    /**
+     * @brief Количество байтов текста.
+     */
+    vi_usize_t size;
+
+    /**
+     * @brief Количество единиц UTF-16.
+     */
+    vi_usize_t units_size;
+} vi_bench_utf_t;
+
+/**
+ * @brief Строки и буферы для замеров строковых функций.
+ */
+typedef struct vi_bench_text_t
+{
+    /**
+     * @brief Строка из повторяющихся строчных букв с `VI_BENCH_TEXT_NEEDLE` в конце.
+     */
+    vi_char_t *str;
+
+    /**
+     * @brief Копия `str` для сравнения.
+     */
+    vi_char_t *copy;
+
+    /**
+     * @brief Приемник результатов `vi_ascii_case_fold_n`.
+     */
+    vi_char_t *folded;
+
+    /**
+     * @brief Приемник результатов `vi_ascii_classify_n`.
+     */
+    vi_u16_t *classes;
+
+    /**
+     * @brief Длина строки без завершающего нуля.
+     */
+    vi_usize_t size;
+} vi_bench_text_t;
+
+static void
+vi_bench_str_raw_length(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_text_t *const t = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_str_raw_length(t->str));
+    }
+}
+
+static void
+vi_bench_str_raw_length_n(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_text_t *const t = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_str_raw_length_n(t->str, t->size + 1));
+    }
+}
+
+static void
+vi_bench_str_raw_compare(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_text_t *const t = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_str_raw_compare(t->str, t->copy));
+    }
+}
+
+static void
+vi_bench_str_raw_compare_n(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_text_t *const t = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_str_raw_compare_n(t->str, t->copy, t->size));
+    }
+}
+
+static void
+vi_bench_str_raw_find_char(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_text_t *const t = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_str_raw_find_char(t->str, '#'));
+    }
+}
+
+static void
+vi_bench_str_raw_find(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_text_t *const t = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_str_raw_find(t->str, (const vi_char_t *)VI_BENCH_TEXT_NEEDLE));
+    }
+}
+
+static void
+vi_bench_str_raw_span(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_text_t *const t      = arg;
+    const vi_char_t *const accept = (const vi_char_t *)"abcdefghijklmnopqrstuvwxyz";
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_str_raw_span(t->str, accept));
+    }
+}
+
+static void
+vi_bench_str_raw_cspan(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_text_t *const t = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_str_raw_cspan(t->str, (const vi_char_t *)"#$"));
+    }
+}
+
+static void
+vi_bench_ascii_classify_n(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_text_t *const t = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_ascii_classify_n(t->classes, t->str, t->size);
+        vi_bench_clobber(t->classes);
+    }
+}
+
+static void
+vi_bench_ascii_case_fold_n(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_text_t *const t = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_ascii_case_fold_n(t->folded, t->str, t->size);
+        vi_bench_clobber(t->folded);
+    }
+}
+
+static void
+vi_bench_hash_bytes(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_text_t *const t = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_hash_bytes(t->str, t->size));
+    }
+}
+
+static void
+vi_bench_hash_str_raw(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_text_t *const t = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_hash_str_raw(t->str));
+    }
+}
+
+static void
+vi_bench_hash_u64(vi_ptr_t arg, vi_usize_t iterations)
+{
+    (void)arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_hash_u64(i));
+    }
+}
+
+static void
+vi_bench_libc_strlen(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_text_t *const t = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(strlen((const char *)t->str));
+        vi_bench_clobber(t->str);
+    }
+}
+
+static void
+vi_bench_libc_strcmp(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_text_t *const t = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(strcmp((const char *)t->str, (const char *)t->copy));
+        vi_bench_clobber(t->str);
+    }
+}
+
+static void
+vi_bench_libc_strchr(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_text_t *const t = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(strchr((const char *)t->str, '#'));
+        vi_bench_clobber(t->str);
+    }
+}
+
+static void
+vi_bench_libc_strstr(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_text_t *const t = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(strstr((const char *)t->str, VI_BENCH_TEXT_NEEDLE));
+        vi_bench_clobber(t->str);
+    }
+}
+
+static void
+vi_bench_numeric_format_u64(vi_ptr_t arg, vi_usize_t iterations)
+{
+    const vi_bench_numbers_t *const n = arg;
+    vi_char_t buffer[VI_NUMERIC_FORMAT_U64_SIZE];
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        const vi_u64_t value = n->values[i & (VI_BENCH_TEXT_NUMBERS - 1)];
+
+        vi_bench_consume(vi_numeric_format_u64(buffer, sizeof(buffer), value));
+        vi_bench_clobber(buffer);
+    }
+}
+
+static void
+vi_bench_numeric_parse_u64(vi_ptr_t arg, vi_usize_t iterations)
+{
+    const vi_bench_numbers_t *const n = arg;
+    vi_u64_t value                    = 0;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        const vi_usize_t index = i & (VI_BENCH_TEXT_NUMBERS - 1);
+
+        vi_numeric_parse_u64(n->text[index], n->lengths[index], &value, nullptr);
+        vi_bench_consume(value);
+    }
+}
+
+static void
+vi_bench_libc_snprintf_u64(vi_ptr_t arg, vi_usize_t iterations)
+{
+    const vi_bench_numbers_t *const n = arg;
+    char buffer[VI_NUMERIC_FORMAT_U64_SIZE];
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        const unsigned long long value = n->values[i & (VI_BENCH_TEXT_NUMBERS - 1)];
+
+        vi_bench_consume(snprintf(buffer, sizeof(buffer), "%llu", value));
+        vi_bench_clobber(buffer);
+    }
+}
+
+static void
+vi_bench_libc_strtoull(vi_ptr_t arg, vi_usize_t iterations)
+{
+    const vi_bench_numbers_t *const n = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        const char *const text = (const char *)n->text[i & (VI_BENCH_TEXT_NUMBERS - 1)];
+
+        vi_bench_consume(strtoull(text, nullptr, 10));
+    }
+}
+
+static void
+vi_bench_hex_encode(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_codec_t *const c = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_hex_encode(c->hex, c->bytes, c->size));
+        vi_bench_clobber(c->hex);
+    }
+}
+
+static void
+vi_bench_hex_decode(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_codec_t *const c = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_hex_decode(c->decoded, c->hex, vi_hex_encoded_size(c->size), nullptr));
+        vi_bench_clobber(c->decoded);
+    }
+}
+
+static void
+vi_bench_base64_encode(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_codec_t *const c = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_base64_encode(c->base64, c->bytes, c->size));
+        vi_bench_clobber(c->base64);
+    }
+}
+
+static void
+vi_bench_base64_decode(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_codec_t *const c = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_base64_decode(c->decoded, c->base64, c->base64_size, nullptr));
+        vi_bench_clobber(c->decoded);
+    }
+}
+
+static void
+vi_bench_utf8_validate(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_utf_t *const u = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_utf8_validate(u->text, u->size, nullptr));
+    }
+}
+
+static void
+vi_bench_utf8_to_utf16(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_utf_t *const u = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_utf8_to_utf16(u->units, u->text, u->size, nullptr));
+        vi_bench_clobber(u->units);
+    }
+}
+
+static void
+vi_bench_utf16_to_utf8(vi_ptr_t arg, vi_usize_t iterations)
+{
+    vi_bench_utf_t *const u = arg;
+
+    for (vi_usize_t i = 0; i < iterations; ++i)
+    {
+        vi_bench_consume(vi_utf16_to_utf8(u->decoded, u->units, u->units_size, nullptr));
+        vi_bench_clobber(u->decoded);
+    }
+}
+
+/**
+ * @brief Замеры кодирования, выполняемые для каждой длины строки, в порядке вывода.
+ */
+static const vi_bench_case_t vi_bench_codec_cases[] = {
+    {"hex_encode", vi_bench_hex_encode},
+    {"hex_decode", vi_bench_hex_decode},
+    {"base64_encode", vi_bench_base64_encode},
+    {"base64_decode", vi_bench_base64_decode},
+};
+
+/**
+ * @brief Замеры UTF-8, выполняемые для каждого текста и длины строки, в порядке вывода.
+ */
+static const vi_bench_case_t vi_bench_utf_cases[] = {
+    {"utf8_validate", vi_bench_utf8_validate},
+    {"utf8_to_utf16", vi_bench_utf8_to_utf16},
+    {"utf16_to_utf8", vi_bench_utf16_to_utf8},
+};
+
+/**
+ * @brief Замеры преобразования чисел, выполняемые по массиву чисел.
+ */
+static const vi_bench_case_t vi_bench_numbers_cases[] = {
+    {"numeric_format_u64", vi_bench_numeric_format_u64},
+    {"numeric_parse_u64", vi_bench_numeric_parse_u64},
+    {"libc_snprintf_u64", vi_bench_libc_snprintf_u64},
+    {"libc_strtoull", vi_bench_libc_strtoull},
+};
+
+/**
+ * @brief Выполняет замеры преобразования чисел с количеством цифр от 1 до 20.
+ */
+static void
+vi_bench_numbers(vi_bench_t *bench)
+{
+    static vi_bench_numbers_t n;
+    vi_u64_t state = 0x9E3779B97F4A7C15ULL;
+
+    for (vi_usize_t i = 0; i < VI_BENCH_TEXT_NUMBERS; ++i)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        n.values[i]  = state >> (i % 64);
+        n.lengths[i] = vi_numeric_format_u64(n.text[i], sizeof(n.text[i]), n.values[i]);
+    }
+
+    for (vi_usize_t c = 0; c < vi_array_size(vi_bench_numbers_cases); ++c)
+    {
+        vi_bench_run(bench,
+                     vi_bench_numbers_cases[c].name,
+                     VI_BENCH_TEXT_NUMBERS,
+                     0,
+                     vi_bench_numbers_cases[c].fn,
+                     &n);
+    }
+}
+
+/**
+ * @brief Замеры, выполняемые для каждой длины строки, в порядке вывода.
+ */
+static const vi_bench_case_t vi_bench_text_cases[] = {
+    {"str_raw_length", vi_bench_str_raw_length},
+    {"str_raw_length_n", vi_bench_str_raw_length_n},
+    {"str_raw_compare", vi_bench_str_raw_compare},
+    {"str_raw_compare_n", vi_bench_str_raw_compare_n},
+    {"str_raw_find_char", vi_bench_str_raw_find_char},
+    {"str_raw_find", vi_bench_str_raw_find},
+    {"str_raw_span", vi_bench_str_raw_span},
+    {"str_raw_cspan", vi_bench_str_raw_cspan},
+    {"ascii_classify_n", vi_bench_ascii_classify_n},
+    {"ascii_case_fold_n", vi_bench_ascii_case_fold_n},
+    {"hash_bytes", vi_bench_hash_bytes},
+    {"hash_str_raw", vi_bench_hash_str_raw},
+    {"libc_strlen", vi_bench_libc_strlen},
+    {"libc_strcmp", vi_bench_libc_strcmp},
+    {"libc_strchr", vi_bench_libc_strchr},
+    {"libc_strstr", vi_bench_libc_strstr},
+};
+
+/**
+ * @brief Длины строк.
+ */
+static const vi_usize_t vi_bench_text_sizes[] = {16, 64, 256, 4096, VI_BENCH_TEXT_MAX};
+
+/**
+ * @brief Выполняет замеры кодирования случайных байтов для каждой длины строки.
+ *
+ * Пропускная способность считается по исходным байтам как для кодирования,
+ * так и для декодирования.
+ */
+static void
+vi_bench_codec(vi_bench_t *bench)
+{
+    const vi_allocator_t *const allocator = vi_allocator_stdlib();
+    const vi_usize_t hex_size             = vi_hex_encoded_size(VI_BENCH_TEXT_MAX);
+    const vi_usize_t base64_size          = vi_base64_encoded_size(VI_BENCH_TEXT_MAX);
+    const vi_usize_t total_size           = 2 * VI_BENCH_TEXT_MAX + hex_size + base64_size;
+
+    vi_u8_t *const buffers = vi_allocator_aligned_allocate(allocator, total_size, 64);
+
+    if (!buffers)
+    {
+        fputs("vi_bench: codec skipped, out of memory\n", stderr);
+        return;
+    }
+
+    vi_bench_codec_t c;
+    vi_u64_t state = 0x9E3779B97F4A7C15ULL;
+
+    c.bytes   = buffers;
+    c.decoded = c.bytes + VI_BENCH_TEXT_MAX;
+    c.hex     = c.decoded + VI_BENCH_TEXT_MAX;
+    c.base64  = c.hex + hex_size;
+
+    for (vi_usize_t i = 0; i < VI_BENCH_TEXT_MAX; ++i)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        c.bytes[i] = (vi_u8_t)(state >> 56);
+    }
+
+    for (vi_usize_t n = 0; n < vi_array_size(vi_bench_codec_cases); ++n)
+    {
+        for (vi_usize_t s = 0; s < vi_array_size(vi_bench_text_sizes); ++s)
+        {
+            c.size        = vi_bench_text_sizes[s];
+            c.base64_size = vi_base64_encode(c.base64, c.bytes, c.size);
+            vi_hex_encode(c.hex, c.bytes, c.size);
+            vi_bench_run(bench,
+                         vi_bench_codec_cases[n].name,
+                         c.size,
+                         c.size,
+                         vi_bench_codec_cases[n].fn,
+                         &c);
+        }
+    }
+
+    vi_allocator_aligned_free(allocator, buffers, total_size, 64);
+}
+
+/**
+ * @brief Выполняет замеры UTF-8 для текста ASCII и русского текста для каждой длины строки.
+ *
+ * Текст заполняется повторениями образца и обрезается по границе символа, поэтому
+ * его длина может быть меньше длины строки на несколько байтов.
+ */
+static void
+vi_bench_utf(vi_bench_t *bench)
+{
+    static const char *const samples[][2] = {
+        {"ascii", "The quick brown fox jumps over the lazy dog. "},
+        {"cyrillic", "\xD0\xA1\xD1\x8A\xD0\xB5\xD1\x88\xD1\x8C \xD0\xB6\xD0\xB5 "
+                     "\xD0\xB5\xD1\x89\xD1\x91, 2024. "},
+    };
+
+    const vi_allocator_t *const allocator = vi_allocator_stdlib();
+    const vi_usize_t units_size           = VI_BENCH_TEXT_MAX * sizeof(vi_uchar16_t);
+    const vi_usize_t total_size           = 2 * VI_BENCH_TEXT_MAX + units_size;
+
+    vi_char_t *const buffers = vi_allocator_aligned_allocate(allocator, total_size, 64);
+
+    if (!buffers)
+    {
+        fputs("vi_bench: utf skipped, out of memory\n", stderr);
+        return;
+    }
+
+    vi_bench_utf_t u;
+    char name[64];
+
+    u.text    = buffers;
+    u.decoded = u.text + VI_BENCH_TEXT_MAX;
+    u.units   = (vi_uchar16_t *)(u.decoded + VI_BENCH_TEXT_MAX);
+
+    for (vi_usize_t t = 0; t < vi_array_size(samples); ++t)
+    {
+        const vi_usize_t length = strlen(samples[t][1]);
+
+        for (vi_usize_t i = 0; i < VI_BENCH_TEXT_MAX; ++i)
+        {
+            u.text[i] = samples[t][1][i % length];
+        }
+
+        for (vi_usize_t n = 0; n < vi_array_size(vi_bench_utf_cases); ++n)
+        {
+            snprintf(name, sizeof(name), "%s_%s", vi_bench_utf_cases[n].name, samples[t][0]);
+
+            for (vi_usize_t s = 0; s < vi_array_size(vi_bench_text_sizes); ++s)
+            {
+                vi_utf8_validate(u.text, vi_bench_text_sizes[s], &u.size);
+                vi_utf8_to_utf16(u.units, u.text, u.size, &u.units_size);
+                vi_bench_run(bench,
+                             name,
+                             vi_bench_text_sizes[s],
+                             u.size,
+                             vi_bench_utf_cases[n].fn,
+                             &u);
+            }
+        }
+    }
+
+    vi_allocator_aligned_free(allocator, buffers, total_size, 64);
+}
+
+/**
+ * @brief Заполняет строку длины `size` повторяющимися буквами и `VI_BENCH_TEXT_NEEDLE` в конце.
+ */
+static void
+vi_bench_text_prepare(vi_bench_text_t *t, vi_usize_t size)
+{
+    for (vi_usize_t i = 0; i < size; ++i)
+    {
+        t->str[i] = (vi_char_t)('a' + i % 26);
+    }
+
+    memcpy(t->str + size - VI_BENCH_TEXT_NEEDLE_LENGTH,
+           VI_BENCH_TEXT_NEEDLE,
+           VI_BENCH_TEXT_NEEDLE_LENGTH);
+    t->str[size] = '\0';
+    memcpy(t->copy, t->str, size + 1);
+    t->size = size;
+}
+
+void
+vi_bench_suite_text(vi_bench_t *bench)
+{
+    const vi_allocator_t *const allocator = vi_allocator_stdlib();
+    const vi_usize_t string_size          = VI_BENCH_TEXT_MAX + 64;
+    const vi_usize_t classes_size         = VI_BENCH_TEXT_MAX * sizeof(vi_u16_t);
+    const vi_usize_t total_size           = 3 * string_size + classes_size;
+
+    vi_char_t *const buffers = vi_allocator_aligned_allocate(allocator, total_size, 64);
+
+    if (!buffers)
+    {
+        fputs("vi_bench: text suite skipped, out of memory\n", stderr);
+        return;
+    }
+
+    vi_bench_text_t t;
+
+    t.str     = buffers;
+    t.copy    = t.str + string_size;
+    t.folded  = t.copy + string_size;
+    t.classes = (vi_u16_t *)(t.folded + string_size);
+
+    for (vi_usize_t c = 0; c < vi_array_size(vi_bench_text_cases); ++c)
+    {
+        for (vi_usize_t s = 0; s < vi_array_size(vi_bench_text_sizes); ++s)
+        {
+            vi_bench_text_prepare(&t, vi_bench_text_sizes[s]);
+            vi_bench_run(bench,
+                         vi_bench_text_cases[c].name,
+                         t.size,
+                         t.size,
+                         vi_bench_text_cases[c].fn,
+                         &t);
+        }
+    }
+
+    vi_bench_run(bench, "hash_u64", 0, sizeof(vi_u64_t), vi_bench_hash_u64, nullptr);
+    vi_allocator_aligned_free(allocator, buffers, total_size, 64);
+    vi_bench_codec(bench);
+    vi_bench_utf(bench);
+    vi_bench_numbers(bench);
+}
@@ -0,0 +1,650 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "harness.h"
+/* Дополнительные модули */
+#include <vi/cpu.h>
+#include <vi/nullptr.h>
+#include <vi/version.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+/**
+ * @def VI_BENCH_TSC
+ * @brief Счетчик тактов TSC доступен.
+ */
+#    define VI_BENCH_TSC 1
+#    if VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC
+#        include <intrin.h>
+#    else
+#        include <x86intrin.h>
+#    endif // VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC
+#else
+/**
+ * @def VI_BENCH_TSC
+ * @brief Счетчик тактов TSC недоступен.
+ */
+#    define VI_BENCH_TSC 0
+#endif // defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+
+#if defined(_WIN32)
+#    include <windows.h>
+#endif // defined(_WIN32)
+
+#ifndef VI_BENCH_OPTIONS
+/**
+ * @def VI_BENCH_OPTIONS
+ * @brief Включенные опции `VI_OPTION_*` библиотеки через запятую; задается при сборке.
+ */
+#    define VI_BENCH_OPTIONS ""
+#endif // VI_BENCH_OPTIONS
+
+#ifndef VI_BENCH_BUILD_TYPE
+/**
+ * @def VI_BENCH_BUILD_TYPE
+ * @brief Тип сборки CMake; задается при сборке.
+ */
+#    define VI_BENCH_BUILD_TYPE ""
+#endif // VI_BENCH_BUILD_TYPE
+
+#ifndef VI_BENCH_COMPILER
+/**
+ * @def VI_BENCH_COMPILER
+ * @brief Компилятор и его версия; задается при сборке.
+ */
+#    define VI_BENCH_COMPILER ""
+#endif // VI_BENCH_COMPILER
+
+#ifndef VI_SYSTEM_PROCESSOR
+/**
+ * @def VI_SYSTEM_PROCESSOR
+ * @brief Архитектура процессора; задается при сборке библиотеки.
+ */
+#    define VI_SYSTEM_PROCESSOR ""
+#endif // VI_SYSTEM_PROCESSOR
+
+/**
+ * @def VI_BENCH_NAME_MAX
+ * @brief Наибольшая длина полного имени замера вместе с завершающим нулем.
+ */
+#define VI_BENCH_NAME_MAX 128
+
+/**
+ * @def VI_BENCH_MAX_ENTRIES
+ * @brief Наибольшее количество элементов контейнеров по умолчанию.
+ *
+ * Замеры с большим количеством элементов требуют нескольких гигабайт памяти
+ * и включаются параметром `--max-entries`.
+ */
+#define VI_BENCH_MAX_ENTRIES (1024 * 1024)
+
+/**
+ * @def VI_BENCH_TSC_CALIBRATION_NS
+ * @brief Длительность сравнения TSC с монотонными часами при инициализации.
+ */
+#define VI_BENCH_TSC_CALIBRATION_NS 50000000ULL
+
+volatile vi_u64_t vi_bench_sink = 0;
+
+vi_u64_t
+vi_bench_now(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER counter;
+    LARGE_INTEGER frequency;
+
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (vi_u64_t)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (vi_u64_t)ts.tv_sec * 1000000000ULL + (vi_u64_t)ts.tv_nsec;
+#endif // defined(_WIN32)
+}
+
+/**
+ * @brief Возвращает значение счетчика тактов TSC или 0, если он недоступен.
+ */
+static vi_u64_t
+vi_bench_ticks(void)
+{
+#if VI_BENCH_TSC
+    return (vi_u64_t)__rdtsc();
+#else
+    return 0;
+#endif // VI_BENCH_TSC
+}
+
+/**
+ * @brief Определяет частоту TSC, сравнивая его с монотонными часами.
+ *
+ * @return Количество тактов в наносекунде или 0, если TSC недоступен.
+ */
+static double
+vi_bench_ticks_per_ns(void)
+{
+#if VI_BENCH_TSC
+    const vi_u64_t start_ns    = vi_bench_now();
+    const vi_u64_t start_ticks = vi_bench_ticks();
+    vi_u64_t elapsed_ns        = 0;
+
+    while (elapsed_ns < VI_BENCH_TSC_CALIBRATION_NS)
+    {
+        elapsed_ns = vi_bench_now() - start_ns;
+    }
+
+    return (double)(vi_bench_ticks() - start_ticks) / (double)elapsed_ns;
+#else
+    return 0.0;
+#endif // VI_BENCH_TSC
+}
+
+/**
+ * @brief Сравнивает два числа `double` для `qsort`.
+ */
+static int
+vi_bench_compare_double(const void *lhs, const void *rhs)
+{
+    const double a = *(const double *)lhs;
+    const double b = *(const double *)rhs;
+
+    return (a > b) - (a < b);
+}
+
+/**
+ * @brief Возвращает процентиль `percent` отсортированных значений по методу ближайшего ранга.
+ */
+static double
+vi_bench_percentile(const double *sorted, vi_usize_t count, vi_usize_t percent)
+{
+    vi_usize_t rank = (percent * count + 99) / 100;
+
+    rank = rank ? rank - 1 : 0;
+    return sorted[rank < count ? rank : count - 1];
+}
+
+/**
+ * @brief Разбирает неотрицательное целое число параметра командной строки.
+ */
+static bool
+vi_bench_parse_number(const char *text, vi_u64_t *value)
+{
+    char *end = nullptr;
+
+    if (!text || *text < '0' || *text > '9')
+    {
+        return false;
+    }
+
+    *value = (vi_u64_t)strtoull(text, &end, 10);
+    return *end == '\0';
+}
+
+/**
+ * @brief Выводит список включенных опций в формате `format`.
+ */
+static void
+vi_bench_print_options(FILE *out, vi_bench_format_t format)
+{
+    const char *it = VI_BENCH_OPTIONS;
+
+    if (format != VI_BENCH_FORMAT_JSON)
+    {
+        fputs(*it ? it : "-", out);
+        return;
+    }
+
+    fputc('[', out);
+
+    while (*it)
+    {
+        const char *const end = strchr(it, ',');
+        const size_t length   = end ? (size_t)(end - it) : strlen(it);
+
+        fprintf(out, "\"%.*s\"%s", (int)length, it, end ? ", " : "");
+        it += length + (end ? 1 : 0);
+    }
+
+    fputc(']', out);
+}
+
+/**
+ * @brief Выводит описание сборки и заголовок таблицы результатов.
+ */
+static void
+vi_bench_print_header(const vi_bench_t *bench)
+{
+    FILE *const out                   = bench->out;
+    const unsigned long long features = (unsigned long long)vi_cpu_features();
+
+    switch (bench->format)
+    {
+    case VI_BENCH_FORMAT_TEXT:
+        fprintf(out, "library:   vi %s\n", vi_version());
+        fprintf(out, "build:     %s, %s\n", VI_BENCH_BUILD_TYPE, VI_BENCH_COMPILER);
+        fputs("options:   ", out);
+        vi_bench_print_options(out, bench->format);
+        fprintf(out, "\nprocessor: %s, features 0x%llx", VI_SYSTEM_PROCESSOR, features);
+        fprintf(out, ", TSC %.3f GHz\n\n", bench->ticks_per_ns);
+        fprintf(out,
+                "%-36s %12s %12s %12s %10s %10s\n",
+                "name",
+                "median ns",
+                "p99 ns",
+                "min ns",
+                "GB/s",
+                "ticks/B");
+        break;
+
+    case VI_BENCH_FORMAT_CSV:
+        fprintf(out, "# library: vi %s\n", vi_version());
+        fprintf(out, "# build: %s, %s\n", VI_BENCH_BUILD_TYPE, VI_BENCH_COMPILER);
+        fputs("# options: ", out);
+        vi_bench_print_options(out, bench->format);
+        fprintf(out, "\n# processor: %s, features 0x%llx", VI_SYSTEM_PROCESSOR, features);
+        fprintf(out, ", TSC %.3f GHz\n", bench->ticks_per_ns);
+        fputs("name,size,bytes,iterations,samples,median_ns,p99_ns,min_ns,"
+              "gb_per_s,ticks_per_op,ticks_per_byte\n",
+              out);
+        break;
+
+    case VI_BENCH_FORMAT_JSON:
+        fprintf(out, "{\n  \"library\": \"%s\",\n", vi_version());
+        fprintf(out, "  \"build_type\": \"%s\",\n", VI_BENCH_BUILD_TYPE);
+        fprintf(out, "  \"compiler\": \"%s\",\n", VI_BENCH_COMPILER);
+        fputs("  \"options\": ", out);
+        vi_bench_print_options(out, bench->format);
+        fprintf(out, ",\n  \"processor\": \"%s\",\n", VI_SYSTEM_PROCESSOR);
+        fprintf(out, "  \"cpu_features\": \"0x%llx\",\n", features);
+        fprintf(out, "  \"tsc_ghz\": %.3f,\n", bench->ticks_per_ns);
+        fprintf(out, "  \"samples\": %llu,\n", (unsigned long long)bench->samples);
+        fputs("  \"results\": [", out);
+        break;
+    }
+}
+
+/**
+ * @brief Выводит результат одного замера.
+ */
+static void
+vi_bench_print_result(vi_bench_t *bench,
+                      const char *name,
+                      vi_usize_t size,
+                      vi_usize_t bytes,
+                      vi_usize_t iterations,
+                      double median_ns,
+                      double p99_ns,
+                      double min_ns,
+                      double ticks)
+{
+    FILE *const out             = bench->out;
+    const bool has_ticks        = bench->ticks_per_ns > 0.0;
+    const double gb_per_s       = bytes && median_ns > 0.0 ? (double)bytes / median_ns : 0.0;
+    const double ticks_per_byte = bytes ? ticks / (double)bytes : 0.0;
+
+    switch (bench->format)
+    {
+    case VI_BENCH_FORMAT_TEXT:
+        fprintf(out, "%-36s %12.2f %12.2f %12.2f", name, median_ns, p99_ns, min_ns);
+
+        if (bytes)
+        {
+            fprintf(out, " %10.2f", gb_per_s);
+        }
+        else
+        {
+            fprintf(out, " %10s", "-");
+        }
+
+        if (bytes && has_ticks)
+        {
+            fprintf(out, " %10.3f\n", ticks_per_byte);
+        }
+        else
+        {
+            fprintf(out, " %10s\n", "-");
+        }
+        break;
+
+    case VI_BENCH_FORMAT_CSV:
+        fprintf(out,
+                "%s,%llu,%llu,%llu,%llu,%.3f,%.3f,%.3f,",
+                name,
+                (unsigned long long)size,
+                (unsigned long long)bytes,
+                (unsigned long long)iterations,
+                (unsigned long long)bench->samples,
+                median_ns,
+                p99_ns,
+                min_ns);
+
+        if (bytes)
+        {
+            fprintf(out, "%.3f", gb_per_s);
+        }
+
+        fputc(',', out);
+
+        if (has_ticks)
+        {
+            fprintf(out, "%.3f", ticks);
+        }
+
+        fputc(',', out);
+
+        if (bytes && has_ticks)
+        {
+            fprintf(out, "%.4f", ticks_per_byte);
+        }
+
+        fputc('\n', out);
+        break;
+
+    case VI_BENCH_FORMAT_JSON:
+        fprintf(out,
+                "%s\n    {\"name\": \"%s\", \"size\": %llu, \"bytes\": %llu, "
+                "\"iterations\": %llu, \"median_ns\": %.3f, \"p99_ns\": %.3f, \"min_ns\": %.3f",
+                bench->count ? "," : "",
+                name,
+                (unsigned long long)size,
+                (unsigned long long)bytes,
+                (unsigned long long)iterations,
+                median_ns,
+                p99_ns,
+                min_ns);
+
+        if (bytes)
+        {
+            fprintf(out, ", \"gb_per_s\": %.3f", gb_per_s);
+        }
+        else
+        {
+            fputs(", \"gb_per_s\": null", out);
+        }
+
+        if (has_ticks)
+        {
+            fprintf(out, ", \"ticks_per_op\": %.3f", ticks);
+        }
+        else
+        {
+            fputs(", \"ticks_per_op\": null", out);
+        }
+
+        if (bytes && has_ticks)
+        {
+            fprintf(out, ", \"ticks_per_byte\": %.4f}", ticks_per_byte);
+        }
+        else
+        {
+            fputs(", \"ticks_per_byte\": null}", out);
+        }
+        break;
+    }
+
+    fflush(out);
+    ++bench->count;
+}
+
+/**
+ * @brief Выводит описание параметров командной строки в `stderr`.
+ */
+static void
+vi_bench_print_usage(const char *program)
+{
+    fprintf(stderr,
+            "usage: %s [--format text|csv|json] [--filter <substring>] [--samples <n>]\n"
+            "       [--warmup <n>] [--min-time-us <n>] [--max-entries <n>] [--output <file>]\n",
+            program);
+}
+
+bool
+vi_bench_init(vi_bench_t *bench, int argc, char **argv)
+{
+    const char *output = nullptr;
+    vi_u64_t number    = 0;
+
+    bench->out           = stdout;
+    bench->format        = VI_BENCH_FORMAT_TEXT;
+    bench->filter        = nullptr;
+    bench->samples       = 15;
+    bench->warmup        = 2;
+    bench->min_sample_ns = 500000;
+    bench->max_entries   = VI_BENCH_MAX_ENTRIES;
+    bench->ticks_per_ns  = 0.0;
+    bench->sample_ns     = nullptr;
+    bench->sample_ticks  = nullptr;
+    bench->count         = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const char *const key   = argv[i];
+        const char *const value = i + 1 < argc ? argv[++i] : nullptr;
+
+        if (!value)
+        {
+            vi_bench_print_usage(argv[0]);
+            return false;
+        }
+
+        if (strcmp(key, "--format") == 0 && strcmp(value, "text") == 0)
+        {
+            bench->format = VI_BENCH_FORMAT_TEXT;
+        }
+        else if (strcmp(key, "--format") == 0 && strcmp(value, "csv") == 0)
+        {
+            bench->format = VI_BENCH_FORMAT_CSV;
+        }
+        else if (strcmp(key, "--format") == 0 && strcmp(value, "json") == 0)
+        {
+            bench->format = VI_BENCH_FORMAT_JSON;
+        }
+        else if (strcmp(key, "--filter") == 0)
+        {
+            bench->filter = value;
+        }
+        else if (strcmp(key, "--samples") == 0 && vi_bench_parse_number(value, &number) &&
+                 number > 0)
+        {
+            bench->samples = (vi_usize_t)number;
+        }
+        else if (strcmp(key, "--warmup") == 0 && vi_bench_parse_number(value, &number))
+        {
+            bench->warmup = (vi_usize_t)number;
+        }
+        else if (strcmp(key, "--min-time-us") == 0 && vi_bench_parse_number(value, &number))
+        {
+            bench->min_sample_ns = number * 1000;
+        }
+        else if (strcmp(key, "--max-entries") == 0 && vi_bench_parse_number(value, &number))
+        {
+            bench->max_entries = (vi_usize_t)number;
+        }
+        else if (strcmp(key, "--output") == 0)
+        {
+            output = value;
+        }
+        else
+        {
+            vi_bench_print_usage(argv[0]);
+            return false;
+        }
+    }
+
+    if (output)
+    {
+        bench->out = fopen(output, "w");
+
+        if (!bench->out)
+        {
+            fprintf(stderr, "vi_bench: cannot open '%s'\n", output);
+            bench->out = stdout;
+            return false;
+        }
+    }
+
+    bench->sample_ns    = malloc(bench->samples * sizeof(double));
+    bench->sample_ticks = malloc(bench->samples * sizeof(double));
+
+    if (!bench->sample_ns || !bench->sample_ticks)
+    {
+        fputs("vi_bench: out of memory\n", stderr);
+        bench->format = VI_BENCH_FORMAT_TEXT;
+        vi_bench_finish(bench);
+        return false;
+    }
+
+    bench->ticks_per_ns = vi_bench_ticks_per_ns();
+    vi_bench_print_header(bench);
+    return true;
+}
+
+void
+vi_bench_finish(vi_bench_t *bench)
+{
+    if (bench->format == VI_BENCH_FORMAT_JSON && bench->sample_ns)
+    {
+        fputs("\n  ]\n}\n", bench->out);
+    }
+
+    if (bench->out != stdout)
+    {
+        fclose(bench->out);
+    }
+
+    free(bench->sample_ns);
+    free(bench->sample_ticks);
+    bench->out          = stdout;
+    bench->sample_ns    = nullptr;
+    bench->sample_ticks = nullptr;
+}
+
+/**
+ * @brief Записывает полное имя `name/size` в `full_name` и проверяет его фильтром.
+ *
+ * @return `true`, если замер нужно выполнить.
+ */
+static bool
+vi_bench_select(const vi_bench_t *bench, char *full_name, const char *name, vi_usize_t size)
+{
+    if (size)
+    {
+        snprintf(full_name, VI_BENCH_NAME_MAX, "%s/%llu", name, (unsigned long long)size);
+    }
+    else
+    {
+        snprintf(full_name, VI_BENCH_NAME_MAX, "%s", name);
+    }
+
+    return !bench->filter || strstr(full_name, bench->filter);
+}
+
+void
+vi_bench_run(vi_bench_t *bench,
+             const char *name,
+             vi_usize_t size,
+             vi_usize_t bytes,
+             vi_bench_fn_t fn,
+             vi_ptr_t arg)
+{
+    char full_name[VI_BENCH_NAME_MAX];
+    vi_usize_t iterations = 1;
+
+    if (!vi_bench_select(bench, full_name, name, size))
+    {
+        return;
+    }
+
+    // Подбираем количество повторов: увеличиваем его по прошедшему времени,
+    // но не более чем в 10 раз за шаг, чтобы не промахнуться из-за шума.
+    for (;;)
+    {
+        const vi_u64_t start   = vi_bench_now();
+        fn(arg, iterations);
+        const vi_u64_t elapsed = vi_bench_now() - start;
+
+        if (elapsed >= bench->min_sample_ns)
+        {
+            break;
+        }
+
+        vi_usize_t factor = elapsed ? (vi_usize_t)(bench->min_sample_ns * 6 / 5 / elapsed) + 1 : 10;
+
+        factor = factor < 2 ? 2 : (factor > 10 ? 10 : factor);
+        iterations *= factor;
+    }
+
+    for (vi_usize_t i = 0; i < bench->warmup; ++i)
+    {
+        fn(arg, iterations);
+    }
+
+    for (vi_usize_t i = 0; i < bench->samples; ++i)
+    {
+        const vi_u64_t start_ns    = vi_bench_now();
+        const vi_u64_t start_ticks = vi_bench_ticks();
+        fn(arg, iterations);
+        const vi_u64_t end_ticks   = vi_bench_ticks();
+        const vi_u64_t end_ns      = vi_bench_now();
+
+        bench->sample_ns[i]    = (double)(end_ns - start_ns) / (double)iterations;
+        bench->sample_ticks[i] = (double)(end_ticks - start_ticks) / (double)iterations;
+    }
+
+    qsort(bench->sample_ns, bench->samples, sizeof(double), vi_bench_compare_double);
+    qsort(bench->sample_ticks, bench->samples, sizeof(double), vi_bench_compare_double);
+
+    vi_bench_print_result(bench,
+                          full_name,
+                          size,
+                          bytes,
+                          iterations,
+                          vi_bench_percentile(bench->sample_ns, bench->samples, 50),
+                          vi_bench_percentile(bench->sample_ns, bench->samples, 99),
+                          bench->sample_ns[0],
+                          vi_bench_percentile(bench->sample_ticks, bench->samples, 50));
+}
+
+void
+vi_bench_report(vi_bench_t *bench,
+                const char *name,
+                vi_usize_t size,
+                double value,
+                const char *unit)
+{
+    char full_name[VI_BENCH_NAME_MAX];
+    FILE *const out = bench->out;
+
+    if (!vi_bench_select(bench, full_name, name, size))
+    {
+        return;
+    }
+
+    switch (bench->format)
+    {
+    case VI_BENCH_FORMAT_TEXT:
+        fprintf(out, "%-36s %12.2f %s\n", full_name, value, unit);
+        break;
+
+    case VI_BENCH_FORMAT_CSV:
+        fprintf(out, "# %s: %.3f %s\n", full_name, value, unit);
+        break;
+
+    case VI_BENCH_FORMAT_JSON:
+        fprintf(out,
+                "%s\n    {\"name\": \"%s\", \"size\": %llu, \"value\": %.3f, \"unit\": \"%s\"}",
+                bench->count ? "," : "",
+                full_name,
+                (unsigned long long)size,
+                value,
+                unit);
+        ++bench->count;
+        break;
+    }
+
+    fflush(out);
+}
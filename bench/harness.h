@@ -0,0 +1,286 @@
+/**
+ * @file harness.h
+ * @brief Каркас замеров производительности `vi_bench`.
+ *
+ * Этот файл содержит функции, которыми наборы замеров измеряют функции библиотеки.
+ * Замер вызывает функцию `fn(arg, iterations)`, которая должна выполнить измеряемую
+ * операцию `iterations` раз, и делит время вызова на `iterations`:
+ *
+ * 1. Количество повторов подбирается так, чтобы один вызов длился не меньше
+ *    `min_sample_ns`; это скрывает погрешность таймера.
+ * 2. Первые `warmup` вызовов прогревают кэши и предсказатель ветвлений и отбрасываются.
+ * 3. Следующие `samples` вызовов сортируются, по ним вычисляются медиана,
+ *    99-й процентиль и минимум времени одной операции.
+ *
+ * Время измеряется монотонными часами. На x86 дополнительно читается счетчик
+ * тактов TSC, по которому вычисляются такты на операцию и на байт. TSC идет
+ * с номинальной частотой процессора, поэтому при турборежиме такты TSC
+ * не совпадают с тактами ядра, но сопоставимы между сборками на одной машине.
+ *
+ * Результаты выводятся таблицей, в CSV или в JSON. В заголовок вывода входят версия
+ * библиотеки, тип сборки, компилятор, включенные опции `VI_OPTION_*` и возможности
+ * процессора, чтобы результаты разных сборок можно было сравнивать.
+ *
+ * Основные функции:
+ * - vi_bench_init: Инициализирует замеры по параметрам командной строки.
+ * - vi_bench_run: Выполняет один замер и выводит результат.
+ * - vi_bench_report: Выводит измеренную величину, не являющуюся временем.
+ * - vi_bench_finish: Завершает вывод и освобождает ресурсы.
+ * - vi_bench_now: Возвращает время монотонных часов в наносекундах.
+ */
+
+#ifndef VI_BENCH_HARNESS_H
+#define VI_BENCH_HARNESS_H
+
+#include <vi/ptr.h>
+#include <vi/bool.h>
+#include <vi/size.h>
+#include <vi/compiler.h>
+#include <vi/numeric_fixed_types.h>
+
+#include <stdio.h>
+
+/**
+ * @brief Формат вывода результатов.
+ */
+typedef enum vi_bench_format_t
+{
+    /**
+     * @brief Таблица для чтения человеком.
+     */
+    VI_BENCH_FORMAT_TEXT,
+
+    /**
+     * @brief Значения, разделенные запятыми, с заголовком в строках `#`.
+     */
+    VI_BENCH_FORMAT_CSV,
+
+    /**
+     * @brief Объект JSON с описанием сборки и массивом результатов.
+     */
+    VI_BENCH_FORMAT_JSON
+} vi_bench_format_t;
+
+/**
+ * @brief Тип измеряемой функции.
+ *
+ * @param arg Аргумент, переданный `vi_bench_run`.
+ * @param iterations Количество повторений измеряемой операции.
+ */
+typedef void (*vi_bench_fn_t)(vi_ptr_t arg, vi_usize_t iterations);
+
+/**
+ * @brief Описание замера из таблицы замеров набора.
+ */
+typedef struct vi_bench_case_t
+{
+    /**
+     * @brief Имя замера.
+     */
+    const char *name;
+
+    /**
+     * @brief Измеряемая функция.
+     */
+    vi_bench_fn_t fn;
+} vi_bench_case_t;
+
+/**
+ * @brief Состояние замеров.
+ */
+typedef struct vi_bench_t
+{
+    /**
+     * @brief Поток вывода результатов.
+     */
+    FILE *out;
+
+    /**
+     * @brief Формат вывода.
+     */
+    vi_bench_format_t format;
+
+    /**
+     * @brief Подстрока, которую должно содержать полное имя замера, или `nullptr`.
+     */
+    const char *filter;
+
+    /**
+     * @brief Количество учитываемых вызовов на замер.
+     */
+    vi_usize_t samples;
+
+    /**
+     * @brief Количество прогревочных вызовов на замер.
+     */
+    vi_usize_t warmup;
+
+    /**
+     * @brief Минимальная длительность одного вызова в наносекундах.
+     */
+    vi_u64_t min_sample_ns;
+
+    /**
+     * @brief Наибольшее количество элементов контейнеров в замерах.
+     */
+    vi_usize_t max_entries;
+
+    /**
+     * @brief Количество тактов TSC в наносекунде или 0, если TSC недоступен.
+     */
+    double ticks_per_ns;
+
+    /**
+     * @brief Время одной операции в каждом вызове, в наносекундах.
+     */
+    double *sample_ns;
+
+    /**
+     * @brief Такты TSC одной операции в каждом вызове.
+     */
+    double *sample_ticks;
+
+    /**
+     * @brief Количество выведенных результатов.
+     */
+    vi_usize_t count;
+} vi_bench_t;
+
+/**
+ * @brief Приемник результатов измеряемых функций.
+ *
+ * Запись результата в эту переменную не дает компилятору удалить вычисление.
+ */
+extern volatile vi_u64_t vi_bench_sink;
+
+/**
+ * @def vi_bench_consume
+ * @brief Сохраняет значение `value` в `vi_bench_sink`, чтобы вычисление не было удалено.
+ */
+#define vi_bench_consume(value) (vi_bench_sink = (vi_u64_t)(value))
+
+#if (VI_COMPILER_TYPE == VI_COMPILER_TYPE_GCC) || (VI_COMPILER_TYPE == VI_COMPILER_TYPE_CLANG)
+/**
+ * @def vi_bench_clobber
+ * @brief Сообщает компилятору, что память по указателю `ptr` могла быть прочитана
+ *        и изменена, чтобы записи в нее не были удалены или перенесены.
+ */
+#    define vi_bench_clobber(ptr) __asm__ volatile("" : : "g"(ptr) : "memory")
+#else
+/**
+ * @def vi_bench_clobber
+ * @brief Сохраняет указатель в `vi_bench_sink` для компиляторов без ассемблерных вставок.
+ */
+#    define vi_bench_clobber(ptr) vi_bench_consume((vi_usize_t)(ptr))
+#endif // (VI_COMPILER_TYPE == VI_COMPILER_TYPE_GCC) || (VI_COMPILER_TYPE == VI_COMPILER_TYPE_CLANG)
+
+/**
+ * @brief Инициализирует замеры по параметрам командной строки.
+ *
+ * Поддерживаются параметры `--format text|csv|json`, `--filter <подстрока>`,
+ * `--samples <n>`, `--warmup <n>`, `--min-time-us <n>`, `--max-entries <n>`
+ * и `--output <файл>`.
+ * Выводит заголовок результатов.
+ *
+ * @param bench Указатель на инициализируемое состояние.
+ * @param argc Количество параметров.
+ * @param argv Параметры командной строки.
+ *
+ * @return `true` при успехе или `false`, если параметры неверны или файл
+ *         не удалось открыть; описание ошибки выводится в `stderr`.
+ */
+bool
+vi_bench_init(vi_bench_t *bench, int argc, char **argv);
+
+/**
+ * @brief Завершает вывод результатов и освобождает ресурсы.
+ *
+ * @param bench Указатель на состояние.
+ */
+void
+vi_bench_finish(vi_bench_t *bench);
+
+/**
+ * @brief Измеряет функцию и выводит результат.
+ *
+ * Замер пропускается, если полное имя `name/size` не содержит подстроку фильтра.
+ *
+ * @param bench Указатель на состояние.
+ * @param name Имя замера, например `memory_copy`.
+ * @param size Параметр перебора, например размер буфера или количество элементов.
+ * @param bytes Количество байтов, обрабатываемых одной операцией; 0, если пропускная
+ *              способность не имеет смысла.
+ * @param fn Измеряемая функция.
+ * @param arg Аргумент функции.
+ */
+void
+vi_bench_run(vi_bench_t *bench,
+             const char *name,
+             vi_usize_t size,
+             vi_usize_t bytes,
+             vi_bench_fn_t fn,
+             vi_ptr_t arg);
+
+/**
+ * @brief Выводит измеренную величину, не являющуюся временем, например расход памяти.
+ *
+ * В таблице величина выводится в столбце медианы, в CSV — строкой комментария `#`,
+ * в JSON — элементом результатов с полями `value` и `unit`. Фильтр применяется
+ * так же, как в `vi_bench_run`.
+ *
+ * @param bench Указатель на состояние.
+ * @param name Имя величины, например `hash_map_bytes_per_entry`.
+ * @param size Параметр перебора.
+ * @param value Значение.
+ * @param unit Единица измерения.
+ */
+void
+vi_bench_report(vi_bench_t *bench,
+                const char *name,
+                vi_usize_t size,
+                double value,
+                const char *unit);
+
+/**
+ * @brief Возвращает время монотонных часов в наносекундах.
+ */
+vi_u64_t
+vi_bench_now(void);
+
+/**
+ * @brief Замеры функций работы с памятью: копирования, заполнения, сравнения и поиска.
+ */
+void
+vi_bench_suite_memory(vi_bench_t *bench);
+
+/**
+ * @brief Замеры функций строк, символов ASCII, хеширования, шестнадцатеричного
+ *        кодирования, Base64, UTF-8 и преобразования чисел.
+ */
+void
+vi_bench_suite_text(vi_bench_t *bench);
+
+/**
+ * @brief Замеры контейнеров: хеш-таблицы, набора битов и динамического блока.
+ *
+ * Для хеш-таблицы дополнительно выводится размер таблицы в байтах на запись.
+ * Замеры больше чем с `max_entries` элементами пропускаются.
+ */
+void
+vi_bench_suite_container(vi_bench_t *bench);
+
+/**
+ * @brief Замеры распределителей памяти: стандартного, арены и пула.
+ */
+void
+vi_bench_suite_allocator(vi_bench_t *bench);
+
+/**
+ * @brief Замеры очередей, в том числе задержки передачи между двумя потоками
+ *        и конкуренции от 1 до 32 производителей и потребителей, пула потоков
+ *        и кадров выполнения.
+ */
+void
+vi_bench_suite_runtime(vi_bench_t *bench);
+
+#endif // VI_BENCH_HARNESS_H
@@ -0,0 +1,23 @@
+#include "harness.h"
+
+#include <stdlib.h>
+
+int
+main(int argc, char **argv)
+{
+    vi_bench_t bench;
+
+    if (!vi_bench_init(&bench, argc, argv))
+    {
+        return EXIT_FAILURE;
+    }
+
+    vi_bench_suite_memory(&bench);
+    vi_bench_suite_text(&bench);
+    vi_bench_suite_container(&bench);
+    vi_bench_suite_allocator(&bench);
+    vi_bench_suite_runtime(&bench);
+    vi_bench_finish(&bench);
+
+    return EXIT_SUCCESS;
+}
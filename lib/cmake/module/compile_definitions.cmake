@@ -18,6 +18,11 @@ list(APPEND VI_TARGET_PUBLIC_COMPILE_DEFINITIONS
         # количество сохраненных состояний кадров в библиотеке.
         VI_RUNTIME_FRAME_STATE_MAX=255
 
+        # VI_THREAD_POOL_GLOBAL_WORKERS задает количество рабочих потоков общего пула,
+        # создаваемого при включенной опции VI_OPTION_THREAD_POOL_GLOBAL.
+        # Значение 0 означает количество процессоров, доступных процессу.
+        VI_THREAD_POOL_GLOBAL_WORKERS=0
+
         # Устанавливаем тип диапазона памяти.
         # Данная переменная определяет тип диапазона, который будет использоваться в проекте.
         #
@@ -26,7 +31,7 @@ list(APPEND VI_TARGET_PUBLIC_COMPILE_DEFINITIONS
         # 1 - Левый полуоткрытый диапазон (VI_MEMORY_RANGE_TYPE_LEFT_OPENED)
         # 2 - Правый полуоткрытый диапазон (VI_MEMORY_RANGE_TYPE_RIGHT_OPENED)
         # 3 - Открытый диапазон (VI_MEMORY_RANGE_TYPE_OPENED)
-        # VI_MEMORY_RANGE_TYPE=2
+        VI_MEMORY_RANGE_TYPE=2
 
         # Макрос VI_DYNAMIC_BLOCK_GROWTH_FACTOR задает коэффициент роста размера памяти
         # при перераспределении в динамических структурах данных. Этот коэффициент определяет
@@ -214,4 +214,31 @@ option(VI_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
 #     и требований вашего приложения.
 #
 option(VI_OPTION_THREAD_LOCAL_VARIABLES
-        "Все статические переменные используют модификатор thread_local." ON)
\ No newline at end of file
+        "Все статические переменные используют модификатор thread_local." ON)
+
+# Опция:
+#
+#     VI_OPTION_THREAD_POOL_GLOBAL
+#
+# Описание:
+#
+#     Опция CMake VI_OPTION_THREAD_POOL_GLOBAL определяет,
+#     должна ли библиотека VI создавать общий пул потоков при загрузке.
+#
+#     Включение этой опции (ON) запускает пул из VI_THREAD_POOL_GLOBAL_WORKERS
+#     рабочих потоков до вызова main() и останавливает его после выхода из main().
+#     Пул доступен через функцию vi_thread_pool_global().
+#
+# Использование:
+#
+#     ON: Создавать общий пул потоков при загрузке библиотеки.
+#     OFF: Не создавать общий пул; приложение создает пулы само через vi_thread_pool_create().
+#
+# Примечание:
+#
+#     Рабочие потоки общего пула спят, пока в пул не добавлены задачи,
+#     но занимают память под стеки. Включайте опцию, если несколько частей
+#     приложения должны использовать одни и те же рабочие потоки.
+#
+option(VI_OPTION_THREAD_POOL_GLOBAL
+        "Создавать общий пул потоков при загрузке библиотеки." OFF)
@@ -0,0 +1,251 @@
+/**
+ * @file allocator.h
+ * @brief Интерфейс распределителя памяти.
+ *
+ * Этот файл содержит структуру `vi_allocator_t`, которая описывает распределитель
+ * памяти таблицей функций и указателем на его контекст. Через этот интерфейс
+ * библиотека выделяет всю память, поэтому стандартную кучу можно заменить
+ * собственной реализацией (например, ареной или пулом) без изменения мест вызова.
+ *
+ * Функции освобождения и перераспределения получают размер блока, указанный
+ * при выделении. Распределители, которые хранят размеры самостоятельно
+ * (как стандартная библиотека), могут его игнорировать.
+ *
+ * Необязательные функции `allocate_zeroed` и `aligned_allocate_zeroed` выделяют
+ * блок, заполненный нулями. Распределитель, который знает происхождение памяти
+ * (например, свежие страницы операционной системы уже обнулены), может пропустить
+ * лишнее заполнение. Поэтому при опции `VI_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE`
+ * блоки выделяются через них, а не через `allocate` и `aligned_allocate`
+ * с последующим обнулением.
+ *
+ * Основные функции:
+ * - vi_allocator_stdlib: Возвращает распределитель на основе стандартной библиотеки.
+ * - vi_allocator_is_valid: Проверяет, заполнены ли все функции распределителя.
+ * - vi_allocator_allocate: Выделяет блок памяти.
+ * - vi_allocator_allocate_zeroed: Выделяет блок памяти, заполненный нулями.
+ * - vi_allocator_reallocate: Изменяет размер блока памяти.
+ * - vi_allocator_free: Освобождает блок памяти.
+ * - vi_allocator_aligned_allocate: Выделяет выровненный блок памяти.
+ * - vi_allocator_aligned_allocate_zeroed: Выделяет выровненный блок, заполненный нулями.
+ * - vi_allocator_aligned_free: Освобождает выровненный блок памяти.
+ */
+
+#ifndef VI_ALLOCATOR_H
+#define VI_ALLOCATOR_H
+
+#include "ptr.h"
+#include "bool.h"
+#include "size.h"
+#include "attribute.h"
+
+/**
+ * @brief Таблица функций распределителя памяти.
+ *
+ * Каждая функция первым аргументом получает `context`, что позволяет
+ * использовать одну реализацию для нескольких экземпляров распределителя.
+ * Все поля, кроме `context`, `allocate_zeroed` и `aligned_allocate_zeroed`, обязательны.
+ */
+typedef struct vi_allocator_t
+{
+    /**
+     * @brief Контекст распределителя, передаваемый во все функции.
+     */
+    vi_ptr_t context;
+
+    /**
+     * @brief Выделяет `size` байт. Возвращает `nullptr` при ошибке.
+     */
+    vi_ptr_t (*allocate)(vi_ptr_t context, vi_usize_t size);
+
+    /**
+     * @brief Выделяет `size` байт, заполненных нулями. Может быть `nullptr`.
+     */
+    vi_ptr_t (*allocate_zeroed)(vi_ptr_t context, vi_usize_t size);
+
+    /**
+     * @brief Изменяет размер блока `ptr` с `old_size` до `new_size` байт.
+     *
+     * Возвращает `nullptr` при ошибке, при этом исходный блок остается действительным.
+     */
+    vi_ptr_t (*reallocate)(vi_ptr_t context,
+                           vi_ptr_t ptr,
+                           vi_usize_t old_size,
+                           vi_usize_t new_size);
+
+    /**
+     * @brief Освобождает блок `ptr` размером `size` байт.
+     */
+    void (*free)(vi_ptr_t context, vi_ptr_t ptr, vi_usize_t size);
+
+    /**
+     * @brief Выделяет `size` байт с выравниванием `alignment` (степень двойки).
+     */
+    vi_ptr_t (*aligned_allocate)(vi_ptr_t context, vi_usize_t size, vi_usize_t alignment);
+
+    /**
+     * @brief Выделяет `size` байт, заполненных нулями, с выравниванием `alignment`.
+     *        Может быть `nullptr`.
+     *
+     * Блок освобождается функцией `aligned_free`.
+     */
+    vi_ptr_t (*aligned_allocate_zeroed)(vi_ptr_t context, vi_usize_t size, vi_usize_t alignment);
+
+    /**
+     * @brief Освобождает блок, выделенный функцией `aligned_allocate`.
+     */
+    void (*aligned_free)(vi_ptr_t context, vi_ptr_t ptr, vi_usize_t size, vi_usize_t alignment);
+} vi_allocator_t;
+
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Возвращает распределитель на основе функций стандартной библиотеки.
+ *
+ * Использует `malloc`, `calloc`, `realloc` и `free`, а для выровненных блоков —
+ * `aligned_alloc` (или `_aligned_malloc` и `_aligned_free` в MSVC). Обнуленные
+ * блоки с выравниванием не больше `max_align_t` выделяются `calloc` (кроме MSVC).
+ *
+ * @return Указатель на статический экземпляр распределителя.
+ */
+VI_ATTRIBUTE(SYMBOL)
+const vi_allocator_t *
+vi_allocator_stdlib(void);
+
+/**
+ * @brief Проверяет, что распределитель существует и заполнены все его функции.
+ *
+ * @param allocator Указатель на распределитель.
+ *
+ * @return `true`, если распределителем можно пользоваться, иначе `false`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_allocator_is_valid(const vi_allocator_t *allocator);
+
+/**
+ * @brief Выделяет блок памяти.
+ *
+ * Если библиотека собрана с опцией `VI_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE`,
+ * функция эквивалентна `vi_allocator_allocate_zeroed`.
+ *
+ * @param allocator Указатель на распределитель.
+ * @param size Размер блока в байтах.
+ *
+ * @return Указатель на блок или `nullptr`, если `allocator` равен `nullptr`,
+ *         `size` равен 0 или память не удалось выделить.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_allocator_allocate(const vi_allocator_t *allocator, vi_usize_t size);
+
+/**
+ * @brief Выделяет блок памяти, заполненный нулями.
+ *
+ * Если у распределителя есть функция `allocate_zeroed`, блок выделяется ею,
+ * иначе выделяется функцией `allocate` и обнуляется.
+ *
+ * @param allocator Указатель на распределитель.
+ * @param size Размер блока в байтах.
+ *
+ * @return Указатель на блок или `nullptr`, если `allocator` равен `nullptr`,
+ *         `size` равен 0 или память не удалось выделить.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_allocator_allocate_zeroed(const vi_allocator_t *allocator, vi_usize_t size);
+
+/**
+ * @brief Изменяет размер блока памяти.
+ *
+ * Если `ptr` равен `nullptr`, функция эквивалентна `vi_allocator_allocate`.
+ * Если библиотека собрана с опцией `VI_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE`,
+ * добавленная часть блока заполняется нулями.
+ *
+ * @param allocator Указатель на распределитель.
+ * @param ptr Указатель на блок или `nullptr`.
+ * @param old_size Текущий размер блока в байтах.
+ * @param new_size Новый размер блока в байтах.
+ *
+ * @return Указатель на блок нового размера или `nullptr` при ошибке.
+ *         При ошибке исходный блок остается действительным.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_allocator_reallocate(const vi_allocator_t *allocator,
+                        vi_ptr_t ptr,
+                        vi_usize_t old_size,
+                        vi_usize_t new_size);
+
+/**
+ * @brief Освобождает блок памяти.
+ *
+ * Если `allocator` или `ptr` равен `nullptr`, функция ничего не делает.
+ *
+ * @param allocator Указатель на распределитель.
+ * @param ptr Указатель на блок.
+ * @param size Размер блока в байтах, указанный при выделении.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_allocator_free(const vi_allocator_t *allocator, vi_ptr_t ptr, vi_usize_t size);
+
+/**
+ * @brief Выделяет выровненный блок памяти.
+ *
+ * Если библиотека собрана с опцией `VI_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE`,
+ * функция эквивалентна `vi_allocator_aligned_allocate_zeroed`.
+ *
+ * @param allocator Указатель на распределитель.
+ * @param size Размер блока в байтах.
+ * @param alignment Выравнивание блока; должно быть степенью двойки.
+ *
+ * @return Указатель на блок или `nullptr`, если аргументы некорректны
+ *         или память не удалось выделить.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_allocator_aligned_allocate(const vi_allocator_t *allocator,
+                              vi_usize_t size,
+                              vi_usize_t alignment);
+
+/**
+ * @brief Выделяет выровненный блок памяти, заполненный нулями.
+ *
+ * Если у распределителя есть функция `aligned_allocate_zeroed`, блок выделяется ею,
+ * иначе выделяется функцией `aligned_allocate` и обнуляется.
+ *
+ * @param allocator Указатель на распределитель.
+ * @param size Размер блока в байтах.
+ * @param alignment Выравнивание блока; должно быть степенью двойки.
+ *
+ * @return Указатель на блок или `nullptr`, если аргументы некорректны
+ *         или память не удалось выделить.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_allocator_aligned_allocate_zeroed(const vi_allocator_t *allocator,
+                                     vi_usize_t size,
+                                     vi_usize_t alignment);
+
+/**
+ * @brief Освобождает блок, выделенный функцией `vi_allocator_aligned_allocate`.
+ *
+ * Если `allocator` или `ptr` равен `nullptr`, функция ничего не делает.
+ *
+ * @param allocator Указатель на распределитель.
+ * @param ptr Указатель на блок.
+ * @param size Размер блока в байтах, указанный при выделении.
+ * @param alignment Выравнивание, указанное при выделении.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_allocator_aligned_free(const vi_allocator_t *allocator,
+                          vi_ptr_t ptr,
+                          vi_usize_t size,
+                          vi_usize_t alignment);
+
+VI_COMPILER(EXTERN_C_END)
+
+#endif // VI_ALLOCATOR_H
@@ -0,0 +1,244 @@
+/**
+ * @file arena.h
+ * @brief Арена — распределитель памяти со сдвигом указателя.
+ *
+ * Этот файл содержит структуру `vi_arena_t`, которая выделяет память сдвигом
+ * указателя внутри крупных участков (chunk) и освобождает ее целиком. Участки
+ * запрашиваются у базового распределителя (по умолчанию — у распределителя
+ * времени выполнения), поэтому множество мелких выделений сводится
+ * к нескольким обращениям к куче.
+ *
+ * Состояние арены можно сохранить маркером `vi_arena_marker_t` и позже
+ * вернуться к нему, освободив все выделенное после сохранения. Это позволяет
+ * вкладывать этапы обработки друг в друга без освобождения отдельных блоков.
+ *
+ * Если библиотека собрана с опцией `VI_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE`,
+ * участки запрашиваются уже обнуленными, а арена помнит границу еще не выдававшейся
+ * памяти. Обнуляются только блоки, память которых уже использовалась
+ * (например, после `vi_arena_restore`).
+ *
+ * Поле `allocator` представляет арену как `vi_allocator_t`, поэтому ее можно
+ * передать в любой код, работающий через интерфейс распределителя, или установить
+ * распределителем времени выполнения на время обработки запроса.
+ *
+ * Основные функции:
+ * - vi_arena_init: Инициализирует арену.
+ * - vi_arena_destroy: Освобождает все участки арены.
+ * - vi_arena_allocate: Выделяет блок с выравниванием по умолчанию.
+ * - vi_arena_aligned_allocate: Выделяет блок с заданным выравниванием.
+ * - vi_arena_allocate_zeroed: Выделяет блок, заполненный нулями.
+ * - vi_arena_save: Возвращает маркер текущего состояния.
+ * - vi_arena_restore: Возвращает арену к состоянию маркера.
+ * - vi_arena_reset: Освобождает все блоки, сохраняя первый участок.
+ */
+
+#ifndef VI_ARENA_H
+#define VI_ARENA_H
+
+#include "allocator.h"
+#include "numeric.h"
+
+/**
+ * @def VI_ARENA_DEFAULT_ALIGNMENT
+ * @brief Выравнивание блоков, выделяемых `vi_arena_allocate`.
+ */
+#define VI_ARENA_DEFAULT_ALIGNMENT (sizeof(vi_ptr_t) * 2)
+
+/**
+ * @def VI_ARENA_DEFAULT_CHUNK_SIZE
+ * @brief Размер участка по умолчанию в байтах.
+ */
+#define VI_ARENA_DEFAULT_CHUNK_SIZE 65536
+
+/**
+ * @brief Заголовок участка памяти арены.
+ *
+ * Данные участка следуют сразу за заголовком.
+ */
+typedef struct vi_arena_chunk_t
+{
+    /**
+     * @brief Предыдущий (более старый) участок или `nullptr`.
+     */
+    struct vi_arena_chunk_t *prev;
+
+    /**
+     * @brief Полный размер участка в байтах, включая заголовок.
+     */
+    vi_usize_t size;
+
+    /**
+     * @brief Начало части участка, которая заведомо заполнена нулями.
+     *
+     * Память за этой границей еще не выдавалась с момента получения участка
+     * обнуленным, поэтому при выделении обнуленных блоков ее не нужно заполнять.
+     */
+    vi_u8_t *clean;
+} vi_arena_chunk_t;
+
+/**
+ * @brief Арена памяти.
+ */
+typedef struct vi_arena_t
+{
+    /**
+     * @brief Интерфейс распределителя, работающий с этой ареной.
+     */
+    vi_allocator_t allocator;
+
+    /**
+     * @brief Распределитель, у которого запрашиваются участки.
+     */
+    const vi_allocator_t *backing;
+
+    /**
+     * @brief Текущий (самый новый) участок или `nullptr`.
+     */
+    vi_arena_chunk_t *chunk;
+
+    /**
+     * @brief Начало свободной части текущего участка.
+     */
+    vi_u8_t *current;
+
+    /**
+     * @brief Конец текущего участка.
+     */
+    vi_u8_t *end;
+
+    /**
+     * @brief Минимальный размер нового участка в байтах.
+     */
+    vi_usize_t chunk_size;
+} vi_arena_t;
+
+/**
+ * @brief Маркер состояния арены.
+ */
+typedef struct vi_arena_marker_t
+{
+    /**
+     * @brief Участок, бывший текущим в момент сохранения.
+     */
+    vi_arena_chunk_t *chunk;
+
+    /**
+     * @brief Начало свободной части участка в момент сохранения.
+     */
+    vi_u8_t *current;
+} vi_arena_marker_t;
+
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Инициализирует пустую арену.
+ *
+ * Участки не выделяются до первого запроса памяти.
+ *
+ * @param arena Указатель на инициализируемую арену.
+ * @param backing Распределитель участков или `nullptr` для распределителя
+ *                времени выполнения, действующего в момент инициализации.
+ * @param chunk_size Минимальный размер участка или 0 для `VI_ARENA_DEFAULT_CHUNK_SIZE`.
+ *
+ * @return `true` при успехе или `false`, если `arena` равен `nullptr`
+ *         или базовый распределитель недействителен.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_arena_init(vi_arena_t *arena, const vi_allocator_t *backing, vi_usize_t chunk_size);
+
+/**
+ * @brief Возвращает все участки арены базовому распределителю.
+ *
+ * После вызова арена пуста и может использоваться повторно.
+ *
+ * @param arena Указатель на арену.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_arena_destroy(vi_arena_t *arena);
+
+/**
+ * @brief Выделяет блок с выравниванием `VI_ARENA_DEFAULT_ALIGNMENT`.
+ *
+ * @param arena Указатель на арену.
+ * @param size Размер блока в байтах.
+ *
+ * @return Указатель на блок или `nullptr`, если `arena` равен `nullptr`,
+ *         `size` равен 0 или не удалось выделить новый участок.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_arena_allocate(vi_arena_t *arena, vi_usize_t size);
+
+/**
+ * @brief Выделяет блок с заданным выравниванием.
+ *
+ * @param arena Указатель на арену.
+ * @param size Размер блока в байтах.
+ * @param alignment Выравнивание блока; должно быть степенью двойки.
+ *
+ * @return Указатель на блок или `nullptr`, если аргументы некорректны
+ *         или не удалось выделить новый участок.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_arena_aligned_allocate(vi_arena_t *arena, vi_usize_t size, vi_usize_t alignment);
+
+/**
+ * @brief Выделяет блок с выравниванием `VI_ARENA_DEFAULT_ALIGNMENT`, заполненный нулями.
+ *
+ * Обнуляется только та часть блока, которая уже выдавалась ранее.
+ *
+ * @param arena Указатель на арену.
+ * @param size Размер блока в байтах.
+ *
+ * @return Указатель на блок или `nullptr`, если `arena` равен `nullptr`,
+ *         `size` равен 0 или не удалось выделить новый участок.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_arena_allocate_zeroed(vi_arena_t *arena, vi_usize_t size);
+
+/**
+ * @brief Возвращает маркер текущего состояния арены.
+ *
+ * @param arena Указатель на арену.
+ *
+ * @return Маркер, который можно передать в `vi_arena_restore`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_arena_marker_t
+vi_arena_save(const vi_arena_t *arena);
+
+/**
+ * @brief Возвращает арену к состоянию маркера.
+ *
+ * Все блоки, выделенные после сохранения маркера, становятся недействительными,
+ * а участки, созданные после него, возвращаются базовому распределителю.
+ * Маркеры восстанавливаются в порядке, обратном сохранению.
+ *
+ * @param arena Указатель на арену.
+ * @param marker Маркер, полученный от `vi_arena_save` для этой арены.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_arena_restore(vi_arena_t *arena, vi_arena_marker_t marker);
+
+/**
+ * @brief Освобождает все блоки арены.
+ *
+ * Самый старый участок сохраняется для повторного использования,
+ * остальные возвращаются базовому распределителю.
+ *
+ * @param arena Указатель на арену.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_arena_reset(vi_arena_t *arena);
+
+VI_COMPILER(EXTERN_C_END)
+
+#endif // VI_ARENA_H
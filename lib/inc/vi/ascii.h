@@ -0,0 +1,274 @@
+/**
+ * @file ascii.h
+ * @brief Табличная классификация символов ASCII.
+ *
+ * Этот файл содержит таблицу `vi_ascii_table` из 256 элементов, в которой каждому
+ * значению байта соответствует набор флагов `VI_ASCII_FLAG_*`. Таблица строится
+ * из имен символов `ascii_map.h`, а байты вне диапазона ASCII (0x80–0xFF)
+ * не имеют ни одного флага.
+ *
+ * Макросы `vi_ascii_is_*`, `vi_ascii_to_upper` и `vi_ascii_to_lower` выполняют одно
+ * чтение из таблицы без ветвлений. Флаги `VI_ASCII_FLAG_LOWER` и `VI_ASCII_FLAG_UPPER`
+ * расположены так, что после маскирования они равны разнице регистров (0x20)
+ * в младшем и старшем байтах флагов, поэтому смена регистра сводится к XOR.
+ *
+ * Для обработки буферов предназначены функции `vi_ascii_classify_n`
+ * и `vi_ascii_case_fold_n`, которые на процессорах x86 обрабатывают
+ * по 16 (SSE2) или 32 (AVX2) байта за шаг.
+ */
+
+#ifndef VI_ASCII_H
+#define VI_ASCII_H
+
+#include "char.h"
+#include "size.h"
+#include "numeric.h"
+#include "attribute.h"
+#include "ascii_map.h"
+
+/**
+ * @def VI_ASCII_FLAG_CONTROL
+ * @brief Управляющий символ (0x00–0x1F и 0x7F).
+ */
+#define VI_ASCII_FLAG_CONTROL 0x0001
+
+/**
+ * @def VI_ASCII_FLAG_SPACE
+ * @brief Пробельный символ (пробел, `\t`, `\n`, `\v`, `\f`, `\r`).
+ */
+#define VI_ASCII_FLAG_SPACE 0x0002
+
+/**
+ * @def VI_ASCII_FLAG_BLANK
+ * @brief Пробел или горизонтальная табуляция.
+ */
+#define VI_ASCII_FLAG_BLANK 0x0004
+
+/**
+ * @def VI_ASCII_FLAG_DIGIT
+ * @brief Десятичная цифра.
+ */
+#define VI_ASCII_FLAG_DIGIT 0x0008
+
+/**
+ * @def VI_ASCII_FLAG_PUNCT
+ * @brief Знак пунктуации (печатный символ, не являющийся буквой, цифрой или пробелом).
+ */
+#define VI_ASCII_FLAG_PUNCT 0x0010
+
+/**
+ * @def VI_ASCII_FLAG_LOWER
+ * @brief Строчная латинская буква.
+ *
+ * Значение равно разнице кодов строчной и заглавной буквы (0x20).
+ */
+#define VI_ASCII_FLAG_LOWER 0x0020
+
+/**
+ * @def VI_ASCII_FLAG_HEX
+ * @brief Шестнадцатеричная цифра.
+ */
+#define VI_ASCII_FLAG_HEX 0x0040
+
+/**
+ * @def VI_ASCII_FLAG_PRINT
+ * @brief Печатный символ, включая пробел (0x20–0x7E).
+ */
+#define VI_ASCII_FLAG_PRINT 0x0080
+
+/**
+ * @def VI_ASCII_FLAG_UPPER
+ * @brief Заглавная латинская буква.
+ *
+ * Значение равно разнице кодов строчной и заглавной буквы (0x20), сдвинутой на 8 бит.
+ */
+#define VI_ASCII_FLAG_UPPER 0x2000
+
+/**
+ * @def VI_ASCII_FLAG_ALPHA
+ * @brief Латинская буква любого регистра.
+ */
+#define VI_ASCII_FLAG_ALPHA (VI_ASCII_FLAG_LOWER | VI_ASCII_FLAG_UPPER)
+
+/**
+ * @def VI_ASCII_FLAG_ALNUM
+ * @brief Латинская буква или десятичная цифра.
+ */
+#define VI_ASCII_FLAG_ALNUM (VI_ASCII_FLAG_ALPHA | VI_ASCII_FLAG_DIGIT)
+
+/**
+ * @def VI_ASCII_FLAG_GRAPH
+ * @brief Печатный символ, кроме пробела.
+ */
+#define VI_ASCII_FLAG_GRAPH (VI_ASCII_FLAG_ALNUM | VI_ASCII_FLAG_PUNCT)
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @var vi_ascii_table
+ * @brief Таблица флагов `VI_ASCII_FLAG_*` для каждого значения байта.
+ */
+VI_ATTRIBUTE(SYMBOL)
+extern const vi_u16_t vi_ascii_table[256];
+
+VI_COMPILER(EXTERN_C_END)
+
+/**
+ * @def vi_ascii_flags
+ * @brief Возвращает флаги символа из таблицы `vi_ascii_table`.
+ *
+ * @param c Символ; приводится к `vi_u8_t`, поэтому знаковость `vi_char_t` не важна.
+ *
+ * @return Набор флагов `VI_ASCII_FLAG_*` типа `vi_u16_t`.
+ */
+#define vi_ascii_flags(c) (vi_ascii_table[(vi_u8_t)(c)])
+
+/**
+ * @def vi_ascii_is
+ * @brief Проверяет, имеет ли символ хотя бы один из заданных флагов.
+ *
+ * @param c Проверяемый символ.
+ * @param flags Комбинация флагов `VI_ASCII_FLAG_*`.
+ *
+ * @return `true`, если символ имеет хотя бы один из флагов, иначе `false`.
+ */
+#define vi_ascii_is(c, flags) ((vi_ascii_flags(c) & (flags)) != 0)
+
+/**
+ * @def vi_ascii_is_ascii
+ * @brief Проверяет, принадлежит ли символ диапазону ASCII (0x00–0x7F).
+ */
+#define vi_ascii_is_ascii(c) ((vi_u8_t)(c) < 0x80)
+
+/**
+ * @def vi_ascii_is_control
+ * @brief Проверяет, является ли символ управляющим.
+ */
+#define vi_ascii_is_control(c) vi_ascii_is(c, VI_ASCII_FLAG_CONTROL)
+
+/**
+ * @def vi_ascii_is_space
+ * @brief Проверяет, является ли символ пробельным.
+ */
+#define vi_ascii_is_space(c) vi_ascii_is(c, VI_ASCII_FLAG_SPACE)
+
+/**
+ * @def vi_ascii_is_blank
+ * @brief Проверяет, является ли символ пробелом или горизонтальной табуляцией.
+ */
+#define vi_ascii_is_blank(c) vi_ascii_is(c, VI_ASCII_FLAG_BLANK)
+
+/**
+ * @def vi_ascii_is_digit
+ * @brief Проверяет, является ли символ десятичной цифрой.
+ */
+#define vi_ascii_is_digit(c) vi_ascii_is(c, VI_ASCII_FLAG_DIGIT)
+
+/**
+ * @def vi_ascii_is_hex
+ * @brief Проверяет, является ли символ шестнадцатеричной цифрой.
+ */
+#define vi_ascii_is_hex(c) vi_ascii_is(c, VI_ASCII_FLAG_HEX)
+
+/**
+ * @def vi_ascii_is_lower
+ * @brief Проверяет, является ли символ строчной латинской буквой.
+ */
+#define vi_ascii_is_lower(c) vi_ascii_is(c, VI_ASCII_FLAG_LOWER)
+
+/**
+ * @def vi_ascii_is_upper
+ * @brief Проверяет, является ли символ заглавной латинской буквой.
+ */
+#define vi_ascii_is_upper(c) vi_ascii_is(c, VI_ASCII_FLAG_UPPER)
+
+/**
+ * @def vi_ascii_is_alpha
+ * @brief Проверяет, является ли символ латинской буквой.
+ */
+#define vi_ascii_is_alpha(c) vi_ascii_is(c, VI_ASCII_FLAG_ALPHA)
+
+/**
+ * @def vi_ascii_is_alnum
+ * @brief Проверяет, является ли символ латинской буквой или десятичной цифрой.
+ */
+#define vi_ascii_is_alnum(c) vi_ascii_is(c, VI_ASCII_FLAG_ALNUM)
+
+/**
+ * @def vi_ascii_is_punct
+ * @brief Проверяет, является ли символ знаком пунктуации.
+ */
+#define vi_ascii_is_punct(c) vi_ascii_is(c, VI_ASCII_FLAG_PUNCT)
+
+/**
+ * @def vi_ascii_is_print
+ * @brief Проверяет, является ли символ печатным (включая пробел).
+ */
+#define vi_ascii_is_print(c) vi_ascii_is(c, VI_ASCII_FLAG_PRINT)
+
+/**
+ * @def vi_ascii_is_graph
+ * @brief Проверяет, является ли символ печатным, кроме пробела.
+ */
+#define vi_ascii_is_graph(c) vi_ascii_is(c, VI_ASCII_FLAG_GRAPH)
+
+/**
+ * @def vi_ascii_to_upper
+ * @brief Преобразует строчную латинскую букву в заглавную.
+ *
+ * Остальные символы возвращаются без изменений.
+ *
+ * @return Преобразованный символ типа `vi_u8_t`.
+ */
+#define vi_ascii_to_upper(c) ((vi_u8_t)((vi_u8_t)(c) ^ (vi_ascii_flags(c) & VI_ASCII_FLAG_LOWER)))
+
+/**
+ * @def vi_ascii_to_lower
+ * @brief Преобразует заглавную латинскую букву в строчную.
+ *
+ * Остальные символы возвращаются без изменений.
+ *
+ * @return Преобразованный символ типа `vi_u8_t`.
+ */
+#define vi_ascii_to_lower(c)                                                                       \
+    ((vi_u8_t)((vi_u8_t)(c) ^ ((vi_ascii_flags(c) & VI_ASCII_FLAG_UPPER) >> 8)))
+
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Записывает флаги каждого символа буфера.
+ *
+ * Для каждого из `size` символов `src` записывает в `dst` значение, равное
+ * `vi_ascii_flags` этого символа. На x86 флаги вычисляются векторными сравнениями
+ * диапазонов по 16 или 32 символа за шаг.
+ *
+ * @param dst Указатель на массив из `size` элементов для записи флагов.
+ * @param src Указатель на классифицируемые символы.
+ * @param size Количество символов.
+ *
+ * @return Указатель `dst` или `nullptr`, если `dst` или `src` равен `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_u16_t *
+vi_ascii_classify_n(vi_u16_t *dst, const vi_char_t *src, vi_usize_t size);
+
+/**
+ * @brief Приводит заглавные латинские буквы буфера к строчным.
+ *
+ * Остальные символы копируются без изменений. Буферы могут совпадать.
+ *
+ * @param dst Указатель на буфер-приемник из `size` символов.
+ * @param src Указатель на исходные символы.
+ * @param size Количество символов.
+ *
+ * @return Указатель `dst` или `nullptr`, если `dst` или `src` равен `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_char_t *
+vi_ascii_case_fold_n(vi_char_t *dst, const vi_char_t *src, vi_usize_t size);
+
+VI_COMPILER(EXTERN_C_END)
+
+#endif // VI_ASCII_H
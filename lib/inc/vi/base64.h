@@ -0,0 +1,152 @@
+/**
+ * @file base64.h
+ * @brief Кодирование байтов в Base64 (RFC 4648).
+ *
+ * Этот файл содержит функции перевода участка байтов в Base64 со стандартным
+ * алфавитом (`+`, `/` и дополнение `=`) и с алфавитом, безопасным для URL и имен
+ * файлов (`-`, `_` без дополнения), а также обратного перевода. Функции не выделяют
+ * память и не записывают завершающий нуль.
+ *
+ * Скалярная реализация построена на таблицах из имен символов `ascii_map.h`.
+ * На процессорах x86 кодирование обрабатывает по 12 (SSSE3) или 24 (AVX2) байта,
+ * а декодирование — по 16 или 32 символа за шаг: 6-битные группы извлекаются
+ * умножениями, а символы переводятся перестановками `pshufb` по таблицам смещений.
+ * Реализация выбирается при загрузке библиотеки по `vi_cpu_has`.
+ *
+ * Декодирование принимает запись с дополнением и без него, но отклоняет
+ * неканоническую запись, в которой неиспользуемые биты последнего символа
+ * не равны нулю. При ошибке сообщается позиция первого недопустимого символа.
+ *
+ * Пример использования:
+ * @code
+ * vi_u8_t text[vi_base64_encoded_size(sizeof(key))];
+ * vi_usize_t length = vi_base64_encode(text, key, sizeof(key));
+ *
+ * vi_usize_t result;
+ * if (vi_base64_decode(key, text, length, &result) != VI_BASE64_SUCCESS)
+ * {
+ *     // result содержит позицию первого недопустимого символа
+ * }
+ * @endcode
+ *
+ * Основные функции:
+ * - vi_base64_encode: Записывает байты стандартным алфавитом с дополнением.
+ * - vi_base64_decode: Переводит запись стандартного алфавита в байты.
+ * - vi_base64_url_encode: Записывает байты алфавитом URL без дополнения.
+ * - vi_base64_url_decode: Переводит запись алфавита URL в байты.
+ */
+
+#ifndef VI_BASE64_H
+#define VI_BASE64_H
+
+#include "size.h"
+#include "return.h"
+#include "attribute.h"
+#include "numeric_fixed_types.h"
+
+/**
+ * @def vi_base64_encoded_size
+ * @brief Количество символов записи `size` байтов стандартным алфавитом с дополнением.
+ */
+#define vi_base64_encoded_size(size) (((size) + 2) / 3 * 4)
+
+/**
+ * @def vi_base64_url_encoded_size
+ * @brief Количество символов записи `size` байтов алфавитом URL без дополнения.
+ */
+#define vi_base64_url_encoded_size(size) (((size) * 4 + 2) / 3)
+
+/**
+ * @def vi_base64_decoded_size
+ * @brief Наибольшее количество байтов, получаемых из `size` символов записи.
+ *
+ * Для записи с дополнением результат больше фактического на количество знаков `=`.
+ */
+#define vi_base64_decoded_size(size) ((size) / 4 * 3 + (size) % 4 * 3 / 4)
+
+/**
+ * @def VI_BASE64_SUCCESS
+ * @brief Код успешного декодирования.
+ */
+#define VI_BASE64_SUCCESS ((vi_return_t)0)
+
+/**
+ * @def VI_BASE64_INVALID
+ * @brief Код ошибки декодирования: аргументы некорректны.
+ */
+#define VI_BASE64_INVALID ((vi_return_t)-1)
+
+/**
+ * @def VI_BASE64_BAD_CHARACTER
+ * @brief Код ошибки декодирования: символ не входит в алфавит, дополнение стоит
+ *        не на своем месте или неиспользуемые биты последнего символа не равны нулю.
+ */
+#define VI_BASE64_BAD_CHARACTER ((vi_return_t)-2)
+
+/**
+ * @def VI_BASE64_BAD_LENGTH
+ * @brief Код ошибки декодирования: последняя группа содержит один символ.
+ */
+#define VI_BASE64_BAD_LENGTH ((vi_return_t)-3)
+
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Записывает байты стандартным алфавитом Base64 с дополнением `=`.
+ *
+ * Буферы не должны перекрываться.
+ *
+ * @param dst Указатель на буфер размером не меньше `vi_base64_encoded_size(size)`.
+ * @param src Указатель на байты.
+ * @param size Количество байтов.
+ *
+ * @return Количество записанных символов или 0, если `dst` или `src` равен `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_base64_encode(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size);
+
+/**
+ * @brief Переводит запись стандартного алфавита Base64 в байты.
+ *
+ * Дополнение `=` необязательно, но если оно есть, длина записи должна быть кратна 4.
+ * При ошибке буфер `dst` может быть частично заполнен. Буферы не должны перекрываться.
+ *
+ * @param dst Указатель на буфер размером не меньше `vi_base64_decoded_size(size)`.
+ * @param src Указатель на запись.
+ * @param size Количество символов.
+ * @param result Указатель на количество записанных байтов при успехе или позицию
+ *               первого недопустимого символа при ошибке; может быть `nullptr`.
+ *
+ * @return `VI_BASE64_SUCCESS`, `VI_BASE64_INVALID`, если `dst` или `src` равен `nullptr`,
+ *         `VI_BASE64_BAD_CHARACTER` или `VI_BASE64_BAD_LENGTH`; в последнем случае
+ *         позицией считается единственный символ последней группы.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_return_t
+vi_base64_decode(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size, vi_usize_t *result);
+
+/**
+ * @brief Записывает байты алфавитом Base64 для URL без дополнения.
+ *
+ * Работает как `vi_base64_encode`; размер буфера `dst` должен быть не меньше
+ * `vi_base64_url_encoded_size(size)`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_base64_url_encode(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size);
+
+/**
+ * @brief Переводит запись алфавита Base64 для URL в байты.
+ *
+ * Работает как `vi_base64_decode`, в том числе принимает дополнение `=`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_return_t
+vi_base64_url_decode(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size, vi_usize_t *result);
+
+VI_COMPILER(EXTERN_C_END)
+
+#endif // VI_BASE64_H
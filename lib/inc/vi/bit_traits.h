@@ -10,6 +10,23 @@
  * Все макросы используют нумерацию битов, начиная с нуля (0 - младший бит).
  * Убедитесь, что индексы битов и значения не выходят за пределы
  * допустимого диапазона для типа данных, с которым вы работаете.
+ * Маски отдельных битов строятся из 64-битной единицы, поэтому макросы
+ * работают с индексами до 63 для операндов любой ширины.
+ *
+ * Для 8-, 16-, 32- и 64-битных беззнаковых значений файл также предоставляет подсчет
+ * ведущих и завершающих нулевых битов, подсчет установленных битов, перестановку байтов,
+ * двоичный логарифм и округление вверх до степени двойки. В GCC и Clang они
+ * отображаются на встроенные функции `__builtin_*`, которые компилируются в одну
+ * команду процессора; в MSVC и других компиляторах используются внутренние функции
+ * компилятора или переносимые реализации из `bit_traits.c`.
+ *
+ * Основные функции:
+ * - vi_bit_clz8/16/32/64: Возвращают количество ведущих нулевых битов.
+ * - vi_bit_ctz8/16/32/64: Возвращают количество завершающих нулевых битов.
+ * - vi_bit_popcount8/16/32/64: Возвращают количество установленных битов.
+ * - vi_bit_bswap16/32/64: Меняют порядок байтов на обратный.
+ * - vi_bit_log2_8/16/32/64: Возвращают двоичный логарифм, округленный вниз.
+ * - vi_bit_ceil_pow2_8/16/32/64: Округляют значение вверх до степени двойки.
  *
  * @note Все макросы определены в этом заголовочном файле
  *       и могут быть использованы в любом месте, где он подключен.
@@ -18,6 +35,14 @@
 #ifndef VI_BIT_TRAITS_H
 #define VI_BIT_TRAITS_H
 
+#include "compiler.h"
+#include "attribute.h"
+#include "numeric_fixed_types.h"
+
+#if VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC
+#    include <stdlib.h>
+#endif // VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC
+
 /**
  * @def vi_bit_is_single
  * @brief Проверяет, является ли заданное значение единственным битом.
@@ -45,7 +70,7 @@
  * @param x Значение, в котором будет установлен указанный бит.
  * @return Возвращает новое значение `x` с установленным битом.
  */
-#define vi_bit_set(bit, x) ((x) | (1 << (bit)))
+#define vi_bit_set(bit, x) ((x) | (1ULL << (bit)))
 
 /**
  * @def vi_bit_clear
@@ -59,7 +84,7 @@
  * @param x Значение, в котором будет очищен указанный бит.
  * @return Возвращает новое значение `x` с очищенным битом.
  */
-#define vi_bit_clear(bit, x) ((x) & ~(1 << (bit)))
+#define vi_bit_clear(bit, x) ((x) & ~(1ULL << (bit)))
 
 /**
  * @def vi_bit_toggle
@@ -73,7 +98,7 @@
  * @param x Значение, в котором будет переключен указанный бит.
  * @return Возвращает новое значение `x` с переключенным битом.
  */
-#define vi_bit_toggle(bit, x) ((x) ^ (1 << (bit)))
+#define vi_bit_toggle(bit, x) ((x) ^ (1ULL << (bit)))
 
 /**
  * @def vi_bit_check
@@ -88,7 +113,7 @@
  * @param x Значение, в котором будет проверяться указанный бит.
  * @return Возвращает 1, если бит установлен, и 0, если бит не установлен.
  */
-#define vi_bit_check(bit, x) (((x) & (1 << (bit))) != 0)
+#define vi_bit_check(bit, x) (((x) & (1ULL << (bit))) != 0)
 
 /**
  * @def vi_bit_mask
@@ -97,10 +122,10 @@
  * Данный макрос создает маску битов длиной `num_bits`.
  * Маска состоит из единиц в положении битов с 0 по `num_bits - 1` и нулей в остальных битах.
  *
- * @param num_bits Длина маски битов, которую необходимо создать.
+ * @param num_bits Длина маски битов, которую необходимо создать (от 0 до 63).
  * @return Возвращает маску битов длиной `num_bits`.
  */
-#define vi_bit_mask(num_bits) ((1 << (num_bits)) - 1)
+#define vi_bit_mask(num_bits) ((1ULL << (num_bits)) - 1)
 
 /**
  * @def vi_bit_is_even
@@ -160,13 +185,18 @@
  * Циклический сдвиг влево означает, что биты, которые выходят за пределы
  * самого значимого бита, возвращаются в младшие биты.
  *
+ * Величина сдвига берется по модулю ширины типа, поэтому сдвиг на 0 корректен.
+ * Компиляторы распознают это выражение и заменяют его одной командой циклического сдвига.
+ *
  * @param x Число, которое необходимо сдвинуть.
  * @param n Количество битов, на которое нужно сдвинуть число влево.
  * @return Результат циклического сдвига числа `x` влево на `n` битов.
  *
- * @warning Убедитесь, что значение `n` не превышает количество битов в типе `x`.
+ * @warning Тип `x` должен быть беззнаковым и не уже `int`: более узкие типы
+ *          расширяются до `int`, и результат придется привести обратно к типу `x`.
  */
-#define vi_bit_rotate_left(x, n) (((x) << (n)) | ((x) >> (sizeof(x) * 8 - (n))))
+#define vi_bit_rotate_left(x, n)                                                                   \
+    (((x) << ((n) & (sizeof(x) * 8 - 1))) | ((x) >> ((0U - (n)) & (sizeof(x) * 8 - 1))))
 
 /**
  * @def vi_bit_rotate_right
@@ -176,13 +206,17 @@
  * Циклический сдвиг вправо означает, что биты, которые выходят за пределы
  * младшего бита, возвращаются в старшие биты.
  *
+ * Величина сдвига берется по модулю ширины типа, поэтому сдвиг на 0 корректен.
+ *
  * @param x Число, которое необходимо сдвинуть.
  * @param n Количество битов, на которое нужно сдвинуть число вправо.
  * @return Результат циклического сдвига числа `x` вправо на `n` битов.
  *
- * @warning Убедитесь, что значение `n` не превышает количество битов в типе `x`.
+ * @warning Тип `x` должен быть беззнаковым и не уже `int`: более узкие типы
+ *          расширяются до `int`, и результат придется привести обратно к типу `x`.
  */
-#define vi_bit_rotate_right(x, n) (((x) >> (n)) | ((x) << (sizeof(x) * 8 - (n))))
+#define vi_bit_rotate_right(x, n)                                                                  \
+    (((x) >> ((n) & (sizeof(x) * 8 - 1))) | ((x) << ((0U - (n)) & (sizeof(x) * 8 - 1))))
 
 /**
  * @def vi_bit_set_by_index
@@ -271,6 +305,340 @@
  * @warning Убедитесь, что значение `i` не превышает количество битов в типе `x`.
  *          Значение `n` должно быть равно 0 или 1.
  */
-#define vi_bit_change_by_index(x, i, n) ((x) = ((x) & ~(1ULL << (i))) | ((n) << (i)))
+#define vi_bit_change_by_index(x, i, n) ((x) = ((x) & ~(1ULL << (i))) | ((vi_u64_t)(n) << (i)))
+
+// ------------------------------------- Подсчет битов ---------------------------------------- //
+
+#if (VI_COMPILER_TYPE == VI_COMPILER_TYPE_GCC) || (VI_COMPILER_TYPE == VI_COMPILER_TYPE_CLANG)
+/**
+ * @def vi_bit_clz32
+ * @brief Возвращает количество ведущих нулевых битов 32-битного значения.
+ *
+ * @param x Значение; должно быть отлично от 0.
+ * @return Количество нулевых битов перед старшим установленным битом.
+ *
+ * @warning Результат для 0 не определен, как и у соответствующих команд процессора.
+ */
+#    define vi_bit_clz32(x) __builtin_clz((vi_u32_t)(x))
+
+/**
+ * @def vi_bit_clz64
+ * @brief Возвращает количество ведущих нулевых битов 64-битного значения.
+ *
+ * @param x Значение; должно быть отлично от 0.
+ * @return Количество нулевых битов перед старшим установленным битом.
+ */
+#    define vi_bit_clz64(x) __builtin_clzll((vi_u64_t)(x))
+
+/**
+ * @def vi_bit_ctz32
+ * @brief Возвращает количество завершающих нулевых битов 32-битного значения.
+ *
+ * @param x Значение; должно быть отлично от 0.
+ * @return Номер младшего установленного бита.
+ *
+ * @warning Результат для 0 не определен, как и у соответствующих команд процессора.
+ */
+#    define vi_bit_ctz32(x) __builtin_ctz((vi_u32_t)(x))
+
+/**
+ * @def vi_bit_ctz64
+ * @brief Возвращает количество завершающих нулевых битов 64-битного значения.
+ *
+ * @param x Значение; должно быть отлично от 0.
+ * @return Номер младшего установленного бита.
+ */
+#    define vi_bit_ctz64(x) __builtin_ctzll((vi_u64_t)(x))
+
+/**
+ * @def vi_bit_popcount32
+ * @brief Возвращает количество установленных битов 32-битного значения.
+ */
+#    define vi_bit_popcount32(x) __builtin_popcount((vi_u32_t)(x))
+
+/**
+ * @def vi_bit_popcount64
+ * @brief Возвращает количество установленных битов 64-битного значения.
+ */
+#    define vi_bit_popcount64(x) __builtin_popcountll((vi_u64_t)(x))
+
+/**
+ * @def vi_bit_bswap16
+ * @brief Меняет порядок байтов 16-битного значения на обратный.
+ */
+#    define vi_bit_bswap16(x) __builtin_bswap16((vi_u16_t)(x))
+
+/**
+ * @def vi_bit_bswap32
+ * @brief Меняет порядок байтов 32-битного значения на обратный.
+ */
+#    define vi_bit_bswap32(x) __builtin_bswap32((vi_u32_t)(x))
+
+/**
+ * @def vi_bit_bswap64
+ * @brief Меняет порядок байтов 64-битного значения на обратный.
+ */
+#    define vi_bit_bswap64(x) __builtin_bswap64((vi_u64_t)(x))
+#else
+/**
+ * @def vi_bit_clz32
+ * @brief Возвращает количество ведущих нулевых битов 32-битного значения.
+ *
+ * @warning Результат для 0 не определен.
+ */
+#    define vi_bit_clz32(x) vi_bit_clz32_portable((vi_u32_t)(x))
+
+/**
+ * @def vi_bit_clz64
+ * @brief Возвращает количество ведущих нулевых битов 64-битного значения.
+ */
+#    define vi_bit_clz64(x) vi_bit_clz64_portable((vi_u64_t)(x))
+
+/**
+ * @def vi_bit_ctz32
+ * @brief Возвращает количество завершающих нулевых битов 32-битного значения.
+ *
+ * @warning Результат для 0 не определен.
+ */
+#    define vi_bit_ctz32(x) vi_bit_ctz32_portable((vi_u32_t)(x))
+
+/**
+ * @def vi_bit_ctz64
+ * @brief Возвращает количество завершающих нулевых битов 64-битного значения.
+ */
+#    define vi_bit_ctz64(x) vi_bit_ctz64_portable((vi_u64_t)(x))
+
+/**
+ * @def vi_bit_popcount32
+ * @brief Возвращает количество установленных битов 32-битного значения.
+ */
+#    define vi_bit_popcount32(x) vi_bit_popcount32_portable((vi_u32_t)(x))
+
+/**
+ * @def vi_bit_popcount64
+ * @brief Возвращает количество установленных битов 64-битного значения.
+ */
+#    define vi_bit_popcount64(x) vi_bit_popcount64_portable((vi_u64_t)(x))
+
+#    if VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC
+/**
+ * @def vi_bit_bswap16
+ * @brief Меняет порядок байтов 16-битного значения на обратный.
+ */
+#        define vi_bit_bswap16(x) ((vi_u16_t)_byteswap_ushort((vi_u16_t)(x)))
+
+/**
+ * @def vi_bit_bswap32
+ * @brief Меняет порядок байтов 32-битного значения на обратный.
+ */
+#        define vi_bit_bswap32(x) ((vi_u32_t)_byteswap_ulong((vi_u32_t)(x)))
+
+/**
+ * @def vi_bit_bswap64
+ * @brief Меняет порядок байтов 64-битного значения на обратный.
+ */
+#        define vi_bit_bswap64(x) ((vi_u64_t)_byteswap_uint64((vi_u64_t)(x)))
+#    else
+/**
+ * @def vi_bit_bswap16
+ * @brief Меняет порядок байтов 16-битного значения на обратный.
+ */
+#        define vi_bit_bswap16(x) ((vi_u16_t)(((vi_u16_t)(x) >> 8) | ((vi_u16_t)(x) << 8)))
+
+/**
+ * @def vi_bit_bswap32
+ * @brief Меняет порядок байтов 32-битного значения на обратный.
+ */
+#        define vi_bit_bswap32(x) vi_bit_bswap32_portable((vi_u32_t)(x))
+
+/**
+ * @def vi_bit_bswap64
+ * @brief Меняет порядок байтов 64-битного значения на обратный.
+ */
+#        define vi_bit_bswap64(x) vi_bit_bswap64_portable((vi_u64_t)(x))
+#    endif // VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC
+#endif // (VI_COMPILER_TYPE == VI_COMPILER_TYPE_GCC) || (VI_COMPILER_TYPE == VI_COMPILER_TYPE_CLANG)
+
+/**
+ * @def vi_bit_clz8
+ * @brief Возвращает количество ведущих нулевых битов 8-битного значения.
+ *
+ * @warning Результат для 0 не определен.
+ */
+#define vi_bit_clz8(x) (vi_bit_clz32((vi_u8_t)(x)) - 24)
+
+/**
+ * @def vi_bit_clz16
+ * @brief Возвращает количество ведущих нулевых битов 16-битного значения.
+ *
+ * @warning Результат для 0 не определен.
+ */
+#define vi_bit_clz16(x) (vi_bit_clz32((vi_u16_t)(x)) - 16)
+
+/**
+ * @def vi_bit_ctz8
+ * @brief Возвращает количество завершающих нулевых битов 8-битного значения.
+ *
+ * @warning Результат для 0 не определен.
+ */
+#define vi_bit_ctz8(x) vi_bit_ctz32((vi_u8_t)(x))
+
+/**
+ * @def vi_bit_ctz16
+ * @brief Возвращает количество завершающих нулевых битов 16-битного значения.
+ *
+ * @warning Результат для 0 не определен.
+ */
+#define vi_bit_ctz16(x) vi_bit_ctz32((vi_u16_t)(x))
+
+/**
+ * @def vi_bit_popcount8
+ * @brief Возвращает количество установленных битов 8-битного значения.
+ */
+#define vi_bit_popcount8(x) vi_bit_popcount32((vi_u8_t)(x))
+
+/**
+ * @def vi_bit_popcount16
+ * @brief Возвращает количество установленных битов 16-битного значения.
+ */
+#define vi_bit_popcount16(x) vi_bit_popcount32((vi_u16_t)(x))
+
+/**
+ * @def vi_bit_log2_8
+ * @brief Возвращает двоичный логарифм 8-битного значения, округленный вниз.
+ *
+ * @warning Результат для 0 не определен.
+ */
+#define vi_bit_log2_8(x) (7 - vi_bit_clz8(x))
+
+/**
+ * @def vi_bit_log2_16
+ * @brief Возвращает двоичный логарифм 16-битного значения, округленный вниз.
+ *
+ * @warning Результат для 0 не определен.
+ */
+#define vi_bit_log2_16(x) (15 - vi_bit_clz16(x))
+
+/**
+ * @def vi_bit_log2_32
+ * @brief Возвращает двоичный логарифм 32-битного значения, округленный вниз.
+ *
+ * Равен номеру старшего установленного бита.
+ *
+ * @warning Результат для 0 не определен.
+ */
+#define vi_bit_log2_32(x) (31 - vi_bit_clz32(x))
+
+/**
+ * @def vi_bit_log2_64
+ * @brief Возвращает двоичный логарифм 64-битного значения, округленный вниз.
+ *
+ * Равен номеру старшего установленного бита.
+ *
+ * @warning Результат для 0 не определен.
+ */
+#define vi_bit_log2_64(x) (63 - vi_bit_clz64(x))
+
+/**
+ * @def vi_bit_ceil_pow2_8
+ * @brief Возвращает наименьшую степень двойки, не меньшую 8-битного значения `x`.
+ *
+ * @return Степень двойки; 1 для 0 и 1; 0, если результат не помещается в тип.
+ */
+#define vi_bit_ceil_pow2_8(x)                                                                      \
+    ((vi_u8_t)((vi_u8_t)(x) <= 1 ? 1 : (vi_u8_t)2 << vi_bit_log2_8((vi_u8_t)(x) - 1)))
+
+/**
+ * @def vi_bit_ceil_pow2_16
+ * @brief Возвращает наименьшую степень двойки, не меньшую 16-битного значения `x`.
+ *
+ * @return Степень двойки; 1 для 0 и 1; 0, если результат не помещается в тип.
+ */
+#define vi_bit_ceil_pow2_16(x)                                                                     \
+    ((vi_u16_t)((vi_u16_t)(x) <= 1 ? 1 : (vi_u16_t)2 << vi_bit_log2_16((vi_u16_t)(x) - 1)))
+
+/**
+ * @def vi_bit_ceil_pow2_32
+ * @brief Возвращает наименьшую степень двойки, не меньшую 32-битного значения `x`.
+ *
+ * Используется для округления размеров и емкостей. Значение `x` вычисляется дважды.
+ *
+ * @return Степень двойки; 1 для 0 и 1; 0, если результат не помещается в тип.
+ */
+#define vi_bit_ceil_pow2_32(x)                                                                     \
+    ((vi_u32_t)((vi_u32_t)(x) <= 1 ? 1 : (vi_u32_t)2 << vi_bit_log2_32((vi_u32_t)(x) - 1)))
+
+/**
+ * @def vi_bit_ceil_pow2_64
+ * @brief Возвращает наименьшую степень двойки, не меньшую 64-битного значения `x`.
+ *
+ * Используется для округления размеров и емкостей. Значение `x` вычисляется дважды.
+ *
+ * @return Степень двойки; 1 для 0 и 1; 0, если результат не помещается в тип.
+ */
+#define vi_bit_ceil_pow2_64(x)                                                                     \
+    ((vi_u64_t)((vi_u64_t)(x) <= 1 ? 1 : (vi_u64_t)2 << vi_bit_log2_64((vi_u64_t)(x) - 1)))
+
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Переносимая реализация `vi_bit_clz32`; результат для 0 равен 32.
+ */
+VI_ATTRIBUTE(SYMBOL)
+int
+vi_bit_clz32_portable(vi_u32_t x);
+
+/**
+ * @brief Переносимая реализация `vi_bit_clz64`; результат для 0 равен 64.
+ */
+VI_ATTRIBUTE(SYMBOL)
+int
+vi_bit_clz64_portable(vi_u64_t x);
+
+/**
+ * @brief Переносимая реализация `vi_bit_ctz32`; результат для 0 равен 32.
+ */
+VI_ATTRIBUTE(SYMBOL)
+int
+vi_bit_ctz32_portable(vi_u32_t x);
+
+/**
+ * @brief Переносимая реализация `vi_bit_ctz64`; результат для 0 равен 64.
+ */
+VI_ATTRIBUTE(SYMBOL)
+int
+vi_bit_ctz64_portable(vi_u64_t x);
+
+/**
+ * @brief Переносимая реализация `vi_bit_popcount32`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+int
+vi_bit_popcount32_portable(vi_u32_t x);
+
+/**
+ * @brief Переносимая реализация `vi_bit_popcount64`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+int
+vi_bit_popcount64_portable(vi_u64_t x);
+
+/**
+ * @brief Переносимая реализация `vi_bit_bswap32`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_u32_t
+vi_bit_bswap32_portable(vi_u32_t x);
+
+/**
+ * @brief Переносимая реализация `vi_bit_bswap64`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_u64_t
+vi_bit_bswap64_portable(vi_u64_t x);
+
+VI_COMPILER(EXTERN_C_END)
 
 #endif // VI_BIT_TRAITS_H
@@ -0,0 +1,242 @@
+/**
+ * @file bitset.h
+ * @brief Плотный набор битов фиксированного размера.
+ *
+ * Этот файл содержит структуру `vi_bitset_t` — массив битов, упакованных в 64-битные
+ * слова. Набор подходит для учета занятых ячеек больших таблиц и пулов: поиск
+ * свободной ячейки пропускает целые слова, в которых нет подходящих битов, и находит
+ * нужный бит командами подсчета нулевых битов из `bit_traits.h`.
+ *
+ * Биты за пределами размера набора в последнем слове всегда равны нулю, поэтому
+ * поиск и подсчет битов не маскируют последнее слово. Побитовые операции над целыми
+ * наборами обрабатывают слова векторными командами SSE2 или AVX2, если они доступны.
+ *
+ * Функции `vi_bitset_acquire` и `vi_bitset_release` превращают набор в распределитель
+ * номеров: установленный бит означает занятую ячейку.
+ *
+ * Основные функции:
+ * - vi_bitset_init: Инициализирует набор заданного размера.
+ * - vi_bitset_destroy: Освобождает память набора.
+ * - vi_bitset_set, vi_bitset_clear, vi_bitset_test: Работают с отдельным битом.
+ * - vi_bitset_fill: Устанавливает или сбрасывает диапазон битов.
+ * - vi_bitset_find_first_set: Ищет первый установленный бит, начиная с позиции.
+ * - vi_bitset_find_first_clear: Ищет первый сброшенный бит, начиная с позиции.
+ * - vi_bitset_count: Подсчитывает установленные биты диапазона.
+ * - vi_bitset_and, vi_bitset_or, vi_bitset_xor: Объединяют два набора.
+ * - vi_bitset_acquire: Находит сброшенный бит и устанавливает его.
+ * - vi_bitset_release: Сбрасывает бит, занятый `vi_bitset_acquire`.
+ */
+
+#ifndef VI_BITSET_H
+#define VI_BITSET_H
+
+#include "allocator.h"
+#include "bit_traits.h"
+
+/**
+ * @def VI_BITSET_NPOS
+ * @brief Результат поиска, не нашедшего подходящий бит.
+ */
+#define VI_BITSET_NPOS VI_USIZE_T_MAX
+
+/**
+ * @brief Набор битов.
+ */
+typedef struct vi_bitset_t
+{
+    /**
+     * @brief Распределитель памяти набора.
+     */
+    const vi_allocator_t *allocator;
+
+    /**
+     * @brief Слова набора или `nullptr` для пустого набора; бит `i` хранится
+     *        в бите `i % 64` слова `i / 64`.
+     */
+    vi_u64_t *words;
+
+    /**
+     * @brief Количество битов.
+     */
+    vi_usize_t size;
+
+    /**
+     * @brief Количество слов.
+     */
+    vi_usize_t word_count;
+} vi_bitset_t;
+
+/**
+ * @def vi_bitset_size
+ * @brief Возвращает количество битов в наборе.
+ */
+#define vi_bitset_size(set) ((set)->size)
+
+/**
+ * @def vi_bitset_set
+ * @brief Устанавливает бит `index`; индекс должен быть меньше размера набора.
+ */
+#define vi_bitset_set(set, index) vi_bit_set_by_index((set)->words[(index) >> 6], (index) & 63)
+
+/**
+ * @def vi_bitset_clear
+ * @brief Сбрасывает бит `index`; индекс должен быть меньше размера набора.
+ */
+#define vi_bitset_clear(set, index) vi_bit_clear_by_index((set)->words[(index) >> 6], (index) & 63)
+
+/**
+ * @def vi_bitset_test
+ * @brief Возвращает `true`, если бит `index` установлен; индекс должен быть
+ *        меньше размера набора.
+ */
+#define vi_bitset_test(set, index)                                                                 \
+    (vi_bit_check_by_index((set)->words[(index) >> 6], (index) & 63) != 0)
+
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Инициализирует набор, в котором все биты сброшены.
+ *
+ * @param set Указатель на инициализируемый набор.
+ * @param allocator Распределитель памяти или `nullptr` для распределителя
+ *                  времени выполнения, действующего в момент инициализации.
+ * @param size Количество битов; 0 создает пустой набор без памяти.
+ *
+ * @return `true` при успехе или `false`, если `set` равен `nullptr`,
+ *         распределитель недействителен или память не удалось выделить.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_bitset_init(vi_bitset_t *set, const vi_allocator_t *allocator, vi_usize_t size);
+
+/**
+ * @brief Освобождает память набора.
+ *
+ * После вызова набор пуст.
+ *
+ * @param set Указатель на набор или `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_bitset_destroy(vi_bitset_t *set);
+
+/**
+ * @brief Устанавливает или сбрасывает `count` битов, начиная с `index`.
+ *
+ * Диапазон, выходящий за пределы набора, обрезается.
+ *
+ * @param set Указатель на набор.
+ * @param index Номер первого бита диапазона.
+ * @param count Количество битов.
+ * @param value `true` для установки битов, `false` для сброса.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_bitset_fill(vi_bitset_t *set, vi_usize_t index, vi_usize_t count, bool value);
+
+/**
+ * @brief Ищет первый установленный бит с номером не меньше `from`.
+ *
+ * @param set Указатель на набор.
+ * @param from Номер бита, с которого начинается поиск.
+ *
+ * @return Номер найденного бита или `VI_BITSET_NPOS`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_bitset_find_first_set(const vi_bitset_t *set, vi_usize_t from);
+
+/**
+ * @brief Ищет первый сброшенный бит с номером не меньше `from`.
+ *
+ * @param set Указатель на набор.
+ * @param from Номер бита, с которого начинается поиск.
+ *
+ * @return Номер найденного бита или `VI_BITSET_NPOS`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_bitset_find_first_clear(const vi_bitset_t *set, vi_usize_t from);
+
+/**
+ * @brief Подсчитывает установленные биты среди `count` битов, начиная с `index`.
+ *
+ * Диапазон, выходящий за пределы набора, обрезается.
+ *
+ * @param set Указатель на набор.
+ * @param index Номер первого бита диапазона.
+ * @param count Количество битов.
+ *
+ * @return Количество установленных битов.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_bitset_count(const vi_bitset_t *set, vi_usize_t index, vi_usize_t count);
+
+/**
+ * @brief Заменяет `dst` побитовым И `dst` и `src`.
+ *
+ * @param dst Указатель на изменяемый набор.
+ * @param src Указатель на второй набор.
+ *
+ * @return `true` при успехе или `false`, если размеры наборов различаются.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_bitset_and(vi_bitset_t *dst, const vi_bitset_t *src);
+
+/**
+ * @brief Заменяет `dst` побитовым ИЛИ `dst` и `src`.
+ *
+ * @param dst Указатель на изменяемый набор.
+ * @param src Указатель на второй набор.
+ *
+ * @return `true` при успехе или `false`, если размеры наборов различаются.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_bitset_or(vi_bitset_t *dst, const vi_bitset_t *src);
+
+/**
+ * @brief Заменяет `dst` побитовым исключающим ИЛИ `dst` и `src`.
+ *
+ * @param dst Указатель на изменяемый набор.
+ * @param src Указатель на второй набор.
+ *
+ * @return `true` при успехе или `false`, если размеры наборов различаются.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_bitset_xor(vi_bitset_t *dst, const vi_bitset_t *src);
+
+/**
+ * @brief Находит сброшенный бит и устанавливает его.
+ *
+ * Поиск начинается с `hint` и при необходимости продолжается с начала набора.
+ * Передача номера, следующего за последним занятым, сохраняет поиск коротким
+ * при последовательном заполнении.
+ *
+ * @param set Указатель на набор.
+ * @param hint Номер бита, с которого начинается поиск.
+ *
+ * @return Номер занятого бита или `VI_BITSET_NPOS`, если все биты установлены.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_bitset_acquire(vi_bitset_t *set, vi_usize_t hint);
+
+/**
+ * @brief Сбрасывает бит, занятый `vi_bitset_acquire`.
+ *
+ * @param set Указатель на набор.
+ * @param index Номер бита; номера за пределами набора игнорируются.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_bitset_release(vi_bitset_t *set, vi_usize_t index);
+
+VI_COMPILER(EXTERN_C_END)
+
+#endif // VI_BITSET_H
@@ -16,6 +16,7 @@
  * - `compiler_destructor.h`: Определяет атрибуты для вызова деструкторов.
  * - `compiler_constructor.h`: Определяет атрибуты для вызова конструкторов.
  * - `compiler_std_version.h`: Определяет используемую версию стандарта C.
+ * - `compiler_simd.h`: Определяет доступные компилятору векторные расширения.
  *
  * @note Использование этого заголовка упрощает кроссплатформенную разработку,
  *       обеспечивая консистентность и удобство при работе с различными компиляторами.
@@ -29,6 +30,7 @@
 #include "compiler_constructor.h"
 #include "compiler_destructor.h"
 #include "compiler_extern_c.h"
+#include "compiler_simd.h"
 #include "compiler_std_version.h"
 #include "compiler_version.h"
 
@@ -12,6 +12,10 @@
  *    Определения встроенных функций компилятора.
  * - `compiler_attribute_symbol.h`:
  *    Атрибуты для управления экспортом и импортом символов.
+ * - `compiler_attribute_may_alias.h`:
+ *    Атрибут для снятия ограничений строгих псевдонимов с типа.
+ * - `compiler_attribute_noreturn.h`:
+ *    Атрибут для функций, не возвращающих управление.
  * - `compiler_attribute_unused.h`:
  *    Атрибуты для пометки неиспользуемых переменных и функций.
  * - `compiler_attribute_thread_local.h`:
@@ -26,6 +30,8 @@
 #define VI_COMPILER_ATTRIBUTE_H
 
 #include "compiler_attribute_builtin.h"
+#include "compiler_attribute_may_alias.h"
+#include "compiler_attribute_noreturn.h"
 #include "compiler_attribute_symbol.h"
 #include "compiler_attribute_thread_local.h"
 #include "compiler_attribute_unused.h"
@@ -0,0 +1,55 @@
+/**
+ * @file compiler_attribute_may_alias.h
+ * @brief Определение атрибута, разрешающего псевдонимы для типов.
+ *
+ * Этот файл предоставляет макрос `VI_COMPILER_ATTRIBUTE_MAY_ALIAS`, который снимает
+ * с типа ограничения правила строгих псевдонимов (strict aliasing). Это позволяет
+ * безопасно читать и записывать произвольную память словами (например, `vi_u64_t`)
+ * в пословных алгоритмах заполнения, копирования и поиска.
+ *
+ * Поддерживаемые компиляторы:
+ * - GCC и Clang: атрибут `__attribute__((may_alias))`
+ * - MSVC: компилятор не применяет оптимизации на основе строгих псевдонимов,
+ *         поэтому атрибут определяется как пустой.
+ *
+ * @note На неподдерживаемых компиляторах макрос
+ *       определяется как пустой и выводится предупреждение.
+ */
+
+#ifndef VI_COMPILER_ATTRIBUTE_MAY_ALIAS_H
+#define VI_COMPILER_ATTRIBUTE_MAY_ALIAS_H
+
+#include "compiler_type.h"
+
+#if (VI_COMPILER_TYPE == VI_COMPILER_TYPE_GCC) || (VI_COMPILER_TYPE == VI_COMPILER_TYPE_CLANG)
+/**
+ * @def VI_COMPILER_ATTRIBUTE_MAY_ALIAS
+ * @brief Разрешает типу быть псевдонимом любого другого типа в GCC/Clang.
+ * @details Доступ к памяти через тип с этим атрибутом рассматривается компилятором
+ *          так же, как доступ через `char`, и не нарушает правило строгих псевдонимов.
+ */
+#    define VI_COMPILER_ATTRIBUTE_MAY_ALIAS __attribute__((may_alias))
+
+#elif (VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC)
+/**
+ * @def VI_COMPILER_ATTRIBUTE_MAY_ALIAS
+ * @brief Пустой атрибут для MSVC.
+ * @details MSVC не использует правило строгих псевдонимов для оптимизаций,
+ *          поэтому дополнительная пометка типа не требуется.
+ */
+#    define VI_COMPILER_ATTRIBUTE_MAY_ALIAS
+
+#else
+/**
+ * @def VI_COMPILER_ATTRIBUTE_MAY_ALIAS
+ * @brief Заглушка для компиляторов, не поддерживающих атрибут 'may_alias'.
+ *
+ * @warning На таких компиляторах пословный доступ к памяти
+ *          может нарушать правило строгих псевдонимов.
+ */
+#    define VI_COMPILER_ATTRIBUTE_MAY_ALIAS
+
+#    pragma message("Warning: Compiler does not support may_alias attribute")
+#endif
+
+#endif // VI_COMPILER_ATTRIBUTE_MAY_ALIAS_H
@@ -0,0 +1,52 @@
+/**
+ * @file compiler_attribute_noreturn.h
+ * @brief Определение атрибута для функций, не возвращающих управление.
+ *
+ * Этот файл предоставляет макрос `VI_COMPILER_ATTRIBUTE_NORETURN`, которым помечаются
+ * функции, завершающиеся нелокальным переходом или завершением программы. Компилятор
+ * не ожидает возврата из таких функций, поэтому не выдает предупреждений о пропущенном
+ * возвращаемом значении после их вызова и не генерирует недостижимый код.
+ *
+ * Поддерживаемые компиляторы:
+ * - GCC и Clang: атрибут `__attribute__((noreturn))`
+ * - MSVC: спецификатор `__declspec(noreturn)`
+ *
+ * Атрибут записывается перед объявлением функции, поэтому подходит и для C, и для C++.
+ *
+ * @note На неподдерживаемых компиляторах макрос
+ *       определяется как пустой и выводится предупреждение.
+ */
+
+#ifndef VI_COMPILER_ATTRIBUTE_NORETURN_H
+#define VI_COMPILER_ATTRIBUTE_NORETURN_H
+
+#include "compiler_type.h"
+
+#if (VI_COMPILER_TYPE == VI_COMPILER_TYPE_GCC) || (VI_COMPILER_TYPE == VI_COMPILER_TYPE_CLANG)
+/**
+ * @def VI_COMPILER_ATTRIBUTE_NORETURN
+ * @brief Помечает функцию как не возвращающую управление в GCC/Clang.
+ */
+#    define VI_COMPILER_ATTRIBUTE_NORETURN __attribute__((noreturn))
+
+#elif (VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC)
+/**
+ * @def VI_COMPILER_ATTRIBUTE_NORETURN
+ * @brief Помечает функцию как не возвращающую управление в MSVC.
+ */
+#    define VI_COMPILER_ATTRIBUTE_NORETURN __declspec(noreturn)
+
+#else
+/**
+ * @def VI_COMPILER_ATTRIBUTE_NORETURN
+ * @brief Заглушка для компиляторов, не поддерживающих атрибут 'noreturn'.
+ *
+ * @warning На таких компиляторах возможны предупреждения о пропущенном
+ *          возвращаемом значении после вызова помеченных функций.
+ */
+#    define VI_COMPILER_ATTRIBUTE_NORETURN
+
+#    pragma message("Warning: Compiler does not support noreturn attribute")
+#endif
+
+#endif // VI_COMPILER_ATTRIBUTE_NORETURN_H
@@ -0,0 +1,88 @@
+/**
+ * @file compiler_simd.h
+ * @brief Определение доступных компилятору векторных расширений процессора.
+ *
+ * Этот файл предоставляет макросы, описывающие, какие наборы SIMD-инструкций
+ * компилятор может использовать при сборке библиотеки:
+ *
+ * - `VI_COMPILER_SIMD_SSE2`:
+ *    SSE2 включен для всей единицы трансляции (базовый набор для x86-64).
+ * - `VI_COMPILER_SIMD_SSSE3`:
+ *    Компилятор умеет генерировать отдельные функции с SSSE3 без
+ *    глобального флага `-mssse3`, используя атрибут цели.
+ * - `VI_COMPILER_SIMD_AVX2`:
+ *    Компилятор умеет генерировать отдельные функции с AVX2 без
+ *    глобального флага `-mavx2`, используя атрибут цели.
+ * - `VI_COMPILER_SIMD_TARGET(N)`:
+ *    Атрибут, разрешающий функции использовать набор инструкций `N`.
+ *
+ * Макросы описывают только возможности компилятора. Наличие инструкций у процессора,
+ * на котором выполняется код, проверяется во время загрузки библиотеки функцией
+ * `vi_cpu_has` из `cpu.h`, прежде чем выбрать соответствующую реализацию.
+ *
+ * @note На платформах без поддержки x86 SIMD все макросы
+ *       возможностей равны нулю, а атрибут цели определяется как пустой.
+ */
+
+#ifndef VI_COMPILER_SIMD_H
+#define VI_COMPILER_SIMD_H
+
+#include "compiler_type.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) ||                                  \
+    (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+/**
+ * @def VI_COMPILER_SIMD_SSE2
+ * @brief Набор инструкций SSE2 доступен для всей единицы трансляции.
+ */
+#    define VI_COMPILER_SIMD_SSE2 1
+#else
+/**
+ * @def VI_COMPILER_SIMD_SSE2
+ * @brief Набор инструкций SSE2 недоступен.
+ */
+#    define VI_COMPILER_SIMD_SSE2 0
+#endif // defined(__SSE2__) || defined(_M_X64) || ...
+
+#if VI_COMPILER_SIMD_SSE2 &&                                                                       \
+    ((VI_COMPILER_TYPE == VI_COMPILER_TYPE_GCC) || (VI_COMPILER_TYPE == VI_COMPILER_TYPE_CLANG))
+/**
+ * @def VI_COMPILER_SIMD_SSSE3
+ * @brief Компилятор может генерировать функции с инструкциями SSSE3.
+ */
+#    define VI_COMPILER_SIMD_SSSE3 1
+
+/**
+ * @def VI_COMPILER_SIMD_AVX2
+ * @brief Компилятор может генерировать функции с инструкциями AVX2.
+ */
+#    define VI_COMPILER_SIMD_AVX2 1
+
+/**
+ * @def VI_COMPILER_SIMD_TARGET(N)
+ * @brief Разрешает функции использовать набор инструкций `N` для GCC и Clang.
+ *
+ * @param N Строка с названием набора инструкций, например `"avx2"`.
+ */
+#    define VI_COMPILER_SIMD_TARGET(N) __attribute__((target(N)))
+#else
+/**
+ * @def VI_COMPILER_SIMD_SSSE3
+ * @brief Компилятор не может генерировать функции с инструкциями SSSE3.
+ */
+#    define VI_COMPILER_SIMD_SSSE3 0
+
+/**
+ * @def VI_COMPILER_SIMD_AVX2
+ * @brief Компилятор не может генерировать функции с инструкциями AVX2.
+ */
+#    define VI_COMPILER_SIMD_AVX2 0
+
+/**
+ * @def VI_COMPILER_SIMD_TARGET(N)
+ * @brief Пустой атрибут цели для компиляторов без его поддержки.
+ */
+#    define VI_COMPILER_SIMD_TARGET(N)
+#endif // VI_COMPILER_SIMD_SSE2 && ...
+
+#endif // VI_COMPILER_SIMD_H
@@ -0,0 +1,191 @@
+/**
+ * @file cpu.h
+ * @brief Определение возможностей процессора во время выполнения.
+ *
+ * Этот файл содержит функции, сообщающие, какие наборы инструкций поддерживает
+ * процессор, на котором выполняется программа. В отличие от `compiler_simd.h`,
+ * описывающего возможности компилятора, эти функции позволяют одной сборке библиотеки
+ * выбирать наиболее быструю реализацию на каждой машине.
+ *
+ * Возможности определяются один раз: командой CPUID на x86 и x86-64 и функцией
+ * `getauxval` на AArch64 под Linux. Для наборов AVX, AVX2 и AVX-512 дополнительно
+ * проверяется, что операционная система сохраняет их регистры при переключении
+ * потоков. Определение выполняется при загрузке библиотеки, а также при первом
+ * вызове `vi_cpu_features`, если он произошел раньше, например из конструкторов
+ * других модулей.
+ *
+ * Модули библиотеки выбирают реализации при загрузке и сохраняют их в указателях
+ * на функции:
+ *
+ * @code
+ * vi_compiler_constructor(vi_module_init)
+ * {
+ *     if (vi_cpu_has(VI_CPU_FEATURE_AVX2))
+ *     {
+ *         vi_module_impl = vi_module_impl_avx2;
+ *     }
+ * }
+ * @endcode
+ *
+ * Основные функции:
+ * - vi_cpu_features: Возвращает маску возможностей процессора.
+ * - vi_cpu_has: Проверяет наличие возможностей.
+ * - vi_cpu_processor_count: Возвращает количество процессоров, доступных процессу.
+ */
+
+#ifndef VI_CPU_H
+#define VI_CPU_H
+
+#include "size.h"
+#include "attribute.h"
+#include "numeric_fixed_types.h"
+
+/**
+ * @def VI_CPU_FEATURE_SSE2
+ * @brief Набор инструкций SSE2.
+ */
+#define VI_CPU_FEATURE_SSE2 (1ULL << 0)
+
+/**
+ * @def VI_CPU_FEATURE_SSE3
+ * @brief Набор инструкций SSE3.
+ */
+#define VI_CPU_FEATURE_SSE3 (1ULL << 1)
+
+/**
+ * @def VI_CPU_FEATURE_SSSE3
+ * @brief Набор инструкций SSSE3.
+ */
+#define VI_CPU_FEATURE_SSSE3 (1ULL << 2)
+
+/**
+ * @def VI_CPU_FEATURE_SSE41
+ * @brief Набор инструкций SSE4.1.
+ */
+#define VI_CPU_FEATURE_SSE41 (1ULL << 3)
+
+/**
+ * @def VI_CPU_FEATURE_SSE42
+ * @brief Набор инструкций SSE4.2.
+ */
+#define VI_CPU_FEATURE_SSE42 (1ULL << 4)
+
+/**
+ * @def VI_CPU_FEATURE_POPCNT
+ * @brief Команда POPCNT.
+ */
+#define VI_CPU_FEATURE_POPCNT (1ULL << 5)
+
+/**
+ * @def VI_CPU_FEATURE_AVX
+ * @brief Набор инструкций AVX, поддерживаемый операционной системой.
+ */
+#define VI_CPU_FEATURE_AVX (1ULL << 6)
+
+/**
+ * @def VI_CPU_FEATURE_AVX2
+ * @brief Набор инструкций AVX2, поддерживаемый операционной системой.
+ */
+#define VI_CPU_FEATURE_AVX2 (1ULL << 7)
+
+/**
+ * @def VI_CPU_FEATURE_FMA
+ * @brief Набор инструкций FMA3, поддерживаемый операционной системой.
+ */
+#define VI_CPU_FEATURE_FMA (1ULL << 8)
+
+/**
+ * @def VI_CPU_FEATURE_BMI1
+ * @brief Набор инструкций BMI1.
+ */
+#define VI_CPU_FEATURE_BMI1 (1ULL << 9)
+
+/**
+ * @def VI_CPU_FEATURE_BMI2
+ * @brief Набор инструкций BMI2.
+ */
+#define VI_CPU_FEATURE_BMI2 (1ULL << 10)
+
+/**
+ * @def VI_CPU_FEATURE_LZCNT
+ * @brief Команда LZCNT.
+ */
+#define VI_CPU_FEATURE_LZCNT (1ULL << 11)
+
+/**
+ * @def VI_CPU_FEATURE_AVX512F
+ * @brief Базовый набор инструкций AVX-512, поддерживаемый операционной системой.
+ */
+#define VI_CPU_FEATURE_AVX512F (1ULL << 12)
+
+/**
+ * @def VI_CPU_FEATURE_AVX512BW
+ * @brief Команды AVX-512 над байтами и словами.
+ */
+#define VI_CPU_FEATURE_AVX512BW (1ULL << 13)
+
+/**
+ * @def VI_CPU_FEATURE_AVX512VL
+ * @brief Команды AVX-512 над 128- и 256-битными регистрами.
+ */
+#define VI_CPU_FEATURE_AVX512VL (1ULL << 14)
+
+/**
+ * @def VI_CPU_FEATURE_NEON
+ * @brief Набор инструкций Advanced SIMD (NEON) на AArch64.
+ */
+#define VI_CPU_FEATURE_NEON (1ULL << 32)
+
+/**
+ * @def VI_CPU_FEATURE_CRC32
+ * @brief Команды CRC32 на AArch64.
+ */
+#define VI_CPU_FEATURE_CRC32 (1ULL << 33)
+
+/**
+ * @def VI_CPU_FEATURE_DETECTED
+ * @brief Бит, отмечающий, что возможности процессора уже определены.
+ *
+ * Всегда установлен в результате `vi_cpu_features`.
+ */
+#define VI_CPU_FEATURE_DETECTED (1ULL << 63)
+
+/**
+ * @def vi_cpu_has
+ * @brief Возвращает `true`, если процессор поддерживает все возможности из маски `features`.
+ */
+#define vi_cpu_has(features) ((vi_cpu_features() & (features)) == (features))
+
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Возвращает маску возможностей процессора.
+ *
+ * Результат вычисляется один раз и затем читается из памяти, поэтому функцию
+ * можно вызывать из любых потоков и конструкторов.
+ *
+ * @return Объединение констант `VI_CPU_FEATURE_*`, поддерживаемых процессором,
+ *         с установленным битом `VI_CPU_FEATURE_DETECTED`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_u64_t
+vi_cpu_features(void);
+
+/**
+ * @brief Возвращает количество процессоров, доступных процессу.
+ *
+ * Учитывается маска сродства процесса: `sched_getaffinity` в Linux
+ * и `GetProcessAffinityMask` в Windows. Если маску получить нельзя, возвращается
+ * количество включенных процессоров системы.
+ *
+ * @return Количество процессоров; не меньше 1.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_cpu_processor_count(void);
+
+VI_COMPILER(EXTERN_C_END)
+
+#endif // VI_CPU_H
@@ -0,0 +1,340 @@
+/**
+ * @file dynamic_block.h
+ * @brief Динамический блок — растущий массив элементов фиксированного размера.
+ *
+ * Этот файл содержит структуру `vi_dynamic_block_t`, которая хранит элементы
+ * одного размера в непрерывном участке памяти и увеличивает его по мере
+ * добавления элементов. Память выделяется через интерфейс `vi_allocator_t`,
+ * поэтому блок может работать поверх кучи, арены или любого другого распределителя.
+ *
+ * Емкость растет в `VI_DYNAMIC_BLOCK_GROWTH_FACTOR / 1000` раз, что дает
+ * амортизированно постоянное время добавления без вычислений с плавающей точкой.
+ * При увеличении участка используется функция `reallocate` распределителя,
+ * которая может расширить блок на месте без копирования данных.
+ *
+ * Указатели на элементы становятся недействительными после любой операции,
+ * изменяющей емкость блока.
+ *
+ * Блок может начинать работу со встроенным буфером (small buffer), объявленным
+ * рядом с ним макросом `VI_DYNAMIC_BLOCK_SMALL`. Пока элементы помещаются в буфер,
+ * память у распределителя не запрашивается; при переполнении элементы переносятся
+ * в кучу с обычным коэффициентом роста.
+ *
+ * Основные функции:
+ * - vi_dynamic_block_init: Инициализирует пустой блок.
+ * - vi_dynamic_block_init_inline: Инициализирует пустой блок со встроенным буфером.
+ * - vi_dynamic_block_destroy: Освобождает память блока.
+ * - vi_dynamic_block_reserve: Резервирует емкость не меньше заданной.
+ * - vi_dynamic_block_push: Добавляет элемент в конец.
+ * - vi_dynamic_block_pop: Удаляет последний элемент.
+ * - vi_dynamic_block_insert: Вставляет элементы в заданную позицию.
+ * - vi_dynamic_block_erase: Удаляет элементы из заданной позиции.
+ * - vi_dynamic_block_clear: Удаляет все элементы, сохраняя емкость.
+ * - vi_dynamic_block_shrink_to_fit: Уменьшает емкость до количества элементов.
+ */
+
+#ifndef VI_DYNAMIC_BLOCK_H
+#define VI_DYNAMIC_BLOCK_H
+
+#include "allocator.h"
+
+#ifndef VI_DYNAMIC_BLOCK_GROWTH_FACTOR
+/**
+ * @def VI_DYNAMIC_BLOCK_GROWTH_FACTOR
+ * @brief Коэффициент роста емкости, умноженный на 1000.
+ *
+ * Обычно задается при сборке в `compile_definitions.cmake`.
+ */
+#    define VI_DYNAMIC_BLOCK_GROWTH_FACTOR 1500
+#endif // VI_DYNAMIC_BLOCK_GROWTH_FACTOR
+
+#if VI_DYNAMIC_BLOCK_GROWTH_FACTOR <= 1000
+#    error "VI_DYNAMIC_BLOCK_GROWTH_FACTOR must be greater than 1000"
+#endif // VI_DYNAMIC_BLOCK_GROWTH_FACTOR <= 1000
+
+/**
+ * @def VI_DYNAMIC_BLOCK_MIN_CAPACITY
+ * @brief Емкость, выделяемая при первом добавлении элемента.
+ */
+#define VI_DYNAMIC_BLOCK_MIN_CAPACITY 4
+
+/**
+ * @brief Динамический блок элементов.
+ */
+typedef struct vi_dynamic_block_t
+{
+    /**
+     * @brief Распределитель памяти блока.
+     */
+    const vi_allocator_t *allocator;
+
+    /**
+     * @brief Указатель на первый элемент или `nullptr`, если память не выделена.
+     */
+    vi_ptr_t data;
+
+    /**
+     * @brief Размер элемента в байтах.
+     */
+    vi_usize_t element_size;
+
+    /**
+     * @brief Количество элементов.
+     */
+    vi_usize_t size;
+
+    /**
+     * @brief Количество элементов, для которых выделена память.
+     */
+    vi_usize_t capacity;
+
+    /**
+     * @brief Встроенный буфер или `nullptr`, если блок создан без него.
+     */
+    vi_ptr_t inline_data;
+
+    /**
+     * @brief Емкость встроенного буфера в элементах.
+     */
+    vi_usize_t inline_capacity;
+} vi_dynamic_block_t;
+
+/**
+ * @def VI_DYNAMIC_BLOCK_SMALL
+ * @brief Объявляет тип блока со встроенным буфером на `N` элементов типа `T`.
+ *
+ * Поле `block` используется со всеми функциями `vi_dynamic_block_*`.
+ * Так как блок ссылается на буфер внутри той же структуры, ее нельзя копировать
+ * или перемещать побайтно, пока элементы хранятся во встроенном буфере.
+ *
+ * Пример:
+ * @code
+ * VI_DYNAMIC_BLOCK_SMALL(int, 16) values;
+ * vi_dynamic_block_small_init(&values, nullptr);
+ * vi_dynamic_block_push(&values.block, &value);
+ * vi_dynamic_block_destroy(&values.block);
+ * @endcode
+ *
+ * @param T Тип элемента.
+ * @param N Количество элементов во встроенном буфере.
+ */
+#define VI_DYNAMIC_BLOCK_SMALL(T, N)                                                               \
+    struct                                                                                         \
+    {                                                                                              \
+        vi_dynamic_block_t block;                                                                  \
+        T storage[N];                                                                              \
+    }
+
+/**
+ * @def vi_dynamic_block_small_init
+ * @brief Инициализирует блок, объявленный через `VI_DYNAMIC_BLOCK_SMALL`.
+ *
+ * @param small Указатель на структуру блока со встроенным буфером.
+ * @param allocator Распределитель памяти или `nullptr` для распределителя времени выполнения.
+ */
+#define vi_dynamic_block_small_init(small, allocator)                                              \
+    vi_dynamic_block_init_inline(&(small)->block,                                                  \
+                                 (allocator),                                                      \
+                                 sizeof((small)->storage[0]),                                      \
+                                 (small)->storage,                                                 \
+                                 sizeof((small)->storage) / sizeof((small)->storage[0]))
+
+/**
+ * @def vi_dynamic_block_is_inline
+ * @brief Проверяет, хранятся ли элементы блока во встроенном буфере.
+ */
+#define vi_dynamic_block_is_inline(block)                                                          \
+    ((block)->inline_data && (block)->data == (block)->inline_data)
+
+/**
+ * @def vi_dynamic_block_at
+ * @brief Возвращает указатель на элемент с индексом `index` без проверки границ.
+ *
+ * @param block Указатель на блок.
+ * @param T Тип элемента.
+ * @param index Индекс элемента.
+ */
+#define vi_dynamic_block_at(block, T, index) ((T *)(block)->data + (index))
+
+/**
+ * @def vi_dynamic_block_is_empty
+ * @brief Проверяет, пуст ли блок.
+ */
+#define vi_dynamic_block_is_empty(block) ((block)->size == 0)
+
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Инициализирует пустой блок.
+ *
+ * Память не выделяется до первого добавления элемента.
+ *
+ * @param block Указатель на инициализируемый блок.
+ * @param allocator Распределитель памяти или `nullptr` для распределителя
+ *                  времени выполнения, действующего в момент инициализации.
+ * @param element_size Размер элемента в байтах.
+ *
+ * @return `true` при успехе или `false`, если `block` равен `nullptr`,
+ *         `element_size` равен 0 или распределитель недействителен.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_dynamic_block_init(vi_dynamic_block_t *block,
+                      const vi_allocator_t *allocator,
+                      vi_usize_t element_size);
+
+/**
+ * @brief Инициализирует пустой блок со встроенным буфером.
+ *
+ * Пока количество элементов не превышает `inline_capacity`, элементы хранятся
+ * в `buffer`, и память у распределителя не запрашивается. Буфер должен быть
+ * выровнен для типа элемента и существовать, пока используется блок.
+ *
+ * @param block Указатель на инициализируемый блок.
+ * @param allocator Распределитель памяти или `nullptr` для распределителя
+ *                  времени выполнения, действующего в момент инициализации.
+ * @param element_size Размер элемента в байтах.
+ * @param buffer Встроенный буфер на `inline_capacity` элементов.
+ * @param inline_capacity Емкость встроенного буфера в элементах.
+ *
+ * @return `true` при успехе или `false`, если аргументы некорректны
+ *         или распределитель недействителен.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_dynamic_block_init_inline(vi_dynamic_block_t *block,
+                             const vi_allocator_t *allocator,
+                             vi_usize_t element_size,
+                             vi_ptr_t buffer,
+                             vi_usize_t inline_capacity);
+
+/**
+ * @brief Освобождает память блока.
+ *
+ * После вызова блок пуст и может использоваться повторно. Блок со встроенным
+ * буфером возвращается к нему.
+ *
+ * @param block Указатель на блок или `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_dynamic_block_destroy(vi_dynamic_block_t *block);
+
+/**
+ * @brief Резервирует память не меньше чем для `capacity` элементов.
+ *
+ * Если текущая емкость достаточна, функция ничего не делает, и указатели
+ * на элементы остаются действительными. Иначе все указатели становятся
+ * недействительными, в том числе при переносе из встроенного буфера в кучу.
+ *
+ * @param block Указатель на блок.
+ * @param capacity Требуемая емкость в элементах.
+ *
+ * @return `true` при успехе или `false`, если память не удалось выделить
+ *         или размер в байтах превышает `VI_USIZE_T_MAX`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_dynamic_block_reserve(vi_dynamic_block_t *block, vi_usize_t capacity);
+
+/**
+ * @brief Добавляет элемент в конец блока.
+ *
+ * Указатели на элементы остаются действительными, если емкости хватает
+ * для нового элемента (`size < capacity`).
+ *
+ * @param block Указатель на блок.
+ * @param element Указатель на копируемый элемент или `nullptr`, чтобы оставить
+ *                новый элемент неинициализированным. Не должен указывать внутрь блока.
+ *
+ * @return Указатель на добавленный элемент или `nullptr` при ошибке.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_dynamic_block_push(vi_dynamic_block_t *block, const vi_ptr_t element);
+
+/**
+ * @brief Удаляет последний элемент блока.
+ *
+ * Указатели на остальные элементы остаются действительными.
+ *
+ * @param block Указатель на блок.
+ *
+ * @return `true`, если элемент удален, или `false`, если блок пуст.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_dynamic_block_pop(vi_dynamic_block_t *block);
+
+/**
+ * @brief Вставляет `count` элементов перед позицией `index`.
+ *
+ * Элементы начиная с `index` сдвигаются к концу блока, поэтому указатели на них
+ * становятся недействительными. Указатели на элементы до `index` остаются
+ * действительными, если емкости хватает для новых элементов.
+ *
+ * @param block Указатель на блок.
+ * @param index Позиция вставки; не больше количества элементов.
+ * @param elements Указатель на `count` копируемых элементов или `nullptr`, чтобы
+ *                 оставить новые элементы неинициализированными. Не должен указывать
+ *                 внутрь блока.
+ * @param count Количество вставляемых элементов.
+ *
+ * @return Указатель на первый вставленный элемент или `nullptr`,
+ *         если `index` вне блока или память не удалось выделить.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_dynamic_block_insert(vi_dynamic_block_t *block,
+                        vi_usize_t index,
+                        const vi_ptr_t elements,
+                        vi_usize_t count);
+
+/**
+ * @brief Удаляет `count` элементов начиная с позиции `index`.
+ *
+ * Последующие элементы сдвигаются к началу блока, и указатели на них становятся
+ * недействительными. Указатели на элементы до `index` остаются действительными,
+ * так как емкость не изменяется.
+ *
+ * @param block Указатель на блок.
+ * @param index Позиция первого удаляемого элемента.
+ * @param count Количество удаляемых элементов.
+ *
+ * @return `true` при успехе или `false`, если диапазон выходит за пределы блока.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_dynamic_block_erase(vi_dynamic_block_t *block, vi_usize_t index, vi_usize_t count);
+
+/**
+ * @brief Удаляет все элементы блока, сохраняя выделенную память.
+ *
+ * Память не перемещается, поэтому ее можно заполнить снова без перераспределения.
+ *
+ * @param block Указатель на блок.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_dynamic_block_clear(vi_dynamic_block_t *block);
+
+/**
+ * @brief Уменьшает емкость блока до количества элементов.
+ *
+ * Если блок пуст, память освобождается. Если элементы помещаются во встроенный
+ * буфер, они переносятся в него, а память кучи освобождается. Указатели на
+ * элементы становятся недействительными, если емкость изменилась.
+ *
+ * @param block Указатель на блок.
+ *
+ * @return `true` при успехе или `false`, если память не удалось перераспределить.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_dynamic_block_shrink_to_fit(vi_dynamic_block_t *block);
+
+VI_COMPILER(EXTERN_C_END)
+
+#endif // VI_DYNAMIC_BLOCK_H
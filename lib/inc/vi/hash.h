@@ -0,0 +1,123 @@
+/**
+ * @file hash.h
+ * @brief Быстрые некриптографические хеш-функции.
+ *
+ * Этот файл содержит хеш-функции для ключей хеш-таблиц, идентификаторов
+ * и буферов произвольной длины. Функции построены на схеме wyhash: блоки
+ * входных данных смешиваются 64x64→128-битным умножением, после чего старшая
+ * и младшая половины произведения складываются по XOR. Длинные входы обрабатываются
+ * блоками по 48 байт в трех независимых цепочках, что позволяет процессору
+ * выполнять умножения параллельно.
+ *
+ * Каждая функция имеет вариант с суффиксом `_seeded`, принимающий зерно (seed).
+ * Случайное зерно, выбранное при запуске программы, не дает злоумышленнику
+ * заранее подобрать множество ключей с одинаковым хешем (hash flooding).
+ * Функции без зерна эквивалентны вариантам с зерном 0.
+ *
+ * Хеш-функции не являются криптографическими и не должны использоваться
+ * для проверки целостности или хранения паролей. Значения хеша могут измениться
+ * между версиями библиотеки и не должны сохраняться.
+ *
+ * Основные функции:
+ * - vi_hash_bytes: Возвращает хеш участка памяти.
+ * - vi_hash_bytes_seeded: Возвращает хеш участка памяти с заданным зерном.
+ * - vi_hash_u64: Возвращает хеш 64-битного числа.
+ * - vi_hash_u64_seeded: Возвращает хеш 64-битного числа с заданным зерном.
+ * - vi_hash_str_raw: Возвращает хеш строки, завершающейся нулевым символом.
+ * - vi_hash_str_raw_seeded: Возвращает хеш строки с заданным зерном.
+ */
+
+#ifndef VI_HASH_H
+#define VI_HASH_H
+
+#include "ptr.h"
+#include "char.h"
+#include "size.h"
+#include "attribute.h"
+#include "numeric_fixed_types.h"
+
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Возвращает хеш участка памяти.
+ *
+ * @param data Указатель на начало участка; может быть `nullptr`, если `size` равен 0.
+ * @param size Размер участка в байтах.
+ *
+ * @return 64-битный хеш.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_u64_t
+vi_hash_bytes(const vi_ptr_t data, vi_usize_t size);
+
+/**
+ * @brief Возвращает хеш участка памяти с заданным зерном.
+ *
+ * @param data Указатель на начало участка; может быть `nullptr`, если `size` равен 0.
+ * @param size Размер участка в байтах.
+ * @param seed Зерно хеширования.
+ *
+ * @return 64-битный хеш.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_u64_t
+vi_hash_bytes_seeded(const vi_ptr_t data, vi_usize_t size, vi_u64_t seed);
+
+/**
+ * @brief Возвращает хеш 64-битного числа.
+ *
+ * Выполняется за два 128-битных умножения, поэтому подходит для целочисленных
+ * ключей и указателей. Результат не совпадает с хешем 8 байт числа,
+ * полученным `vi_hash_bytes`.
+ *
+ * @param value Хешируемое значение.
+ *
+ * @return 64-битный хеш.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_u64_t
+vi_hash_u64(vi_u64_t value);
+
+/**
+ * @brief Возвращает хеш 64-битного числа с заданным зерном.
+ *
+ * @param value Хешируемое значение.
+ * @param seed Зерно хеширования.
+ *
+ * @return 64-битный хеш.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_u64_t
+vi_hash_u64_seeded(vi_u64_t value, vi_u64_t seed);
+
+/**
+ * @brief Возвращает хеш строки, завершающейся нулевым символом.
+ *
+ * Результат совпадает с хешем `vi_hash_bytes` для символов строки
+ * без завершающего нуля.
+ *
+ * @param str Указатель на строку.
+ *
+ * @return 64-битный хеш или хеш пустой строки, если `str` равен `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_u64_t
+vi_hash_str_raw(const vi_char_t *str);
+
+/**
+ * @brief Возвращает хеш строки, завершающейся нулевым символом, с заданным зерном.
+ *
+ * @param str Указатель на строку.
+ * @param seed Зерно хеширования.
+ *
+ * @return 64-битный хеш или хеш пустой строки, если `str` равен `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_u64_t
+vi_hash_str_raw_seeded(const vi_char_t *str, vi_u64_t seed);
+
+VI_COMPILER(EXTERN_C_END)
+
+#endif // VI_HASH_H
@@ -0,0 +1,265 @@
+/**
+ * @file hash_map.h
+ * @brief Хеш-таблица с открытой адресацией и групповым пробированием.
+ *
+ * Этот файл содержит структуру `vi_hash_map_t` — ассоциативный контейнер,
+ * который хранит ключи и значения фиксированного размера непосредственно
+ * в ячейках таблицы, без отдельного выделения памяти на каждую запись.
+ *
+ * Каждой ячейке соответствует управляющий байт: пустая ячейка, удаленная ячейка
+ * или младшие 7 бит хеша занятой ячейки. Поиск сначала сравнивает управляющие байты
+ * целой группы ячеек и только для совпавших байтов сравнивает ключи. Группа состоит
+ * из 16 ячеек и проверяется одной командой SSE2, а на платформах без SSE2 — из 8 ячеек
+ * и проверяется приемом SWAR над 64-битным словом. Управляющие байты хранятся
+ * отдельно от ячеек, поэтому промах обычно затрагивает одну строку кэша.
+ *
+ * Таблица заполняется не более чем на 7/8. Удаление помечает ячейку как удаленную
+ * только тогда, когда это нужно для продолжения поиска, иначе ячейка становится пустой.
+ *
+ * Указатели на ключи и значения становятся недействительными после вставки,
+ * вызвавшей перестройку таблицы, а также после `vi_hash_map_reserve`.
+ *
+ * Основные функции:
+ * - vi_hash_map_init: Инициализирует пустую таблицу.
+ * - vi_hash_map_destroy: Освобождает память таблицы.
+ * - vi_hash_map_reserve: Резервирует место под заданное количество записей.
+ * - vi_hash_map_find: Ищет значение по ключу.
+ * - vi_hash_map_insert: Вставляет запись или возвращает существующую.
+ * - vi_hash_map_erase: Удаляет запись по ключу.
+ * - vi_hash_map_clear: Удаляет все записи, сохраняя емкость.
+ * - vi_hash_map_next: Перебирает записи таблицы.
+ */
+
+#ifndef VI_HASH_MAP_H
+#define VI_HASH_MAP_H
+
+#include "allocator.h"
+
+/**
+ * @brief Тип функции хеширования ключа.
+ *
+ * @param key Указатель на ключ.
+ * @param size Размер ключа в байтах.
+ *
+ * @return 64-битный хеш ключа.
+ */
+typedef vi_u64_t (*vi_hash_map_hash_fn_t)(const vi_ptr_t key, vi_usize_t size);
+
+/**
+ * @brief Тип функции сравнения ключей.
+ *
+ * @param lhs Указатель на первый ключ.
+ * @param rhs Указатель на второй ключ.
+ * @param size Размер ключа в байтах.
+ *
+ * @return `true`, если ключи равны, иначе `false`.
+ */
+typedef bool (*vi_hash_map_equal_fn_t)(const vi_ptr_t lhs, const vi_ptr_t rhs, vi_usize_t size);
+
+/**
+ * @brief Хеш-таблица.
+ */
+typedef struct vi_hash_map_t
+{
+    /**
+     * @brief Распределитель памяти таблицы.
+     */
+    const vi_allocator_t *allocator;
+
+    /**
+     * @brief Функция хеширования или `nullptr` для функций модуля `hash.h`.
+     */
+    vi_hash_map_hash_fn_t hash;
+
+    /**
+     * @brief Функция сравнения ключей или `nullptr` для побайтового сравнения.
+     */
+    vi_hash_map_equal_fn_t equal;
+
+    /**
+     * @brief Управляющие байты ячеек или `nullptr`, если память не выделена.
+     */
+    vi_u8_t *ctrl;
+
+    /**
+     * @brief Ячейки таблицы; каждая содержит ключ и следующее за ним значение.
+     */
+    vi_u8_t *slots;
+
+    /**
+     * @brief Размер ключа в байтах.
+     */
+    vi_usize_t key_size;
+
+    /**
+     * @brief Размер значения в байтах.
+     */
+    vi_usize_t value_size;
+
+    /**
+     * @brief Смещение значения от начала ячейки.
+     */
+    vi_usize_t value_offset;
+
+    /**
+     * @brief Размер ячейки в байтах с учетом выравнивания.
+     */
+    vi_usize_t slot_size;
+
+    /**
+     * @brief Количество ячеек; 0 или степень двойки.
+     */
+    vi_usize_t capacity;
+
+    /**
+     * @brief Количество записей.
+     */
+    vi_usize_t size;
+
+    /**
+     * @brief Количество записей, которые можно вставить до перестройки таблицы.
+     */
+    vi_usize_t growth_left;
+} vi_hash_map_t;
+
+/**
+ * @def vi_hash_map_size
+ * @brief Возвращает количество записей в таблице.
+ */
+#define vi_hash_map_size(map) ((map)->size)
+
+/**
+ * @def vi_hash_map_memory_size
+ * @brief Возвращает объем памяти, занятой ячейками и управляющими байтами таблицы.
+ */
+#define vi_hash_map_memory_size(map) ((map)->capacity * ((map)->slot_size + 1))
+
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Инициализирует пустую таблицу.
+ *
+ * Память не выделяется до первой вставки. Значение размещается в ячейке после ключа
+ * и выравнивается по наибольшей степени двойки, на которую делится `value_size`
+ * (но не более 16 байт), поэтому структуры в качестве значений выравниваются правильно.
+ *
+ * @param map Указатель на инициализируемую таблицу.
+ * @param allocator Распределитель памяти или `nullptr` для распределителя
+ *                  времени выполнения, действующего в момент инициализации.
+ * @param key_size Размер ключа в байтах.
+ * @param value_size Размер значения в байтах; 0 превращает таблицу в множество.
+ * @param hash Функция хеширования или `nullptr` для `vi_hash_u64` (ключи по 8 байт)
+ *             и `vi_hash_bytes` (остальные ключи).
+ * @param equal Функция сравнения ключей или `nullptr` для побайтового сравнения.
+ *
+ * @return `true` при успехе или `false`, если `map` равен `nullptr`,
+ *         `key_size` равен 0 или распределитель недействителен.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_hash_map_init(vi_hash_map_t *map,
+                 const vi_allocator_t *allocator,
+                 vi_usize_t key_size,
+                 vi_usize_t value_size,
+                 vi_hash_map_hash_fn_t hash,
+                 vi_hash_map_equal_fn_t equal);
+
+/**
+ * @brief Освобождает память таблицы.
+ *
+ * После вызова таблица пуста и может использоваться повторно.
+ *
+ * @param map Указатель на таблицу или `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_hash_map_destroy(vi_hash_map_t *map);
+
+/**
+ * @brief Резервирует место под `count` записей без перестройки таблицы.
+ *
+ * @param map Указатель на таблицу.
+ * @param count Требуемое количество записей.
+ *
+ * @return `true` при успехе или `false`, если память не удалось выделить.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_hash_map_reserve(vi_hash_map_t *map, vi_usize_t count);
+
+/**
+ * @brief Ищет значение по ключу.
+ *
+ * @param map Указатель на таблицу.
+ * @param key Указатель на ключ.
+ *
+ * @return Указатель на значение или `nullptr`, если ключ не найден.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_hash_map_find(const vi_hash_map_t *map, const vi_ptr_t key);
+
+/**
+ * @brief Вставляет запись, если ключа еще нет в таблице.
+ *
+ * Если ключ уже есть, значение не изменяется.
+ *
+ * @param map Указатель на таблицу.
+ * @param key Указатель на ключ.
+ * @param value Указатель на копируемое значение или `nullptr`, чтобы оставить
+ *              значение новой записи неинициализированным.
+ * @param inserted Указатель, по которому записывается `true`, если запись
+ *                 была вставлена, или `false`, если ключ уже был; может быть `nullptr`.
+ *
+ * @return Указатель на значение записи или `nullptr` при ошибке.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_hash_map_insert(vi_hash_map_t *map, const vi_ptr_t key, const vi_ptr_t value, bool *inserted);
+
+/**
+ * @brief Удаляет запись по ключу.
+ *
+ * Указатели на остальные записи остаются действительными.
+ *
+ * @param map Указатель на таблицу.
+ * @param key Указатель на ключ.
+ *
+ * @return `true`, если запись удалена, или `false`, если ключ не найден.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_hash_map_erase(vi_hash_map_t *map, const vi_ptr_t key);
+
+/**
+ * @brief Удаляет все записи таблицы, сохраняя выделенную память.
+ *
+ * @param map Указатель на таблицу.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_hash_map_clear(vi_hash_map_t *map);
+
+/**
+ * @brief Возвращает следующую запись таблицы.
+ *
+ * Перебор начинается с `*index == 0`. Порядок записей не определен.
+ * Во время перебора таблицу можно изменять только функцией `vi_hash_map_erase`
+ * для текущей записи.
+ *
+ * @param map Указатель на таблицу.
+ * @param index Указатель на позицию перебора; обновляется при каждом вызове.
+ * @param key Указатель, по которому записывается адрес ключа; может быть `nullptr`.
+ * @param value Указатель, по которому записывается адрес значения; может быть `nullptr`.
+ *
+ * @return `true`, если запись найдена, или `false`, если перебор завершен.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_hash_map_next(const vi_hash_map_t *map, vi_usize_t *index, vi_ptr_t *key, vi_ptr_t *value);
+
+VI_COMPILER(EXTERN_C_END)
+
+#endif // VI_HASH_MAP_H
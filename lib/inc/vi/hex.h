@@ -0,0 +1,128 @@
+/**
+ * @file hex.h
+ * @brief Шестнадцатеричное кодирование байтов.
+ *
+ * Этот файл содержит функции перевода участка байтов в шестнадцатеричную
+ * запись (по два символа на байт) и обратно. Функции не выделяют память
+ * и не записывают завершающий нуль: размер результата заранее известен
+ * и вычисляется макросами `vi_hex_encoded_size` и `vi_hex_decoded_size`.
+ *
+ * Скалярная реализация построена на таблицах из имен символов `ascii_map.h`.
+ * На процессорах x86 кодирование и декодирование обрабатывают по 16 (SSSE3)
+ * или 32 (AVX2) байта результата за шаг; реализация выбирается при загрузке
+ * библиотеки по `vi_cpu_has`. Декодирование принимает цифры обоих регистров
+ * и при ошибке сообщает позицию первого недопустимого символа.
+ *
+ * Пример использования:
+ * @code
+ * vi_u8_t text[vi_hex_encoded_size(sizeof(digest))];
+ * vi_hex_encode(text, digest, sizeof(digest));
+ *
+ * vi_usize_t result;
+ * if (vi_hex_decode(digest, text, sizeof(text), &result) != VI_HEX_SUCCESS)
+ * {
+ *     // result содержит позицию первого недопустимого символа
+ * }
+ * @endcode
+ *
+ * Основные функции:
+ * - vi_hex_encode: Записывает байты строчными шестнадцатеричными цифрами.
+ * - vi_hex_encode_upper: Записывает байты заглавными шестнадцатеричными цифрами.
+ * - vi_hex_decode: Переводит шестнадцатеричную запись в байты.
+ */
+
+#ifndef VI_HEX_H
+#define VI_HEX_H
+
+#include "size.h"
+#include "return.h"
+#include "attribute.h"
+#include "numeric_fixed_types.h"
+
+/**
+ * @def vi_hex_encoded_size
+ * @brief Количество символов шестнадцатеричной записи `size` байтов.
+ */
+#define vi_hex_encoded_size(size) ((size) * 2)
+
+/**
+ * @def vi_hex_decoded_size
+ * @brief Количество байтов, получаемых из `size` шестнадцатеричных символов.
+ */
+#define vi_hex_decoded_size(size) ((size) / 2)
+
+/**
+ * @def VI_HEX_SUCCESS
+ * @brief Код успешного декодирования.
+ */
+#define VI_HEX_SUCCESS ((vi_return_t)0)
+
+/**
+ * @def VI_HEX_INVALID
+ * @brief Код ошибки декодирования: аргументы некорректны.
+ */
+#define VI_HEX_INVALID ((vi_return_t)-1)
+
+/**
+ * @def VI_HEX_BAD_CHARACTER
+ * @brief Код ошибки декодирования: символ не является шестнадцатеричной цифрой.
+ */
+#define VI_HEX_BAD_CHARACTER ((vi_return_t)-2)
+
+/**
+ * @def VI_HEX_BAD_LENGTH
+ * @brief Код ошибки декодирования: запись содержит нечетное количество символов.
+ */
+#define VI_HEX_BAD_LENGTH ((vi_return_t)-3)
+
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Записывает байты строчными шестнадцатеричными цифрами.
+ *
+ * Старшая тетрада каждого байта записывается первой. Буферы не должны перекрываться.
+ *
+ * @param dst Указатель на буфер размером не меньше `vi_hex_encoded_size(size)`.
+ * @param src Указатель на байты.
+ * @param size Количество байтов.
+ *
+ * @return Количество записанных символов или 0, если `dst` или `src` равен `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_hex_encode(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size);
+
+/**
+ * @brief Записывает байты заглавными шестнадцатеричными цифрами.
+ *
+ * Работает как `vi_hex_encode`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_hex_encode_upper(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size);
+
+/**
+ * @brief Переводит шестнадцатеричную запись в байты.
+ *
+ * Допускаются цифры обоих регистров. При ошибке буфер `dst` может быть
+ * частично заполнен. Буферы не должны перекрываться.
+ *
+ * @param dst Указатель на буфер размером не меньше `vi_hex_decoded_size(size)`.
+ * @param src Указатель на шестнадцатеричную запись.
+ * @param size Количество символов.
+ * @param result Указатель на количество записанных байтов при успехе или позицию
+ *               первого недопустимого символа при ошибке; может быть `nullptr`.
+ *
+ * @return `VI_HEX_SUCCESS`, `VI_HEX_INVALID`, если `dst` или `src` равен `nullptr`,
+ *         `VI_HEX_BAD_CHARACTER` или `VI_HEX_BAD_LENGTH`; в последнем случае
+ *         позицией считается последний символ без пары.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_return_t
+vi_hex_decode(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size, vi_usize_t *result);
+
+VI_COMPILER(EXTERN_C_END)
+
+#endif // VI_HEX_H
@@ -0,0 +1,108 @@
+/**
+ * @file memory_compare.h
+ * @brief Функции сравнения участков памяти.
+ *
+ * Этот файл содержит функции `vi_memory_compare` и `vi_memory_equal`, которые
+ * сравнивают участки памяти побайтово как беззнаковые значения. Если участки
+ * одинаково выровнены относительно машинного слова, сравнение выполняется
+ * словами `vi_memory_word_t`, а побайтово обрабатывается только слово,
+ * в котором найдено различие.
+ *
+ * На процессорах x86 участки от 16 байт сравниваются векторными регистрами SSE2
+ * (или AVX2 при поддержке процессором) независимо от взаимного выравнивания.
+ * Подходящая реализация выбирается один раз при загрузке библиотеки.
+ *
+ * Основные функции:
+ * - vi_memory_compare_unsafe: Сравнивает `size` байт без проверок.
+ * - vi_memory_compare: Лексикографически сравнивает два диапазона.
+ * - vi_memory_equal_unsafe: Проверяет равенство `size` байт без проверок.
+ * - vi_memory_equal: Проверяет равенство двух диапазонов.
+ */
+
+#ifndef VI_MEMORY_COMPARE_H
+#define VI_MEMORY_COMPARE_H
+
+#include "ptr.h"
+#include "bool.h"
+#include "size.h"
+#include "return.h"
+#include "attribute.h"
+
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Сравнивает участки памяти без проверок.
+ *
+ * Эта функция сравнивает `size` байт, начиная с `lhs` и `rhs`,
+ * и останавливается на первом различающемся байте.
+ *
+ * @param lhs Указатель на начало первого участка.
+ * @param rhs Указатель на начало второго участка.
+ * @param size Количество байт для сравнения.
+ *
+ * @return Отрицательное значение, если первый различающийся байт `lhs` меньше байта `rhs`,
+ *         положительное значение, если больше, и 0, если участки равны.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_return_t
+vi_memory_compare_unsafe(const vi_ptr_t lhs, const vi_ptr_t rhs, vi_usize_t size);
+
+/**
+ * @brief Лексикографически сравнивает два диапазона памяти.
+ *
+ * Эта функция проверяет оба диапазона с помощью `vi_ptr_is_valid_ranges`
+ * и сравнивает их общую часть. Если общая часть совпадает,
+ * меньшим считается более короткий диапазон.
+ *
+ * @param lhs_begin Указатель на начало первого диапазона.
+ * @param lhs_end Указатель на конец первого диапазона.
+ * @param rhs_begin Указатель на начало второго диапазона.
+ * @param rhs_end Указатель на конец второго диапазона.
+ *
+ * @return Отрицательное значение, 0 или положительное значение, аналогично
+ *         `vi_memory_compare_unsafe`, или `VI_RETURN_T_MIN`, если диапазоны недействительны.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_return_t
+vi_memory_compare(const vi_ptr_t lhs_begin,
+                  const vi_ptr_t lhs_end,
+                  const vi_ptr_t rhs_begin,
+                  const vi_ptr_t rhs_end);
+
+/**
+ * @brief Проверяет равенство участков памяти без проверок.
+ *
+ * @param lhs Указатель на начало первого участка.
+ * @param rhs Указатель на начало второго участка.
+ * @param size Количество байт для сравнения.
+ *
+ * @return `true`, если все `size` байт совпадают, иначе `false`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_memory_equal_unsafe(const vi_ptr_t lhs, const vi_ptr_t rhs, vi_usize_t size);
+
+/**
+ * @brief Проверяет равенство двух диапазонов памяти.
+ *
+ * Диапазоны равны, если они имеют одинаковый размер и совпадают побайтово.
+ *
+ * @param lhs_begin Указатель на начало первого диапазона.
+ * @param lhs_end Указатель на конец первого диапазона.
+ * @param rhs_begin Указатель на начало второго диапазона.
+ * @param rhs_end Указатель на конец второго диапазона.
+ *
+ * @return `true`, если диапазоны действительны и равны, иначе `false`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_memory_equal(const vi_ptr_t lhs_begin,
+                const vi_ptr_t lhs_end,
+                const vi_ptr_t rhs_begin,
+                const vi_ptr_t rhs_end);
+
+VI_COMPILER(EXTERN_C_END)
+
+#endif // VI_MEMORY_COMPARE_H
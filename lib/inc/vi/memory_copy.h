@@ -0,0 +1,115 @@
+/**
+ * @file memory_copy.h
+ * @brief Функции копирования и перемещения участков памяти.
+ *
+ * Этот файл содержит функции `vi_memory_copy` и `vi_memory_move`, которые копируют
+ * байты из одного участка памяти в другой. Направление копирования выбирается с помощью
+ * `vi_ptr_range_is_overlapped`: если приемник начинается внутри источника, байты
+ * копируются с конца, иначе — с начала.
+ *
+ * Если источник и приемник одинаково выровнены относительно машинного слова,
+ * середина участка копируется словами `vi_memory_word_t`, а побайтово обрабатываются
+ * только края. На процессорах x86 участки от 16 байт копируются векторными регистрами
+ * SSE2 (или AVX2 при поддержке процессором) независимо от взаимного выравнивания.
+ *
+ * Основные функции:
+ * - vi_memory_copy_unsafe: Копирует `size` байт без проверок, участки не должны перекрываться.
+ * - vi_memory_move_unsafe: Копирует `size` байт без проверок, участки могут перекрываться.
+ * - vi_memory_copy: Копирует диапазон с проверкой диапазонов и отсутствия перекрытия.
+ * - vi_memory_move: Копирует диапазон с проверкой диапазонов, допускает перекрытие.
+ */
+
+#ifndef VI_MEMORY_COPY_H
+#define VI_MEMORY_COPY_H
+
+#include "ptr.h"
+#include "size.h"
+#include "attribute.h"
+
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Копирует участок памяти без проверок.
+ *
+ * Эта функция копирует `size` байт из `src` в `dst` в прямом направлении.
+ * Указатели и размер не проверяются.
+ *
+ * @param dst Указатель на начало участка-приемника.
+ * @param src Указатель на начало участка-источника.
+ * @param size Количество байт для копирования.
+ *
+ * @return Указатель `dst`.
+ *
+ * @warning Если участки перекрываются и `dst` находится после `src`,
+ *          результат не определен. Для таких случаев используйте `vi_memory_move_unsafe`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_memory_copy_unsafe(vi_ptr_t dst, const vi_ptr_t src, vi_usize_t size);
+
+/**
+ * @brief Перемещает участок памяти без проверок.
+ *
+ * Эта функция копирует `size` байт из `src` в `dst`, корректно обрабатывая
+ * перекрывающиеся участки. Если `dst` начинается внутри `src`,
+ * копирование выполняется с конца участка.
+ *
+ * @param dst Указатель на начало участка-приемника.
+ * @param src Указатель на начало участка-источника.
+ * @param size Количество байт для копирования.
+ *
+ * @return Указатель `dst`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_memory_move_unsafe(vi_ptr_t dst, const vi_ptr_t src, vi_usize_t size);
+
+/**
+ * @brief Копирует диапазон памяти в другой диапазон.
+ *
+ * Эта функция проверяет оба диапазона с помощью `vi_ptr_is_valid_ranges`
+ * и копирует наименьшее из количеств байт в диапазонах dst_begin/dst_end
+ * и src_begin/src_end. Принадлежность границ диапазонам определяется
+ * `VI_MEMORY_RANGE_TYPE`.
+ *
+ * @param dst_begin Указатель на начало диапазона-приемника.
+ * @param dst_end Указатель на конец диапазона-приемника.
+ * @param src_begin Указатель на начало диапазона-источника.
+ * @param src_end Указатель на конец диапазона-источника.
+ *
+ * @return Указатель `dst_begin` в случае успеха или `nullptr`,
+ *         если диапазоны недействительны или копируемые участки перекрываются.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_memory_copy(vi_ptr_t dst_begin,
+               vi_ptr_t dst_end,
+               const vi_ptr_t src_begin,
+               const vi_ptr_t src_end);
+
+/**
+ * @brief Перемещает диапазон памяти в другой диапазон.
+ *
+ * Аналогична `vi_memory_copy`, но допускает перекрытие диапазонов:
+ * направление копирования выбирается автоматически.
+ *
+ * @param dst_begin Указатель на начало диапазона-приемника.
+ * @param dst_end Указатель на конец диапазона-приемника.
+ * @param src_begin Указатель на начало диапазона-источника.
+ * @param src_end Указатель на конец диапазона-источника.
+ *
+ * @return Указатель `dst_begin` в случае успеха
+ *         или `nullptr`, если диапазоны недействительны.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_memory_move(vi_ptr_t dst_begin,
+               vi_ptr_t dst_end,
+               const vi_ptr_t src_begin,
+               const vi_ptr_t src_end);
+
+VI_COMPILER(EXTERN_C_END)
+
+#endif // VI_MEMORY_COPY_H
@@ -0,0 +1,94 @@
+/**
+ * @file memory_find.h
+ * @brief Функции поиска байта в участке памяти.
+ *
+ * Этот файл содержит функции `vi_memory_find_byte` и `vi_memory_find_last_byte`,
+ * которые ищут первое и последнее вхождение байта в участке памяти.
+ *
+ * Выровненная середина участка проверяется словами `vi_memory_word_t` с помощью
+ * приема SWAR (`vi_numeric_has_byte64`), а на процессорах x86 участки от 16 байт
+ * проверяются векторными регистрами SSE2 (или AVX2 при поддержке процессором).
+ * Чтения никогда не выходят за пределы переданного участка.
+ *
+ * Основные функции:
+ * - vi_memory_find_byte_unsafe: Ищет первое вхождение байта без проверок.
+ * - vi_memory_find_byte: Ищет первое вхождение байта в диапазоне.
+ * - vi_memory_find_last_byte_unsafe: Ищет последнее вхождение байта без проверок.
+ * - vi_memory_find_last_byte: Ищет последнее вхождение байта в диапазоне.
+ */
+
+#ifndef VI_MEMORY_FIND_H
+#define VI_MEMORY_FIND_H
+
+#include "ptr.h"
+#include "size.h"
+#include "numeric.h"
+#include "attribute.h"
+
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Ищет первое вхождение байта без проверок.
+ *
+ * @param ptr Указатель на начало участка.
+ * @param size Размер участка в байтах.
+ * @param value Искомое значение байта.
+ *
+ * @return Указатель на первый байт, равный `value`, или `nullptr`, если байт не найден.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_memory_find_byte_unsafe(const vi_ptr_t ptr, vi_usize_t size, vi_u8_t value);
+
+/**
+ * @brief Ищет первое вхождение байта в диапазоне.
+ *
+ * Эта функция проверяет диапазон с помощью `vi_ptr_is_valid_range`
+ * и вызывает `vi_memory_find_byte_unsafe` для байтов диапазона.
+ *
+ * @param begin Указатель на начало диапазона.
+ * @param end Указатель на конец диапазона.
+ * @param value Искомое значение байта.
+ *
+ * @return Указатель на первый байт, равный `value`, или `nullptr`,
+ *         если байт не найден или диапазон недействителен.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_memory_find_byte(const vi_ptr_t begin, const vi_ptr_t end, vi_u8_t value);
+
+/**
+ * @brief Ищет последнее вхождение байта без проверок.
+ *
+ * @param ptr Указатель на начало участка.
+ * @param size Размер участка в байтах.
+ * @param value Искомое значение байта.
+ *
+ * @return Указатель на последний байт, равный `value`, или `nullptr`, если байт не найден.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_memory_find_last_byte_unsafe(const vi_ptr_t ptr, vi_usize_t size, vi_u8_t value);
+
+/**
+ * @brief Ищет последнее вхождение байта в диапазоне.
+ *
+ * Эта функция проверяет диапазон с помощью `vi_ptr_is_valid_range`
+ * и вызывает `vi_memory_find_last_byte_unsafe` для байтов диапазона.
+ *
+ * @param begin Указатель на начало диапазона.
+ * @param end Указатель на конец диапазона.
+ * @param value Искомое значение байта.
+ *
+ * @return Указатель на последний байт, равный `value`, или `nullptr`,
+ *         если байт не найден или диапазон недействителен.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_memory_find_last_byte(const vi_ptr_t begin, const vi_ptr_t end, vi_u8_t value);
+
+VI_COMPILER(EXTERN_C_END)
+
+#endif // VI_MEMORY_FIND_H
@@ -0,0 +1,191 @@
+/**
+ * @file memory_range.h
+ * @brief Диапазон памяти с семантикой границ, выбранной на этапе компиляции.
+ *
+ * Этот файл содержит структуру `vi_memory_range_t`, которая хранит пару указателей
+ * begin/end, и макросы для работы с ней. Семантика границ определяется макросом
+ * `VI_MEMORY_RANGE_TYPE` (см. `memory_range_type.h`) и одинакова для всех
+ * функций библиотеки, принимающих пару указателей begin/end.
+ *
+ * Основные макросы:
+ * - vi_memory_range_init: Инициализирует диапазон парой указателей.
+ * - vi_memory_range_is_valid: Проверяет диапазон.
+ * - vi_memory_range_has: Проверяет принадлежность указателя диапазону.
+ * - vi_memory_range_first: Возвращает указатель на первый байт диапазона.
+ * - vi_memory_range_size: Возвращает количество байт в диапазоне.
+ * - vi_memory_range_set, vi_memory_range_zero, vi_memory_range_copy, vi_memory_range_move:
+ *   Вызывают соответствующие функции памяти для диапазонов.
+ * - vi_memory_range_compare, vi_memory_range_equal, vi_memory_range_find_byte,
+ *   vi_memory_range_find_last_byte: Вызывают функции сравнения и поиска для диапазонов.
+ */
+
+#ifndef VI_MEMORY_RANGE_H
+#define VI_MEMORY_RANGE_H
+
+#include "ptr.h"
+#include "ptr_traits.h"
+#include "initializer.h"
+#include "memory_set.h"
+#include "memory_copy.h"
+#include "memory_find.h"
+#include "memory_compare.h"
+#include "memory_range_type.h"
+
+/**
+ * @struct vi_memory_range_t
+ * @brief Диапазон памяти, заданный парой указателей.
+ *
+ * Интерпретация полей `begin` и `end` зависит от `VI_MEMORY_RANGE_TYPE`.
+ */
+typedef struct vi_memory_range_t
+{
+    vi_ptr_t begin; ///< Начало диапазона.
+    vi_ptr_t end;   ///< Конец диапазона.
+} vi_memory_range_t;
+
+/**
+ * @def vi_memory_range_init
+ * @brief Создает диапазон из пары указателей.
+ *
+ * @param begin Начало диапазона.
+ * @param end Конец диапазона.
+ *
+ * @return Значение типа `vi_memory_range_t`.
+ */
+#define vi_memory_range_init(begin, end) vi_struct_initializer(vi_memory_range_t, begin, end)
+
+/**
+ * @def vi_memory_range_is_valid
+ * @brief Проверяет, является ли диапазон действительным.
+ *
+ * @param range Диапазон типа `vi_memory_range_t`.
+ *
+ * @return Результат `vi_ptr_is_valid_range` для границ диапазона.
+ */
+#define vi_memory_range_is_valid(range) vi_ptr_is_valid_range((range).begin, (range).end)
+
+/**
+ * @def vi_memory_range_has
+ * @brief Проверяет, принадлежит ли указатель диапазону.
+ *
+ * @param range Диапазон типа `vi_memory_range_t`.
+ * @param ptr Проверяемый указатель.
+ *
+ * @return Результат `vi_ptr_has_range` для границ диапазона.
+ */
+#define vi_memory_range_has(range, ptr) vi_ptr_has_range((range).begin, (range).end, ptr)
+
+/**
+ * @def vi_memory_range_first
+ * @brief Возвращает указатель на первый байт диапазона.
+ *
+ * @param range Диапазон типа `vi_memory_range_t`.
+ *
+ * @return Результат `vi_ptr_range_first` для начала диапазона.
+ */
+#define vi_memory_range_first(range) vi_ptr_range_first((range).begin)
+
+/**
+ * @def vi_memory_range_size
+ * @brief Возвращает количество байт в диапазоне.
+ *
+ * @param range Диапазон типа `vi_memory_range_t`.
+ *
+ * @return Результат `vi_ptr_range_size` для границ диапазона.
+ */
+#define vi_memory_range_size(range) vi_ptr_range_size((range).begin, (range).end)
+
+/**
+ * @def vi_memory_range_set
+ * @brief Заполняет диапазон заданным байтом.
+ *
+ * @param range Диапазон типа `vi_memory_range_t`.
+ * @param value Значение байта.
+ *
+ * @return Результат `vi_memory_set` для границ диапазона.
+ */
+#define vi_memory_range_set(range, value) vi_memory_set((range).begin, (range).end, value)
+
+/**
+ * @def vi_memory_range_zero
+ * @brief Обнуляет диапазон.
+ *
+ * @param range Диапазон типа `vi_memory_range_t`.
+ *
+ * @return Результат `vi_memory_zero` для границ диапазона.
+ */
+#define vi_memory_range_zero(range) vi_memory_zero((range).begin, (range).end)
+
+/**
+ * @def vi_memory_range_copy
+ * @brief Копирует один диапазон в другой.
+ *
+ * @param dst Диапазон-приемник типа `vi_memory_range_t`.
+ * @param src Диапазон-источник типа `vi_memory_range_t`.
+ *
+ * @return Результат `vi_memory_copy` для границ диапазонов.
+ */
+#define vi_memory_range_copy(dst, src)                                                             \
+    vi_memory_copy((dst).begin, (dst).end, (src).begin, (src).end)
+
+/**
+ * @def vi_memory_range_move
+ * @brief Перемещает один диапазон в другой, допуская перекрытие.
+ *
+ * @param dst Диапазон-приемник типа `vi_memory_range_t`.
+ * @param src Диапазон-источник типа `vi_memory_range_t`.
+ *
+ * @return Результат `vi_memory_move` для границ диапазонов.
+ */
+#define vi_memory_range_move(dst, src)                                                             \
+    vi_memory_move((dst).begin, (dst).end, (src).begin, (src).end)
+
+/**
+ * @def vi_memory_range_compare
+ * @brief Сравнивает два диапазона побайтно.
+ *
+ * @param lhs Первый диапазон типа `vi_memory_range_t`.
+ * @param rhs Второй диапазон типа `vi_memory_range_t`.
+ *
+ * @return Результат `vi_memory_compare` для границ диапазонов.
+ */
+#define vi_memory_range_compare(lhs, rhs)                                                          \
+    vi_memory_compare((lhs).begin, (lhs).end, (rhs).begin, (rhs).end)
+
+/**
+ * @def vi_memory_range_equal
+ * @brief Проверяет, совпадает ли содержимое двух диапазонов.
+ *
+ * @param lhs Первый диапазон типа `vi_memory_range_t`.
+ * @param rhs Второй диапазон типа `vi_memory_range_t`.
+ *
+ * @return Результат `vi_memory_equal` для границ диапазонов.
+ */
+#define vi_memory_range_equal(lhs, rhs)                                                            \
+    vi_memory_equal((lhs).begin, (lhs).end, (rhs).begin, (rhs).end)
+
+/**
+ * @def vi_memory_range_find_byte
+ * @brief Ищет первое вхождение байта в диапазоне.
+ *
+ * @param range Диапазон типа `vi_memory_range_t`.
+ * @param value Искомый байт.
+ *
+ * @return Результат `vi_memory_find_byte` для границ диапазона.
+ */
+#define vi_memory_range_find_byte(range, value)                                                    \
+    vi_memory_find_byte((range).begin, (range).end, value)
+
+/**
+ * @def vi_memory_range_find_last_byte
+ * @brief Ищет последнее вхождение байта в диапазоне.
+ *
+ * @param range Диапазон типа `vi_memory_range_t`.
+ * @param value Искомый байт.
+ *
+ * @return Результат `vi_memory_find_last_byte` для границ диапазона.
+ */
+#define vi_memory_range_find_last_byte(range, value)                                               \
+    vi_memory_find_last_byte((range).begin, (range).end, value)
+
+#endif // VI_MEMORY_RANGE_H
@@ -0,0 +1,70 @@
+/**
+ * @file memory_range_type.h
+ * @brief Определяет тип границ диапазонов памяти, используемый библиотекой.
+ *
+ * Этот заголовочный файл содержит коды четырех типов диапазонов, соответствующих
+ * предикатам из `interval_traits.h`, и макрос `VI_MEMORY_RANGE_TYPE`, который выбирает
+ * один из них на этапе компиляции:
+ * - `VI_MEMORY_RANGE_TYPE_CLOSED` для диапазона [begin, end]
+ * - `VI_MEMORY_RANGE_TYPE_LEFT_OPENED` для диапазона (begin, end]
+ * - `VI_MEMORY_RANGE_TYPE_RIGHT_OPENED` для диапазона [begin, end)
+ * - `VI_MEMORY_RANGE_TYPE_OPENED` для диапазона (begin, end)
+ *
+ * Значение `VI_MEMORY_RANGE_TYPE` задается в `compile_definitions.cmake`.
+ * Если оно не задано, используется правый полуоткрытый диапазон.
+ *
+ * @note Библиотека и использующий ее код должны собираться с одинаковым значением
+ *       `VI_MEMORY_RANGE_TYPE`, поэтому определение передается как публичное.
+ */
+
+#ifndef VI_MEMORY_RANGE_TYPE_H
+#define VI_MEMORY_RANGE_TYPE_H
+
+/**
+ * @def VI_MEMORY_RANGE_TYPE_CLOSED
+ * @brief Определяет код замкнутого диапазона [begin, end].
+ *
+ * Оба указателя ссылаются на байты, принадлежащие диапазону.
+ */
+#define VI_MEMORY_RANGE_TYPE_CLOSED 0
+
+/**
+ * @def VI_MEMORY_RANGE_TYPE_LEFT_OPENED
+ * @brief Определяет код левого полуоткрытого диапазона (begin, end].
+ *
+ * Первый байт диапазона находится сразу после `begin`, последний — по адресу `end`.
+ */
+#define VI_MEMORY_RANGE_TYPE_LEFT_OPENED 1
+
+/**
+ * @def VI_MEMORY_RANGE_TYPE_RIGHT_OPENED
+ * @brief Определяет код правого полуоткрытого диапазона [begin, end).
+ *
+ * Первый байт диапазона находится по адресу `begin`, `end` указывает за последний байт.
+ */
+#define VI_MEMORY_RANGE_TYPE_RIGHT_OPENED 2
+
+/**
+ * @def VI_MEMORY_RANGE_TYPE_OPENED
+ * @brief Определяет код открытого диапазона (begin, end).
+ *
+ * Ни один из указателей не ссылается на байты, принадлежащие диапазону.
+ */
+#define VI_MEMORY_RANGE_TYPE_OPENED 3
+
+/**
+ * @def VI_MEMORY_RANGE_TYPE
+ * @brief Тип границ диапазонов памяти, выбранный для сборки.
+ *
+ * По умолчанию используется `VI_MEMORY_RANGE_TYPE_RIGHT_OPENED`.
+ */
+#ifndef VI_MEMORY_RANGE_TYPE
+#    define VI_MEMORY_RANGE_TYPE VI_MEMORY_RANGE_TYPE_RIGHT_OPENED
+#endif // VI_MEMORY_RANGE_TYPE
+
+#if VI_MEMORY_RANGE_TYPE < VI_MEMORY_RANGE_TYPE_CLOSED ||                                          \
+    VI_MEMORY_RANGE_TYPE > VI_MEMORY_RANGE_TYPE_OPENED
+#    error "Unsupported VI_MEMORY_RANGE_TYPE defined"
+#endif
+
+#endif // VI_MEMORY_RANGE_TYPE_H
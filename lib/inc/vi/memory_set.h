@@ -0,0 +1,100 @@
+/**
+ * @file memory_set.h
+ * @brief Функции заполнения участков памяти заданным байтом.
+ *
+ * Этот файл содержит семейство функций `vi_memory_set`, которые заполняют
+ * участок памяти одним значением байта. Реализация обрабатывает невыровненные
+ * начало и конец участка побайтово, а выровненную середину заполняет
+ * машинными словами, размноженными с помощью `vi_numeric_repeat64`.
+ *
+ * На процессорах x86 для больших участков используются векторные регистры SSE2,
+ * а при поддержке процессором — AVX2. Подходящая реализация выбирается
+ * один раз при загрузке библиотеки.
+ *
+ * Основные функции:
+ * - vi_memory_set_unsafe: Заполняет `size` байт начиная с `dst` без проверок.
+ * - vi_memory_set: Заполняет диапазон begin/end с проверкой диапазона.
+ * - vi_memory_zero_unsafe: Обнуляет `size` байт начиная с `dst` без проверок.
+ * - vi_memory_zero: Обнуляет диапазон begin/end с проверкой диапазона.
+ */
+
+#ifndef VI_MEMORY_SET_H
+#define VI_MEMORY_SET_H
+
+#include "ptr.h"
+#include "size.h"
+#include "attribute.h"
+
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Заполняет участок памяти заданным байтом без проверок.
+ *
+ * Эта функция записывает значение `value` в `size` байт, начиная с адреса `dst`.
+ * Указатель и размер не проверяются, поэтому функция предназначена для горячих участков
+ * кода, где корректность аргументов гарантирует вызывающая сторона.
+ *
+ * @param dst Указатель на начало заполняемого участка.
+ * @param size Количество байт для заполнения.
+ * @param value Значение байта, которым заполняется участок.
+ *
+ * @return Указатель `dst`.
+ *
+ * @warning Передача `nullptr` при ненулевом `size` приводит к неопределенному поведению.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_memory_set_unsafe(vi_ptr_t dst, vi_usize_t size, vi_u8_t value);
+
+/**
+ * @brief Заполняет диапазон памяти заданным байтом.
+ *
+ * Эта функция проверяет диапазон с помощью `vi_ptr_is_valid_range`
+ * и заполняет значением `value` все байты диапазона. Принадлежность границ
+ * диапазону определяется `VI_MEMORY_RANGE_TYPE`.
+ *
+ * @param begin Указатель на начало диапазона.
+ * @param end Указатель на конец диапазона.
+ * @param value Значение байта, которым заполняется диапазон.
+ *
+ * @return Указатель `begin` в случае успеха
+ *         или `nullptr`, если диапазон недействителен.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_memory_set(vi_ptr_t begin, vi_ptr_t end, vi_u8_t value);
+
+/**
+ * @brief Обнуляет участок памяти без проверок.
+ *
+ * Эквивалентна вызову `vi_memory_set_unsafe(dst, size, 0)`.
+ *
+ * @param dst Указатель на начало обнуляемого участка.
+ * @param size Количество байт для обнуления.
+ *
+ * @return Указатель `dst`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_memory_zero_unsafe(vi_ptr_t dst, vi_usize_t size);
+
+/**
+ * @brief Обнуляет диапазон памяти.
+ *
+ * Эквивалентна вызову `vi_memory_set(begin, end, 0)`.
+ *
+ * @param begin Указатель на начало диапазона.
+ * @param end Указатель на конец диапазона.
+ *
+ * @return Указатель `begin` в случае успеха
+ *         или `nullptr`, если диапазон недействителен.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_memory_zero(vi_ptr_t begin, vi_ptr_t end);
+
+VI_COMPILER(EXTERN_C_END)
+
+#endif // VI_MEMORY_SET_H
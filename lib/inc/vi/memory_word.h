@@ -0,0 +1,55 @@
+/**
+ * @file memory_word.h
+ * @brief Определение машинного слова для пословной обработки памяти.
+ *
+ * Этот файл содержит определение типа `vi_memory_word_t`, который используется
+ * алгоритмами заполнения, копирования, сравнения и поиска для обработки памяти
+ * блоками по 8 байт вместо побайтового прохода.
+ *
+ * Тип помечен атрибутом `VI_COMPILER_ATTRIBUTE_MAY_ALIAS`, поэтому через него
+ * можно обращаться к памяти любого типа без нарушения правила строгих псевдонимов.
+ *
+ * @note Обращения через `vi_memory_word_t` должны быть выровнены
+ *       по `VI_MEMORY_WORD_SIZE`, невыровненные края обрабатываются побайтово.
+ */
+
+#ifndef VI_MEMORY_WORD_H
+#define VI_MEMORY_WORD_H
+
+#include "numeric.h"
+#include "compiler.h"
+
+/**
+ * @typedef vi_memory_word16_t
+ * @brief 16-битное слово для обработки краев участка памяти.
+ *
+ * Псевдоним для `vi_u16_t`, который может ссылаться
+ * на память любого типа (атрибут `may_alias`).
+ */
+typedef vi_u16_t VI_COMPILER(ATTRIBUTE_MAY_ALIAS) vi_memory_word16_t;
+
+/**
+ * @typedef vi_memory_word32_t
+ * @brief 32-битное слово для обработки краев участка памяти.
+ *
+ * Псевдоним для `vi_u32_t`, который может ссылаться
+ * на память любого типа (атрибут `may_alias`).
+ */
+typedef vi_u32_t VI_COMPILER(ATTRIBUTE_MAY_ALIAS) vi_memory_word32_t;
+
+/**
+ * @def VI_MEMORY_WORD_SIZE
+ * @brief Размер машинного слова `vi_memory_word_t` в байтах.
+ */
+#define VI_MEMORY_WORD_SIZE VI_U64_T_SIZE
+
+/**
+ * @typedef vi_memory_word_t
+ * @brief Машинное слово для пословной обработки памяти.
+ *
+ * Псевдоним для `vi_u64_t`, который может ссылаться
+ * на память любого типа (атрибут `may_alias`).
+ */
+typedef vi_u64_t VI_COMPILER(ATTRIBUTE_MAY_ALIAS) vi_memory_word_t;
+
+#endif // VI_MEMORY_WORD_H
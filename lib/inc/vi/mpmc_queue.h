@@ -0,0 +1,206 @@
+/**
+ * @file mpmc_queue.h
+ * @brief Ограниченная очередь без блокировок для многих производителей и потребителей.
+ *
+ * Этот файл содержит функции очереди `vi_mpmc_queue_t`, через которую любое количество
+ * потоков передает сообщения фиксированного размера любому количеству других потоков.
+ * Очередь построена по схеме Д. Вьюкова: каждая ячейка хранит порядковый номер,
+ * по которому производитель узнает, что ячейка освобождена потребителем предыдущего
+ * круга, а потребитель — что производитель закончил запись. Позиции начала и конца
+ * очереди занимаются одной операцией сравнения с обменом, а запись и чтение
+ * элементов разных потоков выполняются параллельно.
+ *
+ * Каждая ячейка занимает целое число строк кэша, поэтому потоки, работающие
+ * с соседними ячейками, не мешают друг другу (false sharing). Позиции начала
+ * и конца также находятся в отдельных строках кэша.
+ *
+ * Функции с префиксом `try` не ждут: при заполненной или пустой очереди они сразу
+ * возвращают результат. Остальные функции ждут, сначала повторяя попытки с паузой
+ * процессора, а затем уступая процессор другим потокам. Пакетные функции занимают
+ * несколько соседних ячеек одной операцией сравнения с обменом.
+ *
+ * Основные функции:
+ * - vi_mpmc_queue_create: Создает очередь.
+ * - vi_mpmc_queue_destroy: Уничтожает очередь.
+ * - vi_mpmc_queue_try_push: Добавляет элемент, если есть место.
+ * - vi_mpmc_queue_push: Добавляет элемент, ожидая места.
+ * - vi_mpmc_queue_try_pop: Извлекает элемент, если он есть.
+ * - vi_mpmc_queue_pop: Извлекает элемент, ожидая его появления.
+ * - vi_mpmc_queue_try_push_n: Добавляет несколько элементов, сколько поместится.
+ * - vi_mpmc_queue_push_n: Добавляет несколько элементов, ожидая места для всех.
+ * - vi_mpmc_queue_try_pop_n: Извлекает несколько элементов, сколько есть.
+ * - vi_mpmc_queue_pop_n: Извлекает несколько элементов, ожидая хотя бы одного.
+ * - vi_mpmc_queue_size: Возвращает количество элементов в очереди.
+ * - vi_mpmc_queue_capacity: Возвращает емкость очереди.
+ */
+
+#ifndef VI_MPMC_QUEUE_H
+#define VI_MPMC_QUEUE_H
+
+#include "allocator.h"
+
+/**
+ * @brief Очередь для многих производителей и потребителей.
+ *
+ * Структура непрозрачна; очередь создается функцией `vi_mpmc_queue_create`.
+ */
+typedef struct vi_mpmc_queue_t vi_mpmc_queue_t;
+
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Создает очередь.
+ *
+ * @param backing Распределитель памяти или `nullptr` для распределителя
+ *                времени выполнения, действующего в момент создания.
+ * @param element_size Размер элемента в байтах.
+ * @param capacity Количество элементов; должно быть степенью двойки не меньше 2.
+ *
+ * @return Указатель на очередь или `nullptr`, если `element_size` равен 0,
+ *         `capacity` не подходит, распределитель недействителен
+ *         или память не удалось выделить.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_mpmc_queue_t *
+vi_mpmc_queue_create(const vi_allocator_t *backing, vi_usize_t element_size, vi_usize_t capacity);
+
+/**
+ * @brief Уничтожает очередь.
+ *
+ * Очередь не должна использоваться другими потоками во время уничтожения.
+ *
+ * @param queue Указатель на очередь или `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_mpmc_queue_destroy(vi_mpmc_queue_t *queue);
+
+/**
+ * @brief Добавляет элемент в конец очереди, если в ней есть место.
+ *
+ * @param queue Указатель на очередь.
+ * @param element Указатель на копируемый элемент.
+ *
+ * @return `true`, если элемент добавлен, или `false`, если очередь заполнена.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_mpmc_queue_try_push(vi_mpmc_queue_t *queue, const vi_ptr_t element);
+
+/**
+ * @brief Добавляет элемент в конец очереди, ожидая освобождения места.
+ *
+ * @param queue Указатель на очередь.
+ * @param element Указатель на копируемый элемент.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_mpmc_queue_push(vi_mpmc_queue_t *queue, const vi_ptr_t element);
+
+/**
+ * @brief Извлекает элемент из начала очереди, если он есть.
+ *
+ * @param queue Указатель на очередь.
+ * @param element Указатель на память, в которую копируется элемент.
+ *
+ * @return `true`, если элемент извлечен, или `false`, если очередь пуста.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_mpmc_queue_try_pop(vi_mpmc_queue_t *queue, vi_ptr_t element);
+
+/**
+ * @brief Извлекает элемент из начала очереди, ожидая его появления.
+ *
+ * @param queue Указатель на очередь.
+ * @param element Указатель на память, в которую копируется элемент.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_mpmc_queue_pop(vi_mpmc_queue_t *queue, vi_ptr_t element);
+
+/**
+ * @brief Добавляет до `count` элементов в конец очереди без ожидания.
+ *
+ * Добавленные элементы занимают соседние позиции очереди, поэтому потребители
+ * извлекают их в том же порядке без элементов других производителей между ними.
+ *
+ * @param queue Указатель на очередь.
+ * @param elements Указатель на массив копируемых элементов.
+ * @param count Количество элементов в массиве.
+ *
+ * @return Количество добавленных элементов; меньше `count`, если места не хватило.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_mpmc_queue_try_push_n(vi_mpmc_queue_t *queue, const vi_ptr_t elements, vi_usize_t count);
+
+/**
+ * @brief Добавляет `count` элементов в конец очереди, ожидая освобождения места.
+ *
+ * Если места для всех элементов сразу нет, элементы добавляются частями,
+ * между которыми могут оказаться элементы других производителей.
+ *
+ * @param queue Указатель на очередь.
+ * @param elements Указатель на массив копируемых элементов.
+ * @param count Количество элементов в массиве.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_mpmc_queue_push_n(vi_mpmc_queue_t *queue, const vi_ptr_t elements, vi_usize_t count);
+
+/**
+ * @brief Извлекает до `count` элементов из начала очереди без ожидания.
+ *
+ * @param queue Указатель на очередь.
+ * @param elements Указатель на массив, в который копируются элементы.
+ * @param count Наибольшее количество извлекаемых элементов.
+ *
+ * @return Количество извлеченных элементов.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_mpmc_queue_try_pop_n(vi_mpmc_queue_t *queue, vi_ptr_t elements, vi_usize_t count);
+
+/**
+ * @brief Извлекает до `count` элементов из начала очереди, ожидая хотя бы одного.
+ *
+ * @param queue Указатель на очередь.
+ * @param elements Указатель на массив, в который копируются элементы.
+ * @param count Наибольшее количество извлекаемых элементов; больше 0.
+ *
+ * @return Количество извлеченных элементов.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_mpmc_queue_pop_n(vi_mpmc_queue_t *queue, vi_ptr_t elements, vi_usize_t count);
+
+/**
+ * @brief Возвращает количество элементов в очереди.
+ *
+ * При одновременной работе потоков значение приблизительно.
+ *
+ * @param queue Указатель на очередь.
+ *
+ * @return Количество элементов или 0, если `queue` равен `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_mpmc_queue_size(const vi_mpmc_queue_t *queue);
+
+/**
+ * @brief Возвращает емкость очереди в элементах.
+ *
+ * @param queue Указатель на очередь.
+ *
+ * @return Емкость или 0, если `queue` равен `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_mpmc_queue_capacity(const vi_mpmc_queue_t *queue);
+
+VI_COMPILER(EXTERN_C_END)
+
+#endif // VI_MPMC_QUEUE_H
@@ -0,0 +1,173 @@
+/**
+ * @file numeric_convert.h
+ * @brief Преобразование целых чисел в десятичную строку и обратно.
+ *
+ * Этот файл содержит функции записи целых чисел в буфер вызывающего кода
+ * и разбора десятичных чисел из участка строки. Функции не используют локаль,
+ * не выделяют память и не требуют завершающего нуля во входных данных, поэтому
+ * подходят для журналов и сетевых форматов, где преобразуются миллионы чисел.
+ *
+ * Запись сначала вычисляет количество цифр по номеру старшего бита числа
+ * и таблице степеней десяти, а затем заполняет буфер с конца по две цифры
+ * за шаг из таблицы пар цифр "00" ... "99".
+ *
+ * Разбор читает по 8 символов как одно 64-битное слово (SWAR): одна проверка
+ * определяет, что все 8 символов являются цифрами, а три умножения переводят
+ * их в число. Оставшиеся символы обрабатываются по одному с проверкой
+ * переполнения по пределам из `numeric_fixed_limits.h`.
+ *
+ * Пример использования:
+ * @code
+ * vi_char_t buffer[VI_NUMERIC_FORMAT_S64_SIZE];
+ * vi_usize_t length = vi_numeric_format_s64(buffer, sizeof(buffer), -42);
+ *
+ * vi_u32_t port;
+ * if (vi_numeric_parse_u32(text, text_size, &port, nullptr) != VI_NUMERIC_SUCCESS)
+ * {
+ *     return false;
+ * }
+ * @endcode
+ *
+ * Основные функции:
+ * - vi_numeric_digits_u64: Возвращает количество десятичных цифр числа.
+ * - vi_numeric_format_u64: Записывает беззнаковое число в буфер.
+ * - vi_numeric_format_s64: Записывает знаковое число в буфер.
+ * - vi_numeric_parse_u32/u64: Разбирают беззнаковое десятичное число.
+ * - vi_numeric_parse_s32/s64: Разбирают знаковое десятичное число.
+ */
+
+#ifndef VI_NUMERIC_CONVERT_H
+#define VI_NUMERIC_CONVERT_H
+
+#include "char.h"
+#include "size.h"
+#include "return.h"
+#include "attribute.h"
+#include "numeric_fixed_types.h"
+
+/**
+ * @def VI_NUMERIC_FORMAT_U64_SIZE
+ * @brief Размер буфера, достаточный для любого `vi_u64_t` и завершающего нуля.
+ */
+#define VI_NUMERIC_FORMAT_U64_SIZE 21
+
+/**
+ * @def VI_NUMERIC_FORMAT_S64_SIZE
+ * @brief Размер буфера, достаточный для любого `vi_s64_t` со знаком и завершающего нуля.
+ */
+#define VI_NUMERIC_FORMAT_S64_SIZE 21
+
+/**
+ * @def VI_NUMERIC_SUCCESS
+ * @brief Код успешного разбора числа.
+ */
+#define VI_NUMERIC_SUCCESS ((vi_return_t)0)
+
+/**
+ * @def VI_NUMERIC_INVALID
+ * @brief Код ошибки разбора: аргументы некорректны или строка не начинается с цифры.
+ */
+#define VI_NUMERIC_INVALID ((vi_return_t)-1)
+
+/**
+ * @def VI_NUMERIC_OVERFLOW
+ * @brief Код ошибки разбора: число не помещается в тип результата.
+ */
+#define VI_NUMERIC_OVERFLOW ((vi_return_t)-2)
+
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Возвращает количество десятичных цифр числа.
+ *
+ * @param value Число.
+ *
+ * @return Количество цифр от 1 до 20; для 0 возвращается 1.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_numeric_digits_u64(vi_u64_t value);
+
+/**
+ * @brief Записывает беззнаковое число в десятичной записи и завершающий нуль.
+ *
+ * @param buffer Указатель на буфер.
+ * @param size Размер буфера; `VI_NUMERIC_FORMAT_U64_SIZE` достаточно для любого числа.
+ * @param value Число.
+ *
+ * @return Количество записанных цифр без завершающего нуля или 0, если `buffer`
+ *         равен `nullptr` или буфер мал; в последнем случае буфер не изменяется.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_numeric_format_u64(vi_char_t *buffer, vi_usize_t size, vi_u64_t value);
+
+/**
+ * @brief Записывает знаковое число в десятичной записи и завершающий нуль.
+ *
+ * Отрицательное число записывается со знаком `-`, положительное — без знака.
+ *
+ * @param buffer Указатель на буфер.
+ * @param size Размер буфера; `VI_NUMERIC_FORMAT_S64_SIZE` достаточно для любого числа.
+ * @param value Число.
+ *
+ * @return Количество записанных символов без завершающего нуля или 0, если `buffer`
+ *         равен `nullptr` или буфер мал; в последнем случае буфер не изменяется.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_numeric_format_s64(vi_char_t *buffer, vi_usize_t size, vi_s64_t value);
+
+/**
+ * @brief Разбирает беззнаковое десятичное число в начале участка строки.
+ *
+ * Разбор останавливается на первом символе, не являющемся цифрой, или в конце
+ * участка. Пробелы и знак `+` не пропускаются.
+ *
+ * @param str Указатель на начало участка.
+ * @param size Длина участка; завершающий нуль не требуется.
+ * @param value Указатель на результат; изменяется только при успехе.
+ * @param end Указатель на количество разобранных символов или `nullptr`.
+ *            При переполнении учитываются все цифры числа.
+ *
+ * @return `VI_NUMERIC_SUCCESS`, `VI_NUMERIC_INVALID`, если `str` или `value`
+ *         равен `nullptr` или участок не начинается с цифры, или `VI_NUMERIC_OVERFLOW`,
+ *         если число больше `VI_U32_T_MAX`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_return_t
+vi_numeric_parse_u32(const vi_char_t *str, vi_usize_t size, vi_u32_t *value, vi_usize_t *end);
+
+/**
+ * @brief Разбирает беззнаковое десятичное число в начале участка строки.
+ *
+ * Работает как `vi_numeric_parse_u32`, но с пределом `VI_U64_T_MAX`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_return_t
+vi_numeric_parse_u64(const vi_char_t *str, vi_usize_t size, vi_u64_t *value, vi_usize_t *end);
+
+/**
+ * @brief Разбирает знаковое десятичное число в начале участка строки.
+ *
+ * Перед цифрами допускается один знак `-` или `+`. Работает как `vi_numeric_parse_u32`,
+ * но с пределами `VI_S32_T_MIN` и `VI_S32_T_MAX`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_return_t
+vi_numeric_parse_s32(const vi_char_t *str, vi_usize_t size, vi_s32_t *value, vi_usize_t *end);
+
+/**
+ * @brief Разбирает знаковое десятичное число в начале участка строки.
+ *
+ * Работает как `vi_numeric_parse_s32`, но с пределами `VI_S64_T_MIN` и `VI_S64_T_MAX`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_return_t
+vi_numeric_parse_s64(const vi_char_t *str, vi_usize_t size, vi_s64_t *value, vi_usize_t *end);
+
+VI_COMPILER(EXTERN_C_END)
+
+#endif // VI_NUMERIC_CONVERT_H
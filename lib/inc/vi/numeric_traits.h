@@ -3,7 +3,8 @@
  * @brief Множество макросов для работы с числовыми операциями.
  *
  * Этот файл предоставляет макросы, которые упрощают операции с числами,
- * такие как проверка кратности чисел и создание чисел с заполнением через побитовые сдвиги.
+ * такие как проверка кратности чисел, создание чисел с заполнением через побитовые сдвиги
+ * и поиск байтов внутри машинного слова (SWAR).
  * Макросы используют операции побитовых сдвигов и делений для выполнения математических операций
  * и обеспечивают оптимизацию производительности для аппаратных операций.
  */
@@ -180,4 +181,56 @@
  */
 #define vi_numeric_repeat16(value) vi_numeric_repeat16_of(vi_u16_t, value)
 
+/**
+ * @def vi_numeric_has_zero_byte64
+ * @brief Проверяет, содержит ли 64-битное значение нулевой байт.
+ *
+ * Этот макрос реализует прием SWAR (SIMD within a register): вычитание единицы
+ * из каждого байта заимствует старший бит только у нулевых байтов, а маска `~value`
+ * отбрасывает байты, у которых старший бит был установлен изначально.
+ *
+ * @param value 64-битное беззнаковое значение.
+ *
+ * @return Ненулевое значение, если хотя бы один байт `value` равен нулю, иначе 0.
+ *
+ * @note Младший установленный бит результата точно указывает на первый
+ *       (в порядке little-endian) нулевой байт, но старшие биты могут быть
+ *       ложными из-за распространения заема. Для точной маски используйте
+ *       `vi_numeric_zero_byte_mask64`.
+ */
+#define vi_numeric_has_zero_byte64(value)                                                          \
+    (((value) - vi_numeric_repeat64(0x01)) & ~(value) & vi_numeric_repeat64(0x80))
+
+/**
+ * @def vi_numeric_zero_byte_mask64
+ * @brief Возвращает точную маску нулевых байтов 64-битного значения.
+ *
+ * В отличие от `vi_numeric_has_zero_byte64`, сложение выполняется только над
+ * младшими семью битами каждого байта, поэтому переноса между байтами нет,
+ * и старший бит результата установлен ровно в тех байтах, которые равны нулю.
+ *
+ * @param value 64-битное беззнаковое значение.
+ *
+ * @return Значение, в котором бит 0x80 каждого байта установлен,
+ *         если соответствующий байт `value` равен нулю.
+ */
+#define vi_numeric_zero_byte_mask64(value)                                                         \
+    (~((((value) & vi_numeric_repeat64(0x7F)) + vi_numeric_repeat64(0x7F)) | (value) |            \
+       vi_numeric_repeat64(0x7F)))
+
+/**
+ * @def vi_numeric_has_byte64
+ * @brief Проверяет, содержит ли 64-битное значение заданный байт.
+ *
+ * Байты, равные `byte`, обнуляются операцией XOR со значением, размноженным
+ * с помощью `vi_numeric_repeat64`, после чего применяется `vi_numeric_has_zero_byte64`.
+ *
+ * @param value 64-битное беззнаковое значение.
+ * @param byte Искомое значение байта.
+ *
+ * @return Ненулевое значение, если хотя бы один байт `value` равен `byte`, иначе 0.
+ */
+#define vi_numeric_has_byte64(value, byte)                                                         \
+    vi_numeric_has_zero_byte64((value) ^ vi_numeric_repeat64(byte))
+
 #endif // VI_NUMERIC_TRAITS_H
@@ -0,0 +1,182 @@
+/**
+ * @file pool.h
+ * @brief Пул объектов фиксированного размера.
+ *
+ * Этот файл содержит функции пула `vi_pool_t`, который выделяет объекты одного
+ * размера из слэбов (slab) размером в страницу памяти. Свободные объекты хранятся
+ * в интрузивных списках: указатель на следующий объект записывается в сам объект,
+ * поэтому пул не тратит память на служебные данные для каждого объекта.
+ *
+ * Каждый поток получает собственный кэш свободных объектов, поэтому выделение
+ * и освобождение обычно выполняются без синхронизации. Кэш обменивается с общим
+ * хранилищем (depot) пакетами по `VI_POOL_BATCH_SIZE` объектов под блокировкой.
+ * Номер кэша потока хранится в переменной с атрибутом `VI_ATTRIBUTE(THREAD_LOCAL)`.
+ * При завершении потока его кэш во всех пулах переносится в общее хранилище,
+ * а номер возвращается в список свободных и достается следующему потоку.
+ * Если библиотека собрана без опции `VI_OPTION_THREAD_LOCAL_VARIABLES` или без
+ * `<threads.h>`, а также для потоков сверх `VI_POOL_THREAD_CACHE_MAX` одновременно
+ * работающих, используется общий кэш под блокировкой.
+ *
+ * Объект можно освободить в любом потоке, а не только в том, который его выделил.
+ * Память слэбов возвращается базовому распределителю только при уничтожении пула.
+ *
+ * Основные функции:
+ * - vi_pool_create: Создает пул.
+ * - vi_pool_destroy: Уничтожает пул и все его объекты.
+ * - vi_pool_allocate: Выделяет объект.
+ * - vi_pool_free: Освобождает объект.
+ * - vi_pool_stats: Возвращает статистику заполненности пула.
+ */
+
+#ifndef VI_POOL_H
+#define VI_POOL_H
+
+#include "allocator.h"
+
+/**
+ * @def VI_POOL_SLAB_SIZE
+ * @brief Минимальный размер слэба в байтах.
+ *
+ * Для крупных объектов размер слэба удваивается, пока в нем не поместится
+ * хотя бы `VI_POOL_SLAB_MIN_OBJECTS` объектов.
+ */
+#define VI_POOL_SLAB_SIZE 4096
+
+/**
+ * @def VI_POOL_SLAB_MIN_OBJECTS
+ * @brief Минимальное количество объектов в слэбе.
+ */
+#define VI_POOL_SLAB_MIN_OBJECTS 8
+
+/**
+ * @def VI_POOL_BATCH_SIZE
+ * @brief Количество объектов, которыми кэш потока обменивается с общим хранилищем.
+ */
+#define VI_POOL_BATCH_SIZE 32
+
+/**
+ * @def VI_POOL_THREAD_CACHE_MAX
+ * @brief Количество кэшей потоков в каждом пуле, то есть потоков, одновременно
+ *        работающих с пулами без блокировки.
+ */
+#define VI_POOL_THREAD_CACHE_MAX 64
+
+/**
+ * @brief Пул объектов фиксированного размера.
+ *
+ * Структура непрозрачна; пул создается функцией `vi_pool_create`.
+ */
+typedef struct vi_pool_t vi_pool_t;
+
+/**
+ * @brief Статистика заполненности пула.
+ */
+typedef struct vi_pool_stats_t
+{
+    /**
+     * @brief Размер объекта в байтах после выравнивания.
+     */
+    vi_usize_t object_size;
+
+    /**
+     * @brief Размер слэба в байтах.
+     */
+    vi_usize_t slab_size;
+
+    /**
+     * @brief Количество выделенных слэбов.
+     */
+    vi_usize_t slab_count;
+
+    /**
+     * @brief Общее количество объектов во всех слэбах.
+     */
+    vi_usize_t capacity;
+
+    /**
+     * @brief Количество объектов, доступных для выделения.
+     */
+    vi_usize_t available;
+
+    /**
+     * @brief Количество выделенных объектов (`capacity - available`).
+     */
+    vi_usize_t in_use;
+} vi_pool_stats_t;
+
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Создает пул объектов заданного размера.
+ *
+ * Размер объекта округляется вверх до `2 * sizeof(vi_ptr_t)`,
+ * и объекты выравниваются на эту же величину.
+ *
+ * @param backing Распределитель слэбов или `nullptr` для распределителя
+ *                времени выполнения, действующего в момент создания.
+ * @param object_size Размер объекта в байтах.
+ *
+ * @return Указатель на пул или `nullptr`, если `object_size` равен 0,
+ *         базовый распределитель недействителен или память не удалось выделить.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_pool_t *
+vi_pool_create(const vi_allocator_t *backing, vi_usize_t object_size);
+
+/**
+ * @brief Уничтожает пул и возвращает все слэбы базовому распределителю.
+ *
+ * Все объекты пула становятся недействительными. Пул не должен
+ * использоваться другими потоками во время уничтожения.
+ *
+ * @param pool Указатель на пул или `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_pool_destroy(vi_pool_t *pool);
+
+/**
+ * @brief Выделяет объект из пула.
+ *
+ * Если библиотека собрана с опцией `VI_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE`,
+ * объект заполняется нулями.
+ *
+ * @param pool Указатель на пул.
+ *
+ * @return Указатель на объект или `nullptr`, если `pool` равен `nullptr`
+ *         или не удалось выделить новый слэб.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_pool_allocate(vi_pool_t *pool);
+
+/**
+ * @brief Возвращает объект в пул.
+ *
+ * @param pool Указатель на пул, из которого был выделен объект.
+ * @param ptr Указатель на объект или `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_pool_free(vi_pool_t *pool, vi_ptr_t ptr);
+
+/**
+ * @brief Возвращает статистику заполненности пула.
+ *
+ * Кэши других потоков читаются без синхронизации, поэтому при одновременной
+ * работе с пулом значения `available` и `in_use` приблизительны.
+ *
+ * @param pool Указатель на пул.
+ * @param stats Указатель на структуру для записи статистики.
+ *
+ * @return `true` при успехе или `false`, если один из указателей равен `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_pool_stats(vi_pool_t *pool, vi_pool_stats_t *stats);
+
+VI_COMPILER(EXTERN_C_END)
+
+#endif // VI_POOL_H
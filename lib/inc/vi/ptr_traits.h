@@ -15,6 +15,8 @@
  * - vi_ptr_diff: Вычисляет разницу между двумя указателями.
  * - vi_ptr_add_offset: Прибавляет смещение к указателю.
  * - vi_ptr_sub_offset: Вычитает смещение из указателя.
+ * - vi_ptr_is_valid_range: Проверяет диапазон с учетом `VI_MEMORY_RANGE_TYPE`.
+ * - vi_ptr_has_range: Проверяет принадлежность указателя диапазону одним сравнением.
  * - vi_ptr_is_aligned: Проверяет выравнивание указателя по заданному значению.
  * - vi_ptr_range_is_aligned: Проверяет выравнивание двух указателей.
  * - vi_ptr_range_overlap_check: Проверяет перекрытие двух диапазонов указателей.
@@ -34,6 +36,7 @@
 #include "numeric_traits.h"
 #include "interval_traits.h"
 #include "reinterpret_cast.h"
+#include "memory_range_type.h"
 
 /**
  * @def vi_addr_to_ptr
@@ -143,7 +146,7 @@
  * @return Новый указатель, полученный после прибавления смещения к адресу указателя `ptr`.
  *         Используется без предварительной проверки на NULL, что может привести к ошибкам.
  */
-#define vi_ptr_add_offset_unsafe(T, ptr, offset) vi_addr_to_ptr(T, (vi_ptr_to_addr(ptr) + offset))
+#define vi_ptr_add_offset_unsafe(T, ptr, offset) vi_addr_to_ptr(T, (vi_ptr_to_addr(ptr) + (offset)))
 
 /**
  * @def vi_ptr_add_offset
@@ -161,7 +164,8 @@
  * @return Новый указатель, полученный путем прибавления смещения к адресу указателя `ptr`.
  *         Если указатель `ptr` равен NULL, возвращается NULL.
  */
-#define vi_ptr_add_offset(T, ptr, offset) (ptr ? vi_ptr_add_offset_unsafe(T, ptr, offset) : nullptr)
+#define vi_ptr_add_offset(T, ptr, offset)                                                          \
+    ((ptr) ? vi_ptr_add_offset_unsafe(T, ptr, offset) : nullptr)
 /**
  * @def vi_ptr_sub_offset_unsafe
  * @brief Вычитает смещение из указателя без проверки на NULL.
@@ -177,7 +181,7 @@
  * @return Новый указатель, полученный после вычитания смещения из адреса указателя `ptr`.
  *         Используется без предварительной проверки на NULL, что может привести к ошибкам.
  */
-#define vi_ptr_sub_offset_unsafe(T, ptr, offset) vi_addr_to_ptr(T, (vi_ptr_to_addr(ptr) - offset))
+#define vi_ptr_sub_offset_unsafe(T, ptr, offset) vi_addr_to_ptr(T, (vi_ptr_to_addr(ptr) - (offset)))
 
 /**
  * @def vi_ptr_sub_offset
@@ -195,7 +199,49 @@
  * @return Новый указатель, полученный путем вычитания смещения из адреса указателя `ptr`.
  *         Если указатель `ptr` равен NULL, возвращается NULL.
  */
-#define vi_ptr_sub_offset(T, ptr, offset) (ptr ? vi_ptr_sub_offset_unsafe(T, ptr, offset) : nullptr)
+#define vi_ptr_sub_offset(T, ptr, offset)                                                          \
+    ((ptr) ? vi_ptr_sub_offset_unsafe(T, ptr, offset) : nullptr)
+
+/**
+ * @def vi_ptr_range_first
+ * @brief Возвращает указатель на первый байт диапазона.
+ *
+ * Для диапазонов с открытой левой границей (`VI_MEMORY_RANGE_TYPE_LEFT_OPENED`
+ * и `VI_MEMORY_RANGE_TYPE_OPENED`) первый байт находится сразу после `begin`,
+ * для остальных — по адресу `begin`.
+ *
+ * @param begin Начало диапазона.
+ *
+ * @return Указатель на первый байт диапазона в виде `vi_u8_t *`.
+ */
+#if VI_MEMORY_RANGE_TYPE == VI_MEMORY_RANGE_TYPE_LEFT_OPENED ||                                    \
+    VI_MEMORY_RANGE_TYPE == VI_MEMORY_RANGE_TYPE_OPENED
+#    define vi_ptr_range_first(begin) (vi_static_cast(vi_u8_t *, begin) + 1)
+#else
+#    define vi_ptr_range_first(begin) vi_static_cast(vi_u8_t *, begin)
+#endif
+
+/**
+ * @def vi_ptr_range_size
+ * @brief Вычисляет количество байт в диапазоне.
+ *
+ * Результат зависит от `VI_MEMORY_RANGE_TYPE`: для замкнутого диапазона
+ * это `end - begin + 1`, для полуоткрытых — `end - begin`, для открытого — `end - begin - 1`.
+ *
+ * @param begin Начало диапазона.
+ * @param end Конец диапазона.
+ *
+ * @return Количество байт в диапазоне в виде `vi_uaddr_t`.
+ *
+ * @warning Диапазон должен быть предварительно проверен с помощью `vi_ptr_is_valid_range`.
+ */
+#if VI_MEMORY_RANGE_TYPE == VI_MEMORY_RANGE_TYPE_CLOSED
+#    define vi_ptr_range_size(begin, end) (vi_addr_diff(end, begin) + 1)
+#elif VI_MEMORY_RANGE_TYPE == VI_MEMORY_RANGE_TYPE_OPENED
+#    define vi_ptr_range_size(begin, end) (vi_addr_diff(end, begin) - 1)
+#else
+#    define vi_ptr_range_size(begin, end) vi_addr_diff(end, begin)
+#endif
 
 /**
  * @def vi_ptr_is_valid_range
@@ -203,43 +249,46 @@
  *
  * Этот макрос проверяет два условия:
  * 1. Указатель `begin` не является NULL.
- * 2. Интервал, определяемый значениями `begin` и `end`, является валидным,
- *    что проверяется с помощью макроса `vi_interval_is_valid_closed`.
+ * 2. Интервал, определяемый значениями `begin` и `end`, является валидным для типа
+ *    диапазона `VI_MEMORY_RANGE_TYPE`, что проверяется соответствующим макросом
+ *    `vi_interval_is_valid_*` из `interval_traits.h`.
  *
- * Таким образом, данный макрос используется для проверки, что указатель
- * не равен NULL и что интервал, в который он попадает, является валидным.
+ * Тип диапазона выбирается на этапе компиляции, поэтому проверка сводится
+ * к одному сравнению указателей после проверки на NULL.
  *
  * @param begin Начало интервала.
  * @param end Конец интервала.
  *
- * @return Возвращает значение выражения `begin && vi_interval_is_valid_closed(begin, end)`,
- *         что истинно, если указатель `begin` не равен NULL и интервал
- *         с замкнутыми границами валиден.
+ * @return Возвращает истинное значение, если указатель `begin` не равен NULL
+ *         и интервал валиден для выбранного типа диапазона.
  *
- * @see vi_interval_is_valid_closed
+ * @see VI_MEMORY_RANGE_TYPE
  */
-#define vi_ptr_is_valid_range(begin, end) (begin && vi_interval_is_valid_closed(begin, end))
+#if VI_MEMORY_RANGE_TYPE == VI_MEMORY_RANGE_TYPE_CLOSED
+#    define vi_ptr_is_valid_range(begin, end) ((begin) && vi_interval_is_valid_closed(begin, end))
+#elif VI_MEMORY_RANGE_TYPE == VI_MEMORY_RANGE_TYPE_LEFT_OPENED
+#    define vi_ptr_is_valid_range(begin, end)                                                      \
+        ((begin) && vi_interval_is_valid_left_opened(begin, end))
+#elif VI_MEMORY_RANGE_TYPE == VI_MEMORY_RANGE_TYPE_RIGHT_OPENED
+#    define vi_ptr_is_valid_range(begin, end)                                                      \
+        ((begin) && vi_interval_is_valid_right_opened(begin, end))
+#else
+#    define vi_ptr_is_valid_range(begin, end) ((begin) && vi_interval_is_valid_opened(begin, end))
+#endif
 
 /**
  * @def vi_ptr_is_valid_ranges
- * @brief Проверяет, что два диапазона указателей являются замкнутыми.
- *
- * Этот макрос использует два диапазона указателей и проверяет,
- * что оба диапазона являются замкнутыми.
+ * @brief Проверяет, что два диапазона указателей являются действительными.
  *
- * Это достигается путем проверки того, что оба диапазона являются действительными
- * замкнутыми диапазонами, с помощью макроса `vi_ptr_is_valid_range`.
- *
- * Каждый из диапазонов должен быть замкнутым, что означает,
- * что указатели не равны нулю и что указатель `begin` не больше указателя `end`.
+ * Этот макрос проверяет оба диапазона с помощью макроса `vi_ptr_is_valid_range`,
+ * то есть с учетом типа диапазона `VI_MEMORY_RANGE_TYPE`.
  *
  * @param r1_begin Указатель на начало первого диапазона.
  * @param r1_end Указатель на конец первого диапазона.
  * @param r2_begin Указатель на начало второго диапазона.
  * @param r2_end Указатель на конец второго диапазона.
  *
- * @return Возвращает 1 (истина), если оба диапазона являются замкнутыми
- *         (проверяются с помощью макроса `vi_ptr_is_valid_closed_range`), иначе 0 (ложь).
+ * @return Возвращает 1 (истина), если оба диапазона действительны, иначе 0 (ложь).
  */
 #define vi_ptr_is_valid_ranges(r1_begin, r1_end, r2_begin, r2_end)                                 \
     (vi_ptr_is_valid_range(r1_begin, r1_end) && vi_ptr_is_valid_range(r2_begin, r2_end))
@@ -248,23 +297,36 @@
  * @def vi_ptr_has_range
  * @brief Проверяет, находится ли указатель в пределах заданного интервала.
  *
- * Этот макрос проверяет, находится ли значение указателя `ptr`
- * в пределах интервала, определяемого значениями `begin` и `end`.
+ * Этот макрос проверяет, находится ли значение указателя `ptr` в пределах
+ * интервала, определяемого значениями `begin` и `end`, с учетом типа диапазона
+ * `VI_MEMORY_RANGE_TYPE`.
  *
- * Для выполнения проверки используется макрос `vi_interval_has_closed`,
- * который проверяет, что указатель лежит внутри интервала
- * с замкнутыми границами (включая обе границы).
+ * Вместо двух сравнений из `vi_interval_has_*` используется одно беззнаковое
+ * сравнение смещений: указатели левее начала диапазона при вычитании дают
+ * очень большое беззнаковое значение и не проходят проверку.
  *
  * @param begin Начало интервала.
  * @param end Конец интервала.
  * @param ptr Указатель, значение которого проверяется на принадлежность интервалу.
  *
- * @return Возвращает значение выражения `vi_interval_has_closed(begin, end, ptr)`,
- *         что истинно, если указатель `ptr` лежит в интервале [begin, end], включая границы.
+ * @return Возвращает истинное значение, если указатель `ptr`
+ *         принадлежит интервалу выбранного типа.
+ *
+ * @warning Интервал должен быть предварительно проверен с помощью `vi_ptr_is_valid_range`.
  *
- * @see vi_interval_has_closed
+ * @see VI_MEMORY_RANGE_TYPE
  */
-#define vi_ptr_has_range(begin, end, ptr) vi_interval_has_closed(begin, end, ptr)
+#if VI_MEMORY_RANGE_TYPE == VI_MEMORY_RANGE_TYPE_CLOSED
+#    define vi_ptr_has_range(begin, end, ptr) (vi_addr_diff(ptr, begin) <= vi_addr_diff(end, begin))
+#elif VI_MEMORY_RANGE_TYPE == VI_MEMORY_RANGE_TYPE_LEFT_OPENED
+#    define vi_ptr_has_range(begin, end, ptr)                                                      \
+        (vi_addr_diff(ptr, begin) - 1 < vi_addr_diff(end, begin))
+#elif VI_MEMORY_RANGE_TYPE == VI_MEMORY_RANGE_TYPE_RIGHT_OPENED
+#    define vi_ptr_has_range(begin, end, ptr) (vi_addr_diff(ptr, begin) < vi_addr_diff(end, begin))
+#else
+#    define vi_ptr_has_range(begin, end, ptr)                                                      \
+        (vi_addr_diff(ptr, begin) - 1 < vi_addr_diff(end, begin) - 1)
+#endif
 
 /**
  * @def vi_ptr_is_aligned
@@ -389,9 +451,13 @@
  * @param type_size Размер типа для выравнивания.
  *
  * @return Новый указатель, выровненный по указанному размеру типа.
+ *
+ * @note Для выравнивания по абсолютному адресу в качестве `begin` передается `nullptr`.
  */
 #define vi_ptr_align_up(ptr, begin, type_size)                                                     \
-    (vi_ptr_add_offset(ptr, (type_size - (vi_ptr_diff(ptr, begin) % type_size)) % type_size))
+    (vi_ptr_add_offset(void,                                                                       \
+                       ptr,                                                                        \
+                       ((type_size) - (vi_addr_diff(ptr, begin) % (type_size))) % (type_size)))
 
 /**
  * @def vi_ptr_align_down
@@ -406,8 +472,10 @@
  * @param type_size Размер типа для выравнивания.
  *
  * @return Новый указатель, выровненный вниз по указанному размеру типа.
+ *
+ * @note Для выравнивания по абсолютному адресу в качестве `begin` передается `nullptr`.
  */
 #define vi_ptr_align_down(ptr, begin, type_size)                                                   \
-    (vi_ptr_sub_offset(ptr, (vi_ptr_diff(ptr, begin) % type_size)))
+    (vi_ptr_sub_offset(void, ptr, (vi_addr_diff(ptr, begin) % (type_size))))
 
 #endif // VI_PTR_TRAITS_H
@@ -31,7 +31,7 @@
  * @param V Значение, которое нужно привести.
  * @return Приведенное значение типа T.
  */
-#    define vi_reinterpret_cast(T, V) ((T)V)
+#    define vi_reinterpret_cast(T, V) ((T)(V))
 #endif // __cplusplus
 
 #endif // VI_REINTERPRET_CAST_H
\ No newline at end of file
@@ -0,0 +1,118 @@
+/**
+ * @file runtime_allocator.h
+ * @brief Распределитель памяти времени выполнения.
+ *
+ * Этот файл содержит функции доступа к общему для процесса распределителю
+ * `vi_allocator_t`, через который библиотека выделяет память. Если библиотека
+ * собрана с опцией `VI_OPTION_RUNTIME_ALLOCATOR_INIT_STDLIB`, распределитель
+ * инициализируется `vi_allocator_stdlib` при загрузке библиотеки. Иначе до вызова
+ * `vi_runtime_allocator_set` распределитель не задан, и функции выделения
+ * возвращают `nullptr`.
+ *
+ * Распределитель можно заменить в любой момент, однако блоки должны освобождаться
+ * тем же распределителем, которым были выделены. Указатель на распределитель
+ * читается и записывается атомарно, поэтому замена во время работы других потоков
+ * не является гонкой данных: поток, получивший новый распределитель, видит его
+ * полностью заполненным.
+ *
+ * Основные функции:
+ * - vi_runtime_allocator_get: Возвращает текущий распределитель.
+ * - vi_runtime_allocator_set: Заменяет текущий распределитель.
+ * - vi_runtime_allocator_allocate: Выделяет блок памяти.
+ * - vi_runtime_allocator_allocate_zeroed: Выделяет блок памяти, заполненный нулями.
+ * - vi_runtime_allocator_reallocate: Изменяет размер блока памяти.
+ * - vi_runtime_allocator_free: Освобождает блок памяти.
+ * - vi_runtime_allocator_aligned_allocate: Выделяет выровненный блок памяти.
+ * - vi_runtime_allocator_aligned_free: Освобождает выровненный блок памяти.
+ */
+
+#ifndef VI_RUNTIME_ALLOCATOR_H
+#define VI_RUNTIME_ALLOCATOR_H
+
+#include "allocator.h"
+
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Возвращает текущий распределитель времени выполнения.
+ *
+ * @return Указатель на распределитель или `nullptr`, если он не задан.
+ */
+VI_ATTRIBUTE(SYMBOL)
+const vi_allocator_t *
+vi_runtime_allocator_get(void);
+
+/**
+ * @brief Заменяет распределитель времени выполнения.
+ *
+ * Распределитель не копируется, поэтому он должен существовать,
+ * пока используется библиотекой.
+ *
+ * @param allocator Указатель на новый распределитель.
+ *
+ * @return `true`, если распределитель заменен, или `false`,
+ *         если `vi_allocator_is_valid(allocator)` ложно.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_runtime_allocator_set(const vi_allocator_t *allocator);
+
+/**
+ * @brief Выделяет блок памяти распределителем времени выполнения.
+ *
+ * @see vi_allocator_allocate
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_runtime_allocator_allocate(vi_usize_t size);
+
+/**
+ * @brief Выделяет блок памяти, заполненный нулями, распределителем времени выполнения.
+ *
+ * @see vi_allocator_allocate_zeroed
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_runtime_allocator_allocate_zeroed(vi_usize_t size);
+
+/**
+ * @brief Изменяет размер блока памяти распределителем времени выполнения.
+ *
+ * @see vi_allocator_reallocate
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_runtime_allocator_reallocate(vi_ptr_t ptr, vi_usize_t old_size, vi_usize_t new_size);
+
+/**
+ * @brief Освобождает блок памяти распределителем времени выполнения.
+ *
+ * @see vi_allocator_free
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_runtime_allocator_free(vi_ptr_t ptr, vi_usize_t size);
+
+/**
+ * @brief Выделяет выровненный блок памяти распределителем времени выполнения.
+ *
+ * @see vi_allocator_aligned_allocate
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_ptr_t
+vi_runtime_allocator_aligned_allocate(vi_usize_t size, vi_usize_t alignment);
+
+/**
+ * @brief Освобождает выровненный блок памяти распределителем времени выполнения.
+ *
+ * @see vi_allocator_aligned_free
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_runtime_allocator_aligned_free(vi_ptr_t ptr, vi_usize_t size, vi_usize_t alignment);
+
+VI_COMPILER(EXTERN_C_END)
+
+#endif // VI_RUNTIME_ALLOCATOR_H
@@ -0,0 +1,187 @@
+/**
+ * @file runtime_frame.h
+ * @brief Стек кадров для нелокального выхода при ошибках.
+ *
+ * Этот файл содержит функции, позволяющие выйти из глубоко вложенных вызовов
+ * (например, из рекурсивного разбора) сразу в точку обработки ошибки, как при
+ * исключениях try/catch. Кадр `vi_runtime_frame_t` сохраняет состояние выполнения
+ * функцией `setjmp`, а `vi_runtime_frame_throw` возвращает управление в последний
+ * сохраненный кадр функцией `longjmp` и передает ему код ошибки `vi_return_t`.
+ *
+ * Кадры хранятся в стеке вызывающих функций и связаны в список через указатель
+ * на предыдущий кадр, а поток хранит только последний кадр и глубину стека.
+ * Глубина ограничена `VI_RUNTIME_FRAME_STATE_MAX`, поэтому добавление
+ * и удаление кадра не выделяют память и выполняются за несколько команд.
+ * При включенной опции `VI_OPTION_THREAD_LOCAL_VARIABLES` у каждого потока свой
+ * стек кадров; без нее стек общий, и кадры можно использовать только в одном потоке.
+ *
+ * Пример использования:
+ * @code
+ * vi_runtime_frame_t frame;
+ *
+ * vi_runtime_frame_try(&frame)
+ * {
+ *     parse(input); // может вызвать vi_runtime_frame_throw(код)
+ *     vi_runtime_frame_pop(&frame);
+ * }
+ * else
+ * {
+ *     return vi_runtime_frame_code(&frame);
+ * }
+ * @endcode
+ *
+ * Стандарт C разрешает `setjmp` только как все условие оператора выбора, поэтому
+ * `vi_runtime_frame_try` записывается как заголовок оператора `if`, а не внутри
+ * выражения. Как и для любого `setjmp`, локальные переменные функции с кадром, изменяемые
+ * внутри блока и читаемые после перехода, должны быть объявлены `volatile`; поле кода
+ * ошибки в кадре уже объявлено так.
+ * Функция с кадром не должна завершаться, пока кадр находится в стеке.
+ *
+ * Основные функции:
+ * - vi_runtime_frame_try: Добавляет кадр и сохраняет состояние выполнения.
+ * - vi_runtime_frame_push: Добавляет кадр в стек.
+ * - vi_runtime_frame_pop: Удаляет кадр из стека.
+ * - vi_runtime_frame_throw: Переходит в последний кадр с кодом ошибки.
+ * - vi_runtime_frame_depth: Возвращает количество кадров в стеке.
+ */
+
+#ifndef VI_RUNTIME_FRAME_H
+#define VI_RUNTIME_FRAME_H
+
+#include "bool.h"
+#include "size.h"
+#include "return.h"
+#include "compiler.h"
+#include "attribute.h"
+
+#include <setjmp.h>
+
+#ifndef VI_RUNTIME_FRAME_STATE_MAX
+/**
+ * @def VI_RUNTIME_FRAME_STATE_MAX
+ * @brief Наибольшее количество кадров в стеке одного потока.
+ *
+ * Обычно задается при сборке в `compile_definitions.cmake`.
+ */
+#    define VI_RUNTIME_FRAME_STATE_MAX 255
+#endif // VI_RUNTIME_FRAME_STATE_MAX
+
+#if VI_RUNTIME_FRAME_STATE_MAX <= 0
+#    error "VI_RUNTIME_FRAME_STATE_MAX must be greater than 0"
+#endif // VI_RUNTIME_FRAME_STATE_MAX <= 0
+
+/**
+ * @def VI_RUNTIME_FRAME_OVERFLOW
+ * @brief Код ошибки кадра, который не поместился в стек.
+ */
+#define VI_RUNTIME_FRAME_OVERFLOW ((vi_return_t)-1)
+
+/**
+ * @brief Кадр с сохраненным состоянием выполнения.
+ */
+typedef struct vi_runtime_frame_t
+{
+    /**
+     * @brief Состояние выполнения, сохраненное `setjmp`.
+     */
+    jmp_buf state;
+
+    /**
+     * @brief Предыдущий кадр стека или `nullptr`.
+     */
+    struct vi_runtime_frame_t *previous;
+
+    /**
+     * @brief Код ошибки, переданный `vi_runtime_frame_throw`, или 0.
+     *
+     * Поле записывается между `setjmp` и `longjmp`, а кадр обычно является
+     * локальной переменной функции, вызвавшей `setjmp`. Без `volatile` значение,
+     * прочитанное после перехода, было бы неопределенным (C11 7.13.2.1).
+     */
+    volatile vi_return_t code;
+} vi_runtime_frame_t;
+
+/**
+ * @def vi_runtime_frame_try
+ * @brief Добавляет кадр в стек и сохраняет состояние выполнения.
+ *
+ * Раскрывается в добавление кадра и заголовок `if (setjmp(...) == 0)`, за которым
+ * следуют блок, защищенный кадром, и необязательный `else` с обработкой ошибки.
+ * Блок выполняется при первом проходе, а `else` — после перехода в кадр функцией
+ * `vi_runtime_frame_throw`; к этому моменту кадр уже удален из стека.
+ *
+ * Если стек заполнен, кадр не добавляется, а переход с кодом
+ * `VI_RUNTIME_FRAME_OVERFLOW` выполняется в последний кадр стека, то есть
+ * в ближайший внешний обработчик.
+ *
+ * Макрос раскрывается в два оператора, поэтому не может быть телом `if`, `else`
+ * или цикла без фигурных скобок.
+ */
+#define vi_runtime_frame_try(frame)                                                                \
+    if (!vi_runtime_frame_push(frame))                                                             \
+        vi_runtime_frame_throw(VI_RUNTIME_FRAME_OVERFLOW);                                         \
+    if (setjmp((frame)->state) == 0)
+
+/**
+ * @def vi_runtime_frame_code
+ * @brief Возвращает код ошибки, с которым выполнен переход в кадр.
+ */
+#define vi_runtime_frame_code(frame) ((frame)->code)
+
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Добавляет кадр в стек текущего потока.
+ *
+ * Обычно вызывается через `vi_runtime_frame_try`, который затем сохраняет
+ * состояние выполнения в кадре.
+ *
+ * @param frame Указатель на кадр; кадр должен жить, пока находится в стеке.
+ *
+ * @return `true` при успехе или `false`, если в стеке уже
+ *         `VI_RUNTIME_FRAME_STATE_MAX` кадров.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_runtime_frame_push(vi_runtime_frame_t *frame);
+
+/**
+ * @brief Удаляет кадр из стека текущего потока.
+ *
+ * Вызывается при обычном завершении блока, защищенного кадром. Если `frame`
+ * не является последним кадром стека, то внутренний кадр не был удален и остался
+ * указывать на завершившуюся функцию; переход в него был бы неопределенным, поэтому
+ * программа аварийно завершается.
+ *
+ * @param frame Указатель на кадр.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_runtime_frame_pop(const vi_runtime_frame_t *frame);
+
+/**
+ * @brief Удаляет последний кадр из стека и переходит в него с кодом `code`.
+ *
+ * Если стек пуст, программа аварийно завершается.
+ *
+ * @param code Код ошибки; должен быть отличен от 0.
+ */
+VI_ATTRIBUTE(SYMBOL)
+VI_COMPILER(ATTRIBUTE_NORETURN)
+void
+vi_runtime_frame_throw(vi_return_t code);
+
+/**
+ * @brief Возвращает количество кадров в стеке текущего потока.
+ *
+ * @return Количество кадров.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_runtime_frame_depth(void);
+
+VI_COMPILER(EXTERN_C_END)
+
+#endif // VI_RUNTIME_FRAME_H
@@ -0,0 +1,219 @@
+/**
+ * @file spsc_ring.h
+ * @brief Кольцевой буфер без блокировок для одного производителя и одного потребителя.
+ *
+ * Этот файл содержит функции кольцевого буфера `vi_spsc_ring_t`, который передает
+ * сообщения фиксированного размера из одного потока (производителя) в другой
+ * (потребителя) без блокировок. Производитель изменяет только индекс конца очереди,
+ * а потребитель — только индекс начала, поэтому для синхронизации достаточно
+ * атомарных загрузок с семантикой acquire и сохранений с семантикой release.
+ *
+ * Индексы находятся в разных строках кэша вместе с копией индекса другой стороны,
+ * прочитанной в последний раз. Сторона перечитывает индекс другой стороны только
+ * тогда, когда по копии места или сообщений не хватает, поэтому строка кэша другой
+ * стороны запрашивается примерно один раз на заполнение или опустошение буфера,
+ * а не на каждое сообщение.
+ *
+ * Помимо поэлементных функций буфер предоставляет пакетный доступ: сторона получает
+ * непрерывный участок элементов внутри буфера, заполняет или обрабатывает его на месте
+ * и затем публикует результат одним сохранением индекса. Так сообщения можно
+ * формировать и читать без промежуточного копирования.
+ *
+ * Функции производителя можно вызывать только из одного потока, функции
+ * потребителя — только из одного (другого или того же) потока.
+ *
+ * Основные функции:
+ * - vi_spsc_ring_create: Создает кольцевой буфер.
+ * - vi_spsc_ring_destroy: Уничтожает кольцевой буфер.
+ * - vi_spsc_ring_push: Добавляет элемент (производитель).
+ * - vi_spsc_ring_pop: Извлекает элемент (потребитель).
+ * - vi_spsc_ring_push_n: Добавляет несколько элементов (производитель).
+ * - vi_spsc_ring_pop_n: Извлекает несколько элементов (потребитель).
+ * - vi_spsc_ring_acquire_write: Возвращает непрерывный участок свободных элементов.
+ * - vi_spsc_ring_commit_write: Публикует записанные элементы.
+ * - vi_spsc_ring_acquire_read: Возвращает непрерывный участок готовых элементов.
+ * - vi_spsc_ring_release_read: Освобождает прочитанные элементы.
+ * - vi_spsc_ring_size: Возвращает количество элементов в буфере.
+ * - vi_spsc_ring_capacity: Возвращает емкость буфера.
+ */
+
+#ifndef VI_SPSC_RING_H
+#define VI_SPSC_RING_H
+
+#include "allocator.h"
+
+/**
+ * @brief Кольцевой буфер для одного производителя и одного потребителя.
+ *
+ * Структура непрозрачна; буфер создается функцией `vi_spsc_ring_create`.
+ */
+typedef struct vi_spsc_ring_t vi_spsc_ring_t;
+
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Создает кольцевой буфер.
+ *
+ * @param backing Распределитель памяти или `nullptr` для распределителя
+ *                времени выполнения, действующего в момент создания.
+ * @param element_size Размер элемента в байтах.
+ * @param capacity Количество элементов; должно быть степенью двойки.
+ *
+ * @return Указатель на буфер или `nullptr`, если `element_size` равен 0,
+ *         `capacity` не является степенью двойки, распределитель недействителен
+ *         или память не удалось выделить.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_spsc_ring_t *
+vi_spsc_ring_create(const vi_allocator_t *backing, vi_usize_t element_size, vi_usize_t capacity);
+
+/**
+ * @brief Уничтожает кольцевой буфер.
+ *
+ * Буфер не должен использоваться другими потоками во время уничтожения.
+ *
+ * @param ring Указатель на буфер или `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_spsc_ring_destroy(vi_spsc_ring_t *ring);
+
+/**
+ * @brief Добавляет элемент в конец буфера. Вызывается производителем.
+ *
+ * @param ring Указатель на буфер.
+ * @param element Указатель на копируемый элемент.
+ *
+ * @return `true`, если элемент добавлен, или `false`, если буфер заполнен.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_spsc_ring_push(vi_spsc_ring_t *ring, const vi_ptr_t element);
+
+/**
+ * @brief Извлекает элемент из начала буфера. Вызывается потребителем.
+ *
+ * @param ring Указатель на буфер.
+ * @param element Указатель на память, в которую копируется элемент.
+ *
+ * @return `true`, если элемент извлечен, или `false`, если буфер пуст.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_spsc_ring_pop(vi_spsc_ring_t *ring, vi_ptr_t element);
+
+/**
+ * @brief Добавляет до `count` элементов в конец буфера. Вызывается производителем.
+ *
+ * Все добавленные элементы публикуются одним сохранением индекса.
+ *
+ * @param ring Указатель на буфер.
+ * @param elements Указатель на массив копируемых элементов.
+ * @param count Количество элементов в массиве.
+ *
+ * @return Количество добавленных элементов; меньше `count`, если места не хватило.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_spsc_ring_push_n(vi_spsc_ring_t *ring, const vi_ptr_t elements, vi_usize_t count);
+
+/**
+ * @brief Извлекает до `count` элементов из начала буфера. Вызывается потребителем.
+ *
+ * @param ring Указатель на буфер.
+ * @param elements Указатель на массив, в который копируются элементы.
+ * @param count Наибольшее количество извлекаемых элементов.
+ *
+ * @return Количество извлеченных элементов.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_spsc_ring_pop_n(vi_spsc_ring_t *ring, vi_ptr_t elements, vi_usize_t count);
+
+/**
+ * @brief Возвращает непрерывный участок свободных элементов для записи на месте.
+ *         Вызывается производителем.
+ *
+ * Участок не пересекает конец внутреннего массива, поэтому может оказаться короче
+ * свободного места. Элементы становятся видны потребителю только после
+ * `vi_spsc_ring_commit_write`.
+ *
+ * @param ring Указатель на буфер.
+ * @param span Указатель, по которому записывается адрес первого свободного элемента.
+ * @param count Наибольшее количество требуемых элементов.
+ *
+ * @return Количество элементов в участке; 0, если буфер заполнен.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_spsc_ring_acquire_write(vi_spsc_ring_t *ring, vi_ptr_t *span, vi_usize_t count);
+
+/**
+ * @brief Публикует `count` элементов, записанных в участок от `vi_spsc_ring_acquire_write`.
+ *        Вызывается производителем.
+ *
+ * @param ring Указатель на буфер.
+ * @param count Количество записанных элементов; не больше длины полученного участка.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_spsc_ring_commit_write(vi_spsc_ring_t *ring, vi_usize_t count);
+
+/**
+ * @brief Возвращает непрерывный участок готовых элементов для чтения на месте.
+ *        Вызывается потребителем.
+ *
+ * Участок не пересекает конец внутреннего массива, поэтому может оказаться короче
+ * количества готовых элементов. Элементы остаются в буфере до вызова
+ * `vi_spsc_ring_release_read`.
+ *
+ * @param ring Указатель на буфер.
+ * @param span Указатель, по которому записывается адрес первого готового элемента.
+ * @param count Наибольшее количество требуемых элементов.
+ *
+ * @return Количество элементов в участке; 0, если буфер пуст.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_spsc_ring_acquire_read(vi_spsc_ring_t *ring, vi_ptr_t *span, vi_usize_t count);
+
+/**
+ * @brief Освобождает `count` элементов участка от `vi_spsc_ring_acquire_read`.
+ *        Вызывается потребителем.
+ *
+ * @param ring Указатель на буфер.
+ * @param count Количество прочитанных элементов; не больше длины полученного участка.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_spsc_ring_release_read(vi_spsc_ring_t *ring, vi_usize_t count);
+
+/**
+ * @brief Возвращает количество элементов в буфере.
+ *
+ * При одновременной работе производителя и потребителя значение приблизительно.
+ *
+ * @param ring Указатель на буфер.
+ *
+ * @return Количество элементов или 0, если `ring` равен `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_spsc_ring_size(const vi_spsc_ring_t *ring);
+
+/**
+ * @brief Возвращает емкость буфера в элементах.
+ *
+ * @param ring Указатель на буфер.
+ *
+ * @return Емкость или 0, если `ring` равен `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_spsc_ring_capacity(const vi_spsc_ring_t *ring);
+
+VI_COMPILER(EXTERN_C_END)
+
+#endif // VI_SPSC_RING_H
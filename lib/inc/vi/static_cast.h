@@ -43,7 +43,7 @@
  * @endcode
  */
 #ifndef __cplusplus
-#    define vi_static_cast(T, V) ((T)V) ///< В языке C используется приведение типов через (T)V
+#    define vi_static_cast(T, V) ((T)(V)) ///< В языке C используется приведение типов через (T)V
 #else
 #    define vi_static_cast(T, V) static_cast<T>(V) ///< В C++ используется оператор static_cast
 #endif
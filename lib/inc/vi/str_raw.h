@@ -1,7 +1,37 @@
+/**
+ * @file str_raw.h
+ * @brief Тип и функции для работы со строками, завершающимися нулевым символом.
+ *
+ * Этот файл содержит тип `vi_str_raw_t` и функции длины, сравнения и поиска
+ * для строк, завершающихся нулевым символом. Символы сравниваются как беззнаковые
+ * байты независимо от знаковости `vi_char_t`.
+ *
+ * Так как длина строки заранее неизвестна, реализации читают память только
+ * выровненными блоками (машинными словами или векторными регистрами SSE2/AVX2)
+ * либо проверяют, что блок не пересекает границу страницы. Поэтому чтение после
+ * завершающего нуля никогда не затрагивает следующую страницу памяти.
+ *
+ * Поиск подстроки использует алгоритм Two-Way, поэтому время поиска линейно
+ * зависит от длины строки независимо от содержимого искомой подстроки.
+ *
+ * Основные функции:
+ * - vi_str_raw_length: Возвращает длину строки.
+ * - vi_str_raw_length_n: Возвращает длину строки, ограниченную заданным значением.
+ * - vi_str_raw_compare: Лексикографически сравнивает две строки.
+ * - vi_str_raw_compare_n: Сравнивает не более заданного числа символов двух строк.
+ * - vi_str_raw_find_char: Ищет первое вхождение символа.
+ * - vi_str_raw_find: Ищет первое вхождение подстроки.
+ * - vi_str_raw_span: Возвращает длину начального участка из символов набора.
+ * - vi_str_raw_cspan: Возвращает длину начального участка без символов набора.
+ */
+
 #ifndef VI_STR_RAW_H
 #define VI_STR_RAW_H
 
 #include "char.h"
+#include "size.h"
+#include "return.h"
+#include "attribute.h"
 
 /**
  * @def vi_str_raw_t
@@ -23,4 +53,121 @@
  */
 #define vi_str_raw_t vi_char_t *
 
-#endif // VI_STR_RAW_H
\ No newline at end of file
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Возвращает длину строки.
+ *
+ * @param str Указатель на строку.
+ *
+ * @return Количество символов до завершающего нуля или 0, если `str` равен `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_str_raw_length(const vi_str_raw_t str);
+
+/**
+ * @brief Возвращает длину строки, но не более `max`.
+ *
+ * Функция не читает память за пределами первых `max` символов,
+ * кроме байтов того же выровненного блока.
+ *
+ * @param str Указатель на строку.
+ * @param max Максимальное количество проверяемых символов.
+ *
+ * @return Наименьшее из длины строки и `max` или 0, если `str` равен `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_str_raw_length_n(const vi_str_raw_t str, vi_usize_t max);
+
+/**
+ * @brief Лексикографически сравнивает две строки.
+ *
+ * Строка `nullptr` считается меньше любой другой строки.
+ *
+ * @param lhs Указатель на первую строку.
+ * @param rhs Указатель на вторую строку.
+ *
+ * @return Отрицательное значение, если `lhs` меньше `rhs`,
+ *         положительное значение, если больше, и 0, если строки равны.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_return_t
+vi_str_raw_compare(const vi_str_raw_t lhs, const vi_str_raw_t rhs);
+
+/**
+ * @brief Сравнивает не более `size` символов двух строк.
+ *
+ * Строка `nullptr` считается меньше любой другой строки.
+ *
+ * @param lhs Указатель на первую строку.
+ * @param rhs Указатель на вторую строку.
+ * @param size Максимальное количество сравниваемых символов.
+ *
+ * @return Отрицательное значение, 0 или положительное значение,
+ *         аналогично `vi_str_raw_compare`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_return_t
+vi_str_raw_compare_n(const vi_str_raw_t lhs, const vi_str_raw_t rhs, vi_usize_t size);
+
+/**
+ * @brief Ищет первое вхождение символа в строке.
+ *
+ * Завершающий нуль считается частью строки, поэтому поиск символа `0`
+ * возвращает указатель на конец строки.
+ *
+ * @param str Указатель на строку.
+ * @param ch Искомый символ.
+ *
+ * @return Указатель на найденный символ или `nullptr`,
+ *         если символ не найден или `str` равен `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_str_raw_t
+vi_str_raw_find_char(const vi_str_raw_t str, vi_char_t ch);
+
+/**
+ * @brief Ищет первое вхождение подстроки в строке.
+ *
+ * @param str Указатель на строку, в которой выполняется поиск.
+ * @param substr Указатель на искомую подстроку.
+ *
+ * @return Указатель на начало найденной подстроки, `str`, если подстрока пуста,
+ *         или `nullptr`, если подстрока не найдена или один из указателей равен `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_str_raw_t
+vi_str_raw_find(const vi_str_raw_t str, const vi_str_raw_t substr);
+
+/**
+ * @brief Возвращает длину начального участка строки, состоящего только из символов `accept`.
+ *
+ * @param str Указатель на строку.
+ * @param accept Указатель на строку с допустимыми символами.
+ *
+ * @return Длина начального участка или 0, если один из указателей равен `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_str_raw_span(const vi_str_raw_t str, const vi_str_raw_t accept);
+
+/**
+ * @brief Возвращает длину начального участка строки, не содержащего символов `reject`.
+ *
+ * @param str Указатель на строку.
+ * @param reject Указатель на строку с запрещенными символами.
+ *
+ * @return Длина начального участка или 0, если `str` равен `nullptr`.
+ *         Если `reject` равен `nullptr`, возвращается длина строки.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_str_raw_cspan(const vi_str_raw_t str, const vi_str_raw_t reject);
+
+VI_COMPILER(EXTERN_C_END)
+
+#endif // VI_STR_RAW_H
@@ -0,0 +1,205 @@
+/**
+ * @file thread_pool.h
+ * @brief Пул потоков с перехватом задач.
+ *
+ * Этот файл содержит функции пула `vi_thread_pool_t` — фиксированного набора рабочих
+ * потоков, выполняющих задачи библиотеки и приложения. У каждого рабочего потока есть
+ * собственный дек задач Чейза — Лева: поток добавляет и забирает задачи с одного конца
+ * дека без блокировок, а простаивающие потоки перехватывают задачи с другого конца
+ * деков соседей. Задачи, добавленные из потоков вне пула, попадают в общую очередь
+ * `vi_mpmc_queue_t`. Потоки, которым нечего делать, засыпают на условной переменной
+ * и просыпаются при добавлении новых задач.
+ *
+ * Функция `vi_thread_pool_parallel_for` делит диапазон индексов адаптивно: поток
+ * отделяет половину оставшегося диапазона в свой дек только тогда, когда дек пуст,
+ * то есть когда прежние части уже перехвачены другими потоками. При равномерной
+ * нагрузке диапазон делится всего на несколько частей, а при неравномерной —
+ * дробится до `grain` индексов там, где другие потоки простаивают.
+ *
+ * Номер текущего рабочего потока хранится в переменной потока
+ * (`VI_ATTRIBUTE(THREAD_LOCAL)`); без опции `VI_OPTION_THREAD_LOCAL_VARIABLES`
+ * поток определяется сравнением с идентификаторами рабочих потоков.
+ *
+ * При включенной опции `VI_OPTION_THREAD_POOL_GLOBAL` библиотека создает общий пул
+ * из `VI_THREAD_POOL_GLOBAL_WORKERS` потоков при загрузке и уничтожает его при
+ * выгрузке; пул доступен через `vi_thread_pool_global`.
+ *
+ * Все функции, принимающие пул, допускают `nullptr`: задачи тогда выполняются
+ * сразу в вызывающем потоке. Это позволяет писать код, работающий и без пула.
+ *
+ * Основные функции:
+ * - vi_thread_pool_create: Создает пул и запускает рабочие потоки.
+ * - vi_thread_pool_destroy: Дожидается задач и останавливает пул.
+ * - vi_thread_pool_submit: Добавляет задачу.
+ * - vi_thread_pool_wait: Дожидается выполнения всех задач.
+ * - vi_thread_pool_parallel_for: Выполняет функцию над диапазоном индексов параллельно.
+ * - vi_thread_pool_size: Возвращает количество рабочих потоков.
+ * - vi_thread_pool_worker_index: Возвращает номер текущего рабочего потока.
+ * - vi_thread_pool_global: Возвращает общий пул библиотеки.
+ */
+
+#ifndef VI_THREAD_POOL_H
+#define VI_THREAD_POOL_H
+
+#include "allocator.h"
+
+#ifndef VI_THREAD_POOL_GLOBAL_WORKERS
+/**
+ * @def VI_THREAD_POOL_GLOBAL_WORKERS
+ * @brief Количество рабочих потоков общего пула; 0 — по числу процессоров.
+ *
+ * Обычно задается при сборке в `compile_definitions.cmake`.
+ */
+#    define VI_THREAD_POOL_GLOBAL_WORKERS 0
+#endif // VI_THREAD_POOL_GLOBAL_WORKERS
+
+/**
+ * @def VI_THREAD_POOL_NPOS
+ * @brief Номер потока, не являющегося рабочим потоком пула.
+ */
+#define VI_THREAD_POOL_NPOS VI_USIZE_T_MAX
+
+/**
+ * @brief Пул потоков.
+ *
+ * Структура непрозрачна; пул создается функцией `vi_thread_pool_create`.
+ */
+typedef struct vi_thread_pool_t vi_thread_pool_t;
+
+/**
+ * @brief Тип функции задачи.
+ *
+ * @param arg Аргумент, переданный при добавлении задачи.
+ */
+typedef void (*vi_thread_pool_task_fn_t)(vi_ptr_t arg);
+
+/**
+ * @brief Тип функции, обрабатывающей часть диапазона индексов.
+ *
+ * @param arg Аргумент, переданный `vi_thread_pool_parallel_for`.
+ * @param begin Первый индекс части.
+ * @param end Индекс, следующий за последним индексом части.
+ */
+typedef void (*vi_thread_pool_range_fn_t)(vi_ptr_t arg, vi_usize_t begin, vi_usize_t end);
+
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Создает пул и запускает рабочие потоки.
+ *
+ * @param backing Распределитель памяти или `nullptr` для распределителя
+ *                времени выполнения, действующего в момент создания.
+ * @param worker_count Количество рабочих потоков; 0 — по числу процессоров.
+ *
+ * @return Указатель на пул или `nullptr`, если распределитель недействителен,
+ *         память не удалось выделить, потоки не удалось запустить
+ *         или платформа не поддерживает потоки C11.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_thread_pool_t *
+vi_thread_pool_create(const vi_allocator_t *backing, vi_usize_t worker_count);
+
+/**
+ * @brief Дожидается выполнения всех задач, останавливает рабочие потоки и уничтожает пул.
+ *
+ * Не должна вызываться из задач этого пула.
+ *
+ * @param pool Указатель на пул или `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_thread_pool_destroy(vi_thread_pool_t *pool);
+
+/**
+ * @brief Добавляет задачу в пул.
+ *
+ * Задача, добавленная из рабочего потока, попадает в его дек и в первую очередь
+ * выполняется им самим; задача из другого потока попадает в общую очередь.
+ * Если общая очередь заполнена, функция ждет освобождения места. Если заполнен
+ * дек рабочего потока, задача выполняется сразу.
+ *
+ * @param pool Указатель на пул или `nullptr` для выполнения задачи в вызывающем потоке.
+ * @param fn Функция задачи.
+ * @param arg Аргумент функции.
+ *
+ * @return `true`, если задача добавлена или выполнена, или `false`, если `fn` равен `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+bool
+vi_thread_pool_submit(vi_thread_pool_t *pool, vi_thread_pool_task_fn_t fn, vi_ptr_t arg);
+
+/**
+ * @brief Дожидается выполнения всех добавленных задач.
+ *
+ * Пока задачи есть в очередях, вызывающий поток выполняет их сам, а затем засыпает
+ * до завершения задач, выполняемых рабочими потоками. Не должна вызываться
+ * из задач этого пула.
+ *
+ * @param pool Указатель на пул или `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_thread_pool_wait(vi_thread_pool_t *pool);
+
+/**
+ * @brief Вызывает `fn` для непересекающихся частей диапазона `[begin, end)`,
+ *        распределяя части между рабочими потоками.
+ *
+ * Вызывающий поток обрабатывает начало диапазона и выполняет задачи пула, пока
+ * не будет обработан весь диапазон. Функцию можно вызывать из задач того же пула.
+ *
+ * @param pool Указатель на пул или `nullptr` для одного вызова `fn(arg, begin, end)`.
+ * @param begin Первый индекс диапазона.
+ * @param end Индекс, следующий за последним индексом диапазона.
+ * @param grain Наибольший размер части, передаваемой `fn` за один вызов; 0 выбирает
+ *              размер так, чтобы на каждый рабочий поток пришлось около 8 частей.
+ * @param fn Функция, обрабатывающая часть диапазона.
+ * @param arg Аргумент функции.
+ */
+VI_ATTRIBUTE(SYMBOL)
+void
+vi_thread_pool_parallel_for(vi_thread_pool_t *pool,
+                            vi_usize_t begin,
+                            vi_usize_t end,
+                            vi_usize_t grain,
+                            vi_thread_pool_range_fn_t fn,
+                            vi_ptr_t arg);
+
+/**
+ * @brief Возвращает количество рабочих потоков пула.
+ *
+ * @param pool Указатель на пул.
+ *
+ * @return Количество потоков или 0, если `pool` равен `nullptr`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_thread_pool_size(const vi_thread_pool_t *pool);
+
+/**
+ * @brief Возвращает номер текущего потока среди рабочих потоков пула.
+ *
+ * @param pool Указатель на пул.
+ *
+ * @return Номер от 0 до `vi_thread_pool_size(pool) - 1` или `VI_THREAD_POOL_NPOS`,
+ *         если текущий поток не является рабочим потоком пула.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_thread_pool_worker_index(const vi_thread_pool_t *pool);
+
+/**
+ * @brief Возвращает общий пул библиотеки.
+ *
+ * @return Указатель на пул или `nullptr`, если опция `VI_OPTION_THREAD_POOL_GLOBAL`
+ *         выключена или пул не удалось создать.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_thread_pool_t *
+vi_thread_pool_global(void);
+
+VI_COMPILER(EXTERN_C_END)
+
+#endif // VI_THREAD_POOL_H
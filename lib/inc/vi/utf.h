@@ -0,0 +1,188 @@
+/**
+ * @file utf.h
+ * @brief Проверка UTF-8 и преобразование между UTF-8, UTF-16 и UTF-32.
+ *
+ * Этот файл содержит функции проверки текста UTF-8 вида `vi_char_t`, перевода его
+ * в единицы UTF-16 (`vi_uchar16_t`) и кодовые точки UTF-32 (`vi_uchar32_t`) и обратного
+ * перевода UTF-16 в UTF-8, а также функции подсчета длины результата. Функции
+ * не выделяют память и не требуют завершающего нуля.
+ *
+ * Проверка следует RFC 3629: отклоняются избыточно длинные последовательности,
+ * суррогаты и значения больше U+10FFFF. На процессорах x86 `vi_utf8_validate`
+ * проверяет по 16 (SSSE3) или 32 (AVX2) байта за шаг по трем таблицам `pshufb`,
+ * индексируемым тетрадами соседних байтов, как в simdjson и simdutf. Преобразования
+ * и подсчет длины переводят участки ASCII по 16 (SSE2) или 32 (AVX2) байта за шаг,
+ * а остальные символы разбирают по одному с той же проверкой. Реализация выбирается
+ * при загрузке библиотеки по `vi_cpu_has`.
+ *
+ * При ошибке сообщается смещение первой единицы недопустимой последовательности.
+ * Последовательность, оборванная концом входа, отличается от недопустимой кодом
+ * `VI_UTF_TRUNCATED`, что позволяет дочитать ее при потоковой обработке.
+ *
+ * Пример использования:
+ * @code
+ * vi_usize_t result;
+ * if (vi_utf8_to_utf16(units, text, text_size, &result) != VI_UTF_SUCCESS)
+ * {
+ *     // result содержит смещение недопустимой последовательности в text
+ * }
+ * @endcode
+ *
+ * Основные функции:
+ * - vi_utf8_validate: Проверяет текст UTF-8.
+ * - vi_utf8_to_utf16: Переводит UTF-8 в UTF-16.
+ * - vi_utf8_to_utf32: Переводит UTF-8 в UTF-32.
+ * - vi_utf16_to_utf8: Переводит UTF-16 в UTF-8.
+ * - vi_utf8_length: Считает кодовые точки корректного текста UTF-8.
+ * - vi_utf8_length_utf16: Считает единицы UTF-16 для корректного текста UTF-8.
+ * - vi_utf16_length_utf8: Считает байты UTF-8 для корректного текста UTF-16.
+ */
+
+#ifndef VI_UTF_H
+#define VI_UTF_H
+
+#include "char.h"
+#include "size.h"
+#include "wchar.h"
+#include "return.h"
+#include "attribute.h"
+
+/**
+ * @def vi_utf16_to_utf8_size
+ * @brief Наибольшее количество байтов UTF-8 для `size` единиц UTF-16.
+ */
+#define vi_utf16_to_utf8_size(size) ((size) * 3)
+
+/**
+ * @def VI_UTF_SUCCESS
+ * @brief Код успешной проверки или преобразования.
+ */
+#define VI_UTF_SUCCESS ((vi_return_t)0)
+
+/**
+ * @def VI_UTF_INVALID
+ * @brief Код ошибки: аргументы некорректны.
+ */
+#define VI_UTF_INVALID ((vi_return_t)-1)
+
+/**
+ * @def VI_UTF_BAD_SEQUENCE
+ * @brief Код ошибки: недопустимая последовательность или непарный суррогат.
+ */
+#define VI_UTF_BAD_SEQUENCE ((vi_return_t)-2)
+
+/**
+ * @def VI_UTF_TRUNCATED
+ * @brief Код ошибки: вход заканчивается внутри последовательности.
+ */
+#define VI_UTF_TRUNCATED ((vi_return_t)-3)
+
+// ------------------------------------------ Методы ------------------------------------------ //
+
+VI_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Проверяет текст UTF-8.
+ *
+ * @param src Указатель на текст.
+ * @param size Количество байтов.
+ * @param offset Указатель на смещение первой недопустимой последовательности или `size`
+ *               при успехе; может быть `nullptr`.
+ *
+ * @return `VI_UTF_SUCCESS`, `VI_UTF_INVALID`, если `src` равен `nullptr`,
+ *         `VI_UTF_BAD_SEQUENCE` или `VI_UTF_TRUNCATED`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_return_t
+vi_utf8_validate(const vi_char_t *src, vi_usize_t size, vi_usize_t *offset);
+
+/**
+ * @brief Переводит текст UTF-8 в UTF-16.
+ *
+ * Кодовые точки больше U+FFFF записываются суррогатными парами. При ошибке буфер
+ * `dst` может быть частично заполнен.
+ *
+ * @param dst Указатель на буфер из `size` единиц или из `vi_utf8_length_utf16` единиц
+ *            для заранее проверенного текста.
+ * @param src Указатель на текст.
+ * @param size Количество байтов.
+ * @param result Указатель на количество записанных единиц при успехе или смещение
+ *               недопустимой последовательности при ошибке; может быть `nullptr`.
+ *
+ * @return `VI_UTF_SUCCESS`, `VI_UTF_INVALID`, если `dst` или `src` равен `nullptr`,
+ *         `VI_UTF_BAD_SEQUENCE` или `VI_UTF_TRUNCATED`.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_return_t
+vi_utf8_to_utf16(vi_uchar16_t *dst, const vi_char_t *src, vi_usize_t size, vi_usize_t *result);
+
+/**
+ * @brief Переводит текст UTF-8 в UTF-32.
+ *
+ * Работает как `vi_utf8_to_utf16`; размер буфера `dst` — `size` кодовых точек
+ * или `vi_utf8_length` для заранее проверенного текста.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_return_t
+vi_utf8_to_utf32(vi_uchar32_t *dst, const vi_char_t *src, vi_usize_t size, vi_usize_t *result);
+
+/**
+ * @brief Переводит текст UTF-16 в UTF-8.
+ *
+ * @param dst Указатель на буфер из `vi_utf16_to_utf8_size(size)` байтов или из
+ *            `vi_utf16_length_utf8` байтов для заранее проверенного текста.
+ * @param src Указатель на единицы UTF-16 в порядке байтов процессора.
+ * @param size Количество единиц.
+ * @param result Указатель на количество записанных байтов при успехе или смещение
+ *               непарного суррогата при ошибке; может быть `nullptr`.
+ *
+ * @return `VI_UTF_SUCCESS`, `VI_UTF_INVALID`, если `dst` или `src` равен `nullptr`,
+ *         `VI_UTF_BAD_SEQUENCE` или `VI_UTF_TRUNCATED`, если последняя единица —
+ *         старший суррогат.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_return_t
+vi_utf16_to_utf8(vi_char_t *dst, const vi_uchar16_t *src, vi_usize_t size, vi_usize_t *result);
+
+/**
+ * @brief Считает кодовые точки текста UTF-8.
+ *
+ * Считаются байты, не являющиеся продолжением последовательности. Текст не проверяется;
+ * для некорректного текста результат не превышает `size`.
+ *
+ * @param src Указатель на текст или `nullptr` при нулевом `size`.
+ * @param size Количество байтов.
+ *
+ * @return Количество кодовых точек, то есть единиц UTF-32.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_utf8_length(const vi_char_t *src, vi_usize_t size);
+
+/**
+ * @brief Считает единицы UTF-16, необходимые для текста UTF-8.
+ *
+ * Работает как `vi_utf8_length`, но четырехбайтовые последовательности считаются
+ * дважды.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_utf8_length_utf16(const vi_char_t *src, vi_usize_t size);
+
+/**
+ * @brief Считает байты UTF-8, необходимые для текста UTF-16.
+ *
+ * Текст не проверяется: каждый суррогат считается за 2 байта, что для пары дает 4.
+ *
+ * @param src Указатель на единицы UTF-16 или `nullptr` при нулевом `size`.
+ * @param size Количество единиц.
+ *
+ * @return Количество байтов.
+ */
+VI_ATTRIBUTE(SYMBOL)
+vi_usize_t
+vi_utf16_length_utf8(const vi_uchar16_t *src, vi_usize_t size);
+
+VI_COMPILER(EXTERN_C_END)
+
+#endif // VI_UTF_H
@@ -0,0 +1,269 @@
+#include <vi/allocator.h>
+/* Дополнительные модули */
+#include <vi/nullptr.h>
+#include <vi/bit_traits.h>
+#include <vi/memory_set.h>
+
+#include <stdlib.h>
+#include <stddef.h>
+
+#if (VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC)
+#    include <malloc.h>
+#endif // (VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC)
+
+static vi_ptr_t
+vi_allocator_stdlib_allocate(vi_ptr_t context, vi_usize_t size)
+{
+    (void)context;
+    return malloc(size);
+}
+
+/**
+ * @brief Выделяет обнуленный блок функцией `calloc`.
+ *
+ * `calloc` не заполняет нулями память, только что полученную от операционной
+ * системы, поэтому крупные блоки выделяются без записи в каждую страницу.
+ */
+static vi_ptr_t
+vi_allocator_stdlib_allocate_zeroed(vi_ptr_t context, vi_usize_t size)
+{
+    (void)context;
+    return calloc(1, size);
+}
+
+static vi_ptr_t
+vi_allocator_stdlib_reallocate(vi_ptr_t context,
+                               vi_ptr_t ptr,
+                               vi_usize_t old_size,
+                               vi_usize_t new_size)
+{
+    (void)context;
+    (void)old_size;
+    return realloc(ptr, new_size);
+}
+
+static void
+vi_allocator_stdlib_free(vi_ptr_t context, vi_ptr_t ptr, vi_usize_t size)
+{
+    (void)context;
+    (void)size;
+    free(ptr);
+}
+
+/**
+ * @brief Выделяет выровненный блок функциями стандартной библиотеки.
+ *
+ * `aligned_alloc` требует, чтобы размер был кратен выравниванию,
+ * поэтому размер округляется вверх.
+ */
+static vi_ptr_t
+vi_allocator_stdlib_aligned_allocate(vi_ptr_t context, vi_usize_t size, vi_usize_t alignment)
+{
+    (void)context;
+#if (VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC)
+    return _aligned_malloc(size, alignment);
+#else
+    if (size > VI_USIZE_T_MAX - (alignment - 1))
+    {
+        return nullptr;
+    }
+    return aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+#endif // (VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC)
+}
+
+/**
+ * @brief Выделяет выровненный обнуленный блок.
+ *
+ * Блоки с выравниванием не больше `max_align_t` выделяются функцией `calloc`:
+ * ее результат достаточно выровнен, освобождается функцией `free`, и свежие страницы
+ * не заполняются повторно. В MSVC такие блоки нельзя освободить `_aligned_free`,
+ * поэтому там и при большем выравнивании блок обнуляется после выделения.
+ */
+static vi_ptr_t
+vi_allocator_stdlib_aligned_allocate_zeroed(vi_ptr_t context,
+                                            vi_usize_t size,
+                                            vi_usize_t alignment)
+{
+#if (VI_COMPILER_TYPE != VI_COMPILER_TYPE_MSVC)
+    if (alignment <= _Alignof(max_align_t))
+    {
+        return vi_allocator_stdlib_allocate_zeroed(context, size);
+    }
+#endif // (VI_COMPILER_TYPE != VI_COMPILER_TYPE_MSVC)
+
+    vi_ptr_t ptr = vi_allocator_stdlib_aligned_allocate(context, size, alignment);
+
+    if (ptr)
+    {
+        vi_memory_zero_unsafe(ptr, size);
+    }
+    return ptr;
+}
+
+static void
+vi_allocator_stdlib_aligned_free(vi_ptr_t context,
+                                 vi_ptr_t ptr,
+                                 vi_usize_t size,
+                                 vi_usize_t alignment)
+{
+    (void)context;
+    (void)size;
+    (void)alignment;
+#if (VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC)
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif // (VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC)
+}
+
+/**
+ * @brief Распределитель на основе стандартной библиотеки.
+ */
+static const vi_allocator_t vi_allocator_stdlib_instance = {
+    .context                 = nullptr,
+    .allocate                = vi_allocator_stdlib_allocate,
+    .allocate_zeroed         = vi_allocator_stdlib_allocate_zeroed,
+    .reallocate              = vi_allocator_stdlib_reallocate,
+    .free                    = vi_allocator_stdlib_free,
+    .aligned_allocate        = vi_allocator_stdlib_aligned_allocate,
+    .aligned_allocate_zeroed = vi_allocator_stdlib_aligned_allocate_zeroed,
+    .aligned_free            = vi_allocator_stdlib_aligned_free,
+};
+
+const vi_allocator_t *
+vi_allocator_stdlib(void)
+{
+    return &vi_allocator_stdlib_instance;
+}
+
+bool
+vi_allocator_is_valid(const vi_allocator_t *allocator)
+{
+    return allocator && allocator->allocate && allocator->reallocate && allocator->free &&
+           allocator->aligned_allocate && allocator->aligned_free;
+}
+
+vi_ptr_t
+vi_allocator_allocate(const vi_allocator_t *allocator, vi_usize_t size)
+{
+#ifdef VI_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
+    return vi_allocator_allocate_zeroed(allocator, size);
+#else
+    if (!allocator || !size)
+    {
+        return nullptr;
+    }
+    return allocator->allocate(allocator->context, size);
+#endif // VI_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
+}
+
+vi_ptr_t
+vi_allocator_allocate_zeroed(const vi_allocator_t *allocator, vi_usize_t size)
+{
+    if (!allocator || !size)
+    {
+        return nullptr;
+    }
+
+    if (allocator->allocate_zeroed)
+    {
+        return allocator->allocate_zeroed(allocator->context, size);
+    }
+
+    vi_ptr_t ptr = allocator->allocate(allocator->context, size);
+
+    if (ptr)
+    {
+        vi_memory_zero_unsafe(ptr, size);
+    }
+    return ptr;
+}
+
+vi_ptr_t
+vi_allocator_reallocate(const vi_allocator_t *allocator,
+                        vi_ptr_t ptr,
+                        vi_usize_t old_size,
+                        vi_usize_t new_size)
+{
+    if (!ptr)
+    {
+        return vi_allocator_allocate(allocator, new_size);
+    }
+
+    if (!allocator || !new_size)
+    {
+        return nullptr;
+    }
+
+    vi_ptr_t result = allocator->reallocate(allocator->context, ptr, old_size, new_size);
+
+#ifdef VI_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
+    if (result && new_size > old_size)
+    {
+        vi_memory_zero_unsafe((vi_u8_t *)result + old_size, new_size - old_size);
+    }
+#endif // VI_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
+
+    return result;
+}
+
+void
+vi_allocator_free(const vi_allocator_t *allocator, vi_ptr_t ptr, vi_usize_t size)
+{
+    if (allocator && ptr)
+    {
+        allocator->free(allocator->context, ptr, size);
+    }
+}
+
+vi_ptr_t
+vi_allocator_aligned_allocate(const vi_allocator_t *allocator,
+                              vi_usize_t size,
+                              vi_usize_t alignment)
+{
+#ifdef VI_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
+    return vi_allocator_aligned_allocate_zeroed(allocator, size, alignment);
+#else
+    if (!allocator || !size || !vi_bit_is_single(alignment))
+    {
+        return nullptr;
+    }
+    return allocator->aligned_allocate(allocator->context, size, alignment);
+#endif // VI_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
+}
+
+vi_ptr_t
+vi_allocator_aligned_allocate_zeroed(const vi_allocator_t *allocator,
+                                     vi_usize_t size,
+                                     vi_usize_t alignment)
+{
+    if (!allocator || !size || !vi_bit_is_single(alignment))
+    {
+        return nullptr;
+    }
+
+    if (allocator->aligned_allocate_zeroed)
+    {
+        return allocator->aligned_allocate_zeroed(allocator->context, size, alignment);
+    }
+
+    vi_ptr_t ptr = allocator->aligned_allocate(allocator->context, size, alignment);
+
+    if (ptr)
+    {
+        vi_memory_zero_unsafe(ptr, size);
+    }
+    return ptr;
+}
+
+void
+vi_allocator_aligned_free(const vi_allocator_t *allocator,
+                          vi_ptr_t ptr,
+                          vi_usize_t size,
+                          vi_usize_t alignment)
+{
+    if (allocator && ptr)
+    {
+        allocator->aligned_free(allocator->context, ptr, size, alignment);
+    }
+}
@@ -0,0 +1,345 @@
+#include <vi/arena.h>
+/* Дополнительные модули */
+#include <vi/nullptr.h>
+#include <vi/bit_traits.h>
+#include <vi/initializer.h>
+#include <vi/ptr_traits.h>
+#include <vi/memory_set.h>
+#include <vi/memory_copy.h>
+#include <vi/runtime_allocator.h>
+
+/**
+ * @def vi_arena_chunk_data
+ * @brief Возвращает начало данных участка.
+ */
+#define vi_arena_chunk_data(chunk) ((vi_u8_t *)((chunk) + 1))
+
+/**
+ * @def vi_arena_chunk_end
+ * @brief Возвращает конец участка.
+ */
+#define vi_arena_chunk_end(chunk) ((vi_u8_t *)(chunk) + (chunk)->size)
+
+/**
+ * @brief Возвращает участок базовому распределителю.
+ */
+static void
+vi_arena_chunk_free(vi_arena_t *arena, vi_arena_chunk_t *chunk)
+{
+    arena->backing->free(arena->backing->context, chunk, chunk->size);
+}
+
+/**
+ * @brief Выделяет новый участок, в котором поместится блок `size` с выравниванием `alignment`.
+ *
+ * Память участка запрашивается напрямую у базового распределителя. При опции
+ * `VI_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE` участок запрашивается обнуленным,
+ * если распределитель это поддерживает, и тогда весь участок считается чистым.
+ */
+static bool
+vi_arena_grow(vi_arena_t *arena, vi_usize_t size, vi_usize_t alignment)
+{
+    const vi_usize_t overhead = sizeof(vi_arena_chunk_t) + alignment - 1;
+
+    if (size > VI_USIZE_T_MAX - overhead)
+    {
+        return false;
+    }
+
+    const vi_usize_t required = size + overhead;
+    const vi_usize_t total    = required > arena->chunk_size ? required : arena->chunk_size;
+
+#ifdef VI_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
+    const bool zeroed = arena->backing->allocate_zeroed != nullptr;
+#else
+    const bool zeroed = false;
+#endif // VI_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
+
+    vi_arena_chunk_t *const chunk =
+        zeroed ? arena->backing->allocate_zeroed(arena->backing->context, total)
+               : arena->backing->allocate(arena->backing->context, total);
+
+    if (!chunk)
+    {
+        return false;
+    }
+
+    chunk->prev    = arena->chunk;
+    chunk->size    = total;
+    chunk->clean   = zeroed ? vi_arena_chunk_data(chunk) : vi_arena_chunk_end(chunk);
+    arena->chunk   = chunk;
+    arena->current = vi_arena_chunk_data(chunk);
+    arena->end     = vi_arena_chunk_end(chunk);
+    return true;
+}
+
+/**
+ * @brief Выделяет блок сдвигом указателя текущего участка.
+ */
+static vi_ptr_t
+vi_arena_bump(vi_arena_t *arena, vi_usize_t size, vi_usize_t alignment)
+{
+    if (arena->chunk)
+    {
+        vi_u8_t *const ptr = vi_ptr_align_up(arena->current, nullptr, alignment);
+
+        if (vi_ptr_to_addr(ptr) <= vi_ptr_to_addr(arena->end) &&
+            size <= vi_addr_diff(arena->end, ptr))
+        {
+            arena->current = ptr + size;
+            return ptr;
+        }
+    }
+
+    if (!vi_arena_grow(arena, size, alignment))
+    {
+        return nullptr;
+    }
+
+    vi_u8_t *const ptr = vi_ptr_align_up(arena->current, nullptr, alignment);
+    arena->current     = ptr + size;
+    return ptr;
+}
+
+/**
+ * @brief Выделяет блок и отмечает его память как использованную.
+ *
+ * Если `zero` истинно, обнуляется только часть блока перед границей `clean`
+ * текущего участка: память за ней еще не выдавалась и уже заполнена нулями.
+ */
+static vi_ptr_t
+vi_arena_take(vi_arena_t *arena, vi_usize_t size, vi_usize_t alignment, bool zero)
+{
+    vi_u8_t *const ptr = vi_arena_bump(arena, size, alignment);
+
+    if (!ptr)
+    {
+        return nullptr;
+    }
+
+    vi_arena_chunk_t *const chunk = arena->chunk;
+    vi_u8_t *const block_end      = ptr + size;
+
+    if (zero && ptr < chunk->clean)
+    {
+        vi_u8_t *const dirty_end = block_end < chunk->clean ? block_end : chunk->clean;
+        vi_memory_zero_unsafe(ptr, vi_addr_diff(dirty_end, ptr));
+    }
+
+    if (block_end > chunk->clean)
+    {
+        chunk->clean = block_end;
+    }
+    return ptr;
+}
+
+static vi_ptr_t
+vi_arena_allocator_allocate(vi_ptr_t context, vi_usize_t size)
+{
+    return vi_arena_allocate(context, size);
+}
+
+static vi_ptr_t
+vi_arena_allocator_allocate_zeroed(vi_ptr_t context, vi_usize_t size)
+{
+    return vi_arena_allocate_zeroed(context, size);
+}
+
+/**
+ * @brief Изменяет размер блока арены.
+ *
+ * Последний выделенный блок расширяется или сжимается на месте, если это позволяет
+ * текущий участок. Иначе при уменьшении блок остается прежним, а при увеличении
+ * выделяется новый блок и данные копируются в него.
+ */
+static vi_ptr_t
+vi_arena_allocator_reallocate(vi_ptr_t context,
+                              vi_ptr_t ptr,
+                              vi_usize_t old_size,
+                              vi_usize_t new_size)
+{
+    vi_arena_t *const arena = context;
+    vi_u8_t *const block    = ptr;
+
+    if (block + old_size == arena->current && new_size <= vi_addr_diff(arena->end, block))
+    {
+        arena->current = block + new_size;
+
+        if (arena->current > arena->chunk->clean)
+        {
+            arena->chunk->clean = arena->current;
+        }
+        return block;
+    }
+
+    if (new_size <= old_size)
+    {
+        return block;
+    }
+
+    vi_ptr_t result = vi_arena_allocate(arena, new_size);
+
+    if (result)
+    {
+        vi_memory_copy_unsafe(result, block, old_size);
+    }
+    return result;
+}
+
+/**
+ * @brief Освобождает блок арены.
+ *
+ * Память возвращается только для последнего выделенного блока,
+ * остальные блоки освобождаются вместе с ареной.
+ */
+static void
+vi_arena_allocator_free(vi_ptr_t context, vi_ptr_t ptr, vi_usize_t size)
+{
+    vi_arena_t *const arena = context;
+
+    if ((vi_u8_t *)ptr + size == arena->current)
+    {
+        arena->current = ptr;
+    }
+}
+
+static vi_ptr_t
+vi_arena_allocator_aligned_allocate(vi_ptr_t context, vi_usize_t size, vi_usize_t alignment)
+{
+    return vi_arena_aligned_allocate(context, size, alignment);
+}
+
+/**
+ * @brief Выделяет выровненный обнуленный блок; обнуляется только уже выдававшаяся память.
+ */
+static vi_ptr_t
+vi_arena_allocator_aligned_allocate_zeroed(vi_ptr_t context,
+                                           vi_usize_t size,
+                                           vi_usize_t alignment)
+{
+    return vi_arena_take(context, size, alignment, true);
+}
+
+static void
+vi_arena_allocator_aligned_free(vi_ptr_t context,
+                                vi_ptr_t ptr,
+                                vi_usize_t size,
+                                vi_usize_t alignment)
+{
+    (void)alignment;
+    vi_arena_allocator_free(context, ptr, size);
+}
+
+bool
+vi_arena_init(vi_arena_t *arena, const vi_allocator_t *backing, vi_usize_t chunk_size)
+{
+    if (!arena)
+    {
+        return false;
+    }
+
+    if (!backing)
+    {
+        backing = vi_runtime_allocator_get();
+    }
+
+    if (!vi_allocator_is_valid(backing))
+    {
+        return false;
+    }
+
+    arena->allocator.context                 = arena;
+    arena->allocator.allocate                = vi_arena_allocator_allocate;
+    arena->allocator.allocate_zeroed         = vi_arena_allocator_allocate_zeroed;
+    arena->allocator.reallocate              = vi_arena_allocator_reallocate;
+    arena->allocator.free                    = vi_arena_allocator_free;
+    arena->allocator.aligned_allocate        = vi_arena_allocator_aligned_allocate;
+    arena->allocator.aligned_allocate_zeroed = vi_arena_allocator_aligned_allocate_zeroed;
+    arena->allocator.aligned_free            = vi_arena_allocator_aligned_free;
+
+    arena->backing    = backing;
+    arena->chunk      = nullptr;
+    arena->current    = nullptr;
+    arena->end        = nullptr;
+    arena->chunk_size = chunk_size ? chunk_size : VI_ARENA_DEFAULT_CHUNK_SIZE;
+    return true;
+}
+
+void
+vi_arena_destroy(vi_arena_t *arena)
+{
+    if (arena)
+    {
+        vi_arena_restore(arena, vi_struct_initializer(vi_arena_marker_t, nullptr, nullptr));
+    }
+}
+
+vi_ptr_t
+vi_arena_allocate(vi_arena_t *arena, vi_usize_t size)
+{
+    return vi_arena_aligned_allocate(arena, size, VI_ARENA_DEFAULT_ALIGNMENT);
+}
+
+vi_ptr_t
+vi_arena_aligned_allocate(vi_arena_t *arena, vi_usize_t size, vi_usize_t alignment)
+{
+    if (!arena || !size || !vi_bit_is_single(alignment))
+    {
+        return nullptr;
+    }
+
+#ifdef VI_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
+    return vi_arena_take(arena, size, alignment, true);
+#else
+    return vi_arena_take(arena, size, alignment, false);
+#endif // VI_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
+}
+
+vi_ptr_t
+vi_arena_allocate_zeroed(vi_arena_t *arena, vi_usize_t size)
+{
+    if (!arena || !size)
+    {
+        return nullptr;
+    }
+    return vi_arena_take(arena, size, VI_ARENA_DEFAULT_ALIGNMENT, true);
+}
+
+vi_arena_marker_t
+vi_arena_save(const vi_arena_t *arena)
+{
+    return vi_struct_initializer(vi_arena_marker_t, arena->chunk, arena->current);
+}
+
+void
+vi_arena_restore(vi_arena_t *arena, vi_arena_marker_t marker)
+{
+    while (arena->chunk != marker.chunk)
+    {
+        vi_arena_chunk_t *const prev = arena->chunk->prev;
+        vi_arena_chunk_free(arena, arena->chunk);
+        arena->chunk = prev;
+    }
+
+    arena->current = marker.current;
+    arena->end     = arena->chunk ? vi_arena_chunk_end(arena->chunk) : nullptr;
+}
+
+void
+vi_arena_reset(vi_arena_t *arena)
+{
+    if (!arena || !arena->chunk)
+    {
+        return;
+    }
+
+    while (arena->chunk->prev)
+    {
+        vi_arena_chunk_t *const prev = arena->chunk->prev;
+        vi_arena_chunk_free(arena, arena->chunk);
+        arena->chunk = prev;
+    }
+
+    arena->current = vi_arena_chunk_data(arena->chunk);
+    arena->end     = vi_arena_chunk_end(arena->chunk);
+}
@@ -0,0 +1,456 @@
+#include <vi/ascii.h>
+/* Дополнительные модули */
+#include "simd_range.h"
+#include <vi/cpu.h>
+#include <vi/nullptr.h>
+#include <vi/ptr_traits.h>
+#include <vi/memory_word.h>
+
+#if VI_COMPILER_SIMD_SSE2
+#    include <emmintrin.h>
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_AVX2
+#    include <immintrin.h>
+#endif // VI_COMPILER_SIMD_AVX2
+
+/* Наборы флагов, общие для групп символов таблицы */
+#define VI_ASCII_TABLE_CONTROL VI_ASCII_FLAG_CONTROL
+#define VI_ASCII_TABLE_CONTROL_SPACE (VI_ASCII_FLAG_CONTROL | VI_ASCII_FLAG_SPACE)
+#define VI_ASCII_TABLE_CONTROL_BLANK (VI_ASCII_TABLE_CONTROL_SPACE | VI_ASCII_FLAG_BLANK)
+#define VI_ASCII_TABLE_SPACE (VI_ASCII_FLAG_SPACE | VI_ASCII_FLAG_BLANK | VI_ASCII_FLAG_PRINT)
+#define VI_ASCII_TABLE_PUNCT (VI_ASCII_FLAG_PUNCT | VI_ASCII_FLAG_PRINT)
+#define VI_ASCII_TABLE_DIGIT (VI_ASCII_FLAG_DIGIT | VI_ASCII_FLAG_HEX | VI_ASCII_FLAG_PRINT)
+#define VI_ASCII_TABLE_UPPER (VI_ASCII_FLAG_UPPER | VI_ASCII_FLAG_PRINT)
+#define VI_ASCII_TABLE_UPPER_HEX (VI_ASCII_TABLE_UPPER | VI_ASCII_FLAG_HEX)
+#define VI_ASCII_TABLE_LOWER (VI_ASCII_FLAG_LOWER | VI_ASCII_FLAG_PRINT)
+#define VI_ASCII_TABLE_LOWER_HEX (VI_ASCII_TABLE_LOWER | VI_ASCII_FLAG_HEX)
+
+const vi_u16_t vi_ascii_table[256] = {
+    [VI_ASCII_MAP_NULL_TERMINATOR]           = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_CONTROL_1]                 = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_CONTROL_2]                 = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_CONTROL_3]                 = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_CONTROL_4]                 = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_CONTROL_5]                 = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_CONTROL_6]                 = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_BELL]                      = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_BACKSPACE]                 = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_TAB]                       = VI_ASCII_TABLE_CONTROL_BLANK,
+    [VI_ASCII_MAP_NEWLINE]                   = VI_ASCII_TABLE_CONTROL_SPACE,
+    [VI_ASCII_MAP_VERTICAL_TAB]              = VI_ASCII_TABLE_CONTROL_SPACE,
+    [VI_ASCII_MAP_FORM_FEED]                 = VI_ASCII_TABLE_CONTROL_SPACE,
+    [VI_ASCII_MAP_CARRIAGE_RETURN]           = VI_ASCII_TABLE_CONTROL_SPACE,
+    [VI_ASCII_MAP_SHIFT_OUT]                 = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_SHIFT_IN]                  = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_DATA_LINK_ESCAPE]          = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_DEVICE_CONTROL_1]          = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_DEVICE_CONTROL_2]          = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_DEVICE_CONTROL_3]          = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_DEVICE_CONTROL_4]          = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_NEGATIVE_ACKNOWLEDGE]      = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_SYNCHRONOUS_IDLE]          = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_END_OF_TRANSMISSION_BLOCK] = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_CANCEL]                    = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_END_OF_MEDIUM]             = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_SUBSTITUTE]                = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_ESCAPE]                    = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_FILE_SEPARATOR]            = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_GROUP_SEPARATOR]           = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_RECORD_SEPARATOR]          = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_UNIT_SEPARATOR]            = VI_ASCII_TABLE_CONTROL,
+    [VI_ASCII_MAP_SPACE]                     = VI_ASCII_TABLE_SPACE,
+    [VI_ASCII_MAP_EXCLAMATION_MARK]          = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_QUOTE]                     = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_HASH]                      = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_DOLLAR]                    = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_PERCENT]                   = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_AMPERSAND]                 = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_SINGLE_QUOTE]              = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_LEFT_PARENTHESIS]          = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_RIGHT_PARENTHESIS]         = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_ASTERISK]                  = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_PLUS]                      = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_COMMA]                     = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_HYPHEN]                    = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_PERIOD]                    = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_SLASH]                     = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_DIGIT_0]                   = VI_ASCII_TABLE_DIGIT,
+    [VI_ASCII_MAP_DIGIT_1]                   = VI_ASCII_TABLE_DIGIT,
+    [VI_ASCII_MAP_DIGIT_2]                   = VI_ASCII_TABLE_DIGIT,
+    [VI_ASCII_MAP_DIGIT_3]                   = VI_ASCII_TABLE_DIGIT,
+    [VI_ASCII_MAP_DIGIT_4]                   = VI_ASCII_TABLE_DIGIT,
+    [VI_ASCII_MAP_DIGIT_5]                   = VI_ASCII_TABLE_DIGIT,
+    [VI_ASCII_MAP_DIGIT_6]                   = VI_ASCII_TABLE_DIGIT,
+    [VI_ASCII_MAP_DIGIT_7]                   = VI_ASCII_TABLE_DIGIT,
+    [VI_ASCII_MAP_DIGIT_8]                   = VI_ASCII_TABLE_DIGIT,
+    [VI_ASCII_MAP_DIGIT_9]                   = VI_ASCII_TABLE_DIGIT,
+    [VI_ASCII_MAP_COLON]                     = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_SEMICOLON]                 = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_LESS_THAN]                 = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_EQUAL]                     = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_GREATER_THAN]              = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_QUESTION_MARK]             = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_AT]                        = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_UPPERCASE_A]               = VI_ASCII_TABLE_UPPER_HEX,
+    [VI_ASCII_MAP_UPPERCASE_B]               = VI_ASCII_TABLE_UPPER_HEX,
+    [VI_ASCII_MAP_UPPERCASE_C]               = VI_ASCII_TABLE_UPPER_HEX,
+    [VI_ASCII_MAP_UPPERCASE_D]               = VI_ASCII_TABLE_UPPER_HEX,
+    [VI_ASCII_MAP_UPPERCASE_E]               = VI_ASCII_TABLE_UPPER_HEX,
+    [VI_ASCII_MAP_UPPERCASE_F]               = VI_ASCII_TABLE_UPPER_HEX,
+    [VI_ASCII_MAP_UPPERCASE_G]               = VI_ASCII_TABLE_UPPER,
+    [VI_ASCII_MAP_UPPERCASE_H]               = VI_ASCII_TABLE_UPPER,
+    [VI_ASCII_MAP_UPPERCASE_I]               = VI_ASCII_TABLE_UPPER,
+    [VI_ASCII_MAP_UPPERCASE_J]               = VI_ASCII_TABLE_UPPER,
+    [VI_ASCII_MAP_UPPERCASE_K]               = VI_ASCII_TABLE_UPPER,
+    [VI_ASCII_MAP_UPPERCASE_L]               = VI_ASCII_TABLE_UPPER,
+    [VI_ASCII_MAP_UPPERCASE_M]               = VI_ASCII_TABLE_UPPER,
+    [VI_ASCII_MAP_UPPERCASE_N]               = VI_ASCII_TABLE_UPPER,
+    [VI_ASCII_MAP_UPPERCASE_O]               = VI_ASCII_TABLE_UPPER,
+    [VI_ASCII_MAP_UPPERCASE_P]               = VI_ASCII_TABLE_UPPER,
+    [VI_ASCII_MAP_UPPERCASE_Q]               = VI_ASCII_TABLE_UPPER,
+    [VI_ASCII_MAP_UPPERCASE_R]               = VI_ASCII_TABLE_UPPER,
+    [VI_ASCII_MAP_UPPERCASE_S]               = VI_ASCII_TABLE_UPPER,
+    [VI_ASCII_MAP_UPPERCASE_T]               = VI_ASCII_TABLE_UPPER,
+    [VI_ASCII_MAP_UPPERCASE_U]               = VI_ASCII_TABLE_UPPER,
+    [VI_ASCII_MAP_UPPERCASE_V]               = VI_ASCII_TABLE_UPPER,
+    [VI_ASCII_MAP_UPPERCASE_W]               = VI_ASCII_TABLE_UPPER,
+    [VI_ASCII_MAP_UPPERCASE_X]               = VI_ASCII_TABLE_UPPER,
+    [VI_ASCII_MAP_UPPERCASE_Y]               = VI_ASCII_TABLE_UPPER,
+    [VI_ASCII_MAP_UPPERCASE_Z]               = VI_ASCII_TABLE_UPPER,
+    [VI_ASCII_MAP_LEFT_BRACKET]              = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_BACKSLASH]                 = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_RIGHT_BRACKET]             = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_CARET]                     = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_UNDERLINE]                 = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_GRAVE]                     = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_LOWERCASE_A]               = VI_ASCII_TABLE_LOWER_HEX,
+    [VI_ASCII_MAP_LOWERCASE_B]               = VI_ASCII_TABLE_LOWER_HEX,
+    [VI_ASCII_MAP_LOWERCASE_C]               = VI_ASCII_TABLE_LOWER_HEX,
+    [VI_ASCII_MAP_LOWERCASE_D]               = VI_ASCII_TABLE_LOWER_HEX,
+    [VI_ASCII_MAP_LOWERCASE_E]               = VI_ASCII_TABLE_LOWER_HEX,
+    [VI_ASCII_MAP_LOWERCASE_F]               = VI_ASCII_TABLE_LOWER_HEX,
+    [VI_ASCII_MAP_LOWERCASE_G]               = VI_ASCII_TABLE_LOWER,
+    [VI_ASCII_MAP_LOWERCASE_H]               = VI_ASCII_TABLE_LOWER,
+    [VI_ASCII_MAP_LOWERCASE_I]               = VI_ASCII_TABLE_LOWER,
+    [VI_ASCII_MAP_LOWERCASE_J]               = VI_ASCII_TABLE_LOWER,
+    [VI_ASCII_MAP_LOWERCASE_K]               = VI_ASCII_TABLE_LOWER,
+    [VI_ASCII_MAP_LOWERCASE_L]               = VI_ASCII_TABLE_LOWER,
+    [VI_ASCII_MAP_LOWERCASE_M]               = VI_ASCII_TABLE_LOWER,
+    [VI_ASCII_MAP_LOWERCASE_N]               = VI_ASCII_TABLE_LOWER,
+    [VI_ASCII_MAP_LOWERCASE_O]               = VI_ASCII_TABLE_LOWER,
+    [VI_ASCII_MAP_LOWERCASE_P]               = VI_ASCII_TABLE_LOWER,
+    [VI_ASCII_MAP_LOWERCASE_Q]               = VI_ASCII_TABLE_LOWER,
+    [VI_ASCII_MAP_LOWERCASE_R]               = VI_ASCII_TABLE_LOWER,
+    [VI_ASCII_MAP_LOWERCASE_S]               = VI_ASCII_TABLE_LOWER,
+    [VI_ASCII_MAP_LOWERCASE_T]               = VI_ASCII_TABLE_LOWER,
+    [VI_ASCII_MAP_LOWERCASE_U]               = VI_ASCII_TABLE_LOWER,
+    [VI_ASCII_MAP_LOWERCASE_V]               = VI_ASCII_TABLE_LOWER,
+    [VI_ASCII_MAP_LOWERCASE_W]               = VI_ASCII_TABLE_LOWER,
+    [VI_ASCII_MAP_LOWERCASE_X]               = VI_ASCII_TABLE_LOWER,
+    [VI_ASCII_MAP_LOWERCASE_Y]               = VI_ASCII_TABLE_LOWER,
+    [VI_ASCII_MAP_LOWERCASE_Z]               = VI_ASCII_TABLE_LOWER,
+    [VI_ASCII_MAP_LEFT_BRACE]                = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_VERTICAL_BAR]              = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_RIGHT_BRACE]               = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_TILDE]                     = VI_ASCII_TABLE_PUNCT,
+    [VI_ASCII_MAP_DELETE]                    = VI_ASCII_TABLE_CONTROL,
+};
+
+/**
+ * @brief Тип указателя на реализацию классификации буфера.
+ */
+typedef void (*vi_ascii_classify_fn_t)(vi_u16_t *dst, const vi_u8_t *src, vi_usize_t size);
+
+/**
+ * @brief Тип указателя на реализацию приведения буфера к нижнему регистру.
+ */
+typedef void (*vi_ascii_case_fold_fn_t)(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size);
+
+static void
+vi_ascii_classify_bytes(vi_u16_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    for (; size; --size, ++dst, ++src)
+    {
+        *dst = vi_ascii_table[*src];
+    }
+}
+
+static void
+vi_ascii_case_fold_bytes(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    for (; size; --size, ++dst, ++src)
+    {
+        *dst = vi_ascii_to_lower(*src);
+    }
+}
+
+#if !VI_COMPILER_SIMD_SSE2
+/**
+ * @brief Приводит буфер к нижнему регистру машинными словами.
+ *
+ * Заглавные буквы определяются без ветвлений: к младшим 7 битам каждого байта
+ * прибавляются смещения, при которых старший бит байта устанавливается для значений
+ * не меньше 'A' и больше 'Z'. Байты со старшим битом исключаются. Перенос между
+ * байтами невозможен, так как сумма не превышает 0xFF. Словами обрабатываются
+ * только одинаково выровненные буферы.
+ */
+static void
+vi_ascii_case_fold_word(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    if (size < VI_MEMORY_WORD_SIZE * 2 ||
+        !vi_numeric_has_zero_remainder(vi_addr_diff(dst, src), VI_MEMORY_WORD_SIZE))
+    {
+        vi_ascii_case_fold_bytes(dst, src, size);
+        return;
+    }
+
+    const vi_u8_t *const aligned = vi_ptr_align_up(src, nullptr, VI_MEMORY_WORD_SIZE);
+    const vi_usize_t head        = vi_addr_diff(aligned, src);
+
+    vi_ascii_case_fold_bytes(dst, src, head);
+
+    const vi_memory_word_t *src_it = (const vi_memory_word_t *)(src + head);
+    vi_memory_word_t *dst_it       = (vi_memory_word_t *)(dst + head);
+    size -= head;
+
+    const vi_memory_word_t low  = (vi_memory_word_t)vi_numeric_repeat64(0x7F);
+    const vi_memory_word_t high = (vi_memory_word_t)vi_numeric_repeat64(0x80);
+    const vi_memory_word_t ge_a = (vi_memory_word_t)vi_numeric_repeat64(0x80 - 'A');
+    const vi_memory_word_t gt_z = (vi_memory_word_t)vi_numeric_repeat64(0x80 - 'Z' - 1);
+
+    for (; size >= VI_MEMORY_WORD_SIZE; size -= VI_MEMORY_WORD_SIZE)
+    {
+        const vi_memory_word_t word  = *src_it++;
+        const vi_memory_word_t bits  = word & low;
+        const vi_memory_word_t upper = (bits + ge_a) & ~(bits + gt_z) & ~word & high;
+
+        *dst_it++ = word | (upper >> 2);
+    }
+
+    vi_ascii_case_fold_bytes((vi_u8_t *)dst_it, (const vi_u8_t *)src_it, size);
+}
+#endif // !VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_SSE2
+/**
+ * @def vi_ascii_select_sse2
+ * @brief Оставляет флаг `flag` в байтах, выбранных маской `mask`.
+ */
+#define vi_ascii_select_sse2(mask, flag) _mm_and_si128((mask), _mm_set1_epi8(flag))
+
+/**
+ * @brief Вычисляет младший и старший байты флагов для 16 символов.
+ *
+ * Каждый флаг вычисляется сравнением диапазонов, поэтому результат совпадает
+ * с `vi_ascii_table` для всех 256 значений байта.
+ */
+static inline void
+vi_ascii_classify_block_sse2(__m128i x, __m128i *low, __m128i *high)
+{
+    const __m128i space = _mm_cmpeq_epi8(x, _mm_set1_epi8(' '));
+    const __m128i digit = vi_simd_range_sse2(x, '0', 10);
+    const __m128i upper = vi_simd_range_sse2(x, 'A', 26);
+    const __m128i lower = vi_simd_range_sse2(x, 'a', 26);
+    const __m128i print = vi_simd_range_sse2(x, ' ', 95);
+    const __m128i alnum = _mm_or_si128(digit, _mm_or_si128(upper, lower));
+    const __m128i del   = _mm_set1_epi8(0x7F);
+
+    const __m128i control = _mm_or_si128(vi_simd_range_sse2(x, 0, 32),
+                                         _mm_cmpeq_epi8(x, del));
+    const __m128i spaces  = _mm_or_si128(space, vi_simd_range_sse2(x, '\t', 5));
+    const __m128i blank   = _mm_or_si128(space, _mm_cmpeq_epi8(x, _mm_set1_epi8('\t')));
+    const __m128i punct   = _mm_andnot_si128(_mm_or_si128(alnum, space), print);
+    const __m128i letter  = _mm_or_si128(vi_simd_range_sse2(x, 'A', 6),
+                                         vi_simd_range_sse2(x, 'a', 6));
+    const __m128i hex     = _mm_or_si128(digit, letter);
+
+    __m128i flags = vi_ascii_select_sse2(control, VI_ASCII_FLAG_CONTROL);
+    flags         = _mm_or_si128(flags, vi_ascii_select_sse2(spaces, VI_ASCII_FLAG_SPACE));
+    flags         = _mm_or_si128(flags, vi_ascii_select_sse2(blank, VI_ASCII_FLAG_BLANK));
+    flags         = _mm_or_si128(flags, vi_ascii_select_sse2(digit, VI_ASCII_FLAG_DIGIT));
+    flags         = _mm_or_si128(flags, vi_ascii_select_sse2(punct, VI_ASCII_FLAG_PUNCT));
+    flags         = _mm_or_si128(flags, vi_ascii_select_sse2(lower, VI_ASCII_FLAG_LOWER));
+    flags         = _mm_or_si128(flags, vi_ascii_select_sse2(hex, VI_ASCII_FLAG_HEX));
+    flags         = _mm_or_si128(flags, vi_ascii_select_sse2(print, (char)VI_ASCII_FLAG_PRINT));
+
+    *low  = flags;
+    *high = vi_ascii_select_sse2(upper, VI_ASCII_FLAG_UPPER >> 8);
+}
+
+/**
+ * @brief Классифицирует буфер по 16 символов за шаг SSE2.
+ *
+ * Младшие и старшие байты флагов чередуются `unpacklo/unpackhi`, образуя
+ * 16-битные значения. Остаток короче 16 символов обрабатывается по таблице.
+ */
+static void
+vi_ascii_classify_sse2(vi_u16_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    for (; size >= 16; size -= 16, src += 16, dst += 16)
+    {
+        __m128i low, high;
+        vi_ascii_classify_block_sse2(_mm_loadu_si128((const __m128i *)src), &low, &high);
+
+        _mm_storeu_si128((__m128i *)dst, _mm_unpacklo_epi8(low, high));
+        _mm_storeu_si128((__m128i *)(dst + 8), _mm_unpackhi_epi8(low, high));
+    }
+
+    vi_ascii_classify_bytes(dst, src, size);
+}
+
+/**
+ * @brief Приводит буфер к нижнему регистру по 16 символов за шаг SSE2.
+ *
+ * Блок читается до записи, поэтому буферы могут совпадать.
+ */
+static void
+vi_ascii_case_fold_sse2(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    for (; size >= 16; size -= 16, src += 16, dst += 16)
+    {
+        const __m128i x     = _mm_loadu_si128((const __m128i *)src);
+        const __m128i upper = vi_simd_range_sse2(x, 'A', 26);
+
+        _mm_storeu_si128((__m128i *)dst, _mm_or_si128(x, vi_ascii_select_sse2(upper, 0x20)));
+    }
+
+    vi_ascii_case_fold_bytes(dst, src, size);
+}
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_AVX2
+/**
+ * @def vi_ascii_select_avx2
+ * @brief Оставляет флаг `flag` в байтах, выбранных маской `mask`.
+ */
+#define vi_ascii_select_avx2(mask, flag) _mm256_and_si256((mask), _mm256_set1_epi8(flag))
+
+/**
+ * @brief Вычисляет младший и старший байты флагов для 32 символов.
+ *
+ * Аналогична `vi_ascii_classify_block_sse2`.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static inline void
+vi_ascii_classify_block_avx2(__m256i x, __m256i *low, __m256i *high)
+{
+    const __m256i space = _mm256_cmpeq_epi8(x, _mm256_set1_epi8(' '));
+    const __m256i digit = vi_simd_range_avx2(x, '0', 10);
+    const __m256i upper = vi_simd_range_avx2(x, 'A', 26);
+    const __m256i lower = vi_simd_range_avx2(x, 'a', 26);
+    const __m256i print = vi_simd_range_avx2(x, ' ', 95);
+    const __m256i alnum = _mm256_or_si256(digit, _mm256_or_si256(upper, lower));
+    const __m256i del   = _mm256_set1_epi8(0x7F);
+
+    const __m256i control = _mm256_or_si256(vi_simd_range_avx2(x, 0, 32),
+                                            _mm256_cmpeq_epi8(x, del));
+    const __m256i spaces  = _mm256_or_si256(space, vi_simd_range_avx2(x, '\t', 5));
+    const __m256i blank   = _mm256_or_si256(space, _mm256_cmpeq_epi8(x, _mm256_set1_epi8('\t')));
+    const __m256i punct   = _mm256_andnot_si256(_mm256_or_si256(alnum, space), print);
+    const __m256i letter  = _mm256_or_si256(vi_simd_range_avx2(x, 'A', 6),
+                                            vi_simd_range_avx2(x, 'a', 6));
+    const __m256i hex     = _mm256_or_si256(digit, letter);
+
+    __m256i flags = vi_ascii_select_avx2(control, VI_ASCII_FLAG_CONTROL);
+    flags         = _mm256_or_si256(flags, vi_ascii_select_avx2(spaces, VI_ASCII_FLAG_SPACE));
+    flags         = _mm256_or_si256(flags, vi_ascii_select_avx2(blank, VI_ASCII_FLAG_BLANK));
+    flags         = _mm256_or_si256(flags, vi_ascii_select_avx2(digit, VI_ASCII_FLAG_DIGIT));
+    flags         = _mm256_or_si256(flags, vi_ascii_select_avx2(punct, VI_ASCII_FLAG_PUNCT));
+    flags         = _mm256_or_si256(flags, vi_ascii_select_avx2(lower, VI_ASCII_FLAG_LOWER));
+    flags         = _mm256_or_si256(flags, vi_ascii_select_avx2(hex, VI_ASCII_FLAG_HEX));
+    flags         = _mm256_or_si256(flags, vi_ascii_select_avx2(print, (char)VI_ASCII_FLAG_PRINT));
+
+    *low  = flags;
+    *high = vi_ascii_select_avx2(upper, VI_ASCII_FLAG_UPPER >> 8);
+}
+
+/**
+ * @brief Классифицирует буфер по 32 символа за шаг AVX2.
+ *
+ * `unpacklo/unpackhi` работают внутри 128-битных половин регистра, поэтому
+ * порядок 16-битных значений восстанавливается перестановкой половин.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static void
+vi_ascii_classify_avx2(vi_u16_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    for (; size >= 32; size -= 32, src += 32, dst += 32)
+    {
+        __m256i low, high;
+        vi_ascii_classify_block_avx2(_mm256_loadu_si256((const __m256i *)src), &low, &high);
+
+        const __m256i first  = _mm256_unpacklo_epi8(low, high);
+        const __m256i second = _mm256_unpackhi_epi8(low, high);
+
+        _mm256_storeu_si256((__m256i *)dst, _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256((__m256i *)(dst + 16), _mm256_permute2x128_si256(first, second, 0x31));
+    }
+
+    vi_ascii_classify_sse2(dst, src, size);
+}
+
+/**
+ * @brief Приводит буфер к нижнему регистру по 32 символа за шаг AVX2.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static void
+vi_ascii_case_fold_avx2(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    for (; size >= 32; size -= 32, src += 32, dst += 32)
+    {
+        const __m256i x     = _mm256_loadu_si256((const __m256i *)src);
+        const __m256i upper = vi_simd_range_avx2(x, 'A', 26);
+
+        _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(x, vi_ascii_select_avx2(upper, 0x20)));
+    }
+
+    vi_ascii_case_fold_sse2(dst, src, size);
+}
+#endif // VI_COMPILER_SIMD_AVX2
+
+/**
+ * @brief Реализации обработки буферов, выбираемые при загрузке библиотеки.
+ */
+#if VI_COMPILER_SIMD_SSE2
+static vi_ascii_classify_fn_t vi_ascii_classify_vector   = vi_ascii_classify_sse2;
+static vi_ascii_case_fold_fn_t vi_ascii_case_fold_vector = vi_ascii_case_fold_sse2;
+#else
+static vi_ascii_classify_fn_t vi_ascii_classify_vector   = vi_ascii_classify_bytes;
+static vi_ascii_case_fold_fn_t vi_ascii_case_fold_vector = vi_ascii_case_fold_word;
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_AVX2
+vi_compiler_constructor(vi_ascii_init)
+{
+    if (vi_cpu_has(VI_CPU_FEATURE_AVX2))
+    {
+        vi_ascii_classify_vector  = vi_ascii_classify_avx2;
+        vi_ascii_case_fold_vector = vi_ascii_case_fold_avx2;
+    }
+}
+#endif // VI_COMPILER_SIMD_AVX2
+
+vi_u16_t *
+vi_ascii_classify_n(vi_u16_t *dst, const vi_char_t *src, vi_usize_t size)
+{
+    if (!dst || !src)
+    {
+        return nullptr;
+    }
+
+    vi_ascii_classify_vector(dst, (const vi_u8_t *)src, size);
+    return dst;
+}
+
+vi_char_t *
+vi_ascii_case_fold_n(vi_char_t *dst, const vi_char_t *src, vi_usize_t size)
+{
+    if (!dst || !src)
+    {
+        return nullptr;
+    }
+
+    vi_ascii_case_fold_vector((vi_u8_t *)dst, (const vi_u8_t *)src, size);
+    return dst;
+}
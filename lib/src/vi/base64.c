@@ -0,0 +1,749 @@
+#include <vi/base64.h>
+/* Дополнительные модули */
+#include <vi/cpu.h>
+#include <vi/bool.h>
+#include <vi/nullptr.h>
+#include <vi/ascii_map.h>
+
+#if VI_COMPILER_SIMD_SSSE3 || VI_COMPILER_SIMD_AVX2
+#    include <immintrin.h>
+#endif // VI_COMPILER_SIMD_SSSE3 || VI_COMPILER_SIMD_AVX2
+
+/**
+ * @def VI_BASE64_TABLE_STANDARD
+ * @brief Флаг таблицы декодирования, отмечающий символ стандартного алфавита.
+ *
+ * Младшие 6 бит элемента с флагом содержат значение символа.
+ */
+#define VI_BASE64_TABLE_STANDARD 0x40
+
+/**
+ * @def VI_BASE64_TABLE_URL
+ * @brief Флаг таблицы декодирования, отмечающий символ алфавита URL.
+ */
+#define VI_BASE64_TABLE_URL 0x80
+
+/**
+ * @def VI_BASE64_TABLE_BOTH
+ * @brief Флаги символа, общего для обоих алфавитов.
+ */
+#define VI_BASE64_TABLE_BOTH (VI_BASE64_TABLE_STANDARD | VI_BASE64_TABLE_URL)
+
+/**
+ * @def VI_BASE64_TABLE_VALUE
+ * @brief Маска значения символа в элементе таблицы декодирования.
+ */
+#define VI_BASE64_TABLE_VALUE 0x3F
+
+/**
+ * @brief Описание алфавита.
+ *
+ * Кроме символов для скалярной реализации описание содержит 16-байтовые таблицы
+ * `pshufb` реализаций SSSE3 и AVX2. Алфавиты различаются только символами
+ * со значениями 62 и 63, поэтому различаются и таблицы только в этих местах.
+ */
+typedef struct vi_base64_alphabet_t
+{
+    /**
+     * @brief Символы в порядке значений.
+     */
+    vi_u8_t symbols[64];
+
+    /**
+     * @brief Смещения от значения к символу по номеру диапазона значений: 0–25,
+     *        26–51, 52–61 (десять элементов), 62 и 63.
+     */
+    vi_s8_t encode_shift[16];
+
+    /**
+     * @brief Биты старших тетрад, недопустимых для каждой младшей тетрады символа.
+     *
+     * Символ допустим, если его элемент не пересекается с битом `1 << старшая тетрада`;
+     * для байтов от 0x80 используется маска 0xFF, поэтому они всегда недопустимы.
+     */
+    vi_u8_t check[16];
+
+    /**
+     * @brief Смещения от символа к значению по старшей тетраде символа.
+     */
+    vi_s8_t decode_shift[16];
+
+    /**
+     * @brief Символ со значением 63, старшая тетрада которого совпадает с буквами
+     *        или знаком со значением 62, и поправка к его номеру в `decode_shift`.
+     */
+    vi_u8_t special;
+    vi_s8_t special_adjust;
+
+    /**
+     * @brief Флаг символов алфавита в `vi_base64_table`.
+     */
+    vi_u8_t flag;
+
+    /**
+     * @brief Дополнять запись знаками `=` до длины, кратной 4.
+     */
+    bool padding;
+} vi_base64_alphabet_t;
+
+/**
+ * @def VI_BASE64_LETTERS
+ * @brief Символы со значениями 0–61, общие для обоих алфавитов.
+ */
+#define VI_BASE64_LETTERS                                                                          \
+    VI_ASCII_MAP_UPPERCASE_A, VI_ASCII_MAP_UPPERCASE_B, VI_ASCII_MAP_UPPERCASE_C,                  \
+        VI_ASCII_MAP_UPPERCASE_D, VI_ASCII_MAP_UPPERCASE_E, VI_ASCII_MAP_UPPERCASE_F,              \
+        VI_ASCII_MAP_UPPERCASE_G, VI_ASCII_MAP_UPPERCASE_H, VI_ASCII_MAP_UPPERCASE_I,              \
+        VI_ASCII_MAP_UPPERCASE_J, VI_ASCII_MAP_UPPERCASE_K, VI_ASCII_MAP_UPPERCASE_L,              \
+        VI_ASCII_MAP_UPPERCASE_M, VI_ASCII_MAP_UPPERCASE_N, VI_ASCII_MAP_UPPERCASE_O,              \
+        VI_ASCII_MAP_UPPERCASE_P, VI_ASCII_MAP_UPPERCASE_Q, VI_ASCII_MAP_UPPERCASE_R,              \
+        VI_ASCII_MAP_UPPERCASE_S, VI_ASCII_MAP_UPPERCASE_T, VI_ASCII_MAP_UPPERCASE_U,              \
+        VI_ASCII_MAP_UPPERCASE_V, VI_ASCII_MAP_UPPERCASE_W, VI_ASCII_MAP_UPPERCASE_X,              \
+        VI_ASCII_MAP_UPPERCASE_Y, VI_ASCII_MAP_UPPERCASE_Z, VI_ASCII_MAP_LOWERCASE_A,              \
+        VI_ASCII_MAP_LOWERCASE_B, VI_ASCII_MAP_LOWERCASE_C, VI_ASCII_MAP_LOWERCASE_D,              \
+        VI_ASCII_MAP_LOWERCASE_E, VI_ASCII_MAP_LOWERCASE_F, VI_ASCII_MAP_LOWERCASE_G,              \
+        VI_ASCII_MAP_LOWERCASE_H, VI_ASCII_MAP_LOWERCASE_I, VI_ASCII_MAP_LOWERCASE_J,              \
+        VI_ASCII_MAP_LOWERCASE_K, VI_ASCII_MAP_LOWERCASE_L, VI_ASCII_MAP_LOWERCASE_M,              \
+        VI_ASCII_MAP_LOWERCASE_N, VI_ASCII_MAP_LOWERCASE_O, VI_ASCII_MAP_LOWERCASE_P,              \
+        VI_ASCII_MAP_LOWERCASE_Q, VI_ASCII_MAP_LOWERCASE_R, VI_ASCII_MAP_LOWERCASE_S,              \
+        VI_ASCII_MAP_LOWERCASE_T, VI_ASCII_MAP_LOWERCASE_U, VI_ASCII_MAP_LOWERCASE_V,              \
+        VI_ASCII_MAP_LOWERCASE_W, VI_ASCII_MAP_LOWERCASE_X, VI_ASCII_MAP_LOWERCASE_Y,              \
+        VI_ASCII_MAP_LOWERCASE_Z, VI_ASCII_MAP_DIGIT_0, VI_ASCII_MAP_DIGIT_1,                      \
+        VI_ASCII_MAP_DIGIT_2, VI_ASCII_MAP_DIGIT_3, VI_ASCII_MAP_DIGIT_4, VI_ASCII_MAP_DIGIT_5,    \
+        VI_ASCII_MAP_DIGIT_6, VI_ASCII_MAP_DIGIT_7, VI_ASCII_MAP_DIGIT_8, VI_ASCII_MAP_DIGIT_9
+
+/**
+ * @def VI_BASE64_ENCODE_SHIFT
+ * @brief Смещения `encode_shift` для символов `s62` и `s63`.
+ */
+#define VI_BASE64_ENCODE_SHIFT(s62, s63)                                                           \
+    {                                                                                              \
+        VI_ASCII_MAP_UPPERCASE_A, VI_ASCII_MAP_LOWERCASE_A - 26, VI_ASCII_MAP_DIGIT_0 - 52,        \
+            VI_ASCII_MAP_DIGIT_0 - 52, VI_ASCII_MAP_DIGIT_0 - 52, VI_ASCII_MAP_DIGIT_0 - 52,       \
+            VI_ASCII_MAP_DIGIT_0 - 52, VI_ASCII_MAP_DIGIT_0 - 52, VI_ASCII_MAP_DIGIT_0 - 52,       \
+            VI_ASCII_MAP_DIGIT_0 - 52, VI_ASCII_MAP_DIGIT_0 - 52, VI_ASCII_MAP_DIGIT_0 - 52,       \
+            (s62) - 62, (s63) - 63, 0, 0                                                           \
+    }
+
+static const vi_base64_alphabet_t vi_base64_standard = {
+    .symbols        = {VI_BASE64_LETTERS, VI_ASCII_MAP_PLUS, VI_ASCII_MAP_SLASH},
+    .encode_shift   = VI_BASE64_ENCODE_SHIFT(VI_ASCII_MAP_PLUS, VI_ASCII_MAP_SLASH),
+    .check          = {0x57, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+                       0x07, 0x07, 0x0F, 0xAB, 0xAF, 0xAF, 0xAF, 0xAB},
+    .decode_shift   = {0, 63 - VI_ASCII_MAP_SLASH, 62 - VI_ASCII_MAP_PLUS,
+                       52 - VI_ASCII_MAP_DIGIT_0, -VI_ASCII_MAP_UPPERCASE_A,
+                       -VI_ASCII_MAP_UPPERCASE_A, 26 - VI_ASCII_MAP_LOWERCASE_A,
+                       26 - VI_ASCII_MAP_LOWERCASE_A},
+    .special        = VI_ASCII_MAP_SLASH,
+    .special_adjust = -1,
+    .flag           = VI_BASE64_TABLE_STANDARD,
+    .padding        = true,
+};
+
+static const vi_base64_alphabet_t vi_base64_url = {
+    .symbols        = {VI_BASE64_LETTERS, VI_ASCII_MAP_HYPHEN, VI_ASCII_MAP_UNDERLINE},
+    .encode_shift   = VI_BASE64_ENCODE_SHIFT(VI_ASCII_MAP_HYPHEN, VI_ASCII_MAP_UNDERLINE),
+    .check          = {0x57, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+                       0x07, 0x07, 0x0F, 0xAF, 0xAF, 0xAB, 0xAF, 0x8F},
+    .decode_shift   = {0, 0, 62 - VI_ASCII_MAP_HYPHEN, 52 - VI_ASCII_MAP_DIGIT_0,
+                       -VI_ASCII_MAP_UPPERCASE_A, -VI_ASCII_MAP_UPPERCASE_A,
+                       26 - VI_ASCII_MAP_LOWERCASE_A, 26 - VI_ASCII_MAP_LOWERCASE_A,
+                       0, 0, 0, 0, 0, 63 - VI_ASCII_MAP_UNDERLINE},
+    .special        = VI_ASCII_MAP_UNDERLINE,
+    .special_adjust = 8,
+    .flag           = VI_BASE64_TABLE_URL,
+    .padding        = false,
+};
+
+/**
+ * @brief Таблица декодирования обоих алфавитов: значение символа с флагами
+ *        алфавитов, в которые он входит, или 0 для остальных байтов.
+ */
+static const vi_u8_t vi_base64_table[256] = {
+    [VI_ASCII_MAP_UPPERCASE_A] = VI_BASE64_TABLE_BOTH | 0,
+    [VI_ASCII_MAP_UPPERCASE_B] = VI_BASE64_TABLE_BOTH | 1,
+    [VI_ASCII_MAP_UPPERCASE_C] = VI_BASE64_TABLE_BOTH | 2,
+    [VI_ASCII_MAP_UPPERCASE_D] = VI_BASE64_TABLE_BOTH | 3,
+    [VI_ASCII_MAP_UPPERCASE_E] = VI_BASE64_TABLE_BOTH | 4,
+    [VI_ASCII_MAP_UPPERCASE_F] = VI_BASE64_TABLE_BOTH | 5,
+    [VI_ASCII_MAP_UPPERCASE_G] = VI_BASE64_TABLE_BOTH | 6,
+    [VI_ASCII_MAP_UPPERCASE_H] = VI_BASE64_TABLE_BOTH | 7,
+    [VI_ASCII_MAP_UPPERCASE_I] = VI_BASE64_TABLE_BOTH | 8,
+    [VI_ASCII_MAP_UPPERCASE_J] = VI_BASE64_TABLE_BOTH | 9,
+    [VI_ASCII_MAP_UPPERCASE_K] = VI_BASE64_TABLE_BOTH | 10,
+    [VI_ASCII_MAP_UPPERCASE_L] = VI_BASE64_TABLE_BOTH | 11,
+    [VI_ASCII_MAP_UPPERCASE_M] = VI_BASE64_TABLE_BOTH | 12,
+    [VI_ASCII_MAP_UPPERCASE_N] = VI_BASE64_TABLE_BOTH | 13,
+    [VI_ASCII_MAP_UPPERCASE_O] = VI_BASE64_TABLE_BOTH | 14,
+    [VI_ASCII_MAP_UPPERCASE_P] = VI_BASE64_TABLE_BOTH | 15,
+    [VI_ASCII_MAP_UPPERCASE_Q] = VI_BASE64_TABLE_BOTH | 16,
+    [VI_ASCII_MAP_UPPERCASE_R] = VI_BASE64_TABLE_BOTH | 17,
+    [VI_ASCII_MAP_UPPERCASE_S] = VI_BASE64_TABLE_BOTH | 18,
+    [VI_ASCII_MAP_UPPERCASE_T] = VI_BASE64_TABLE_BOTH | 19,
+    [VI_ASCII_MAP_UPPERCASE_U] = VI_BASE64_TABLE_BOTH | 20,
+    [VI_ASCII_MAP_UPPERCASE_V] = VI_BASE64_TABLE_BOTH | 21,
+    [VI_ASCII_MAP_UPPERCASE_W] = VI_BASE64_TABLE_BOTH | 22,
+    [VI_ASCII_MAP_UPPERCASE_X] = VI_BASE64_TABLE_BOTH | 23,
+    [VI_ASCII_MAP_UPPERCASE_Y] = VI_BASE64_TABLE_BOTH | 24,
+    [VI_ASCII_MAP_UPPERCASE_Z] = VI_BASE64_TABLE_BOTH | 25,
+    [VI_ASCII_MAP_LOWERCASE_A] = VI_BASE64_TABLE_BOTH | 26,
+    [VI_ASCII_MAP_LOWERCASE_B] = VI_BASE64_TABLE_BOTH | 27,
+    [VI_ASCII_MAP_LOWERCASE_C] = VI_BASE64_TABLE_BOTH | 28,
+    [VI_ASCII_MAP_LOWERCASE_D] = VI_BASE64_TABLE_BOTH | 29,
+    [VI_ASCII_MAP_LOWERCASE_E] = VI_BASE64_TABLE_BOTH | 30,
+    [VI_ASCII_MAP_LOWERCASE_F] = VI_BASE64_TABLE_BOTH | 31,
+    [VI_ASCII_MAP_LOWERCASE_G] = VI_BASE64_TABLE_BOTH | 32,
+    [VI_ASCII_MAP_LOWERCASE_H] = VI_BASE64_TABLE_BOTH | 33,
+    [VI_ASCII_MAP_LOWERCASE_I] = VI_BASE64_TABLE_BOTH | 34,
+    [VI_ASCII_MAP_LOWERCASE_J] = VI_BASE64_TABLE_BOTH | 35,
+    [VI_ASCII_MAP_LOWERCASE_K] = VI_BASE64_TABLE_BOTH | 36,
+    [VI_ASCII_MAP_LOWERCASE_L] = VI_BASE64_TABLE_BOTH | 37,
+    [VI_ASCII_MAP_LOWERCASE_M] = VI_BASE64_TABLE_BOTH | 38,
+    [VI_ASCII_MAP_LOWERCASE_N] = VI_BASE64_TABLE_BOTH | 39,
+    [VI_ASCII_MAP_LOWERCASE_O] = VI_BASE64_TABLE_BOTH | 40,
+    [VI_ASCII_MAP_LOWERCASE_P] = VI_BASE64_TABLE_BOTH | 41,
+    [VI_ASCII_MAP_LOWERCASE_Q] = VI_BASE64_TABLE_BOTH | 42,
+    [VI_ASCII_MAP_LOWERCASE_R] = VI_BASE64_TABLE_BOTH | 43,
+    [VI_ASCII_MAP_LOWERCASE_S] = VI_BASE64_TABLE_BOTH | 44,
+    [VI_ASCII_MAP_LOWERCASE_T] = VI_BASE64_TABLE_BOTH | 45,
+    [VI_ASCII_MAP_LOWERCASE_U] = VI_BASE64_TABLE_BOTH | 46,
+    [VI_ASCII_MAP_LOWERCASE_V] = VI_BASE64_TABLE_BOTH | 47,
+    [VI_ASCII_MAP_LOWERCASE_W] = VI_BASE64_TABLE_BOTH | 48,
+    [VI_ASCII_MAP_LOWERCASE_X] = VI_BASE64_TABLE_BOTH | 49,
+    [VI_ASCII_MAP_LOWERCASE_Y] = VI_BASE64_TABLE_BOTH | 50,
+    [VI_ASCII_MAP_LOWERCASE_Z] = VI_BASE64_TABLE_BOTH | 51,
+    [VI_ASCII_MAP_DIGIT_0]     = VI_BASE64_TABLE_BOTH | 52,
+    [VI_ASCII_MAP_DIGIT_1]     = VI_BASE64_TABLE_BOTH | 53,
+    [VI_ASCII_MAP_DIGIT_2]     = VI_BASE64_TABLE_BOTH | 54,
+    [VI_ASCII_MAP_DIGIT_3]     = VI_BASE64_TABLE_BOTH | 55,
+    [VI_ASCII_MAP_DIGIT_4]     = VI_BASE64_TABLE_BOTH | 56,
+    [VI_ASCII_MAP_DIGIT_5]     = VI_BASE64_TABLE_BOTH | 57,
+    [VI_ASCII_MAP_DIGIT_6]     = VI_BASE64_TABLE_BOTH | 58,
+    [VI_ASCII_MAP_DIGIT_7]     = VI_BASE64_TABLE_BOTH | 59,
+    [VI_ASCII_MAP_DIGIT_8]     = VI_BASE64_TABLE_BOTH | 60,
+    [VI_ASCII_MAP_DIGIT_9]     = VI_BASE64_TABLE_BOTH | 61,
+    [VI_ASCII_MAP_PLUS]        = VI_BASE64_TABLE_STANDARD | 62,
+    [VI_ASCII_MAP_SLASH]       = VI_BASE64_TABLE_STANDARD | 63,
+    [VI_ASCII_MAP_HYPHEN]      = VI_BASE64_TABLE_URL | 62,
+    [VI_ASCII_MAP_UNDERLINE]   = VI_BASE64_TABLE_URL | 63,
+};
+
+/**
+ * @brief Тип указателя на реализацию кодирования.
+ *
+ * Реализация получает количество байтов, кратное 3.
+ */
+typedef void (*vi_base64_encode_fn_t)(vi_u8_t *dst,
+                                      const vi_u8_t *src,
+                                      vi_usize_t size,
+                                      const vi_base64_alphabet_t *alphabet);
+
+/**
+ * @brief Тип указателя на реализацию декодирования.
+ *
+ * Реализация получает количество символов, кратное 4, и возвращает позицию
+ * первого недопустимого символа или `size`.
+ */
+typedef vi_usize_t (*vi_base64_decode_fn_t)(vi_u8_t *dst,
+                                            const vi_u8_t *src,
+                                            vi_usize_t size,
+                                            const vi_base64_alphabet_t *alphabet);
+
+static void
+vi_base64_encode_bytes(vi_u8_t *dst,
+                       const vi_u8_t *src,
+                       vi_usize_t size,
+                       const vi_base64_alphabet_t *alphabet)
+{
+    const vi_u8_t *const symbols = alphabet->symbols;
+
+    for (; size; size -= 3, src += 3, dst += 4)
+    {
+        const vi_u32_t bits = (vi_u32_t)src[0] << 16 | (vi_u32_t)src[1] << 8 | src[2];
+
+        dst[0] = symbols[bits >> 18];
+        dst[1] = symbols[bits >> 12 & VI_BASE64_TABLE_VALUE];
+        dst[2] = symbols[bits >> 6 & VI_BASE64_TABLE_VALUE];
+        dst[3] = symbols[bits & VI_BASE64_TABLE_VALUE];
+    }
+}
+
+static vi_usize_t
+vi_base64_decode_bytes(vi_u8_t *dst,
+                       const vi_u8_t *src,
+                       vi_usize_t size,
+                       const vi_base64_alphabet_t *alphabet)
+{
+    const vi_u8_t flag = alphabet->flag;
+
+    for (vi_usize_t i = 0; i < size; i += 4, dst += 3)
+    {
+        const vi_u8_t a = vi_base64_table[src[i]];
+        const vi_u8_t b = vi_base64_table[src[i + 1]];
+        const vi_u8_t c = vi_base64_table[src[i + 2]];
+        const vi_u8_t d = vi_base64_table[src[i + 3]];
+
+        if (!(a & b & c & d & flag))
+        {
+            while (vi_base64_table[src[i]] & flag)
+            {
+                ++i;
+            }
+
+            return i;
+        }
+
+        const vi_u32_t bits = (vi_u32_t)(a & VI_BASE64_TABLE_VALUE) << 18 |
+                              (vi_u32_t)(b & VI_BASE64_TABLE_VALUE) << 12 |
+                              (vi_u32_t)(c & VI_BASE64_TABLE_VALUE) << 6 |
+                              (vi_u32_t)(d & VI_BASE64_TABLE_VALUE);
+
+        dst[0] = (vi_u8_t)(bits >> 16);
+        dst[1] = (vi_u8_t)(bits >> 8);
+        dst[2] = (vi_u8_t)bits;
+    }
+
+    return size;
+}
+
+#if VI_COMPILER_SIMD_SSSE3
+/**
+ * @brief Переводит 6-битные значения в символы алфавита.
+ *
+ * Номер диапазона значения вычисляется насыщающим вычитанием 51 (значения 52–63
+ * получают номера 1–12) и поправкой для значений больше 25, после чего смещение
+ * выбирается из `encode_shift` перестановкой `pshufb`.
+ */
+VI_COMPILER_SIMD_TARGET("ssse3")
+static inline __m128i
+vi_base64_encode_translate_ssse3(__m128i values, __m128i shift)
+{
+    const __m128i range = _mm_sub_epi8(_mm_subs_epu8(values, _mm_set1_epi8(51)),
+                                       _mm_cmpgt_epi8(values, _mm_set1_epi8(25)));
+
+    return _mm_add_epi8(values, _mm_shuffle_epi8(shift, range));
+}
+
+/**
+ * @brief Извлекает 6-битные значения из 12 байт в младших байтах блока.
+ *
+ * Каждые 3 байта размножаются в 4 байта 32-битного слова, после чего две пары
+ * 6-битных групп сдвигаются на свои места умножениями `pmulhuw` и `pmullw`.
+ */
+VI_COMPILER_SIMD_TARGET("ssse3")
+static inline __m128i
+vi_base64_encode_split_ssse3(__m128i x)
+{
+    x = _mm_shuffle_epi8(x, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+
+    const __m128i high = _mm_mulhi_epu16(_mm_and_si128(x, _mm_set1_epi32(0x0FC0FC00)),
+                                         _mm_set1_epi32(0x04000040));
+    const __m128i low  = _mm_mullo_epi16(_mm_and_si128(x, _mm_set1_epi32(0x003F03F0)),
+                                         _mm_set1_epi32(0x01000010));
+
+    return _mm_or_si128(high, low);
+}
+
+/**
+ * @brief Кодирует по 12 байт за шаг SSSE3.
+ *
+ * Блок читается целиком (16 байт), поэтому цикл продолжается, пока до конца
+ * входа остается не меньше 16 байт.
+ */
+VI_COMPILER_SIMD_TARGET("ssse3")
+static void
+vi_base64_encode_ssse3(vi_u8_t *dst,
+                       const vi_u8_t *src,
+                       vi_usize_t size,
+                       const vi_base64_alphabet_t *alphabet)
+{
+    const __m128i shift = _mm_loadu_si128((const __m128i *)alphabet->encode_shift);
+
+    for (; size >= 16; size -= 12, src += 12, dst += 16)
+    {
+        const __m128i values = vi_base64_encode_split_ssse3(
+            _mm_loadu_si128((const __m128i *)src));
+
+        _mm_storeu_si128((__m128i *)dst, vi_base64_encode_translate_ssse3(values, shift));
+    }
+
+    vi_base64_encode_bytes(dst, src, size, alphabet);
+}
+
+/**
+ * @brief Переводит 16 символов в 6-битные значения.
+ *
+ * @param x Символы.
+ * @param alphabet Алфавит.
+ * @param valid Принимает `true`, если все символы входят в алфавит.
+ *
+ * @return Значения символов; при недопустимом символе результат не определен.
+ */
+VI_COMPILER_SIMD_TARGET("ssse3")
+static inline __m128i
+vi_base64_decode_translate_ssse3(__m128i x, const vi_base64_alphabet_t *alphabet, bool *valid)
+{
+    const __m128i check_high = _mm_setr_epi8(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40,
+                                             (char)0x80, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i mask       = _mm_set1_epi8(0x0F);
+    const __m128i high       = _mm_and_si128(_mm_srli_epi16(x, 4), mask);
+    const __m128i low        = _mm_and_si128(x, mask);
+
+    const __m128i check = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)alphabet->check),
+                                           low);
+    const __m128i bad   = _mm_and_si128(check, _mm_shuffle_epi8(check_high, high));
+
+    *valid = _mm_movemask_epi8(_mm_cmpeq_epi8(bad, _mm_setzero_si128())) == 0xFFFF;
+
+    const __m128i special = _mm_and_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(alphabet->special)),
+                                          _mm_set1_epi8(alphabet->special_adjust));
+    const __m128i shift   = _mm_shuffle_epi8(
+        _mm_loadu_si128((const __m128i *)alphabet->decode_shift), _mm_add_epi8(high, special));
+
+    return _mm_add_epi8(x, shift);
+}
+
+/**
+ * @brief Собирает 12 байт из 16 значений в младших байтах блока.
+ *
+ * Пары значений объединяются `pmaddubsw`, пары 12-битных сумм — `pmaddwd`,
+ * а байты 24-битных слов переставляются в порядок записи.
+ */
+VI_COMPILER_SIMD_TARGET("ssse3")
+static inline __m128i
+vi_base64_decode_pack_ssse3(__m128i values)
+{
+    const __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    const __m128i words = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+
+    return _mm_shuffle_epi8(words,
+                            _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+
+/**
+ * @brief Декодирует по 16 символов за шаг SSSE3.
+ *
+ * Запись блока занимает 16 байт, из которых 12 значимы, поэтому цикл продолжается,
+ * пока до конца входа остается не меньше 24 символов. Блок с недопустимым символом
+ * и остаток обрабатываются по таблице, которая и определяет позицию ошибки.
+ */
+VI_COMPILER_SIMD_TARGET("ssse3")
+static vi_usize_t
+vi_base64_decode_ssse3(vi_u8_t *dst,
+                       const vi_u8_t *src,
+                       vi_usize_t size,
+                       const vi_base64_alphabet_t *alphabet)
+{
+    vi_usize_t i = 0;
+
+    for (; size - i >= 24; i += 16, dst += 12)
+    {
+        bool valid;
+        const __m128i values = vi_base64_decode_translate_ssse3(
+            _mm_loadu_si128((const __m128i *)(src + i)), alphabet, &valid);
+
+        if (!valid)
+        {
+            break;
+        }
+
+        _mm_storeu_si128((__m128i *)dst, vi_base64_decode_pack_ssse3(values));
+    }
+
+    return i + vi_base64_decode_bytes(dst, src + i, size - i, alphabet);
+}
+#endif // VI_COMPILER_SIMD_SSSE3
+
+#if VI_COMPILER_SIMD_AVX2
+/**
+ * @brief Кодирует по 24 байта за шаг AVX2.
+ *
+ * Половины регистра загружаются со смещениями 0 и 12 и обрабатываются как два
+ * блока SSSE3; вторая загрузка заканчивается на 28-м байте входа.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static void
+vi_base64_encode_avx2(vi_u8_t *dst,
+                      const vi_u8_t *src,
+                      vi_usize_t size,
+                      const vi_base64_alphabet_t *alphabet)
+{
+    const __m256i shift = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i *)alphabet->encode_shift));
+    const __m256i order = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+                                           1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+
+    for (; size >= 28; size -= 24, src += 24, dst += 32)
+    {
+        __m256i x = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)src)),
+            _mm_loadu_si128((const __m128i *)(src + 12)),
+            1);
+
+        x = _mm256_shuffle_epi8(x, order);
+
+        const __m256i high   = _mm256_mulhi_epu16(
+            _mm256_and_si256(x, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+        const __m256i low    = _mm256_mullo_epi16(
+            _mm256_and_si256(x, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+        const __m256i values = _mm256_or_si256(high, low);
+        const __m256i range  = _mm256_sub_epi8(
+            _mm256_subs_epu8(values, _mm256_set1_epi8(51)),
+            _mm256_cmpgt_epi8(values, _mm256_set1_epi8(25)));
+
+        _mm256_storeu_si256((__m256i *)dst,
+                            _mm256_add_epi8(values, _mm256_shuffle_epi8(shift, range)));
+    }
+
+    vi_base64_encode_ssse3(dst, src, size, alphabet);
+}
+
+/**
+ * @brief Декодирует по 32 символа за шаг AVX2.
+ *
+ * Половины регистра обрабатываются как блоки SSSE3, после чего 12-байтовые
+ * результаты сдвигаются вплотную перестановкой 32-битных слов. Запись блока
+ * занимает 32 байта, поэтому цикл продолжается, пока до конца входа остается
+ * не меньше 48 символов.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static vi_usize_t
+vi_base64_decode_avx2(vi_u8_t *dst,
+                      const vi_u8_t *src,
+                      vi_usize_t size,
+                      const vi_base64_alphabet_t *alphabet)
+{
+    const __m256i check_high = _mm256_setr_epi8(
+        0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, (char)0x80, -1, -1, -1, -1, -1, -1, -1, -1,
+        0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, (char)0x80, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m256i check      = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i *)alphabet->check));
+    const __m256i shift      = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i *)alphabet->decode_shift));
+    const __m256i special    = _mm256_set1_epi8(alphabet->special);
+    const __m256i adjust     = _mm256_set1_epi8(alphabet->special_adjust);
+    const __m256i mask       = _mm256_set1_epi8(0x0F);
+    const __m256i order      = _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    vi_usize_t i             = 0;
+
+    for (; size - i >= 48; i += 32, dst += 24)
+    {
+        const __m256i x    = _mm256_loadu_si256((const __m256i *)(src + i));
+        const __m256i high = _mm256_and_si256(_mm256_srli_epi16(x, 4), mask);
+        const __m256i bad  = _mm256_and_si256(_mm256_shuffle_epi8(check, _mm256_and_si256(x, mask)),
+                                              _mm256_shuffle_epi8(check_high, high));
+
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(bad, _mm256_setzero_si256())) != -1)
+        {
+            break;
+        }
+
+        const __m256i index  = _mm256_add_epi8(
+            high, _mm256_and_si256(_mm256_cmpeq_epi8(x, special), adjust));
+        const __m256i values = _mm256_add_epi8(x, _mm256_shuffle_epi8(shift, index));
+        const __m256i pairs  = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+        const __m256i words  = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+        const __m256i packed = _mm256_shuffle_epi8(words, order);
+
+        _mm256_storeu_si256(
+            (__m256i *)dst,
+            _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7)));
+    }
+
+    return i + vi_base64_decode_ssse3(dst, src + i, size - i, alphabet);
+}
+#endif // VI_COMPILER_SIMD_AVX2
+
+/**
+ * @brief Реализации, выбираемые при загрузке библиотеки.
+ */
+static vi_base64_encode_fn_t vi_base64_encode_vector = vi_base64_encode_bytes;
+static vi_base64_decode_fn_t vi_base64_decode_vector = vi_base64_decode_bytes;
+
+#if VI_COMPILER_SIMD_SSSE3
+vi_compiler_constructor(vi_base64_init)
+{
+    if (vi_cpu_has(VI_CPU_FEATURE_SSSE3))
+    {
+        vi_base64_encode_vector = vi_base64_encode_ssse3;
+        vi_base64_decode_vector = vi_base64_decode_ssse3;
+    }
+
+#    if VI_COMPILER_SIMD_AVX2
+    if (vi_cpu_has(VI_CPU_FEATURE_AVX2))
+    {
+        vi_base64_encode_vector = vi_base64_encode_avx2;
+        vi_base64_decode_vector = vi_base64_decode_avx2;
+    }
+#    endif // VI_COMPILER_SIMD_AVX2
+}
+#endif // VI_COMPILER_SIMD_SSSE3
+
+/**
+ * @brief Кодирует байты алфавитом `alphabet`.
+ *
+ * Полные группы по 3 байта обрабатываются выбранной реализацией, а последние
+ * 1–2 байта записываются здесь вместе с дополнением.
+ */
+static vi_usize_t
+vi_base64_encode_alphabet(vi_u8_t *dst,
+                          const vi_u8_t *src,
+                          vi_usize_t size,
+                          const vi_base64_alphabet_t *alphabet)
+{
+    if (!dst || !src)
+    {
+        return 0;
+    }
+
+    const vi_usize_t full = size / 3 * 3;
+    const vi_usize_t rest = size - full;
+    vi_usize_t length     = full / 3 * 4;
+
+    vi_base64_encode_vector(dst, src, full, alphabet);
+
+    if (rest)
+    {
+        const vi_u8_t *const symbols = alphabet->symbols;
+        const vi_u32_t bits = (vi_u32_t)src[full] << 16 |
+                              (rest == 2 ? (vi_u32_t)src[full + 1] << 8 : 0);
+
+        dst[length++] = symbols[bits >> 18];
+        dst[length++] = symbols[bits >> 12 & VI_BASE64_TABLE_VALUE];
+
+        if (rest == 2)
+        {
+            dst[length++] = symbols[bits >> 6 & VI_BASE64_TABLE_VALUE];
+        }
+
+        while (alphabet->padding && length % 4)
+        {
+            dst[length++] = VI_ASCII_MAP_EQUAL;
+        }
+    }
+
+    return length;
+}
+
+/**
+ * @brief Декодирует запись алфавита `alphabet`.
+ *
+ * Дополнение отбрасывается до декодирования; полные группы по 4 символа
+ * обрабатываются выбранной реализацией, а последние 2–3 символа — здесь вместе
+ * с проверкой неиспользуемых битов. Из нескольких ошибок сообщается о самой ранней.
+ */
+static vi_return_t
+vi_base64_decode_alphabet(vi_u8_t *dst,
+                          const vi_u8_t *src,
+                          vi_usize_t size,
+                          const vi_base64_alphabet_t *alphabet,
+                          vi_usize_t *result)
+{
+    if (!dst || !src)
+    {
+        return VI_BASE64_INVALID;
+    }
+
+    vi_usize_t length = size;
+
+    for (vi_usize_t pad = 0; pad < 2 && length && src[length - 1] == VI_ASCII_MAP_EQUAL; ++pad)
+    {
+        --length;
+    }
+
+    const vi_usize_t full = length & ~(vi_usize_t)3;
+    const vi_usize_t rest = length - full;
+    vi_usize_t position   = vi_base64_decode_vector(dst, src, full, alphabet);
+    vi_return_t status    = VI_BASE64_SUCCESS;
+    vi_u32_t bits         = 0;
+
+    if (position == full)
+    {
+        for (; position < length; ++position)
+        {
+            const vi_u8_t value = vi_base64_table[src[position]];
+
+            if (!(value & alphabet->flag))
+            {
+                break;
+            }
+
+            bits = bits << 6 | (value & VI_BASE64_TABLE_VALUE);
+        }
+    }
+
+    // Последняя группа из 2 или 3 символов содержит 12 или 18 бит, из которых
+    // в байты попадают 8 или 16; остальные биты канонической записи равны нулю.
+    const vi_usize_t unused = 8 - rest * 2;
+
+    if (position < length)
+    {
+        status = VI_BASE64_BAD_CHARACTER;
+    }
+    else if (rest == 1)
+    {
+        status   = VI_BASE64_BAD_LENGTH;
+        position = full;
+    }
+    else if (rest && (bits & ((1U << unused) - 1)))
+    {
+        status   = VI_BASE64_BAD_CHARACTER;
+        position = length - 1;
+    }
+    else if (length != size && size % 4)
+    {
+        status   = VI_BASE64_BAD_CHARACTER;
+        position = length;
+    }
+    else
+    {
+        vi_u8_t *const tail = dst + full / 4 * 3;
+
+        bits >>= rest ? unused : 0;
+
+        if (rest == 3)
+        {
+            tail[0] = (vi_u8_t)(bits >> 8);
+            tail[1] = (vi_u8_t)bits;
+        }
+        else if (rest == 2)
+        {
+            tail[0] = (vi_u8_t)bits;
+        }
+
+        position = full / 4 * 3 + (rest ? rest - 1 : 0);
+    }
+
+    if (result)
+    {
+        *result = position;
+    }
+
+    return status;
+}
+
+vi_usize_t
+vi_base64_encode(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    return vi_base64_encode_alphabet(dst, src, size, &vi_base64_standard);
+}
+
+vi_return_t
+vi_base64_decode(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size, vi_usize_t *result)
+{
+    return vi_base64_decode_alphabet(dst, src, size, &vi_base64_standard, result);
+}
+
+vi_usize_t
+vi_base64_url_encode(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    return vi_base64_encode_alphabet(dst, src, size, &vi_base64_url);
+}
+
+vi_return_t
+vi_base64_url_decode(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size, vi_usize_t *result)
+{
+    return vi_base64_decode_alphabet(dst, src, size, &vi_base64_url, result);
+}
@@ -0,0 +1,112 @@
+#include <vi/bit_traits.h>
+
+#if VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC
+#    include <intrin.h>
+#endif // VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC
+
+int
+vi_bit_clz32_portable(vi_u32_t x)
+{
+#if VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC
+    unsigned long index;
+
+    return _BitScanReverse(&index, x) ? 31 - (int)index : 32;
+#else
+    int count = 0;
+    int shift;
+
+    if (x == 0)
+    {
+        return 32;
+    }
+
+    // Двоичный поиск старшего установленного бита: сдвиги на 16, 8, 4, 2 и 1.
+    for (shift = 16; shift != 0; shift >>= 1)
+    {
+        if ((x >> (32 - shift)) == 0)
+        {
+            count += shift;
+            x <<= shift;
+        }
+    }
+
+    return count;
+#endif // VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC
+}
+
+int
+vi_bit_clz64_portable(vi_u64_t x)
+{
+#if (VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+
+    return _BitScanReverse64(&index, x) ? 63 - (int)index : 64;
+#else
+    const vi_u32_t high = (vi_u32_t)(x >> 32);
+
+    return high != 0 ? vi_bit_clz32_portable(high) : 32 + vi_bit_clz32_portable((vi_u32_t)x);
+#endif // (VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC) && ...
+}
+
+int
+vi_bit_ctz32_portable(vi_u32_t x)
+{
+#if VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC
+    unsigned long index;
+
+    return _BitScanForward(&index, x) ? (int)index : 32;
+#else
+    // Биты ниже младшего установленного образуют маску, число единиц в которой
+    // равно искомому количеству нулей; для 0 маска содержит все 32 бита.
+    return vi_bit_popcount32_portable((x & (0U - x)) - 1U);
+#endif // VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC
+}
+
+int
+vi_bit_ctz64_portable(vi_u64_t x)
+{
+#if (VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+
+    return _BitScanForward64(&index, x) ? (int)index : 64;
+#else
+    const vi_u32_t low = (vi_u32_t)x;
+
+    return low != 0 ? vi_bit_ctz32_portable(low)
+                    : 32 + vi_bit_ctz32_portable((vi_u32_t)(x >> 32));
+#endif // (VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC) && ...
+}
+
+int
+vi_bit_popcount32_portable(vi_u32_t x)
+{
+    // Параллельное суммирование: пары, четверки, байты, затем сумма байтов умножением.
+    x = x - ((x >> 1) & 0x55555555U);
+    x = (x & 0x33333333U) + ((x >> 2) & 0x33333333U);
+    x = (x + (x >> 4)) & 0x0F0F0F0FU;
+
+    return (int)((x * 0x01010101U) >> 24);
+}
+
+int
+vi_bit_popcount64_portable(vi_u64_t x)
+{
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+    return (int)((x * 0x0101010101010101ULL) >> 56);
+}
+
+vi_u32_t
+vi_bit_bswap32_portable(vi_u32_t x)
+{
+    return (x >> 24) | ((x >> 8) & 0x0000FF00U) | ((x << 8) & 0x00FF0000U) | (x << 24);
+}
+
+vi_u64_t
+vi_bit_bswap64_portable(vi_u64_t x)
+{
+    return ((vi_u64_t)vi_bit_bswap32_portable((vi_u32_t)x) << 32) |
+           vi_bit_bswap32_portable((vi_u32_t)(x >> 32));
+}
@@ -0,0 +1,512 @@
+#include <vi/bitset.h>
+/* Дополнительные модули */
+#include <vi/cpu.h>
+#include <vi/nullptr.h>
+#include <vi/memory_set.h>
+#include <vi/runtime_allocator.h>
+
+#if VI_COMPILER_SIMD_SSE2
+#    include <emmintrin.h>
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_AVX2
+#    include <immintrin.h>
+#endif // VI_COMPILER_SIMD_AVX2
+
+/**
+ * @def VI_BITSET_ALIGNMENT
+ * @brief Выравнивание массива слов; равно размеру строки кэша.
+ */
+#define VI_BITSET_ALIGNMENT 64
+
+/**
+ * @def VI_BITSET_BLOCK_WORDS
+ * @brief Количество слов, которые поиск проверяет одним условием.
+ *
+ * Восемь слов занимают одну строку кэша; объединение их перед проверкой
+ * заменяет восемь условных переходов на один.
+ */
+#define VI_BITSET_BLOCK_WORDS 8
+
+/**
+ * @brief Побитовая операция над наборами.
+ */
+typedef enum vi_bitset_op_t
+{
+    VI_BITSET_OP_AND,
+    VI_BITSET_OP_OR,
+    VI_BITSET_OP_XOR
+} vi_bitset_op_t;
+
+/**
+ * @brief Тип функции, применяющей операцию `op` к `count` словам `dst` и `src`.
+ */
+typedef void (*vi_bitset_apply_fn_t)(vi_u64_t *dst,
+                                     const vi_u64_t *src,
+                                     vi_usize_t count,
+                                     vi_bitset_op_t op);
+
+/**
+ * @brief Тип функции, подсчитывающей установленные биты `count` слов.
+ */
+typedef vi_usize_t (*vi_bitset_popcount_fn_t)(const vi_u64_t *words, vi_usize_t count);
+
+/**
+ * @brief Возвращает маску битов слова с номерами не меньше `bit`.
+ */
+#define vi_bitset_mask_from(bit) (~0ULL << ((bit) & 63))
+
+/**
+ * @brief Возвращает маску битов слова с номерами не больше `bit`.
+ */
+#define vi_bitset_mask_to(bit) (~0ULL >> (63 - ((bit) & 63)))
+
+/**
+ * @brief Применяет операцию к паре слов.
+ */
+static inline vi_u64_t
+vi_bitset_op_word(vi_u64_t lhs, vi_u64_t rhs, vi_bitset_op_t op)
+{
+    switch (op)
+    {
+        case VI_BITSET_OP_AND:
+            return lhs & rhs;
+        case VI_BITSET_OP_OR:
+            return lhs | rhs;
+        default:
+            return lhs ^ rhs;
+    }
+}
+
+/**
+ * @brief Применяет операцию к словам по одному.
+ */
+static void
+vi_bitset_apply_word(vi_u64_t *dst, const vi_u64_t *src, vi_usize_t count, vi_bitset_op_t op)
+{
+    for (vi_usize_t i = 0; i < count; ++i)
+    {
+        dst[i] = vi_bitset_op_word(dst[i], src[i], op);
+    }
+}
+
+/**
+ * @brief Подсчитывает установленные биты слов переносимыми командами.
+ */
+static vi_usize_t
+vi_bitset_popcount_word(const vi_u64_t *words, vi_usize_t count)
+{
+    vi_usize_t total = 0;
+
+    for (vi_usize_t i = 0; i < count; ++i)
+    {
+        total += (vi_usize_t)vi_bit_popcount64(words[i]);
+    }
+    return total;
+}
+
+#if VI_COMPILER_SIMD_SSE2
+/**
+ * @brief Применяет операцию к паре 128-битных векторов.
+ */
+static inline __m128i
+vi_bitset_op_sse2(__m128i lhs, __m128i rhs, vi_bitset_op_t op)
+{
+    switch (op)
+    {
+        case VI_BITSET_OP_AND:
+            return _mm_and_si128(lhs, rhs);
+        case VI_BITSET_OP_OR:
+            return _mm_or_si128(lhs, rhs);
+        default:
+            return _mm_xor_si128(lhs, rhs);
+    }
+}
+
+/**
+ * @brief Применяет операцию к словам регистрами SSE2, по 8 слов за итерацию.
+ */
+static void
+vi_bitset_apply_sse2(vi_u64_t *dst, const vi_u64_t *src, vi_usize_t count, vi_bitset_op_t op)
+{
+    vi_usize_t i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        for (vi_usize_t j = 0; j < 8; j += 2)
+        {
+            const __m128i lhs = _mm_loadu_si128((const __m128i *)(dst + i + j));
+            const __m128i rhs = _mm_loadu_si128((const __m128i *)(src + i + j));
+            _mm_storeu_si128((__m128i *)(dst + i + j), vi_bitset_op_sse2(lhs, rhs, op));
+        }
+    }
+    vi_bitset_apply_word(dst + i, src + i, count - i, op);
+}
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_AVX2
+/**
+ * @brief Применяет операцию к паре 256-битных векторов.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static inline __m256i
+vi_bitset_op_avx2(__m256i lhs, __m256i rhs, vi_bitset_op_t op)
+{
+    switch (op)
+    {
+        case VI_BITSET_OP_AND:
+            return _mm256_and_si256(lhs, rhs);
+        case VI_BITSET_OP_OR:
+            return _mm256_or_si256(lhs, rhs);
+        default:
+            return _mm256_xor_si256(lhs, rhs);
+    }
+}
+
+/**
+ * @brief Применяет операцию к словам регистрами AVX2, по 16 слов за итерацию.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static void
+vi_bitset_apply_avx2(vi_u64_t *dst, const vi_u64_t *src, vi_usize_t count, vi_bitset_op_t op)
+{
+    vi_usize_t i = 0;
+
+    for (; i + 16 <= count; i += 16)
+    {
+        for (vi_usize_t j = 0; j < 16; j += 4)
+        {
+            const __m256i lhs = _mm256_loadu_si256((const __m256i *)(dst + i + j));
+            const __m256i rhs = _mm256_loadu_si256((const __m256i *)(src + i + j));
+            _mm256_storeu_si256((__m256i *)(dst + i + j), vi_bitset_op_avx2(lhs, rhs, op));
+        }
+    }
+    vi_bitset_apply_sse2(dst + i, src + i, count - i, op);
+}
+
+/**
+ * @brief Подсчитывает установленные биты слов командой POPCNT.
+ *
+ * Без `-mpopcnt` встроенная функция подсчета битов вызывает табличную
+ * реализацию из libgcc, которая в несколько раз медленнее одной команды.
+ */
+VI_COMPILER_SIMD_TARGET("popcnt")
+static vi_usize_t
+vi_bitset_popcount_popcnt(const vi_u64_t *words, vi_usize_t count)
+{
+    vi_usize_t total = 0;
+
+    for (vi_usize_t i = 0; i < count; ++i)
+    {
+        total += (vi_usize_t)__builtin_popcountll(words[i]);
+    }
+    return total;
+}
+#endif // VI_COMPILER_SIMD_AVX2
+
+/**
+ * @brief Реализации побитовых операций и подсчета битов, выбираемые при загрузке библиотеки.
+ */
+#if VI_COMPILER_SIMD_SSE2
+static vi_bitset_apply_fn_t vi_bitset_apply = vi_bitset_apply_sse2;
+#else
+static vi_bitset_apply_fn_t vi_bitset_apply = vi_bitset_apply_word;
+#endif // VI_COMPILER_SIMD_SSE2
+static vi_bitset_popcount_fn_t vi_bitset_popcount = vi_bitset_popcount_word;
+
+#if VI_COMPILER_SIMD_AVX2
+vi_compiler_constructor(vi_bitset_init_dispatch)
+{
+    if (vi_cpu_has(VI_CPU_FEATURE_AVX2))
+    {
+        vi_bitset_apply = vi_bitset_apply_avx2;
+    }
+
+    if (vi_cpu_has(VI_CPU_FEATURE_POPCNT))
+    {
+        vi_bitset_popcount = vi_bitset_popcount_popcnt;
+    }
+}
+#endif // VI_COMPILER_SIMD_AVX2
+
+/**
+ * @brief Возвращает `true`, если среди `VI_BITSET_BLOCK_WORDS` слов `block`
+ *        есть слово, отличное от `skip`.
+ *
+ * Компиляторы не разворачивают цикл по словам блока, поэтому слова объединяются явно.
+ */
+static inline bool
+vi_bitset_block_differs(const vi_u64_t *block, vi_u64_t skip)
+{
+#if VI_COMPILER_SIMD_SSE2
+    const __m128i pattern = _mm_set1_epi64x((long long)skip);
+    const __m128i diff0 =
+        _mm_or_si128(_mm_xor_si128(_mm_loadu_si128((const __m128i *)block + 0), pattern),
+                     _mm_xor_si128(_mm_loadu_si128((const __m128i *)block + 1), pattern));
+    const __m128i diff1 =
+        _mm_or_si128(_mm_xor_si128(_mm_loadu_si128((const __m128i *)block + 2), pattern),
+                     _mm_xor_si128(_mm_loadu_si128((const __m128i *)block + 3), pattern));
+    const __m128i zero = _mm_cmpeq_epi8(_mm_or_si128(diff0, diff1), _mm_setzero_si128());
+
+    return _mm_movemask_epi8(zero) != 0xFFFF;
+#else
+    const vi_u64_t diff = ((block[0] ^ skip) | (block[1] ^ skip)) |
+                          ((block[2] ^ skip) | (block[3] ^ skip)) |
+                          ((block[4] ^ skip) | (block[5] ^ skip)) |
+                          ((block[6] ^ skip) | (block[7] ^ skip));
+
+    return diff != 0;
+#endif // VI_COMPILER_SIMD_SSE2
+}
+
+/**
+ * @brief Возвращает номер первого слова не меньше `index`, отличного от `skip`.
+ *
+ * Слова проверяются блоками по `VI_BITSET_BLOCK_WORDS`, остаток — по одному.
+ *
+ * @return Номер слова или `word_count`, если такого слова нет.
+ */
+static vi_usize_t
+vi_bitset_skip_words(const vi_u64_t *words, vi_usize_t index, vi_usize_t word_count, vi_u64_t skip)
+{
+    while (index + VI_BITSET_BLOCK_WORDS <= word_count &&
+           !vi_bitset_block_differs(words + index, skip))
+    {
+        index += VI_BITSET_BLOCK_WORDS;
+    }
+
+    while (index < word_count && words[index] == skip)
+    {
+        ++index;
+    }
+    return index;
+}
+
+/**
+ * @brief Ищет первый бит с номером не меньше `from`, отличный от битов `skip`.
+ *
+ * @param skip 0 для поиска установленных битов, `~0` для поиска сброшенных.
+ */
+static vi_usize_t
+vi_bitset_find(const vi_bitset_t *set, vi_usize_t from, vi_u64_t skip)
+{
+    if (!set || from >= set->size)
+    {
+        return VI_BITSET_NPOS;
+    }
+
+    vi_usize_t index = from >> 6;
+    vi_u64_t word    = (set->words[index] ^ skip) & vi_bitset_mask_from(from);
+
+    if (!word)
+    {
+        index = vi_bitset_skip_words(set->words, index + 1, set->word_count, skip);
+
+        if (index == set->word_count)
+        {
+            return VI_BITSET_NPOS;
+        }
+        word = set->words[index] ^ skip;
+    }
+
+    // Биты за пределами размера равны нулю и при поиске сброшенных битов
+    // выглядят свободными, поэтому результат сравнивается с размером.
+    const vi_usize_t bit = (index << 6) + (vi_usize_t)vi_bit_ctz64(word);
+    return bit < set->size ? bit : VI_BITSET_NPOS;
+}
+
+bool
+vi_bitset_init(vi_bitset_t *set, const vi_allocator_t *allocator, vi_usize_t size)
+{
+    if (!allocator)
+    {
+        allocator = vi_runtime_allocator_get();
+    }
+
+    if (!set || !vi_allocator_is_valid(allocator))
+    {
+        return false;
+    }
+
+    const vi_usize_t word_count = (size >> 6) + ((size & 63) != 0);
+    vi_u64_t *words             = nullptr;
+
+    if (word_count)
+    {
+        words = vi_allocator_aligned_allocate_zeroed(allocator,
+                                                     word_count * sizeof(vi_u64_t),
+                                                     VI_BITSET_ALIGNMENT);
+
+        if (!words)
+        {
+            return false;
+        }
+    }
+
+    set->allocator  = allocator;
+    set->words      = words;
+    set->size       = size;
+    set->word_count = word_count;
+    return true;
+}
+
+void
+vi_bitset_destroy(vi_bitset_t *set)
+{
+    if (!set)
+    {
+        return;
+    }
+
+    if (set->words)
+    {
+        vi_allocator_aligned_free(set->allocator,
+                                  set->words,
+                                  set->word_count * sizeof(vi_u64_t),
+                                  VI_BITSET_ALIGNMENT);
+    }
+
+    set->words      = nullptr;
+    set->size       = 0;
+    set->word_count = 0;
+}
+
+void
+vi_bitset_fill(vi_bitset_t *set, vi_usize_t index, vi_usize_t count, bool value)
+{
+    if (!set || index >= set->size || !count)
+    {
+        return;
+    }
+
+    count = count < set->size - index ? count : set->size - index;
+
+    const vi_usize_t last_bit   = index + count - 1;
+    const vi_usize_t first_word = index >> 6;
+    const vi_usize_t last_word  = last_bit >> 6;
+    const vi_u64_t first_mask   = vi_bitset_mask_from(index);
+    const vi_u64_t last_mask    = vi_bitset_mask_to(last_bit);
+
+    if (first_word == last_word)
+    {
+        const vi_u64_t mask = first_mask & last_mask;
+        set->words[first_word] =
+            value ? set->words[first_word] | mask : set->words[first_word] & ~mask;
+        return;
+    }
+
+    set->words[first_word] =
+        value ? set->words[first_word] | first_mask : set->words[first_word] & ~first_mask;
+    vi_memory_set_unsafe(set->words + first_word + 1,
+                         (last_word - first_word - 1) * sizeof(vi_u64_t),
+                         value ? 0xFF : 0x00);
+    set->words[last_word] =
+        value ? set->words[last_word] | last_mask : set->words[last_word] & ~last_mask;
+}
+
+vi_usize_t
+vi_bitset_find_first_set(const vi_bitset_t *set, vi_usize_t from)
+{
+    return vi_bitset_find(set, from, 0);
+}
+
+vi_usize_t
+vi_bitset_find_first_clear(const vi_bitset_t *set, vi_usize_t from)
+{
+    return vi_bitset_find(set, from, ~0ULL);
+}
+
+vi_usize_t
+vi_bitset_count(const vi_bitset_t *set, vi_usize_t index, vi_usize_t count)
+{
+    if (!set || index >= set->size || !count)
+    {
+        return 0;
+    }
+
+    count = count < set->size - index ? count : set->size - index;
+
+    const vi_usize_t last_bit   = index + count - 1;
+    const vi_usize_t first_word = index >> 6;
+    const vi_usize_t last_word  = last_bit >> 6;
+    const vi_u64_t first_mask   = vi_bitset_mask_from(index);
+    const vi_u64_t last_mask    = vi_bitset_mask_to(last_bit);
+
+    if (first_word == last_word)
+    {
+        return (vi_usize_t)vi_bit_popcount64(set->words[first_word] & first_mask & last_mask);
+    }
+
+    return (vi_usize_t)vi_bit_popcount64(set->words[first_word] & first_mask) +
+           vi_bitset_popcount(set->words + first_word + 1, last_word - first_word - 1) +
+           (vi_usize_t)vi_bit_popcount64(set->words[last_word] & last_mask);
+}
+
+bool
+vi_bitset_and(vi_bitset_t *dst, const vi_bitset_t *src)
+{
+    if (!dst || !src || dst->size != src->size)
+    {
+        return false;
+    }
+
+    vi_bitset_apply(dst->words, src->words, dst->word_count, VI_BITSET_OP_AND);
+    return true;
+}
+
+bool
+vi_bitset_or(vi_bitset_t *dst, const vi_bitset_t *src)
+{
+    if (!dst || !src || dst->size != src->size)
+    {
+        return false;
+    }
+
+    vi_bitset_apply(dst->words, src->words, dst->word_count, VI_BITSET_OP_OR);
+    return true;
+}
+
+bool
+vi_bitset_xor(vi_bitset_t *dst, const vi_bitset_t *src)
+{
+    if (!dst || !src || dst->size != src->size)
+    {
+        return false;
+    }
+
+    vi_bitset_apply(dst->words, src->words, dst->word_count, VI_BITSET_OP_XOR);
+    return true;
+}
+
+vi_usize_t
+vi_bitset_acquire(vi_bitset_t *set, vi_usize_t hint)
+{
+    if (!set || !set->size)
+    {
+        return VI_BITSET_NPOS;
+    }
+
+    hint = hint < set->size ? hint : 0;
+
+    vi_usize_t index = vi_bitset_find(set, hint, ~0ULL);
+
+    if (index == VI_BITSET_NPOS && hint)
+    {
+        index = vi_bitset_find(set, 0, ~0ULL);
+    }
+
+    if (index != VI_BITSET_NPOS)
+    {
+        vi_bitset_set(set, index);
+    }
+    return index;
+}
+
+void
+vi_bitset_release(vi_bitset_t *set, vi_usize_t index)
+{
+    if (set && index < set->size)
+    {
+        vi_bitset_clear(set, index);
+    }
+}
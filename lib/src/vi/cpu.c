@@ -0,0 +1,263 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+/**
+ * @def _GNU_SOURCE
+ * @brief Открывает `sched_getaffinity` и `CPU_COUNT` в `<sched.h>`; задается
+ *        до подключения любых заголовков.
+ */
+#    define _GNU_SOURCE
+#endif // defined(__linux__) && !defined(_GNU_SOURCE)
+
+#include <vi/cpu.h>
+/* Дополнительные модули */
+#include <vi/bool.h>
+#include <vi/bit_traits.h>
+#include <vi/compiler_constructor.h>
+
+#include <stdatomic.h>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+/**
+ * @def VI_CPU_X86
+ * @brief Программа собрана для x86 или x86-64.
+ */
+#    define VI_CPU_X86 1
+#    if VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC
+#        include <intrin.h>
+#        include <immintrin.h>
+#    else
+#        include <cpuid.h>
+#    endif // VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC
+#else
+/**
+ * @def VI_CPU_X86
+ * @brief Программа собрана не для x86.
+ */
+#    define VI_CPU_X86 0
+#endif // defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+
+#if defined(__aarch64__) && defined(__linux__)
+#    include <sys/auxv.h>
+#endif // defined(__aarch64__) && defined(__linux__)
+
+#if defined(_WIN32)
+#    include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#    include <unistd.h>
+#    if defined(__linux__)
+#        include <sched.h>
+#    endif // defined(__linux__)
+#endif // defined(_WIN32)
+
+/**
+ * @brief Маска возможностей процессора или 0, пока они не определены.
+ *
+ * Определение не зависит от потока, поэтому одновременные вызовы из нескольких
+ * потоков записывают одно и то же значение.
+ */
+static _Atomic vi_u64_t vi_cpu_feature_mask = 0;
+
+#if VI_CPU_X86
+/**
+ * @brief Выполняет CPUID для листа `leaf` и подлиста `subleaf`.
+ *
+ * @param regs Массив для значений регистров EAX, EBX, ECX и EDX.
+ */
+static void
+vi_cpu_cpuid(vi_u32_t leaf, vi_u32_t subleaf, vi_u32_t regs[4])
+{
+#    if VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC
+    int values[4];
+
+    __cpuidex(values, (int)leaf, (int)subleaf);
+    regs[0] = (vi_u32_t)values[0];
+    regs[1] = (vi_u32_t)values[1];
+    regs[2] = (vi_u32_t)values[2];
+    regs[3] = (vi_u32_t)values[3];
+#    else
+    unsigned int a, b, c, d;
+
+    __cpuid_count(leaf, subleaf, a, b, c, d);
+    regs[0] = a;
+    regs[1] = b;
+    regs[2] = c;
+    regs[3] = d;
+#    endif // VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC
+}
+
+/**
+ * @brief Возвращает регистр XCR0 с маской состояний, сохраняемых операционной системой.
+ *
+ * Вызывается только при установленном бите OSXSAVE, иначе команда XGETBV недоступна.
+ */
+static vi_u64_t
+vi_cpu_xcr0(void)
+{
+#    if VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC
+    return (vi_u64_t)_xgetbv(0);
+#    else
+    vi_u32_t lo, hi;
+
+    __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return ((vi_u64_t)hi << 32) | lo;
+#    endif // VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC
+}
+
+/**
+ * @brief Определяет возможности процессора x86 командой CPUID.
+ */
+static vi_u64_t
+vi_cpu_detect(void)
+{
+    vi_u64_t features = 0;
+    vi_u64_t xcr0     = 0;
+    vi_u32_t regs[4];
+
+    vi_cpu_cpuid(0, 0, regs);
+    const vi_u32_t max_leaf = regs[0];
+
+    if (max_leaf < 1)
+    {
+        return features;
+    }
+
+    vi_cpu_cpuid(1, 0, regs);
+    const vi_u32_t ecx1 = regs[2];
+    const vi_u32_t edx1 = regs[3];
+
+    features |= (edx1 & (1U << 26)) ? VI_CPU_FEATURE_SSE2 : 0;
+    features |= (ecx1 & (1U << 0)) ? VI_CPU_FEATURE_SSE3 : 0;
+    features |= (ecx1 & (1U << 9)) ? VI_CPU_FEATURE_SSSE3 : 0;
+    features |= (ecx1 & (1U << 19)) ? VI_CPU_FEATURE_SSE41 : 0;
+    features |= (ecx1 & (1U << 20)) ? VI_CPU_FEATURE_SSE42 : 0;
+    features |= (ecx1 & (1U << 23)) ? VI_CPU_FEATURE_POPCNT : 0;
+
+    // Регистры YMM и ZMM можно использовать, только если операционная система
+    // сохраняет их при переключении потоков: это отражают биты XCR0.
+    if (ecx1 & (1U << 27))
+    {
+        xcr0 = vi_cpu_xcr0();
+    }
+
+    const bool ymm = (xcr0 & 0x06) == 0x06;
+    const bool zmm = (xcr0 & 0xE6) == 0xE6;
+
+    features |= (ymm && (ecx1 & (1U << 28))) ? VI_CPU_FEATURE_AVX : 0;
+    features |= (ymm && (ecx1 & (1U << 12))) ? VI_CPU_FEATURE_FMA : 0;
+
+    if (max_leaf >= 7)
+    {
+        vi_cpu_cpuid(7, 0, regs);
+        const vi_u32_t ebx7 = regs[1];
+
+        features |= (ebx7 & (1U << 3)) ? VI_CPU_FEATURE_BMI1 : 0;
+        features |= (ebx7 & (1U << 8)) ? VI_CPU_FEATURE_BMI2 : 0;
+        features |= (ymm && (ebx7 & (1U << 5))) ? VI_CPU_FEATURE_AVX2 : 0;
+        features |= (zmm && (ebx7 & (1U << 16))) ? VI_CPU_FEATURE_AVX512F : 0;
+        features |= (zmm && (ebx7 & (1U << 30))) ? VI_CPU_FEATURE_AVX512BW : 0;
+        features |= (zmm && (ebx7 & (1U << 31))) ? VI_CPU_FEATURE_AVX512VL : 0;
+    }
+
+    vi_cpu_cpuid(0x80000000U, 0, regs);
+
+    if (regs[0] >= 0x80000001U)
+    {
+        vi_cpu_cpuid(0x80000001U, 0, regs);
+        features |= (regs[2] & (1U << 5)) ? VI_CPU_FEATURE_LZCNT : 0;
+    }
+
+    return features;
+}
+#elif defined(__aarch64__) || defined(_M_ARM64)
+/**
+ * @brief Определяет возможности процессора AArch64.
+ *
+ * Advanced SIMD обязателен для AArch64; остальные возможности под Linux
+ * сообщает ядро через `getauxval`.
+ */
+static vi_u64_t
+vi_cpu_detect(void)
+{
+    vi_u64_t features = VI_CPU_FEATURE_NEON;
+
+#    if defined(__linux__)
+    const unsigned long hwcap = getauxval(AT_HWCAP);
+
+    // Значение HWCAP_CRC32 из <asm/hwcap.h>, который есть не во всех наборах заголовков.
+    features |= (hwcap & (1UL << 7)) ? VI_CPU_FEATURE_CRC32 : 0;
+#    elif defined(__APPLE__)
+    features |= VI_CPU_FEATURE_CRC32;
+#    endif // defined(__linux__)
+
+    return features;
+}
+#else
+/**
+ * @brief Возвращает пустую маску для архитектур без определения возможностей.
+ */
+static vi_u64_t
+vi_cpu_detect(void)
+{
+    return 0;
+}
+#endif // VI_CPU_X86
+
+vi_compiler_constructor(vi_cpu_init)
+{
+    vi_cpu_features();
+}
+
+vi_u64_t
+vi_cpu_features(void)
+{
+    vi_u64_t features = atomic_load_explicit(&vi_cpu_feature_mask, memory_order_relaxed);
+
+    if (!features)
+    {
+        features = vi_cpu_detect() | VI_CPU_FEATURE_DETECTED;
+        atomic_store_explicit(&vi_cpu_feature_mask, features, memory_order_relaxed);
+    }
+
+    return features;
+}
+
+vi_usize_t
+vi_cpu_processor_count(void)
+{
+#if defined(_WIN32)
+    DWORD_PTR process = 0;
+    DWORD_PTR system  = 0;
+
+    if (GetProcessAffinityMask(GetCurrentProcess(), &process, &system) && process)
+    {
+        return (vi_usize_t)vi_bit_popcount64((vi_u64_t)process);
+    }
+
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors ? (vi_usize_t)info.dwNumberOfProcessors : 1;
+#else
+#    if defined(CPU_COUNT)
+    // Маска сродства учитывает ограничения `taskset` и cgroup cpuset. `cpu_set_t`
+    // вмещает 1024 процессора; на больших системах вызов завершается ошибкой,
+    // и используется количество включенных процессоров.
+    cpu_set_t set;
+
+    if (sched_getaffinity(0, sizeof(set), &set) == 0)
+    {
+        const int count = CPU_COUNT(&set);
+
+        if (count > 0)
+        {
+            return (vi_usize_t)count;
+        }
+    }
+#    endif // defined(CPU_COUNT)
+
+#    if defined(_SC_NPROCESSORS_ONLN)
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (vi_usize_t)count : 1;
+#    else
+    return 1;
+#    endif // defined(_SC_NPROCESSORS_ONLN)
+#endif // defined(_WIN32)
+}
@@ -0,0 +1,305 @@
+#include <vi/dynamic_block.h>
+/* Дополнительные модули */
+#include <vi/nullptr.h>
+#include <vi/memory_copy.h>
+#include <vi/runtime_allocator.h>
+
+/**
+ * @def vi_dynamic_block_element
+ * @brief Возвращает адрес элемента с индексом `index` как `vi_u8_t *`.
+ */
+#define vi_dynamic_block_element(block, index)                                                     \
+    ((vi_u8_t *)(block)->data + (index) * (block)->element_size)
+
+/**
+ * @brief Возвращает емкость, следующую за `capacity` при росте блока.
+ *
+ * Вычисляет `capacity * VI_DYNAMIC_BLOCK_GROWTH_FACTOR / 1000` по частям, чтобы
+ * промежуточное произведение не переполнялось, и ограничивает результат значением
+ * `max`. Результат всегда больше `capacity`, если `capacity < max`.
+ */
+static vi_usize_t
+vi_dynamic_block_next_capacity(vi_usize_t capacity, vi_usize_t max)
+{
+    if (capacity < VI_DYNAMIC_BLOCK_MIN_CAPACITY)
+    {
+        return VI_DYNAMIC_BLOCK_MIN_CAPACITY < max ? VI_DYNAMIC_BLOCK_MIN_CAPACITY : max;
+    }
+
+    const vi_usize_t factor = VI_DYNAMIC_BLOCK_GROWTH_FACTOR;
+    const vi_usize_t whole  = capacity / 1000;
+    const vi_usize_t part   = capacity % 1000;
+
+    if (whole > max / factor)
+    {
+        return max;
+    }
+
+    vi_usize_t next = whole * factor;
+    const vi_usize_t rest = part * factor / 1000;
+
+    if (rest > max - next)
+    {
+        return max;
+    }
+
+    next += rest;
+    return next > capacity ? next : capacity + 1;
+}
+
+/**
+ * @brief Изменяет емкость блока до `capacity` элементов.
+ *
+ * Участок в куче изменяется через `vi_allocator_reallocate`, поэтому распределитель
+ * может расширить его на месте. При переходе между встроенным буфером и кучей
+ * элементы копируются.
+ */
+static bool
+vi_dynamic_block_set_capacity(vi_dynamic_block_t *block, vi_usize_t capacity)
+{
+    const vi_usize_t bytes = block->size * block->element_size;
+    vi_ptr_t data;
+
+    if (vi_dynamic_block_is_inline(block))
+    {
+        data = vi_allocator_allocate(block->allocator, capacity * block->element_size);
+
+        if (!data)
+        {
+            return false;
+        }
+
+        vi_memory_copy_unsafe(data, block->data, bytes);
+    }
+    else if (capacity <= block->inline_capacity)
+    {
+        vi_memory_copy_unsafe(block->inline_data, block->data, bytes);
+        vi_allocator_free(block->allocator, block->data, block->capacity * block->element_size);
+
+        data     = block->inline_data;
+        capacity = block->inline_capacity;
+    }
+    else
+    {
+        data = vi_allocator_reallocate(block->allocator,
+                                       block->data,
+                                       block->capacity * block->element_size,
+                                       capacity * block->element_size);
+
+        if (!data)
+        {
+            return false;
+        }
+    }
+
+    block->data     = data;
+    block->capacity = capacity;
+    return true;
+}
+
+/**
+ * @brief Обеспечивает место еще для `count` элементов, увеличивая емкость по коэффициенту.
+ */
+static bool
+vi_dynamic_block_grow(vi_dynamic_block_t *block, vi_usize_t count)
+{
+    const vi_usize_t max = VI_USIZE_T_MAX / block->element_size;
+
+    if (count > max - block->size)
+    {
+        return false;
+    }
+
+    const vi_usize_t required = block->size + count;
+
+    if (required <= block->capacity)
+    {
+        return true;
+    }
+
+    const vi_usize_t next = vi_dynamic_block_next_capacity(block->capacity, max);
+    return vi_dynamic_block_set_capacity(block, next > required ? next : required);
+}
+
+bool
+vi_dynamic_block_init(vi_dynamic_block_t *block,
+                      const vi_allocator_t *allocator,
+                      vi_usize_t element_size)
+{
+    return vi_dynamic_block_init_inline(block, allocator, element_size, nullptr, 0);
+}
+
+bool
+vi_dynamic_block_init_inline(vi_dynamic_block_t *block,
+                             const vi_allocator_t *allocator,
+                             vi_usize_t element_size,
+                             vi_ptr_t buffer,
+                             vi_usize_t inline_capacity)
+{
+    if (!allocator)
+    {
+        allocator = vi_runtime_allocator_get();
+    }
+
+    if (!block || !element_size || !vi_allocator_is_valid(allocator))
+    {
+        return false;
+    }
+
+    if (!buffer)
+    {
+        inline_capacity = 0;
+    }
+
+    block->allocator       = allocator;
+    block->data            = inline_capacity ? buffer : nullptr;
+    block->element_size    = element_size;
+    block->size            = 0;
+    block->capacity        = inline_capacity;
+    block->inline_data     = block->data;
+    block->inline_capacity = inline_capacity;
+    return true;
+}
+
+void
+vi_dynamic_block_destroy(vi_dynamic_block_t *block)
+{
+    if (!block)
+    {
+        return;
+    }
+
+    if (!vi_dynamic_block_is_inline(block))
+    {
+        vi_allocator_free(block->allocator, block->data, block->capacity * block->element_size);
+    }
+
+    block->data     = block->inline_data;
+    block->size     = 0;
+    block->capacity = block->inline_capacity;
+}
+
+bool
+vi_dynamic_block_reserve(vi_dynamic_block_t *block, vi_usize_t capacity)
+{
+    if (!block)
+    {
+        return false;
+    }
+
+    if (capacity <= block->capacity)
+    {
+        return true;
+    }
+
+    if (capacity > VI_USIZE_T_MAX / block->element_size)
+    {
+        return false;
+    }
+    return vi_dynamic_block_set_capacity(block, capacity);
+}
+
+vi_ptr_t
+vi_dynamic_block_push(vi_dynamic_block_t *block, const vi_ptr_t element)
+{
+    if (!block || !vi_dynamic_block_grow(block, 1))
+    {
+        return nullptr;
+    }
+
+    vi_u8_t *const it = vi_dynamic_block_element(block, block->size);
+
+    if (element)
+    {
+        vi_memory_copy_unsafe(it, element, block->element_size);
+    }
+
+    ++block->size;
+    return it;
+}
+
+bool
+vi_dynamic_block_pop(vi_dynamic_block_t *block)
+{
+    if (!block || !block->size)
+    {
+        return false;
+    }
+
+    --block->size;
+    return true;
+}
+
+vi_ptr_t
+vi_dynamic_block_insert(vi_dynamic_block_t *block,
+                        vi_usize_t index,
+                        const vi_ptr_t elements,
+                        vi_usize_t count)
+{
+    if (!block || index > block->size || !vi_dynamic_block_grow(block, count))
+    {
+        return nullptr;
+    }
+
+    vi_u8_t *const it = vi_dynamic_block_element(block, index);
+
+    vi_memory_move_unsafe(it + count * block->element_size,
+                          it,
+                          (block->size - index) * block->element_size);
+
+    if (elements)
+    {
+        vi_memory_copy_unsafe(it, elements, count * block->element_size);
+    }
+
+    block->size += count;
+    return it;
+}
+
+bool
+vi_dynamic_block_erase(vi_dynamic_block_t *block, vi_usize_t index, vi_usize_t count)
+{
+    if (!block || index > block->size || count > block->size - index)
+    {
+        return false;
+    }
+
+    vi_u8_t *const it = vi_dynamic_block_element(block, index);
+
+    vi_memory_move_unsafe(it,
+                          it + count * block->element_size,
+                          (block->size - index - count) * block->element_size);
+
+    block->size -= count;
+    return true;
+}
+
+void
+vi_dynamic_block_clear(vi_dynamic_block_t *block)
+{
+    if (block)
+    {
+        block->size = 0;
+    }
+}
+
+bool
+vi_dynamic_block_shrink_to_fit(vi_dynamic_block_t *block)
+{
+    if (!block)
+    {
+        return false;
+    }
+
+    if (block->size == block->capacity || vi_dynamic_block_is_inline(block))
+    {
+        return true;
+    }
+
+    if (!block->size)
+    {
+        vi_dynamic_block_destroy(block);
+        return true;
+    }
+    return vi_dynamic_block_set_capacity(block, block->size);
+}
@@ -0,0 +1,215 @@
+#include <vi/hash.h>
+/* Дополнительные модули */
+#include "memory_load.h"
+#include <vi/str_raw.h>
+#include <vi/bit_traits.h>
+
+#if VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC
+#    include <intrin.h>
+#endif // VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC
+
+/**
+ * @def VI_HASH_SECRET0
+ * @brief Первая константа смешивания.
+ *
+ * Константы `VI_HASH_SECRET*` — нечетные числа, в каждом байте которых
+ * установлено ровно четыре бита, как в секретах wyhash.
+ */
+#define VI_HASH_SECRET0 0x2D358DCCAA6C78A5ULL
+
+/**
+ * @def VI_HASH_SECRET1
+ * @brief Вторая константа смешивания.
+ */
+#define VI_HASH_SECRET1 0x8BB84B93962EACC9ULL
+
+/**
+ * @def VI_HASH_SECRET2
+ * @brief Третья константа смешивания.
+ */
+#define VI_HASH_SECRET2 0x4B33A62ED433D4A3ULL
+
+/**
+ * @def VI_HASH_SECRET3
+ * @brief Четвертая константа смешивания.
+ */
+#define VI_HASH_SECRET3 0x4D5A2DA51DE1AA47ULL
+
+/**
+ * @def VI_HASH_BLOCK_SIZE
+ * @brief Размер блока, обрабатываемого тремя независимыми цепочками умножений.
+ */
+#define VI_HASH_BLOCK_SIZE 48
+
+#if defined(__SIZEOF_INT128__)
+/**
+ * @brief Беззнаковое 128-битное целое расширения GCC/Clang.
+ *
+ * `__extension__` подавляет предупреждение `-Wpedantic` о нестандартном типе.
+ */
+__extension__ typedef unsigned __int128 vi_hash_u128_t;
+#endif // defined(__SIZEOF_INT128__)
+
+/**
+ * @brief Умножает `*lhs` на `*rhs` и записывает младшую половину 128-битного
+ *        произведения в `*lhs`, а старшую — в `*rhs`.
+ */
+static inline void
+vi_hash_multiply(vi_u64_t *lhs, vi_u64_t *rhs)
+{
+#if defined(__SIZEOF_INT128__)
+    const vi_hash_u128_t product = (vi_hash_u128_t)*lhs * *rhs;
+
+    *lhs = (vi_u64_t)product;
+    *rhs = (vi_u64_t)(product >> 64);
+#elif VI_COMPILER_TYPE == VI_COMPILER_TYPE_MSVC && defined(_M_X64)
+    *lhs = _umul128(*lhs, *rhs, rhs);
+#else
+    const vi_u64_t lhs_high = *lhs >> 32;
+    const vi_u64_t lhs_low  = (vi_u32_t)*lhs;
+    const vi_u64_t rhs_high = *rhs >> 32;
+    const vi_u64_t rhs_low  = (vi_u32_t)*rhs;
+
+    const vi_u64_t high   = lhs_high * rhs_high;
+    const vi_u64_t middle = lhs_high * rhs_low;
+    const vi_u64_t inner  = lhs_low * rhs_high;
+    const vi_u64_t low    = lhs_low * rhs_low;
+    const vi_u64_t cross  = (low >> 32) + (vi_u32_t)middle + (vi_u32_t)inner;
+
+    *lhs = (cross << 32) | (vi_u32_t)low;
+    *rhs = high + (middle >> 32) + (inner >> 32) + (cross >> 32);
+#endif // defined(__SIZEOF_INT128__)
+}
+
+/**
+ * @brief Возвращает XOR старшей и младшей половин 128-битного произведения `lhs * rhs`.
+ */
+static inline vi_u64_t
+vi_hash_mix(vi_u64_t lhs, vi_u64_t rhs)
+{
+    vi_hash_multiply(&lhs, &rhs);
+    return lhs ^ rhs;
+}
+
+/**
+ * @brief Собирает из участка длиной от 1 до 3 байт число, зависящее от всех его байтов.
+ */
+static inline vi_u64_t
+vi_hash_read_small(const vi_u8_t *ptr, vi_usize_t size)
+{
+    return (vi_u64_t)ptr[0] << 16 | (vi_u64_t)ptr[size >> 1] << 8 | ptr[size - 1];
+}
+
+vi_u64_t
+vi_hash_bytes(const vi_ptr_t data, vi_usize_t size)
+{
+    return vi_hash_bytes_seeded(data, size, 0);
+}
+
+vi_u64_t
+vi_hash_bytes_seeded(const vi_ptr_t data, vi_usize_t size, vi_u64_t seed)
+{
+    const vi_u8_t *it = data;
+    vi_u64_t a;
+    vi_u64_t b;
+
+    seed ^= vi_hash_mix(seed ^ VI_HASH_SECRET0, VI_HASH_SECRET1);
+
+    if (size <= 16)
+    {
+        if (size >= 4)
+        {
+            // Два перекрывающихся чтения по 4 байта с каждого края покрывают
+            // весь участок длиной от 4 до 16 байт без ветвлений по длине.
+            const vi_usize_t shift = (size >> 3) << 2;
+
+            const vi_u8_t *const last = it + size - 4;
+
+            a = (vi_u64_t)vi_memory_load_le32(it) << 32 | vi_memory_load_le32(it + shift);
+            b = (vi_u64_t)vi_memory_load_le32(last) << 32 | vi_memory_load_le32(last - shift);
+        }
+        else if (size)
+        {
+            a = vi_hash_read_small(it, size);
+            b = 0;
+        }
+        else
+        {
+            a = 0;
+            b = 0;
+        }
+    }
+    else
+    {
+        vi_usize_t rest = size;
+
+        if (rest > VI_HASH_BLOCK_SIZE)
+        {
+            vi_u64_t seed1 = seed;
+            vi_u64_t seed2 = seed;
+
+            do
+            {
+                seed  = vi_hash_mix(vi_memory_load_le64(it) ^ VI_HASH_SECRET1,
+                                    vi_memory_load_le64(it + 8) ^ seed);
+                seed1 = vi_hash_mix(vi_memory_load_le64(it + 16) ^ VI_HASH_SECRET2,
+                                    vi_memory_load_le64(it + 24) ^ seed1);
+                seed2 = vi_hash_mix(vi_memory_load_le64(it + 32) ^ VI_HASH_SECRET3,
+                                    vi_memory_load_le64(it + 40) ^ seed2);
+
+                it += VI_HASH_BLOCK_SIZE;
+                rest -= VI_HASH_BLOCK_SIZE;
+            } while (rest > VI_HASH_BLOCK_SIZE);
+
+            seed ^= seed1 ^ seed2;
+        }
+
+        for (; rest > 16; it += 16, rest -= 16)
+        {
+            seed = vi_hash_mix(vi_memory_load_le64(it) ^ VI_HASH_SECRET1,
+                               vi_memory_load_le64(it + 8) ^ seed);
+        }
+
+        // Последние 16 байт читаются с конца участка и могут перекрываться
+        // с уже обработанными, поэтому хвост не требует побайтовой обработки.
+        a = vi_memory_load_le64(it + rest - 16);
+        b = vi_memory_load_le64(it + rest - 8);
+    }
+
+    a ^= VI_HASH_SECRET1;
+    b ^= seed;
+    vi_hash_multiply(&a, &b);
+    return vi_hash_mix(a ^ VI_HASH_SECRET0 ^ size, b ^ VI_HASH_SECRET1);
+}
+
+vi_u64_t
+vi_hash_u64(vi_u64_t value)
+{
+    return vi_hash_u64_seeded(value, 0);
+}
+
+vi_u64_t
+vi_hash_u64_seeded(vi_u64_t value, vi_u64_t seed)
+{
+    // Зерно входит в оба множителя, во второй — с поворотом на половину слова,
+    // поэтому без знания зерна нельзя подобрать значение, обнуляющее произведение.
+    vi_u64_t a = value ^ seed ^ VI_HASH_SECRET0;
+    vi_u64_t b = vi_bit_rotate_left(seed, 32) ^ VI_HASH_SECRET1;
+
+    // Одно умножение плохо распространяет старшие биты значения в младшие биты
+    // результата, поэтому половины произведения смешиваются еще раз.
+    vi_hash_multiply(&a, &b);
+    return vi_hash_mix(a ^ VI_HASH_SECRET0, b ^ VI_HASH_SECRET1);
+}
+
+vi_u64_t
+vi_hash_str_raw(const vi_char_t *str)
+{
+    return vi_hash_str_raw_seeded(str, 0);
+}
+
+vi_u64_t
+vi_hash_str_raw_seeded(const vi_char_t *str, vi_u64_t seed)
+{
+    return vi_hash_bytes_seeded(str, str ? vi_str_raw_length(str) : 0, seed);
+}
@@ -0,0 +1,588 @@
+#include <vi/hash_map.h>
+/* Дополнительные модули */
+#include "memory_load.h"
+#include <vi/hash.h>
+#include <vi/bit_traits.h>
+#include <vi/nullptr.h>
+#include <vi/memory_set.h>
+#include <vi/memory_copy.h>
+#include <vi/memory_word.h>
+#include <vi/memory_compare.h>
+#include <vi/numeric_traits.h>
+#include <vi/runtime_allocator.h>
+
+#if VI_COMPILER_SIMD_SSE2
+#    include <emmintrin.h>
+#endif // VI_COMPILER_SIMD_SSE2
+
+/**
+ * @def VI_HASH_MAP_CTRL_EMPTY
+ * @brief Управляющий байт пустой ячейки.
+ */
+#define VI_HASH_MAP_CTRL_EMPTY 0x80
+
+/**
+ * @def VI_HASH_MAP_CTRL_DELETED
+ * @brief Управляющий байт удаленной ячейки.
+ *
+ * Как и у пустой ячейки, старший бит установлен, а бит 1, в отличие от нее, — тоже.
+ */
+#define VI_HASH_MAP_CTRL_DELETED 0xFE
+
+/**
+ * @def VI_HASH_MAP_TABLE_ALIGNMENT
+ * @brief Выравнивание памяти таблицы и начала массива ячеек.
+ */
+#define VI_HASH_MAP_TABLE_ALIGNMENT 16
+
+/**
+ * @def vi_hash_map_h1
+ * @brief Возвращает часть хеша, определяющую начальную группу пробирования.
+ */
+#define vi_hash_map_h1(hash) ((hash) >> 7)
+
+/**
+ * @def vi_hash_map_h2
+ * @brief Возвращает часть хеша, хранящуюся в управляющем байте занятой ячейки.
+ */
+#define vi_hash_map_h2(hash) ((vi_u8_t)((hash)&0x7F))
+
+/**
+ * @def vi_hash_map_is_full
+ * @brief Проверяет, занята ли ячейка с управляющим байтом `ctrl`.
+ */
+#define vi_hash_map_is_full(ctrl) (((ctrl)&0x80) == 0)
+
+/**
+ * @def vi_hash_map_slot
+ * @brief Возвращает адрес ячейки с индексом `index`.
+ */
+#define vi_hash_map_slot(map, index) ((map)->slots + (index) * (map)->slot_size)
+
+/**
+ * @def vi_hash_map_max_load
+ * @brief Возвращает наибольшее количество записей в таблице емкостью `capacity`.
+ */
+#define vi_hash_map_max_load(capacity) ((capacity) - (capacity) / 8)
+
+#if VI_COMPILER_SIMD_SSE2
+/**
+ * @def VI_HASH_MAP_GROUP_WIDTH
+ * @brief Количество ячеек в группе, проверяемой за один шаг.
+ */
+#    define VI_HASH_MAP_GROUP_WIDTH 16
+
+/**
+ * @def VI_HASH_MAP_GROUP_SHIFT
+ * @brief Сдвиг, переводящий номер бита маски группы в номер ячейки.
+ */
+#    define VI_HASH_MAP_GROUP_SHIFT 0
+
+/**
+ * @brief Группа управляющих байтов.
+ */
+typedef __m128i vi_hash_map_group_t;
+
+/**
+ * @brief Загружает группу управляющих байтов, начинающуюся с `ctrl`.
+ */
+static inline vi_hash_map_group_t
+vi_hash_map_group_load(const vi_u8_t *ctrl)
+{
+    return _mm_load_si128((const __m128i *)ctrl);
+}
+
+/**
+ * @brief Возвращает маску ячеек группы, управляющий байт которых равен `h2`.
+ */
+static inline vi_u64_t
+vi_hash_map_group_match(vi_hash_map_group_t group, vi_u8_t h2)
+{
+    return (vi_u64_t)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)h2)));
+}
+
+/**
+ * @brief Возвращает маску пустых ячеек группы.
+ */
+static inline vi_u64_t
+vi_hash_map_group_match_empty(vi_hash_map_group_t group)
+{
+    const __m128i empty = _mm_set1_epi8((char)VI_HASH_MAP_CTRL_EMPTY);
+    return (vi_u64_t)_mm_movemask_epi8(_mm_cmpeq_epi8(group, empty));
+}
+
+/**
+ * @brief Возвращает маску пустых и удаленных ячеек группы.
+ */
+static inline vi_u64_t
+vi_hash_map_group_match_free(vi_hash_map_group_t group)
+{
+    return (vi_u64_t)_mm_movemask_epi8(group);
+}
+#else
+#    define VI_HASH_MAP_GROUP_WIDTH 8
+#    define VI_HASH_MAP_GROUP_SHIFT 3
+
+typedef vi_u64_t vi_hash_map_group_t;
+
+/**
+ * @brief Загружает группу управляющих байтов как 64-битное слово.
+ *
+ * Байт с меньшим адресом попадает в младшие биты слова независимо от порядка байтов
+ * платформы, поэтому номер бита маски однозначно определяет ячейку.
+ */
+static inline vi_hash_map_group_t
+vi_hash_map_group_load(const vi_u8_t *ctrl)
+{
+    return vi_memory_load_le64(ctrl);
+}
+
+/**
+ * @brief Возвращает маску ячеек группы, управляющий байт которых равен `h2`.
+ *
+ * Бит 0x80 установлен в каждом байте маски, соответствующем совпавшей ячейке.
+ */
+static inline vi_u64_t
+vi_hash_map_group_match(vi_hash_map_group_t group, vi_u8_t h2)
+{
+    return vi_numeric_zero_byte_mask64(group ^ vi_numeric_repeat64(h2));
+}
+
+/**
+ * @brief Возвращает маску пустых ячеек группы.
+ *
+ * Пустой байт отличается от удаленного сброшенным битом 1, который сдвигом
+ * переносится на место старшего бита того же байта.
+ */
+static inline vi_u64_t
+vi_hash_map_group_match_empty(vi_hash_map_group_t group)
+{
+    return group & ~(group << 6) & vi_numeric_repeat64(0x80);
+}
+
+/**
+ * @brief Возвращает маску пустых и удаленных ячеек группы.
+ */
+static inline vi_u64_t
+vi_hash_map_group_match_free(vi_hash_map_group_t group)
+{
+    return group & vi_numeric_repeat64(0x80);
+}
+#endif // VI_COMPILER_SIMD_SSE2
+
+/**
+ * @brief Вычисляет хеш ключа функцией таблицы.
+ *
+ * По умолчанию 8-байтные ключи хешируются как числа функцией `vi_hash_u64`,
+ * остальные — функцией `vi_hash_bytes`.
+ */
+static inline vi_u64_t
+vi_hash_map_hash_key(const vi_hash_map_t *map, const vi_ptr_t key)
+{
+    if (map->hash)
+    {
+        return map->hash(key, map->key_size);
+    }
+
+    if (map->key_size == 8)
+    {
+        return vi_hash_u64(vi_memory_load_le64(key));
+    }
+    return vi_hash_bytes(key, map->key_size);
+}
+
+/**
+ * @brief Сравнивает ключ с ключом ячейки функцией таблицы.
+ *
+ * Побайтовое сравнение ключей размером 4 и 8 байт выполняется одним словом.
+ */
+static inline bool
+vi_hash_map_key_equal(const vi_hash_map_t *map, const vi_u8_t *slot, const vi_ptr_t key)
+{
+    if (map->equal)
+    {
+        return map->equal(slot, key, map->key_size);
+    }
+
+    switch (map->key_size)
+    {
+    case 8:
+        return vi_memory_load_le64(slot) == vi_memory_load_le64(key);
+    case 4:
+        return vi_memory_load_le32(slot) == vi_memory_load_le32(key);
+    default:
+        return vi_memory_equal_unsafe(slot, key, map->key_size);
+    }
+}
+
+/**
+ * @brief Возвращает наибольшую степень двойки, на которую делится `size`, но не более 16.
+ *
+ * Для нулевого размера возвращает 1.
+ */
+static vi_usize_t
+vi_hash_map_alignment_of(vi_usize_t size)
+{
+    const vi_usize_t alignment = size & (~size + 1);
+
+    if (!alignment)
+    {
+        return 1;
+    }
+    return alignment < VI_HASH_MAP_TABLE_ALIGNMENT ? alignment : VI_HASH_MAP_TABLE_ALIGNMENT;
+}
+
+/**
+ * @brief Возвращает наименьшую емкость, вмещающую `count` записей, или 0 при переполнении.
+ *
+ * Емкость не меньше `VI_HASH_MAP_TABLE_ALIGNMENT`, поэтому массив ячеек, следующий
+ * за управляющими байтами, остается выровненным при любой ширине группы.
+ */
+static vi_usize_t
+vi_hash_map_capacity_for(vi_usize_t count, vi_usize_t slot_size)
+{
+    vi_usize_t capacity = VI_HASH_MAP_TABLE_ALIGNMENT;
+
+    while (vi_hash_map_max_load(capacity) < count)
+    {
+        if (capacity > VI_USIZE_T_MAX / 2 / (slot_size + 1))
+        {
+            return 0;
+        }
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+/**
+ * @brief Возвращает индекс первой пустой или удаленной ячейки на пути пробирования `hash`.
+ *
+ * Группы перебираются с треугольным шагом, который при количестве групп,
+ * равном степени двойки, обходит каждую группу ровно один раз.
+ */
+static vi_usize_t
+vi_hash_map_find_free(const vi_hash_map_t *map, vi_u64_t hash)
+{
+    const vi_usize_t mask = map->capacity / VI_HASH_MAP_GROUP_WIDTH - 1;
+    vi_usize_t group      = vi_hash_map_h1(hash) & mask;
+
+    for (vi_usize_t step = 1;; group = (group + step++) & mask)
+    {
+        const vi_usize_t base          = group * VI_HASH_MAP_GROUP_WIDTH;
+        const vi_hash_map_group_t ctrl = vi_hash_map_group_load(map->ctrl + base);
+        const vi_u64_t match           = vi_hash_map_group_match_free(ctrl);
+
+        if (match)
+        {
+            return base + (vi_bit_ctz64(match) >> VI_HASH_MAP_GROUP_SHIFT);
+        }
+    }
+}
+
+/**
+ * @brief Возвращает индекс ячейки с ключом `key` или `VI_USIZE_T_MAX`, если ключ не найден.
+ */
+static vi_usize_t
+vi_hash_map_find_index(const vi_hash_map_t *map, const vi_ptr_t key, vi_u64_t hash)
+{
+    const vi_usize_t mask = map->capacity / VI_HASH_MAP_GROUP_WIDTH - 1;
+    const vi_u8_t h2      = vi_hash_map_h2(hash);
+    vi_usize_t group      = vi_hash_map_h1(hash) & mask;
+
+    for (vi_usize_t step = 1;; group = (group + step++) & mask)
+    {
+        const vi_usize_t base          = group * VI_HASH_MAP_GROUP_WIDTH;
+        const vi_hash_map_group_t ctrl = vi_hash_map_group_load(map->ctrl + base);
+
+        for (vi_u64_t match = vi_hash_map_group_match(ctrl, h2); match; match &= match - 1)
+        {
+            const vi_usize_t index =
+                base + (vi_bit_ctz64(match) >> VI_HASH_MAP_GROUP_SHIFT);
+
+            if (vi_hash_map_key_equal(map, vi_hash_map_slot(map, index), key))
+            {
+                return index;
+            }
+        }
+
+        if (vi_hash_map_group_match_empty(ctrl))
+        {
+            return VI_USIZE_T_MAX;
+        }
+    }
+}
+
+/**
+ * @brief Перестраивает таблицу с емкостью `capacity`, переносит записи и удаляет пометки.
+ */
+static bool
+vi_hash_map_rehash(vi_hash_map_t *map, vi_usize_t capacity)
+{
+    vi_u8_t *const table = vi_allocator_aligned_allocate(map->allocator,
+                                                         capacity * (map->slot_size + 1),
+                                                         VI_HASH_MAP_TABLE_ALIGNMENT);
+
+    if (!table)
+    {
+        return false;
+    }
+
+    vi_hash_map_t next = *map;
+    next.ctrl          = table;
+    next.slots         = table + capacity;
+    next.capacity      = capacity;
+    next.growth_left   = vi_hash_map_max_load(capacity) - map->size;
+
+    vi_memory_set_unsafe(next.ctrl, capacity, VI_HASH_MAP_CTRL_EMPTY);
+
+    for (vi_usize_t i = 0; i < map->capacity; ++i)
+    {
+        if (vi_hash_map_is_full(map->ctrl[i]))
+        {
+            const vi_u8_t *const slot = vi_hash_map_slot(map, i);
+            const vi_u64_t hash       = vi_hash_map_hash_key(map, slot);
+            const vi_usize_t index    = vi_hash_map_find_free(&next, hash);
+
+            next.ctrl[index] = vi_hash_map_h2(hash);
+            vi_memory_copy_unsafe(vi_hash_map_slot(&next, index), slot, map->slot_size);
+        }
+    }
+
+    vi_hash_map_destroy(map);
+    *map = next;
+    return true;
+}
+
+bool
+vi_hash_map_init(vi_hash_map_t *map,
+                 const vi_allocator_t *allocator,
+                 vi_usize_t key_size,
+                 vi_usize_t value_size,
+                 vi_hash_map_hash_fn_t hash,
+                 vi_hash_map_equal_fn_t equal)
+{
+    if (!allocator)
+    {
+        allocator = vi_runtime_allocator_get();
+    }
+
+    if (!map || !key_size || !vi_allocator_is_valid(allocator))
+    {
+        return false;
+    }
+
+    const vi_usize_t key_alignment   = vi_hash_map_alignment_of(key_size);
+    const vi_usize_t value_alignment = vi_hash_map_alignment_of(value_size);
+    const vi_usize_t slot_alignment =
+        key_alignment > value_alignment ? key_alignment : value_alignment;
+    const vi_usize_t value_offset = (key_size + value_alignment - 1) & ~(value_alignment - 1);
+
+    map->allocator    = allocator;
+    map->hash         = hash;
+    map->equal        = equal;
+    map->ctrl         = nullptr;
+    map->slots        = nullptr;
+    map->key_size     = key_size;
+    map->value_size   = value_size;
+    map->value_offset = value_offset;
+    map->slot_size    = (value_offset + value_size + slot_alignment - 1) & ~(slot_alignment - 1);
+    map->capacity     = 0;
+    map->size         = 0;
+    map->growth_left  = 0;
+    return true;
+}
+
+void
+vi_hash_map_destroy(vi_hash_map_t *map)
+{
+    if (!map || !map->ctrl)
+    {
+        return;
+    }
+
+    vi_allocator_aligned_free(map->allocator,
+                              map->ctrl,
+                              map->capacity * (map->slot_size + 1),
+                              VI_HASH_MAP_TABLE_ALIGNMENT);
+
+    map->ctrl        = nullptr;
+    map->slots       = nullptr;
+    map->capacity    = 0;
+    map->size        = 0;
+    map->growth_left = 0;
+}
+
+bool
+vi_hash_map_reserve(vi_hash_map_t *map, vi_usize_t count)
+{
+    if (!map)
+    {
+        return false;
+    }
+
+    if (count <= map->size + map->growth_left)
+    {
+        return true;
+    }
+
+    const vi_usize_t capacity = vi_hash_map_capacity_for(count, map->slot_size);
+    return capacity && vi_hash_map_rehash(map, capacity);
+}
+
+vi_ptr_t
+vi_hash_map_find(const vi_hash_map_t *map, const vi_ptr_t key)
+{
+    if (!map || !key || !map->size)
+    {
+        return nullptr;
+    }
+
+    const vi_usize_t index = vi_hash_map_find_index(map, key, vi_hash_map_hash_key(map, key));
+
+    if (index == VI_USIZE_T_MAX)
+    {
+        return nullptr;
+    }
+    return vi_hash_map_slot(map, index) + map->value_offset;
+}
+
+vi_ptr_t
+vi_hash_map_insert(vi_hash_map_t *map, const vi_ptr_t key, const vi_ptr_t value, bool *inserted)
+{
+    if (!map || !key)
+    {
+        return nullptr;
+    }
+
+    const vi_u64_t hash = vi_hash_map_hash_key(map, key);
+
+    if (map->size)
+    {
+        const vi_usize_t index = vi_hash_map_find_index(map, key, hash);
+
+        if (index != VI_USIZE_T_MAX)
+        {
+            if (inserted)
+            {
+                *inserted = false;
+            }
+            return vi_hash_map_slot(map, index) + map->value_offset;
+        }
+    }
+
+    vi_usize_t index = map->capacity ? vi_hash_map_find_free(map, hash) : 0;
+
+    if (!map->growth_left && (!map->capacity || map->ctrl[index] == VI_HASH_MAP_CTRL_EMPTY))
+    {
+        // Если таблица заполнена в основном удаленными ячейками, достаточно
+        // перестроить ее с прежней емкостью; иначе емкость удваивается.
+        const vi_usize_t max_load = vi_hash_map_max_load(map->capacity);
+        const vi_usize_t capacity = map->size < max_load / 2
+                                        ? map->capacity
+                                        : vi_hash_map_capacity_for(max_load + 1, map->slot_size);
+
+        if (!capacity || !vi_hash_map_rehash(map, capacity))
+        {
+            return nullptr;
+        }
+
+        index = vi_hash_map_find_free(map, hash);
+    }
+
+    map->growth_left -= map->ctrl[index] == VI_HASH_MAP_CTRL_EMPTY;
+    map->ctrl[index] = vi_hash_map_h2(hash);
+    ++map->size;
+
+    vi_u8_t *const slot = vi_hash_map_slot(map, index);
+    vi_memory_copy_unsafe(slot, key, map->key_size);
+
+    if (value)
+    {
+        vi_memory_copy_unsafe(slot + map->value_offset, value, map->value_size);
+    }
+
+    if (inserted)
+    {
+        *inserted = true;
+    }
+    return slot + map->value_offset;
+}
+
+bool
+vi_hash_map_erase(vi_hash_map_t *map, const vi_ptr_t key)
+{
+    if (!map || !key || !map->size)
+    {
+        return false;
+    }
+
+    const vi_usize_t index = vi_hash_map_find_index(map, key, vi_hash_map_hash_key(map, key));
+
+    if (index == VI_USIZE_T_MAX)
+    {
+        return false;
+    }
+
+    // Поиск останавливается на группе с пустой ячейкой, поэтому если в группе
+    // удаляемой записи уже есть пустая ячейка, пометка удаления не нужна.
+    const vi_usize_t base = index & ~(vi_usize_t)(VI_HASH_MAP_GROUP_WIDTH - 1);
+
+    if (vi_hash_map_group_match_empty(vi_hash_map_group_load(map->ctrl + base)))
+    {
+        map->ctrl[index] = VI_HASH_MAP_CTRL_EMPTY;
+        ++map->growth_left;
+    }
+    else
+    {
+        map->ctrl[index] = VI_HASH_MAP_CTRL_DELETED;
+    }
+
+    --map->size;
+    return true;
+}
+
+void
+vi_hash_map_clear(vi_hash_map_t *map)
+{
+    if (!map || !map->ctrl)
+    {
+        return;
+    }
+
+    vi_memory_set_unsafe(map->ctrl, map->capacity, VI_HASH_MAP_CTRL_EMPTY);
+    map->size        = 0;
+    map->growth_left = vi_hash_map_max_load(map->capacity);
+}
+
+bool
+vi_hash_map_next(const vi_hash_map_t *map, vi_usize_t *index, vi_ptr_t *key, vi_ptr_t *value)
+{
+    if (!map || !index)
+    {
+        return false;
+    }
+
+    for (vi_usize_t i = *index; i < map->capacity; ++i)
+    {
+        if (vi_hash_map_is_full(map->ctrl[i]))
+        {
+            vi_u8_t *const slot = vi_hash_map_slot(map, i);
+
+            if (key)
+            {
+                *key = slot;
+            }
+
+            if (value)
+            {
+                *value = slot + map->value_offset;
+            }
+
+            *index = i + 1;
+            return true;
+        }
+    }
+
+    *index = map->capacity;
+    return false;
+}
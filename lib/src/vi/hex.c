@@ -0,0 +1,371 @@
+#include <vi/hex.h>
+/* Дополнительные модули */
+#include "simd_range.h"
+#include <vi/cpu.h>
+#include <vi/nullptr.h>
+#include <vi/ascii_map.h>
+
+#if VI_COMPILER_SIMD_SSSE3 || VI_COMPILER_SIMD_AVX2
+#    include <immintrin.h>
+#endif // VI_COMPILER_SIMD_SSSE3 || VI_COMPILER_SIMD_AVX2
+
+/**
+ * @def VI_HEX_TABLE_VALID
+ * @brief Флаг таблицы декодирования, отмечающий шестнадцатеричную цифру.
+ *
+ * Младшая тетрада элемента с флагом содержит значение цифры.
+ */
+#define VI_HEX_TABLE_VALID 0x10
+
+/**
+ * @brief Строчные шестнадцатеричные цифры в порядке значений.
+ *
+ * Массив занимает ровно 16 байт и используется реализациями SSSE3 и AVX2
+ * как таблица `pshufb`.
+ */
+static const vi_u8_t vi_hex_lower[16] = {
+    VI_ASCII_MAP_DIGIT_0,     VI_ASCII_MAP_DIGIT_1,     VI_ASCII_MAP_DIGIT_2,
+    VI_ASCII_MAP_DIGIT_3,     VI_ASCII_MAP_DIGIT_4,     VI_ASCII_MAP_DIGIT_5,
+    VI_ASCII_MAP_DIGIT_6,     VI_ASCII_MAP_DIGIT_7,     VI_ASCII_MAP_DIGIT_8,
+    VI_ASCII_MAP_DIGIT_9,     VI_ASCII_MAP_LOWERCASE_A, VI_ASCII_MAP_LOWERCASE_B,
+    VI_ASCII_MAP_LOWERCASE_C, VI_ASCII_MAP_LOWERCASE_D, VI_ASCII_MAP_LOWERCASE_E,
+    VI_ASCII_MAP_LOWERCASE_F,
+};
+
+/**
+ * @brief Заглавные шестнадцатеричные цифры в порядке значений.
+ */
+static const vi_u8_t vi_hex_upper[16] = {
+    VI_ASCII_MAP_DIGIT_0,     VI_ASCII_MAP_DIGIT_1,     VI_ASCII_MAP_DIGIT_2,
+    VI_ASCII_MAP_DIGIT_3,     VI_ASCII_MAP_DIGIT_4,     VI_ASCII_MAP_DIGIT_5,
+    VI_ASCII_MAP_DIGIT_6,     VI_ASCII_MAP_DIGIT_7,     VI_ASCII_MAP_DIGIT_8,
+    VI_ASCII_MAP_DIGIT_9,     VI_ASCII_MAP_UPPERCASE_A, VI_ASCII_MAP_UPPERCASE_B,
+    VI_ASCII_MAP_UPPERCASE_C, VI_ASCII_MAP_UPPERCASE_D, VI_ASCII_MAP_UPPERCASE_E,
+    VI_ASCII_MAP_UPPERCASE_F,
+};
+
+/**
+ * @brief Таблица декодирования: значение цифры с флагом `VI_HEX_TABLE_VALID`
+ *        или 0 для остальных байтов.
+ */
+static const vi_u8_t vi_hex_table[256] = {
+    [VI_ASCII_MAP_DIGIT_0]     = VI_HEX_TABLE_VALID | 0x0,
+    [VI_ASCII_MAP_DIGIT_1]     = VI_HEX_TABLE_VALID | 0x1,
+    [VI_ASCII_MAP_DIGIT_2]     = VI_HEX_TABLE_VALID | 0x2,
+    [VI_ASCII_MAP_DIGIT_3]     = VI_HEX_TABLE_VALID | 0x3,
+    [VI_ASCII_MAP_DIGIT_4]     = VI_HEX_TABLE_VALID | 0x4,
+    [VI_ASCII_MAP_DIGIT_5]     = VI_HEX_TABLE_VALID | 0x5,
+    [VI_ASCII_MAP_DIGIT_6]     = VI_HEX_TABLE_VALID | 0x6,
+    [VI_ASCII_MAP_DIGIT_7]     = VI_HEX_TABLE_VALID | 0x7,
+    [VI_ASCII_MAP_DIGIT_8]     = VI_HEX_TABLE_VALID | 0x8,
+    [VI_ASCII_MAP_DIGIT_9]     = VI_HEX_TABLE_VALID | 0x9,
+    [VI_ASCII_MAP_UPPERCASE_A] = VI_HEX_TABLE_VALID | 0xA,
+    [VI_ASCII_MAP_UPPERCASE_B] = VI_HEX_TABLE_VALID | 0xB,
+    [VI_ASCII_MAP_UPPERCASE_C] = VI_HEX_TABLE_VALID | 0xC,
+    [VI_ASCII_MAP_UPPERCASE_D] = VI_HEX_TABLE_VALID | 0xD,
+    [VI_ASCII_MAP_UPPERCASE_E] = VI_HEX_TABLE_VALID | 0xE,
+    [VI_ASCII_MAP_UPPERCASE_F] = VI_HEX_TABLE_VALID | 0xF,
+    [VI_ASCII_MAP_LOWERCASE_A] = VI_HEX_TABLE_VALID | 0xA,
+    [VI_ASCII_MAP_LOWERCASE_B] = VI_HEX_TABLE_VALID | 0xB,
+    [VI_ASCII_MAP_LOWERCASE_C] = VI_HEX_TABLE_VALID | 0xC,
+    [VI_ASCII_MAP_LOWERCASE_D] = VI_HEX_TABLE_VALID | 0xD,
+    [VI_ASCII_MAP_LOWERCASE_E] = VI_HEX_TABLE_VALID | 0xE,
+    [VI_ASCII_MAP_LOWERCASE_F] = VI_HEX_TABLE_VALID | 0xF,
+};
+
+/**
+ * @brief Тип указателя на реализацию кодирования.
+ */
+typedef void (*vi_hex_encode_fn_t)(vi_u8_t *dst,
+                                   const vi_u8_t *src,
+                                   vi_usize_t size,
+                                   const vi_u8_t *digits);
+
+/**
+ * @brief Тип указателя на реализацию декодирования.
+ *
+ * Реализация получает четное количество символов и возвращает позицию
+ * первого недопустимого символа или `size`.
+ */
+typedef vi_usize_t (*vi_hex_decode_fn_t)(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size);
+
+static void
+vi_hex_encode_bytes(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size, const vi_u8_t *digits)
+{
+    for (; size; --size, ++src, dst += 2)
+    {
+        dst[0] = digits[*src >> 4];
+        dst[1] = digits[*src & 0x0F];
+    }
+}
+
+static vi_usize_t
+vi_hex_decode_bytes(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    for (vi_usize_t i = 0; i < size; i += 2, ++dst)
+    {
+        const vi_u8_t high = vi_hex_table[src[i]];
+        const vi_u8_t low  = vi_hex_table[src[i + 1]];
+
+        if (!(high & low & VI_HEX_TABLE_VALID))
+        {
+            return (high & VI_HEX_TABLE_VALID) ? i + 1 : i;
+        }
+
+        *dst = (vi_u8_t)(high << 4 | (low & 0x0F));
+    }
+
+    return size;
+}
+
+#if VI_COMPILER_SIMD_SSSE3
+/**
+ * @brief Кодирует по 16 байт за шаг SSSE3.
+ *
+ * Тетрады байтов переводятся в символы одной перестановкой `pshufb` по таблице
+ * цифр, после чего старшие и младшие символы чередуются `unpacklo/unpackhi`.
+ */
+VI_COMPILER_SIMD_TARGET("ssse3")
+static void
+vi_hex_encode_ssse3(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size, const vi_u8_t *digits)
+{
+    const __m128i table = _mm_loadu_si128((const __m128i *)digits);
+    const __m128i mask  = _mm_set1_epi8(0x0F);
+
+    for (; size >= 16; size -= 16, src += 16, dst += 32)
+    {
+        const __m128i x    = _mm_loadu_si128((const __m128i *)src);
+        const __m128i high = _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(x, 4), mask));
+        const __m128i low  = _mm_shuffle_epi8(table, _mm_and_si128(x, mask));
+
+        _mm_storeu_si128((__m128i *)dst, _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128((__m128i *)(dst + 16), _mm_unpackhi_epi8(high, low));
+    }
+
+    vi_hex_encode_bytes(dst, src, size, digits);
+}
+
+/**
+ * @brief Переводит 16 символов в значения тетрад.
+ *
+ * Цифры и буквы обоих регистров определяются сравнением диапазонов; буквы
+ * предварительно приводятся к нижнему регистру установкой бита 0x20.
+ *
+ * @param x Символы.
+ * @param valid Маска байтов, содержащих шестнадцатеричную цифру.
+ *
+ * @return Значения тетрад; байты вне маски не определены.
+ */
+VI_COMPILER_SIMD_TARGET("ssse3")
+static inline __m128i
+vi_hex_decode_block_ssse3(__m128i x, __m128i *valid)
+{
+    const __m128i folded = _mm_or_si128(x, _mm_set1_epi8(0x20));
+    const __m128i digit  = vi_simd_range_sse2(x, '0', 10);
+    const __m128i letter = vi_simd_range_sse2(folded, 'a', 6);
+
+    *valid = _mm_or_si128(digit, letter);
+    return _mm_or_si128(_mm_and_si128(digit, _mm_sub_epi8(x, _mm_set1_epi8('0'))),
+                        _mm_and_si128(letter, _mm_sub_epi8(folded, _mm_set1_epi8('a' - 10))));
+}
+
+/**
+ * @brief Декодирует по 32 символа за шаг SSSE3.
+ *
+ * Пары тетрад объединяются `pmaddubsw` с весами 16 и 1, а 16-битные суммы
+ * упаковываются в байты. Блок с недопустимым символом и остаток обрабатываются
+ * по таблице, которая и определяет позицию ошибки.
+ */
+VI_COMPILER_SIMD_TARGET("ssse3")
+static vi_usize_t
+vi_hex_decode_ssse3(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    const __m128i weights = _mm_set1_epi16(0x0110);
+    vi_usize_t i          = 0;
+
+    for (; size - i >= 32; i += 32)
+    {
+        __m128i first_valid, second_valid;
+        const __m128i first  = vi_hex_decode_block_ssse3(
+            _mm_loadu_si128((const __m128i *)(src + i)), &first_valid);
+        const __m128i second = vi_hex_decode_block_ssse3(
+            _mm_loadu_si128((const __m128i *)(src + i + 16)), &second_valid);
+
+        if (_mm_movemask_epi8(_mm_and_si128(first_valid, second_valid)) != 0xFFFF)
+        {
+            break;
+        }
+
+        _mm_storeu_si128((__m128i *)(dst + i / 2),
+                         _mm_packus_epi16(_mm_maddubs_epi16(first, weights),
+                                          _mm_maddubs_epi16(second, weights)));
+    }
+
+    return i + vi_hex_decode_bytes(dst + i / 2, src + i, size - i);
+}
+#endif // VI_COMPILER_SIMD_SSSE3
+
+#if VI_COMPILER_SIMD_AVX2
+/**
+ * @brief Кодирует по 32 байта за шаг AVX2.
+ *
+ * `unpacklo/unpackhi` работают внутри 128-битных половин регистра, поэтому
+ * 64-битные части входа заранее переставляются в порядок 0, 2, 1, 3.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static void
+vi_hex_encode_avx2(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size, const vi_u8_t *digits)
+{
+    const __m256i table = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)digits));
+    const __m256i mask  = _mm256_set1_epi8(0x0F);
+
+    for (; size >= 32; size -= 32, src += 32, dst += 64)
+    {
+        const __m256i x    = _mm256_permute4x64_epi64(_mm256_loadu_si256((const __m256i *)src),
+                                                   0xD8);
+        const __m256i high = _mm256_shuffle_epi8(table,
+                                                 _mm256_and_si256(_mm256_srli_epi16(x, 4), mask));
+        const __m256i low  = _mm256_shuffle_epi8(table, _mm256_and_si256(x, mask));
+
+        _mm256_storeu_si256((__m256i *)dst, _mm256_unpacklo_epi8(high, low));
+        _mm256_storeu_si256((__m256i *)(dst + 32), _mm256_unpackhi_epi8(high, low));
+    }
+
+    vi_hex_encode_ssse3(dst, src, size, digits);
+}
+
+/**
+ * @brief Переводит 32 символа в значения тетрад.
+ *
+ * Аналогична `vi_hex_decode_block_ssse3`.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static inline __m256i
+vi_hex_decode_block_avx2(__m256i x, __m256i *valid)
+{
+    const __m256i folded = _mm256_or_si256(x, _mm256_set1_epi8(0x20));
+    const __m256i digit  = vi_simd_range_avx2(x, '0', 10);
+    const __m256i letter = vi_simd_range_avx2(folded, 'a', 6);
+
+    *valid = _mm256_or_si256(digit, letter);
+    return _mm256_or_si256(
+        _mm256_and_si256(digit, _mm256_sub_epi8(x, _mm256_set1_epi8('0'))),
+        _mm256_and_si256(letter, _mm256_sub_epi8(folded, _mm256_set1_epi8('a' - 10))));
+}
+
+/**
+ * @brief Декодирует по 64 символа за шаг AVX2.
+ *
+ * `packus` упаковывает половины регистров по отдельности, поэтому 64-битные
+ * части результата переставляются в порядок 0, 2, 1, 3.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static vi_usize_t
+vi_hex_decode_avx2(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    const __m256i weights = _mm256_set1_epi16(0x0110);
+    vi_usize_t i          = 0;
+
+    for (; size - i >= 64; i += 64)
+    {
+        __m256i first_valid, second_valid;
+        const __m256i first  = vi_hex_decode_block_avx2(
+            _mm256_loadu_si256((const __m256i *)(src + i)), &first_valid);
+        const __m256i second = vi_hex_decode_block_avx2(
+            _mm256_loadu_si256((const __m256i *)(src + i + 32)), &second_valid);
+
+        if (_mm256_movemask_epi8(_mm256_and_si256(first_valid, second_valid)) != -1)
+        {
+            break;
+        }
+
+        const __m256i packed = _mm256_packus_epi16(_mm256_maddubs_epi16(first, weights),
+                                                   _mm256_maddubs_epi16(second, weights));
+
+        _mm256_storeu_si256((__m256i *)(dst + i / 2), _mm256_permute4x64_epi64(packed, 0xD8));
+    }
+
+    return i + vi_hex_decode_ssse3(dst + i / 2, src + i, size - i);
+}
+#endif // VI_COMPILER_SIMD_AVX2
+
+/**
+ * @brief Реализации, выбираемые при загрузке библиотеки.
+ */
+static vi_hex_encode_fn_t vi_hex_encode_vector = vi_hex_encode_bytes;
+static vi_hex_decode_fn_t vi_hex_decode_vector = vi_hex_decode_bytes;
+
+#if VI_COMPILER_SIMD_SSSE3
+vi_compiler_constructor(vi_hex_init)
+{
+    if (vi_cpu_has(VI_CPU_FEATURE_SSSE3))
+    {
+        vi_hex_encode_vector = vi_hex_encode_ssse3;
+        vi_hex_decode_vector = vi_hex_decode_ssse3;
+    }
+
+#    if VI_COMPILER_SIMD_AVX2
+    if (vi_cpu_has(VI_CPU_FEATURE_AVX2))
+    {
+        vi_hex_encode_vector = vi_hex_encode_avx2;
+        vi_hex_decode_vector = vi_hex_decode_avx2;
+    }
+#    endif // VI_COMPILER_SIMD_AVX2
+}
+#endif // VI_COMPILER_SIMD_SSSE3
+
+vi_usize_t
+vi_hex_encode(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    if (!dst || !src)
+    {
+        return 0;
+    }
+
+    vi_hex_encode_vector(dst, src, size, vi_hex_lower);
+    return vi_hex_encoded_size(size);
+}
+
+vi_usize_t
+vi_hex_encode_upper(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    if (!dst || !src)
+    {
+        return 0;
+    }
+
+    vi_hex_encode_vector(dst, src, size, vi_hex_upper);
+    return vi_hex_encoded_size(size);
+}
+
+vi_return_t
+vi_hex_decode(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size, vi_usize_t *result)
+{
+    if (!dst || !src)
+    {
+        return VI_HEX_INVALID;
+    }
+
+    const vi_usize_t even     = size & ~(vi_usize_t)1;
+    const vi_usize_t position = vi_hex_decode_vector(dst, src, even);
+    vi_return_t status        = VI_HEX_SUCCESS;
+    vi_usize_t value          = vi_hex_decoded_size(size);
+
+    if (position != even)
+    {
+        status = VI_HEX_BAD_CHARACTER;
+        value  = position;
+    }
+    else if (size != even)
+    {
+        status = VI_HEX_BAD_LENGTH;
+        value  = even;
+    }
+
+    if (result)
+    {
+        *result = value;
+    }
+
+    return status;
+}
@@ -0,0 +1,294 @@
+#include <vi/memory_compare.h>
+/* Дополнительные модули */
+#include <vi/cpu.h>
+#include <vi/ptr_traits.h>
+#include <vi/memory_word.h>
+
+#if VI_COMPILER_SIMD_SSE2
+#    include <emmintrin.h>
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_AVX2
+#    include <immintrin.h>
+#endif // VI_COMPILER_SIMD_AVX2
+
+/**
+ * @def VI_MEMORY_COMPARE_VECTOR_THRESHOLD
+ * @brief Размер участка в байтах, начиная с которого используется векторная реализация.
+ */
+#define VI_MEMORY_COMPARE_VECTOR_THRESHOLD 16
+
+/**
+ * @brief Тип указателя на реализацию сравнения памяти.
+ */
+typedef vi_return_t (*vi_memory_compare_fn_t)(const vi_u8_t *lhs,
+                                              const vi_u8_t *rhs,
+                                              vi_usize_t size);
+
+static vi_return_t
+vi_memory_compare_bytes(const vi_u8_t *lhs, const vi_u8_t *rhs, vi_usize_t size)
+{
+    for (; size; --size, ++lhs, ++rhs)
+    {
+        if (*lhs != *rhs)
+        {
+            return (vi_return_t)*lhs - (vi_return_t)*rhs;
+        }
+    }
+    return 0;
+}
+
+#if !VI_COMPILER_SIMD_SSE2
+/**
+ * @brief Сравнивает память машинными словами.
+ *
+ * Если участки одинаково выровнены, невыровненное начало сравнивается побайтово,
+ * а середина — словами `vi_memory_word_t`. Слово, в котором найдено различие,
+ * и остаток участка сравниваются побайтово.
+ */
+static vi_return_t
+vi_memory_compare_word(const vi_u8_t *lhs, const vi_u8_t *rhs, vi_usize_t size)
+{
+    if (size < VI_MEMORY_WORD_SIZE * 2 ||
+        !vi_numeric_has_zero_remainder(vi_addr_diff(lhs, rhs), VI_MEMORY_WORD_SIZE))
+    {
+        return vi_memory_compare_bytes(lhs, rhs, size);
+    }
+
+    const vi_u8_t *const aligned = vi_ptr_align_up(lhs, nullptr, VI_MEMORY_WORD_SIZE);
+    const vi_usize_t head        = vi_addr_diff(aligned, lhs);
+    const vi_return_t result     = vi_memory_compare_bytes(lhs, rhs, head);
+
+    if (result)
+    {
+        return result;
+    }
+
+    const vi_memory_word_t *lhs_it = (const vi_memory_word_t *)(lhs + head);
+    const vi_memory_word_t *rhs_it = (const vi_memory_word_t *)(rhs + head);
+    size -= head;
+
+    for (; size >= VI_MEMORY_WORD_SIZE; size -= VI_MEMORY_WORD_SIZE, ++lhs_it, ++rhs_it)
+    {
+        if (*lhs_it != *rhs_it)
+        {
+            return vi_memory_compare_bytes((const vi_u8_t *)lhs_it,
+                                           (const vi_u8_t *)rhs_it,
+                                           VI_MEMORY_WORD_SIZE);
+        }
+    }
+
+    return vi_memory_compare_bytes((const vi_u8_t *)lhs_it, (const vi_u8_t *)rhs_it, size);
+}
+#endif // !VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_SSE2
+/**
+ * @brief Сравнивает память 16-байтными регистрами SSE2.
+ *
+ * Основной цикл сравнивает по 64 байта за итерацию, объединяя результаты сравнений,
+ * а остаток покрывается невыровненным чтением последних 16 байт. Блок, в котором
+ * найдено различие, сравнивается побайтово. Требует `size >= 16`.
+ */
+static vi_return_t
+vi_memory_compare_sse2(const vi_u8_t *lhs, const vi_u8_t *rhs, vi_usize_t size)
+{
+    vi_usize_t offset = 0;
+
+    for (; size - offset >= 64; offset += 64)
+    {
+        const vi_u8_t *const l = lhs + offset;
+        const vi_u8_t *const r = rhs + offset;
+
+        const __m128i x0 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)l),
+                                          _mm_loadu_si128((const __m128i *)r));
+        const __m128i x1 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(l + 16)),
+                                          _mm_loadu_si128((const __m128i *)(r + 16)));
+        const __m128i x2 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(l + 32)),
+                                          _mm_loadu_si128((const __m128i *)(r + 32)));
+        const __m128i x3 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(l + 48)),
+                                          _mm_loadu_si128((const __m128i *)(r + 48)));
+        const __m128i eq = _mm_and_si128(_mm_and_si128(x0, x1), _mm_and_si128(x2, x3));
+
+        if (_mm_movemask_epi8(eq) != 0xFFFF)
+        {
+            return vi_memory_compare_bytes(l, r, 64);
+        }
+    }
+
+    for (; size - offset >= 16; offset += 16)
+    {
+        const __m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(lhs + offset)),
+                                          _mm_loadu_si128((const __m128i *)(rhs + offset)));
+
+        if (_mm_movemask_epi8(eq) != 0xFFFF)
+        {
+            return vi_memory_compare_bytes(lhs + offset, rhs + offset, 16);
+        }
+    }
+
+    if (offset != size)
+    {
+        offset = size - 16;
+
+        const __m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(lhs + offset)),
+                                          _mm_loadu_si128((const __m128i *)(rhs + offset)));
+
+        if (_mm_movemask_epi8(eq) != 0xFFFF)
+        {
+            return vi_memory_compare_bytes(lhs + offset, rhs + offset, 16);
+        }
+    }
+
+    return 0;
+}
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_AVX2
+/**
+ * @brief Сравнивает память 32-байтными регистрами AVX2.
+ *
+ * Аналогична `vi_memory_compare_sse2`, но обрабатывает по 128 байт за итерацию.
+ * Участки короче 32 байт передаются в `vi_memory_compare_sse2`.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static vi_return_t
+vi_memory_compare_avx2(const vi_u8_t *lhs, const vi_u8_t *rhs, vi_usize_t size)
+{
+    if (size < 32)
+    {
+        return vi_memory_compare_sse2(lhs, rhs, size);
+    }
+
+    vi_usize_t offset = 0;
+
+    for (; size - offset >= 128; offset += 128)
+    {
+        const vi_u8_t *const l = lhs + offset;
+        const vi_u8_t *const r = rhs + offset;
+
+        const __m256i x0 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)l),
+                                             _mm256_loadu_si256((const __m256i *)r));
+        const __m256i x1 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(l + 32)),
+                                             _mm256_loadu_si256((const __m256i *)(r + 32)));
+        const __m256i x2 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(l + 64)),
+                                             _mm256_loadu_si256((const __m256i *)(r + 64)));
+        const __m256i x3 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(l + 96)),
+                                             _mm256_loadu_si256((const __m256i *)(r + 96)));
+        const __m256i eq = _mm256_and_si256(_mm256_and_si256(x0, x1), _mm256_and_si256(x2, x3));
+
+        if (_mm256_movemask_epi8(eq) != -1)
+        {
+            return vi_memory_compare_bytes(l, r, 128);
+        }
+    }
+
+    for (; size - offset >= 32; offset += 32)
+    {
+        const __m256i eq = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(lhs + offset)),
+                                             _mm256_loadu_si256((const __m256i *)(rhs + offset)));
+
+        if (_mm256_movemask_epi8(eq) != -1)
+        {
+            return vi_memory_compare_bytes(lhs + offset, rhs + offset, 32);
+        }
+    }
+
+    if (offset != size)
+    {
+        offset = size - 32;
+
+        const __m256i eq = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(lhs + offset)),
+                                             _mm256_loadu_si256((const __m256i *)(rhs + offset)));
+
+        if (_mm256_movemask_epi8(eq) != -1)
+        {
+            return vi_memory_compare_bytes(lhs + offset, rhs + offset, 32);
+        }
+    }
+
+    return 0;
+}
+#endif // VI_COMPILER_SIMD_AVX2
+
+/**
+ * @brief Реализация для участков от `VI_MEMORY_COMPARE_VECTOR_THRESHOLD` байт,
+ *        выбираемая при загрузке библиотеки.
+ */
+#if VI_COMPILER_SIMD_SSE2
+static vi_memory_compare_fn_t vi_memory_compare_vector = vi_memory_compare_sse2;
+#else
+static vi_memory_compare_fn_t vi_memory_compare_vector = vi_memory_compare_word;
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_AVX2
+vi_compiler_constructor(vi_memory_compare_init)
+{
+    if (vi_cpu_has(VI_CPU_FEATURE_AVX2))
+    {
+        vi_memory_compare_vector = vi_memory_compare_avx2;
+    }
+}
+#endif // VI_COMPILER_SIMD_AVX2
+
+vi_return_t
+vi_memory_compare_unsafe(const vi_ptr_t lhs, const vi_ptr_t rhs, vi_usize_t size)
+{
+    if (size < VI_MEMORY_COMPARE_VECTOR_THRESHOLD)
+    {
+        return vi_memory_compare_bytes(lhs, rhs, size);
+    }
+    return vi_memory_compare_vector(lhs, rhs, size);
+}
+
+vi_return_t
+vi_memory_compare(const vi_ptr_t lhs_begin,
+                  const vi_ptr_t lhs_end,
+                  const vi_ptr_t rhs_begin,
+                  const vi_ptr_t rhs_end)
+{
+    if (!vi_ptr_is_valid_ranges(lhs_begin, lhs_end, rhs_begin, rhs_end))
+    {
+        return VI_RETURN_T_MIN;
+    }
+
+    const vi_usize_t lhs_size = vi_ptr_range_size(lhs_begin, lhs_end);
+    const vi_usize_t rhs_size = vi_ptr_range_size(rhs_begin, rhs_end);
+    const vi_return_t result  = vi_memory_compare_unsafe(vi_ptr_range_first(lhs_begin),
+                                                        vi_ptr_range_first(rhs_begin),
+                                                        lhs_size < rhs_size ? lhs_size : rhs_size);
+
+    if (result)
+    {
+        return result;
+    }
+    return (lhs_size > rhs_size) - (lhs_size < rhs_size);
+}
+
+bool
+vi_memory_equal_unsafe(const vi_ptr_t lhs, const vi_ptr_t rhs, vi_usize_t size)
+{
+    return vi_memory_compare_unsafe(lhs, rhs, size) == 0;
+}
+
+bool
+vi_memory_equal(const vi_ptr_t lhs_begin,
+                const vi_ptr_t lhs_end,
+                const vi_ptr_t rhs_begin,
+                const vi_ptr_t rhs_end)
+{
+    if (!vi_ptr_is_valid_ranges(lhs_begin, lhs_end, rhs_begin, rhs_end))
+    {
+        return false;
+    }
+
+    const vi_usize_t size = vi_ptr_range_size(lhs_begin, lhs_end);
+
+    if (size != vi_ptr_range_size(rhs_begin, rhs_end))
+    {
+        return false;
+    }
+    return vi_memory_equal_unsafe(vi_ptr_range_first(lhs_begin),
+                                  vi_ptr_range_first(rhs_begin),
+                                  size);
+}
@@ -0,0 +1,487 @@
+#include <vi/memory_copy.h>
+/* Дополнительные модули */
+#include <vi/cpu.h>
+#include <vi/nullptr.h>
+#include <vi/ptr_traits.h>
+#include <vi/memory_word.h>
+
+#if VI_COMPILER_SIMD_SSE2
+#    include <emmintrin.h>
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_AVX2
+#    include <immintrin.h>
+#endif // VI_COMPILER_SIMD_AVX2
+
+/**
+ * @def VI_MEMORY_COPY_VECTOR_THRESHOLD
+ * @brief Размер участка в байтах, начиная с которого используется векторная реализация.
+ */
+#define VI_MEMORY_COPY_VECTOR_THRESHOLD 16
+
+/**
+ * @brief Тип указателя на реализацию копирования в одном направлении.
+ */
+typedef void (*vi_memory_copy_fn_t)(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size);
+
+static void
+vi_memory_copy_bytes_forward(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    while (size--)
+    {
+        *dst++ = *src++;
+    }
+}
+
+static void
+vi_memory_copy_bytes_backward(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    dst += size;
+    src += size;
+
+    while (size--)
+    {
+        *--dst = *--src;
+    }
+}
+
+#if !VI_COMPILER_SIMD_SSE2
+/**
+ * @brief Копирует память словами с начала участка.
+ *
+ * Если источник и приемник выровнены одинаково, невыровненное начало копируется побайтово,
+ * середина — словами `vi_memory_word_t`, остаток — побайтово. Иначе копирование
+ * выполняется побайтово. Все чтения слова выполняются до записи, поэтому функция
+ * корректна для перекрывающихся участков, если `dst` находится перед `src`.
+ */
+static void
+vi_memory_copy_word_forward(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    if (size < VI_MEMORY_WORD_SIZE * 2 ||
+        !vi_numeric_has_zero_remainder(vi_addr_diff(dst, src), VI_MEMORY_WORD_SIZE))
+    {
+        vi_memory_copy_bytes_forward(dst, src, size);
+        return;
+    }
+
+    const vi_usize_t head = vi_addr_diff(vi_ptr_align_up(dst, nullptr, VI_MEMORY_WORD_SIZE), dst);
+    vi_memory_copy_bytes_forward(dst, src, head);
+
+    vi_memory_word_t *dst_it       = (vi_memory_word_t *)(dst + head);
+    const vi_memory_word_t *src_it = (const vi_memory_word_t *)(src + head);
+    vi_usize_t count               = (size - head) / VI_MEMORY_WORD_SIZE;
+
+    for (; count >= 4; count -= 4, dst_it += 4, src_it += 4)
+    {
+        const vi_memory_word_t w0 = src_it[0];
+        const vi_memory_word_t w1 = src_it[1];
+        const vi_memory_word_t w2 = src_it[2];
+        const vi_memory_word_t w3 = src_it[3];
+
+        dst_it[0] = w0;
+        dst_it[1] = w1;
+        dst_it[2] = w2;
+        dst_it[3] = w3;
+    }
+
+    while (count--)
+    {
+        *dst_it++ = *src_it++;
+    }
+
+    const vi_usize_t done = vi_addr_diff(dst_it, dst);
+    vi_memory_copy_bytes_forward((vi_u8_t *)dst_it, (const vi_u8_t *)src_it, size - done);
+}
+
+/**
+ * @brief Копирует память словами с конца участка.
+ *
+ * Зеркальная версия `vi_memory_copy_word_forward`, корректная
+ * для перекрывающихся участков, если `dst` находится после `src`.
+ */
+static void
+vi_memory_copy_word_backward(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    if (size < VI_MEMORY_WORD_SIZE * 2 ||
+        !vi_numeric_has_zero_remainder(vi_addr_diff(dst, src), VI_MEMORY_WORD_SIZE))
+    {
+        vi_memory_copy_bytes_backward(dst, src, size);
+        return;
+    }
+
+    vi_u8_t *const dst_end = dst + size;
+    const vi_usize_t tail  = vi_ptr_to_addr(dst_end) % VI_MEMORY_WORD_SIZE;
+    vi_memory_copy_bytes_backward(dst_end - tail, src + size - tail, tail);
+
+    vi_memory_word_t *dst_it       = (vi_memory_word_t *)(dst_end - tail);
+    const vi_memory_word_t *src_it = (const vi_memory_word_t *)(src + size - tail);
+    vi_usize_t count               = (size - tail) / VI_MEMORY_WORD_SIZE;
+
+    for (; count >= 4; count -= 4)
+    {
+        dst_it -= 4;
+        src_it -= 4;
+
+        const vi_memory_word_t w3 = src_it[3];
+        const vi_memory_word_t w2 = src_it[2];
+        const vi_memory_word_t w1 = src_it[1];
+        const vi_memory_word_t w0 = src_it[0];
+
+        dst_it[3] = w3;
+        dst_it[2] = w2;
+        dst_it[1] = w1;
+        dst_it[0] = w0;
+    }
+
+    while (count--)
+    {
+        *--dst_it = *--src_it;
+    }
+
+    vi_memory_copy_bytes_backward(dst, src, vi_addr_diff(dst_it, dst));
+}
+#endif // !VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_SSE2
+/**
+ * @brief Копирует от 16 до 64 байт регистрами SSE2.
+ *
+ * Все чтения выполняются до записей, поэтому функция
+ * корректна для перекрывающихся участков в обоих направлениях.
+ */
+static void
+vi_memory_copy_sse2_small(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    if (size <= 32)
+    {
+        const __m128i x0 = _mm_loadu_si128((const __m128i *)src);
+        const __m128i x1 = _mm_loadu_si128((const __m128i *)(src + size - 16));
+
+        _mm_storeu_si128((__m128i *)dst, x0);
+        _mm_storeu_si128((__m128i *)(dst + size - 16), x1);
+        return;
+    }
+
+    const __m128i x0 = _mm_loadu_si128((const __m128i *)src);
+    const __m128i x1 = _mm_loadu_si128((const __m128i *)(src + 16));
+    const __m128i x2 = _mm_loadu_si128((const __m128i *)(src + size - 32));
+    const __m128i x3 = _mm_loadu_si128((const __m128i *)(src + size - 16));
+
+    _mm_storeu_si128((__m128i *)dst, x0);
+    _mm_storeu_si128((__m128i *)(dst + 16), x1);
+    _mm_storeu_si128((__m128i *)(dst + size - 32), x2);
+    _mm_storeu_si128((__m128i *)(dst + size - 16), x3);
+}
+
+/**
+ * @brief Копирует более 64 байт регистрами SSE2 с начала участка.
+ *
+ * Первые и последние 16 байт источника читаются заранее и записываются после цикла,
+ * а середина копируется выровненными по приемнику записями. Корректна для
+ * перекрывающихся участков, если `dst` находится перед `src`.
+ */
+static void
+vi_memory_copy_sse2_forward(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    const __m128i head     = _mm_loadu_si128((const __m128i *)src);
+    const __m128i tail     = _mm_loadu_si128((const __m128i *)(src + size - 16));
+    vi_u8_t *const dst_end = dst + size;
+    vi_u8_t *it            = vi_ptr_align_up(dst + 1, nullptr, sizeof(__m128i));
+    const vi_u8_t *src_it  = src + (it - dst);
+
+    for (; dst_end - it > 64; it += 64, src_it += 64)
+    {
+        const __m128i x0 = _mm_loadu_si128((const __m128i *)src_it);
+        const __m128i x1 = _mm_loadu_si128((const __m128i *)(src_it + 16));
+        const __m128i x2 = _mm_loadu_si128((const __m128i *)(src_it + 32));
+        const __m128i x3 = _mm_loadu_si128((const __m128i *)(src_it + 48));
+
+        _mm_store_si128((__m128i *)it, x0);
+        _mm_store_si128((__m128i *)(it + 16), x1);
+        _mm_store_si128((__m128i *)(it + 32), x2);
+        _mm_store_si128((__m128i *)(it + 48), x3);
+    }
+
+    for (; dst_end - it > 16; it += 16, src_it += 16)
+    {
+        _mm_store_si128((__m128i *)it, _mm_loadu_si128((const __m128i *)src_it));
+    }
+
+    _mm_storeu_si128((__m128i *)(dst_end - 16), tail);
+    _mm_storeu_si128((__m128i *)dst, head);
+}
+
+/**
+ * @brief Копирует более 64 байт регистрами SSE2 с конца участка.
+ *
+ * Зеркальная версия `vi_memory_copy_sse2_forward`, корректная
+ * для перекрывающихся участков, если `dst` находится после `src`.
+ */
+static void
+vi_memory_copy_sse2_backward(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    const __m128i head     = _mm_loadu_si128((const __m128i *)src);
+    const __m128i tail     = _mm_loadu_si128((const __m128i *)(src + size - 16));
+    vi_u8_t *const dst_end = dst + size;
+    vi_u8_t *it            = vi_ptr_align_down(dst_end - 1, nullptr, sizeof(__m128i));
+    const vi_u8_t *src_it  = src + (it - dst);
+
+    for (; it - dst > 64; it -= 64, src_it -= 64)
+    {
+        const __m128i x3 = _mm_loadu_si128((const __m128i *)(src_it - 16));
+        const __m128i x2 = _mm_loadu_si128((const __m128i *)(src_it - 32));
+        const __m128i x1 = _mm_loadu_si128((const __m128i *)(src_it - 48));
+        const __m128i x0 = _mm_loadu_si128((const __m128i *)(src_it - 64));
+
+        _mm_store_si128((__m128i *)(it - 16), x3);
+        _mm_store_si128((__m128i *)(it - 32), x2);
+        _mm_store_si128((__m128i *)(it - 48), x1);
+        _mm_store_si128((__m128i *)(it - 64), x0);
+    }
+
+    for (; it - dst > 16; it -= 16, src_it -= 16)
+    {
+        _mm_store_si128((__m128i *)(it - 16), _mm_loadu_si128((const __m128i *)(src_it - 16)));
+    }
+
+    _mm_storeu_si128((__m128i *)dst, head);
+    _mm_storeu_si128((__m128i *)(dst_end - 16), tail);
+}
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_AVX2
+/**
+ * @brief Копирует более 64 байт регистрами AVX2 с начала участка.
+ *
+ * Аналогична `vi_memory_copy_sse2_forward`, но использует 32-байтные регистры.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static void
+vi_memory_copy_avx2_forward(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    if (size <= 128)
+    {
+        const __m256i x0 = _mm256_loadu_si256((const __m256i *)src);
+        const __m256i x1 = _mm256_loadu_si256((const __m256i *)(src + 32));
+        const __m256i x2 = _mm256_loadu_si256((const __m256i *)(src + size - 64));
+        const __m256i x3 = _mm256_loadu_si256((const __m256i *)(src + size - 32));
+
+        _mm256_storeu_si256((__m256i *)dst, x0);
+        _mm256_storeu_si256((__m256i *)(dst + 32), x1);
+        _mm256_storeu_si256((__m256i *)(dst + size - 64), x2);
+        _mm256_storeu_si256((__m256i *)(dst + size - 32), x3);
+        return;
+    }
+
+    const __m256i head     = _mm256_loadu_si256((const __m256i *)src);
+    const __m256i tail     = _mm256_loadu_si256((const __m256i *)(src + size - 32));
+    vi_u8_t *const dst_end = dst + size;
+    vi_u8_t *it            = vi_ptr_align_up(dst + 1, nullptr, sizeof(__m256i));
+    const vi_u8_t *src_it  = src + (it - dst);
+
+    for (; dst_end - it > 128; it += 128, src_it += 128)
+    {
+        const __m256i x0 = _mm256_loadu_si256((const __m256i *)src_it);
+        const __m256i x1 = _mm256_loadu_si256((const __m256i *)(src_it + 32));
+        const __m256i x2 = _mm256_loadu_si256((const __m256i *)(src_it + 64));
+        const __m256i x3 = _mm256_loadu_si256((const __m256i *)(src_it + 96));
+
+        _mm256_store_si256((__m256i *)it, x0);
+        _mm256_store_si256((__m256i *)(it + 32), x1);
+        _mm256_store_si256((__m256i *)(it + 64), x2);
+        _mm256_store_si256((__m256i *)(it + 96), x3);
+    }
+
+    for (; dst_end - it > 32; it += 32, src_it += 32)
+    {
+        _mm256_store_si256((__m256i *)it, _mm256_loadu_si256((const __m256i *)src_it));
+    }
+
+    _mm256_storeu_si256((__m256i *)(dst_end - 32), tail);
+    _mm256_storeu_si256((__m256i *)dst, head);
+}
+
+/**
+ * @brief Копирует более 64 байт регистрами AVX2 с конца участка.
+ *
+ * Аналогична `vi_memory_copy_sse2_backward`, но использует 32-байтные регистры.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static void
+vi_memory_copy_avx2_backward(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    if (size <= 128)
+    {
+        vi_memory_copy_avx2_forward(dst, src, size);
+        return;
+    }
+
+    const __m256i head     = _mm256_loadu_si256((const __m256i *)src);
+    const __m256i tail     = _mm256_loadu_si256((const __m256i *)(src + size - 32));
+    vi_u8_t *const dst_end = dst + size;
+    vi_u8_t *it            = vi_ptr_align_down(dst_end - 1, nullptr, sizeof(__m256i));
+    const vi_u8_t *src_it  = src + (it - dst);
+
+    for (; it - dst > 128; it -= 128, src_it -= 128)
+    {
+        const __m256i x3 = _mm256_loadu_si256((const __m256i *)(src_it - 32));
+        const __m256i x2 = _mm256_loadu_si256((const __m256i *)(src_it - 64));
+        const __m256i x1 = _mm256_loadu_si256((const __m256i *)(src_it - 96));
+        const __m256i x0 = _mm256_loadu_si256((const __m256i *)(src_it - 128));
+
+        _mm256_store_si256((__m256i *)(it - 32), x3);
+        _mm256_store_si256((__m256i *)(it - 64), x2);
+        _mm256_store_si256((__m256i *)(it - 96), x1);
+        _mm256_store_si256((__m256i *)(it - 128), x0);
+    }
+
+    for (; it - dst > 32; it -= 32, src_it -= 32)
+    {
+        _mm256_store_si256((__m256i *)(it - 32),
+                           _mm256_loadu_si256((const __m256i *)(src_it - 32)));
+    }
+
+    _mm256_storeu_si256((__m256i *)dst, head);
+    _mm256_storeu_si256((__m256i *)(dst_end - 32), tail);
+}
+#endif // VI_COMPILER_SIMD_AVX2
+
+/**
+ * @brief Реализации для участков больше 64 байт, выбираемые при загрузке библиотеки.
+ */
+#if VI_COMPILER_SIMD_SSE2
+static vi_memory_copy_fn_t vi_memory_copy_forward_vector  = vi_memory_copy_sse2_forward;
+static vi_memory_copy_fn_t vi_memory_copy_backward_vector = vi_memory_copy_sse2_backward;
+#else
+static vi_memory_copy_fn_t vi_memory_copy_forward_vector  = vi_memory_copy_word_forward;
+static vi_memory_copy_fn_t vi_memory_copy_backward_vector = vi_memory_copy_word_backward;
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_AVX2
+vi_compiler_constructor(vi_memory_copy_init)
+{
+    if (vi_cpu_has(VI_CPU_FEATURE_AVX2))
+    {
+        vi_memory_copy_forward_vector  = vi_memory_copy_avx2_forward;
+        vi_memory_copy_backward_vector = vi_memory_copy_avx2_backward;
+    }
+}
+#endif // VI_COMPILER_SIMD_AVX2
+
+static void
+vi_memory_copy_forward(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+#if VI_COMPILER_SIMD_SSE2
+    if (size < VI_MEMORY_COPY_VECTOR_THRESHOLD)
+    {
+        vi_memory_copy_bytes_forward(dst, src, size);
+    }
+    else if (size <= 64)
+    {
+        vi_memory_copy_sse2_small(dst, src, size);
+    }
+    else
+    {
+        vi_memory_copy_forward_vector(dst, src, size);
+    }
+#else
+    vi_memory_copy_forward_vector(dst, src, size);
+#endif // VI_COMPILER_SIMD_SSE2
+}
+
+static void
+vi_memory_copy_backward(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+#if VI_COMPILER_SIMD_SSE2
+    if (size < VI_MEMORY_COPY_VECTOR_THRESHOLD)
+    {
+        vi_memory_copy_bytes_backward(dst, src, size);
+    }
+    else if (size <= 64)
+    {
+        vi_memory_copy_sse2_small(dst, src, size);
+    }
+    else
+    {
+        vi_memory_copy_backward_vector(dst, src, size);
+    }
+#else
+    vi_memory_copy_backward_vector(dst, src, size);
+#endif // VI_COMPILER_SIMD_SSE2
+}
+
+vi_ptr_t
+vi_memory_copy_unsafe(vi_ptr_t dst, const vi_ptr_t src, vi_usize_t size)
+{
+    vi_memory_copy_forward(dst, src, size);
+    return dst;
+}
+
+vi_ptr_t
+vi_memory_move_unsafe(vi_ptr_t dst, const vi_ptr_t src, vi_usize_t size)
+{
+    const vi_u8_t *const src_end = (const vi_u8_t *)src + size;
+
+    if (dst == src)
+    {
+        return dst;
+    }
+
+    if (vi_ptr_range_is_overlapped((vi_u8_t *)dst, (const vi_u8_t *)src, src_end))
+    {
+        vi_memory_copy_backward(dst, src, size);
+    }
+    else
+    {
+        vi_memory_copy_forward(dst, src, size);
+    }
+    return dst;
+}
+
+vi_ptr_t
+vi_memory_copy(vi_ptr_t dst_begin,
+               vi_ptr_t dst_end,
+               const vi_ptr_t src_begin,
+               const vi_ptr_t src_end)
+{
+    if (!vi_ptr_is_valid_ranges(dst_begin, dst_end, src_begin, src_end))
+    {
+        return nullptr;
+    }
+
+    const vi_usize_t dst_size = vi_ptr_range_size(dst_begin, dst_end);
+    const vi_usize_t src_size = vi_ptr_range_size(src_begin, src_end);
+    const vi_usize_t size     = dst_size < src_size ? dst_size : src_size;
+
+    vi_u8_t *const dst       = vi_ptr_range_first(dst_begin);
+    const vi_u8_t *const src = vi_ptr_range_first(src_begin);
+
+    if (vi_ptr_range_is_overlapped(dst, src, src + size) ||
+        vi_ptr_range_is_overlapped(src, dst, dst + size))
+    {
+        return nullptr;
+    }
+
+    vi_memory_copy_forward(dst, src, size);
+    return dst_begin;
+}
+
+vi_ptr_t
+vi_memory_move(vi_ptr_t dst_begin,
+               vi_ptr_t dst_end,
+               const vi_ptr_t src_begin,
+               const vi_ptr_t src_end)
+{
+    if (!vi_ptr_is_valid_ranges(dst_begin, dst_end, src_begin, src_end))
+    {
+        return nullptr;
+    }
+
+    const vi_usize_t dst_size = vi_ptr_range_size(dst_begin, dst_end);
+    const vi_usize_t src_size = vi_ptr_range_size(src_begin, src_end);
+
+    vi_memory_move_unsafe(vi_ptr_range_first(dst_begin),
+                          vi_ptr_range_first(src_begin),
+                          dst_size < src_size ? dst_size : src_size);
+    return dst_begin;
+}
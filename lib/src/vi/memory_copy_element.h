@@ -0,0 +1,48 @@
+/**
+ * @file memory_copy_element.h
+ * @brief Внутренняя функция копирования одного элемента очереди.
+ *
+ * Этот файл не входит в публичный интерфейс и подключается только исходными файлами
+ * очередей `vi_spsc_ring_t` и `vi_mpmc_queue_t`, которые копируют элементы
+ * на каждую операцию добавления и извлечения.
+ */
+
+#ifndef VI_MEMORY_COPY_ELEMENT_H
+#define VI_MEMORY_COPY_ELEMENT_H
+
+#include <vi/numeric.h>
+#include <vi/memory_copy.h>
+
+/**
+ * @brief Копирует элемент; элементы по 8 байт копируются без вызова функции.
+ *
+ * Функция вызывается на каждое сообщение, поэтому вызов `vi_memory_copy_unsafe`
+ * для коротких элементов заметно снижает пропускную способность.
+ * Побайтовые выражения компиляторы заменяют одной невыровненной загрузкой
+ * и одним сохранением.
+ */
+static inline void
+vi_memory_copy_element(vi_u8_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    if (size != sizeof(vi_u64_t))
+    {
+        vi_memory_copy_unsafe(dst, src, size);
+        return;
+    }
+
+    const vi_u64_t value = (vi_u64_t)src[0] | (vi_u64_t)src[1] << 8 | (vi_u64_t)src[2] << 16 |
+                           (vi_u64_t)src[3] << 24 | (vi_u64_t)src[4] << 32 |
+                           (vi_u64_t)src[5] << 40 | (vi_u64_t)src[6] << 48 |
+                           (vi_u64_t)src[7] << 56;
+
+    dst[0] = (vi_u8_t)value;
+    dst[1] = (vi_u8_t)(value >> 8);
+    dst[2] = (vi_u8_t)(value >> 16);
+    dst[3] = (vi_u8_t)(value >> 24);
+    dst[4] = (vi_u8_t)(value >> 32);
+    dst[5] = (vi_u8_t)(value >> 40);
+    dst[6] = (vi_u8_t)(value >> 48);
+    dst[7] = (vi_u8_t)(value >> 56);
+}
+
+#endif // VI_MEMORY_COPY_ELEMENT_H
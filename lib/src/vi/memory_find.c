@@ -0,0 +1,468 @@
+#include <vi/memory_find.h>
+/* Дополнительные модули */
+#include <vi/cpu.h>
+#include <vi/nullptr.h>
+#include <vi/bit_traits.h>
+#include <vi/ptr_traits.h>
+#include <vi/memory_word.h>
+
+#if VI_COMPILER_SIMD_SSE2
+#    include <emmintrin.h>
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_AVX2
+#    include <immintrin.h>
+#endif // VI_COMPILER_SIMD_AVX2
+
+/**
+ * @def VI_MEMORY_FIND_VECTOR_THRESHOLD
+ * @brief Размер участка в байтах, начиная с которого используется векторная реализация.
+ */
+#define VI_MEMORY_FIND_VECTOR_THRESHOLD 16
+
+/**
+ * @brief Тип указателя на реализацию поиска байта.
+ */
+typedef const vi_u8_t *(*vi_memory_find_fn_t)(const vi_u8_t *ptr, vi_usize_t size, vi_u8_t value);
+
+/**
+ * @brief Ищет первое вхождение байта с помощью SWAR.
+ *
+ * Невыровненное начало проверяется побайтово, выровненная середина — словами
+ * `vi_memory_word_t` с помощью `vi_numeric_has_zero_byte64`. Слово, в котором
+ * найдено совпадение, и остаток участка проверяются побайтово, поэтому
+ * результат не зависит от порядка байтов платформы.
+ */
+static const vi_u8_t *
+vi_memory_find_byte_word(const vi_u8_t *ptr, vi_usize_t size, vi_u8_t value)
+{
+    const vi_u8_t *it        = ptr;
+    const vi_u8_t *const end = it + size;
+    vi_usize_t head          = vi_addr_diff(vi_ptr_align_up(it, nullptr, VI_MEMORY_WORD_SIZE), it);
+
+    for (head = head < size ? head : size; head; --head, ++it)
+    {
+        if (*it == value)
+        {
+            return it;
+        }
+    }
+
+    const vi_u64_t pattern = vi_numeric_repeat64(value);
+
+    for (; end - it >= VI_MEMORY_WORD_SIZE; it += VI_MEMORY_WORD_SIZE)
+    {
+        const vi_u64_t word = *(const vi_memory_word_t *)it ^ pattern;
+
+        if (vi_numeric_has_zero_byte64(word))
+        {
+            break;
+        }
+    }
+
+    for (; it != end; ++it)
+    {
+        if (*it == value)
+        {
+            return it;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Ищет последнее вхождение байта с помощью SWAR.
+ *
+ * Зеркальная версия `vi_memory_find_byte_word`, проходящая участок с конца.
+ */
+static const vi_u8_t *
+vi_memory_find_last_byte_word(const vi_u8_t *ptr, vi_usize_t size, vi_u8_t value)
+{
+    const vi_u8_t *it = ptr + size;
+    vi_usize_t tail   = vi_ptr_to_addr(it) % VI_MEMORY_WORD_SIZE;
+
+    for (tail = tail < size ? tail : size; tail; --tail)
+    {
+        if (*--it == value)
+        {
+            return it;
+        }
+    }
+
+    const vi_u64_t pattern = vi_numeric_repeat64(value);
+
+    for (; it - ptr >= VI_MEMORY_WORD_SIZE; it -= VI_MEMORY_WORD_SIZE)
+    {
+        const vi_u64_t word = *(const vi_memory_word_t *)(it - VI_MEMORY_WORD_SIZE) ^ pattern;
+
+        if (vi_numeric_has_zero_byte64(word))
+        {
+            break;
+        }
+    }
+
+    while (it != ptr)
+    {
+        if (*--it == value)
+        {
+            return it;
+        }
+    }
+    return nullptr;
+}
+
+#if VI_COMPILER_SIMD_SSE2
+/**
+ * @brief Возвращает битовую маску байтов 16-байтного блока, равных `pattern`.
+ */
+#    define vi_memory_find_mask_sse2(block, pattern)                                               \
+        ((vi_u64_t)(vi_u32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(block, pattern)))
+
+/**
+ * @brief Ищет первое вхождение байта регистрами SSE2.
+ *
+ * Начало участка проверяется невыровненным чтением, середина — выровненными чтениями
+ * по 64 байта за итерацию, а конец — невыровненным чтением последних 16 байт.
+ * Чтения не выходят за пределы участка. Требует `size >= 16`.
+ */
+static const vi_u8_t *
+vi_memory_find_byte_sse2(const vi_u8_t *ptr, vi_usize_t size, vi_u8_t value)
+{
+    const __m128i pattern    = _mm_set1_epi8((char)value);
+    const vi_u8_t *const end = ptr + size;
+    vi_u64_t mask = vi_memory_find_mask_sse2(_mm_loadu_si128((const __m128i *)ptr), pattern);
+
+    if (mask)
+    {
+        return ptr + vi_bit_ctz64(mask);
+    }
+
+    const vi_u8_t *it = vi_ptr_align_up(ptr + 1, nullptr, sizeof(__m128i));
+
+    for (; end - it >= 64; it += 64)
+    {
+        const __m128i *const block = (const __m128i *)it;
+
+        const __m128i x0  = _mm_cmpeq_epi8(_mm_load_si128(block), pattern);
+        const __m128i x1  = _mm_cmpeq_epi8(_mm_load_si128(block + 1), pattern);
+        const __m128i x2  = _mm_cmpeq_epi8(_mm_load_si128(block + 2), pattern);
+        const __m128i x3  = _mm_cmpeq_epi8(_mm_load_si128(block + 3), pattern);
+        const __m128i any = _mm_or_si128(_mm_or_si128(x0, x1), _mm_or_si128(x2, x3));
+
+        if (_mm_movemask_epi8(any))
+        {
+            mask = (vi_u64_t)(vi_u32_t)_mm_movemask_epi8(x0) |
+                   ((vi_u64_t)(vi_u32_t)_mm_movemask_epi8(x1) << 16) |
+                   ((vi_u64_t)(vi_u32_t)_mm_movemask_epi8(x2) << 32) |
+                   ((vi_u64_t)(vi_u32_t)_mm_movemask_epi8(x3) << 48);
+            return it + vi_bit_ctz64(mask);
+        }
+    }
+
+    for (; end - it >= 16; it += 16)
+    {
+        mask = vi_memory_find_mask_sse2(_mm_load_si128((const __m128i *)it), pattern);
+
+        if (mask)
+        {
+            return it + vi_bit_ctz64(mask);
+        }
+    }
+
+    if (it != end)
+    {
+        mask = vi_memory_find_mask_sse2(_mm_loadu_si128((const __m128i *)(end - 16)), pattern);
+
+        if (mask)
+        {
+            return end - 16 + vi_bit_ctz64(mask);
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Ищет последнее вхождение байта регистрами SSE2.
+ *
+ * Зеркальная версия `vi_memory_find_byte_sse2`. Требует `size >= 16`.
+ */
+static const vi_u8_t *
+vi_memory_find_last_byte_sse2(const vi_u8_t *ptr, vi_usize_t size, vi_u8_t value)
+{
+    const __m128i pattern    = _mm_set1_epi8((char)value);
+    const vi_u8_t *const end = ptr + size;
+    vi_u64_t mask = vi_memory_find_mask_sse2(_mm_loadu_si128((const __m128i *)(end - 16)), pattern);
+
+    if (mask)
+    {
+        return end - 16 + vi_bit_log2_64(mask);
+    }
+
+    const vi_u8_t *it = vi_ptr_align_down(end - 1, nullptr, sizeof(__m128i));
+
+    for (; it - ptr >= 64; it -= 64)
+    {
+        const __m128i *const block = (const __m128i *)(it - 64);
+
+        const __m128i x0  = _mm_cmpeq_epi8(_mm_load_si128(block), pattern);
+        const __m128i x1  = _mm_cmpeq_epi8(_mm_load_si128(block + 1), pattern);
+        const __m128i x2  = _mm_cmpeq_epi8(_mm_load_si128(block + 2), pattern);
+        const __m128i x3  = _mm_cmpeq_epi8(_mm_load_si128(block + 3), pattern);
+        const __m128i any = _mm_or_si128(_mm_or_si128(x0, x1), _mm_or_si128(x2, x3));
+
+        if (_mm_movemask_epi8(any))
+        {
+            mask = (vi_u64_t)(vi_u32_t)_mm_movemask_epi8(x0) |
+                   ((vi_u64_t)(vi_u32_t)_mm_movemask_epi8(x1) << 16) |
+                   ((vi_u64_t)(vi_u32_t)_mm_movemask_epi8(x2) << 32) |
+                   ((vi_u64_t)(vi_u32_t)_mm_movemask_epi8(x3) << 48);
+            return it - 64 + vi_bit_log2_64(mask);
+        }
+    }
+
+    for (; it - ptr >= 16; it -= 16)
+    {
+        mask = vi_memory_find_mask_sse2(_mm_load_si128((const __m128i *)(it - 16)), pattern);
+
+        if (mask)
+        {
+            return it - 16 + vi_bit_log2_64(mask);
+        }
+    }
+
+    if (it != ptr)
+    {
+        mask = vi_memory_find_mask_sse2(_mm_loadu_si128((const __m128i *)ptr), pattern);
+
+        if (mask)
+        {
+            return ptr + vi_bit_log2_64(mask);
+        }
+    }
+    return nullptr;
+}
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_AVX2
+/**
+ * @brief Возвращает битовую маску байтов 32-байтного блока, равных `pattern`.
+ */
+#    define vi_memory_find_mask_avx2(block, pattern)                                               \
+        ((vi_u64_t)(vi_u32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, pattern)))
+
+/**
+ * @brief Ищет первое вхождение байта регистрами AVX2.
+ *
+ * Аналогична `vi_memory_find_byte_sse2`, но обрабатывает по 128 байт за итерацию.
+ * Участки короче 32 байт передаются в `vi_memory_find_byte_sse2`.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static const vi_u8_t *
+vi_memory_find_byte_avx2(const vi_u8_t *ptr, vi_usize_t size, vi_u8_t value)
+{
+    if (size < 32)
+    {
+        return vi_memory_find_byte_sse2(ptr, size, value);
+    }
+
+    const __m256i pattern    = _mm256_set1_epi8((char)value);
+    const vi_u8_t *const end = ptr + size;
+    vi_u64_t mask = vi_memory_find_mask_avx2(_mm256_loadu_si256((const __m256i *)ptr), pattern);
+
+    if (mask)
+    {
+        return ptr + vi_bit_ctz64(mask);
+    }
+
+    const vi_u8_t *it = vi_ptr_align_up(ptr + 1, nullptr, sizeof(__m256i));
+
+    for (; end - it >= 128; it += 128)
+    {
+        const __m256i *const block = (const __m256i *)it;
+
+        const __m256i x0  = _mm256_cmpeq_epi8(_mm256_load_si256(block), pattern);
+        const __m256i x1  = _mm256_cmpeq_epi8(_mm256_load_si256(block + 1), pattern);
+        const __m256i x2  = _mm256_cmpeq_epi8(_mm256_load_si256(block + 2), pattern);
+        const __m256i x3  = _mm256_cmpeq_epi8(_mm256_load_si256(block + 3), pattern);
+        const __m256i any = _mm256_or_si256(_mm256_or_si256(x0, x1), _mm256_or_si256(x2, x3));
+
+        if (_mm256_movemask_epi8(any))
+        {
+            mask = (vi_u64_t)(vi_u32_t)_mm256_movemask_epi8(x0) |
+                   ((vi_u64_t)(vi_u32_t)_mm256_movemask_epi8(x1) << 32);
+
+            if (mask)
+            {
+                return it + vi_bit_ctz64(mask);
+            }
+
+            mask = (vi_u64_t)(vi_u32_t)_mm256_movemask_epi8(x2) |
+                   ((vi_u64_t)(vi_u32_t)_mm256_movemask_epi8(x3) << 32);
+            return it + 64 + vi_bit_ctz64(mask);
+        }
+    }
+
+    for (; end - it >= 32; it += 32)
+    {
+        mask = vi_memory_find_mask_avx2(_mm256_load_si256((const __m256i *)it), pattern);
+
+        if (mask)
+        {
+            return it + vi_bit_ctz64(mask);
+        }
+    }
+
+    if (it != end)
+    {
+        mask = vi_memory_find_mask_avx2(_mm256_loadu_si256((const __m256i *)(end - 32)), pattern);
+
+        if (mask)
+        {
+            return end - 32 + vi_bit_ctz64(mask);
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Ищет последнее вхождение байта регистрами AVX2.
+ *
+ * Зеркальная версия `vi_memory_find_byte_avx2`.
+ * Участки короче 32 байт передаются в `vi_memory_find_last_byte_sse2`.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static const vi_u8_t *
+vi_memory_find_last_byte_avx2(const vi_u8_t *ptr, vi_usize_t size, vi_u8_t value)
+{
+    if (size < 32)
+    {
+        return vi_memory_find_last_byte_sse2(ptr, size, value);
+    }
+
+    const __m256i pattern    = _mm256_set1_epi8((char)value);
+    const vi_u8_t *const end = ptr + size;
+    vi_u64_t mask =
+        vi_memory_find_mask_avx2(_mm256_loadu_si256((const __m256i *)(end - 32)), pattern);
+
+    if (mask)
+    {
+        return end - 32 + vi_bit_log2_64(mask);
+    }
+
+    const vi_u8_t *it = vi_ptr_align_down(end - 1, nullptr, sizeof(__m256i));
+
+    for (; it - ptr >= 128; it -= 128)
+    {
+        const __m256i *const block = (const __m256i *)(it - 128);
+
+        const __m256i x0  = _mm256_cmpeq_epi8(_mm256_load_si256(block), pattern);
+        const __m256i x1  = _mm256_cmpeq_epi8(_mm256_load_si256(block + 1), pattern);
+        const __m256i x2  = _mm256_cmpeq_epi8(_mm256_load_si256(block + 2), pattern);
+        const __m256i x3  = _mm256_cmpeq_epi8(_mm256_load_si256(block + 3), pattern);
+        const __m256i any = _mm256_or_si256(_mm256_or_si256(x0, x1), _mm256_or_si256(x2, x3));
+
+        if (_mm256_movemask_epi8(any))
+        {
+            mask = (vi_u64_t)(vi_u32_t)_mm256_movemask_epi8(x2) |
+                   ((vi_u64_t)(vi_u32_t)_mm256_movemask_epi8(x3) << 32);
+
+            if (mask)
+            {
+                return it - 64 + vi_bit_log2_64(mask);
+            }
+
+            mask = (vi_u64_t)(vi_u32_t)_mm256_movemask_epi8(x0) |
+                   ((vi_u64_t)(vi_u32_t)_mm256_movemask_epi8(x1) << 32);
+            return it - 128 + vi_bit_log2_64(mask);
+        }
+    }
+
+    for (; it - ptr >= 32; it -= 32)
+    {
+        mask = vi_memory_find_mask_avx2(_mm256_load_si256((const __m256i *)(it - 32)), pattern);
+
+        if (mask)
+        {
+            return it - 32 + vi_bit_log2_64(mask);
+        }
+    }
+
+    if (it != ptr)
+    {
+        mask = vi_memory_find_mask_avx2(_mm256_loadu_si256((const __m256i *)ptr), pattern);
+
+        if (mask)
+        {
+            return ptr + vi_bit_log2_64(mask);
+        }
+    }
+    return nullptr;
+}
+#endif // VI_COMPILER_SIMD_AVX2
+
+/**
+ * @brief Реализации для участков от `VI_MEMORY_FIND_VECTOR_THRESHOLD` байт,
+ *        выбираемые при загрузке библиотеки.
+ */
+#if VI_COMPILER_SIMD_SSE2
+static vi_memory_find_fn_t vi_memory_find_byte_vector      = vi_memory_find_byte_sse2;
+static vi_memory_find_fn_t vi_memory_find_last_byte_vector = vi_memory_find_last_byte_sse2;
+#else
+static vi_memory_find_fn_t vi_memory_find_byte_vector      = vi_memory_find_byte_word;
+static vi_memory_find_fn_t vi_memory_find_last_byte_vector = vi_memory_find_last_byte_word;
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_AVX2
+vi_compiler_constructor(vi_memory_find_init)
+{
+    if (vi_cpu_has(VI_CPU_FEATURE_AVX2))
+    {
+        vi_memory_find_byte_vector      = vi_memory_find_byte_avx2;
+        vi_memory_find_last_byte_vector = vi_memory_find_last_byte_avx2;
+    }
+}
+#endif // VI_COMPILER_SIMD_AVX2
+
+vi_ptr_t
+vi_memory_find_byte_unsafe(const vi_ptr_t ptr, vi_usize_t size, vi_u8_t value)
+{
+    if (size < VI_MEMORY_FIND_VECTOR_THRESHOLD)
+    {
+        return (vi_ptr_t)vi_memory_find_byte_word(ptr, size, value);
+    }
+    return (vi_ptr_t)vi_memory_find_byte_vector(ptr, size, value);
+}
+
+vi_ptr_t
+vi_memory_find_byte(const vi_ptr_t begin, const vi_ptr_t end, vi_u8_t value)
+{
+    if (!vi_ptr_is_valid_range(begin, end))
+    {
+        return nullptr;
+    }
+    return vi_memory_find_byte_unsafe(vi_ptr_range_first(begin),
+                                      vi_ptr_range_size(begin, end),
+                                      value);
+}
+
+vi_ptr_t
+vi_memory_find_last_byte_unsafe(const vi_ptr_t ptr, vi_usize_t size, vi_u8_t value)
+{
+    if (size < VI_MEMORY_FIND_VECTOR_THRESHOLD)
+    {
+        return (vi_ptr_t)vi_memory_find_last_byte_word(ptr, size, value);
+    }
+    return (vi_ptr_t)vi_memory_find_last_byte_vector(ptr, size, value);
+}
+
+vi_ptr_t
+vi_memory_find_last_byte(const vi_ptr_t begin, const vi_ptr_t end, vi_u8_t value)
+{
+    if (!vi_ptr_is_valid_range(begin, end))
+    {
+        return nullptr;
+    }
+    return vi_memory_find_last_byte_unsafe(vi_ptr_range_first(begin),
+                                           vi_ptr_range_size(begin, end),
+                                           value);
+}
@@ -0,0 +1,37 @@
+/**
+ * @file memory_load.h
+ * @brief Внутренние функции чтения чисел с порядком байтов little-endian.
+ *
+ * Этот файл не входит в публичный интерфейс. Функции читают число из памяти
+ * с любым выравниванием без нарушения правила строгих псевдонимов: компиляторы
+ * распознают побайтовые выражения и заменяют их одной невыровненной загрузкой
+ * на платформах с порядком байтов little-endian.
+ */
+
+#ifndef VI_MEMORY_LOAD_H
+#define VI_MEMORY_LOAD_H
+
+#include <vi/numeric.h>
+
+/**
+ * @brief Читает 8 байт как число, младший байт которого находится по меньшему адресу.
+ */
+static inline vi_u64_t
+vi_memory_load_le64(const vi_u8_t *ptr)
+{
+    return (vi_u64_t)ptr[0] | (vi_u64_t)ptr[1] << 8 | (vi_u64_t)ptr[2] << 16 |
+           (vi_u64_t)ptr[3] << 24 | (vi_u64_t)ptr[4] << 32 | (vi_u64_t)ptr[5] << 40 |
+           (vi_u64_t)ptr[6] << 48 | (vi_u64_t)ptr[7] << 56;
+}
+
+/**
+ * @brief Читает 4 байта как число, младший байт которого находится по меньшему адресу.
+ */
+static inline vi_u32_t
+vi_memory_load_le32(const vi_u8_t *ptr)
+{
+    return (vi_u32_t)ptr[0] | (vi_u32_t)ptr[1] << 8 | (vi_u32_t)ptr[2] << 16 |
+           (vi_u32_t)ptr[3] << 24;
+}
+
+#endif // VI_MEMORY_LOAD_H
@@ -0,0 +1,266 @@
+#include <vi/memory_set.h>
+/* Дополнительные модули */
+#include <vi/cpu.h>
+#include <vi/nullptr.h>
+#include <vi/ptr_traits.h>
+#include <vi/memory_word.h>
+
+#if VI_COMPILER_SIMD_SSE2
+#    include <emmintrin.h>
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_AVX2
+#    include <immintrin.h>
+#endif // VI_COMPILER_SIMD_AVX2
+
+/**
+ * @def VI_MEMORY_SET_VECTOR_THRESHOLD
+ * @brief Размер участка в байтах, начиная с которого используется векторная реализация.
+ */
+#define VI_MEMORY_SET_VECTOR_THRESHOLD 64
+
+/**
+ * @def VI_MEMORY_SET_STREAM_THRESHOLD
+ * @brief Размер участка в байтах, начиная с которого используются потоковые записи.
+ *
+ * Потоковые (non-temporal) записи идут в память в обход кэша. Участок такого размера
+ * все равно не помещается в кэш, поэтому обычные записи только вытесняли бы
+ * из него полезные данные и тратили пропускную способность на чтение строк кэша.
+ */
+#define VI_MEMORY_SET_STREAM_THRESHOLD (4 * 1024 * 1024)
+
+/**
+ * @brief Тип указателя на реализацию заполнения памяти.
+ */
+typedef vi_ptr_t (*vi_memory_set_fn_t)(vi_ptr_t dst, vi_usize_t size, vi_u8_t value);
+
+/**
+ * @brief Заполняет память машинными словами.
+ *
+ * Невыровненное начало заполняется шагами по 1, 2 и 4 байта до границы слова,
+ * середина — словами `vi_memory_word_t`, а остаток — шагами по 4, 2 и 1 байту.
+ * Все записи, кроме записей в очень коротких участках, выровнены.
+ */
+static vi_ptr_t
+vi_memory_set_word(vi_ptr_t dst, vi_usize_t size, vi_u8_t value)
+{
+    vi_u8_t *it        = dst;
+    vi_u8_t *const end = it + size;
+    vi_u8_t *aligned   = vi_ptr_align_up(it, nullptr, VI_MEMORY_WORD_SIZE);
+
+    if (aligned > end)
+    {
+        while (it != end)
+        {
+            *it++ = value;
+        }
+        return dst;
+    }
+
+    if (vi_ptr_to_addr(it) & 1)
+    {
+        *it = value;
+        it += 1;
+    }
+
+    if (vi_ptr_to_addr(it) & 2)
+    {
+        *(vi_memory_word16_t *)it = vi_numeric_repeat16(value);
+        it += 2;
+    }
+
+    if (vi_ptr_to_addr(it) & 4)
+    {
+        *(vi_memory_word32_t *)it = vi_numeric_repeat32(value);
+        it += 4;
+    }
+
+    const vi_memory_word_t word = vi_numeric_repeat64(value);
+    vi_memory_word_t *word_it   = (vi_memory_word_t *)it;
+    vi_usize_t count            = (vi_usize_t)(end - it) / VI_MEMORY_WORD_SIZE;
+
+    for (; count >= 4; count -= 4, word_it += 4)
+    {
+        word_it[0] = word;
+        word_it[1] = word;
+        word_it[2] = word;
+        word_it[3] = word;
+    }
+
+    while (count--)
+    {
+        *word_it++ = word;
+    }
+
+    it                    = (vi_u8_t *)word_it;
+    const vi_usize_t tail = (vi_usize_t)(end - it);
+
+    if (tail & 4)
+    {
+        *(vi_memory_word32_t *)it = vi_numeric_repeat32(value);
+        it += 4;
+    }
+
+    if (tail & 2)
+    {
+        *(vi_memory_word16_t *)it = vi_numeric_repeat16(value);
+        it += 2;
+    }
+
+    if (tail & 1)
+    {
+        *it = value;
+    }
+
+    return dst;
+}
+
+#if VI_COMPILER_SIMD_SSE2
+/**
+ * @brief Заполняет память 16-байтными регистрами SSE2.
+ *
+ * Начало и конец участка покрываются невыровненными записями, которые
+ * перекрываются с выровненной серединой. Середина участков от
+ * `VI_MEMORY_SET_STREAM_THRESHOLD` байт заполняется потоковыми записями.
+ * Требует `size >= 16`.
+ */
+static vi_ptr_t
+vi_memory_set_sse2(vi_ptr_t dst, vi_usize_t size, vi_u8_t value)
+{
+    vi_u8_t *it        = dst;
+    vi_u8_t *const end = it + size;
+    const __m128i fill = _mm_set1_epi8((char)value);
+
+    _mm_storeu_si128((__m128i *)it, fill);
+    it = vi_ptr_align_up(it + 1, nullptr, sizeof(__m128i));
+
+    if (size >= VI_MEMORY_SET_STREAM_THRESHOLD)
+    {
+        for (; end - it >= 64; it += 64)
+        {
+            _mm_stream_si128((__m128i *)it, fill);
+            _mm_stream_si128((__m128i *)(it + 16), fill);
+            _mm_stream_si128((__m128i *)(it + 32), fill);
+            _mm_stream_si128((__m128i *)(it + 48), fill);
+        }
+        _mm_sfence();
+    }
+
+    for (; end - it >= 64; it += 64)
+    {
+        _mm_store_si128((__m128i *)it, fill);
+        _mm_store_si128((__m128i *)(it + 16), fill);
+        _mm_store_si128((__m128i *)(it + 32), fill);
+        _mm_store_si128((__m128i *)(it + 48), fill);
+    }
+
+    for (; end - it >= 16; it += 16)
+    {
+        _mm_store_si128((__m128i *)it, fill);
+    }
+
+    _mm_storeu_si128((__m128i *)(end - 16), fill);
+    return dst;
+}
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_AVX2
+/**
+ * @brief Заполняет память 32-байтными регистрами AVX2.
+ *
+ * Аналогична `vi_memory_set_sse2`, но обрабатывает по 128 байт за итерацию.
+ * Требует `size >= 32`.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static vi_ptr_t
+vi_memory_set_avx2(vi_ptr_t dst, vi_usize_t size, vi_u8_t value)
+{
+    vi_u8_t *it        = dst;
+    vi_u8_t *const end = it + size;
+    const __m256i fill = _mm256_set1_epi8((char)value);
+
+    _mm256_storeu_si256((__m256i *)it, fill);
+    it = vi_ptr_align_up(it + 1, nullptr, sizeof(__m256i));
+
+    if (size >= VI_MEMORY_SET_STREAM_THRESHOLD)
+    {
+        for (; end - it >= 128; it += 128)
+        {
+            _mm256_stream_si256((__m256i *)it, fill);
+            _mm256_stream_si256((__m256i *)(it + 32), fill);
+            _mm256_stream_si256((__m256i *)(it + 64), fill);
+            _mm256_stream_si256((__m256i *)(it + 96), fill);
+        }
+        _mm_sfence();
+    }
+
+    for (; end - it >= 128; it += 128)
+    {
+        _mm256_store_si256((__m256i *)it, fill);
+        _mm256_store_si256((__m256i *)(it + 32), fill);
+        _mm256_store_si256((__m256i *)(it + 64), fill);
+        _mm256_store_si256((__m256i *)(it + 96), fill);
+    }
+
+    for (; end - it >= 32; it += 32)
+    {
+        _mm256_store_si256((__m256i *)it, fill);
+    }
+
+    _mm256_storeu_si256((__m256i *)(end - 32), fill);
+    return dst;
+}
+#endif // VI_COMPILER_SIMD_AVX2
+
+/**
+ * @brief Реализация для участков от `VI_MEMORY_SET_VECTOR_THRESHOLD` байт,
+ *        выбираемая при загрузке библиотеки.
+ */
+#if VI_COMPILER_SIMD_SSE2
+static vi_memory_set_fn_t vi_memory_set_vector = vi_memory_set_sse2;
+#else
+static vi_memory_set_fn_t vi_memory_set_vector = vi_memory_set_word;
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_AVX2
+vi_compiler_constructor(vi_memory_set_init)
+{
+    if (vi_cpu_has(VI_CPU_FEATURE_AVX2))
+    {
+        vi_memory_set_vector = vi_memory_set_avx2;
+    }
+}
+#endif // VI_COMPILER_SIMD_AVX2
+
+vi_ptr_t
+vi_memory_set_unsafe(vi_ptr_t dst, vi_usize_t size, vi_u8_t value)
+{
+    if (size < VI_MEMORY_SET_VECTOR_THRESHOLD)
+    {
+        return vi_memory_set_word(dst, size, value);
+    }
+    return vi_memory_set_vector(dst, size, value);
+}
+
+vi_ptr_t
+vi_memory_set(vi_ptr_t begin, vi_ptr_t end, vi_u8_t value)
+{
+    if (!vi_ptr_is_valid_range(begin, end))
+    {
+        return nullptr;
+    }
+    vi_memory_set_unsafe(vi_ptr_range_first(begin), vi_ptr_range_size(begin, end), value);
+    return begin;
+}
+
+vi_ptr_t
+vi_memory_zero_unsafe(vi_ptr_t dst, vi_usize_t size)
+{
+    return vi_memory_set_unsafe(dst, size, 0);
+}
+
+vi_ptr_t
+vi_memory_zero(vi_ptr_t begin, vi_ptr_t end)
+{
+    return vi_memory_set(begin, end, 0);
+}
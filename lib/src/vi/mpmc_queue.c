@@ -0,0 +1,407 @@
+#include <vi/mpmc_queue.h>
+/* Дополнительные модули */
+#include "memory_copy_element.h"
+#include <vi/nullptr.h>
+#include <vi/ptrdiff.h>
+#include <vi/bit_traits.h>
+#include <vi/runtime_allocator.h>
+
+#include <stdatomic.h>
+
+#if !defined(__STDC_NO_THREADS__)
+#    include <threads.h>
+#endif // !defined(__STDC_NO_THREADS__)
+
+#if VI_COMPILER_SIMD_SSE2
+#    include <emmintrin.h>
+#endif // VI_COMPILER_SIMD_SSE2
+
+/**
+ * @def VI_MPMC_QUEUE_CACHE_LINE_SIZE
+ * @brief Размер строки кэша, по которому выравниваются ячейки и позиции очереди.
+ */
+#define VI_MPMC_QUEUE_CACHE_LINE_SIZE 64
+
+/**
+ * @def VI_MPMC_QUEUE_ELEMENT_OFFSET
+ * @brief Смещение элемента от начала ячейки; элементы выравниваются по 16 байт.
+ */
+#define VI_MPMC_QUEUE_ELEMENT_OFFSET 16
+
+/**
+ * @def VI_MPMC_QUEUE_SPIN_LIMIT
+ * @brief Количество попыток с паузой процессора, после которых ожидающий поток
+ *        начинает уступать процессор. Пауза удваивается с каждой попыткой.
+ */
+#define VI_MPMC_QUEUE_SPIN_LIMIT 6
+
+/**
+ * @brief Позиция начала или конца очереди, занимающая отдельную строку кэша.
+ */
+typedef union vi_mpmc_queue_index_t
+{
+    _Atomic(vi_usize_t) value;
+    vi_u8_t padding[VI_MPMC_QUEUE_CACHE_LINE_SIZE];
+} vi_mpmc_queue_index_t;
+
+struct vi_mpmc_queue_t
+{
+    /**
+     * @brief Позиция следующего извлекаемого элемента.
+     */
+    vi_mpmc_queue_index_t head;
+
+    /**
+     * @brief Позиция следующего добавляемого элемента.
+     */
+    vi_mpmc_queue_index_t tail;
+
+    const vi_allocator_t *backing;
+    vi_usize_t element_size;
+    vi_usize_t capacity;
+
+    /**
+     * @brief Размер ячейки: порядковый номер и элемент, округленные до строки кэша.
+     */
+    vi_usize_t slot_size;
+
+    /**
+     * @brief Ячейки очереди; выровнены по строке кэша.
+     *
+     * Порядковый номер ячейки равен позиции, которую ячейка ждет от производителя,
+     * или позиции плюс 1, если элемент записан и ждет потребителя.
+     */
+    vi_u8_t *slots;
+};
+
+/**
+ * @brief Возвращает порядковый номер ячейки, соответствующей позиции `position`.
+ */
+static inline _Atomic(vi_usize_t) *
+vi_mpmc_queue_sequence(vi_mpmc_queue_t *queue, vi_usize_t position)
+{
+    return (_Atomic(vi_usize_t) *)(queue->slots +
+                                   (position & (queue->capacity - 1)) * queue->slot_size);
+}
+
+/**
+ * @brief Возвращает элемент ячейки, соответствующей позиции `position`.
+ */
+static inline vi_u8_t *
+vi_mpmc_queue_element(vi_mpmc_queue_t *queue, vi_usize_t position)
+{
+    return queue->slots + (position & (queue->capacity - 1)) * queue->slot_size +
+           VI_MPMC_QUEUE_ELEMENT_OFFSET;
+}
+
+/**
+ * @brief Ждет перед повторной попыткой: сначала паузой процессора, удваивая ее
+ *        с каждой попыткой, а затем уступая процессор другим потокам.
+ */
+static void
+vi_mpmc_queue_backoff(vi_u32_t *attempt)
+{
+    if (*attempt < VI_MPMC_QUEUE_SPIN_LIMIT)
+    {
+        for (vi_u32_t i = 0; i < (1U << *attempt); ++i)
+        {
+#if VI_COMPILER_SIMD_SSE2
+            _mm_pause();
+#endif // VI_COMPILER_SIMD_SSE2
+        }
+
+        ++*attempt;
+        return;
+    }
+
+#if !defined(__STDC_NO_THREADS__)
+    thrd_yield();
+#endif // !defined(__STDC_NO_THREADS__)
+}
+
+/**
+ * @brief Занимает до `count` соседних позиций, начиная с `*index`.
+ *
+ * Позиция доступна, если порядковый номер ее ячейки равен позиции плюс `ready`:
+ * 0 для производителя (ячейка освобождена) и 1 для потребителя (элемент записан).
+ * Сначала подсчитываются доступные позиции подряд, затем все они занимаются
+ * одной операцией сравнения с обменом.
+ *
+ * @return Количество занятых позиций; первая записывается в `*position`.
+ */
+static vi_usize_t
+vi_mpmc_queue_claim(vi_mpmc_queue_t *queue,
+                    _Atomic(vi_usize_t) *index,
+                    vi_usize_t ready,
+                    vi_usize_t count,
+                    vi_usize_t *position)
+{
+    if (!count)
+    {
+        // Без этой проверки пустой подсчет не отличить от позиции, занятой другим потоком.
+        return 0;
+    }
+
+    vi_usize_t first = atomic_load_explicit(index, memory_order_relaxed);
+
+    for (;;)
+    {
+        vi_usize_t size   = 0;
+        vi_ptrdiff_t diff = 0;
+
+        for (; size < count; ++size)
+        {
+            // Acquire связывает чтение номера с сохранением другой стороны, после которого
+            // ячейку можно перезаписывать или читать.
+            const vi_usize_t sequence =
+                atomic_load_explicit(vi_mpmc_queue_sequence(queue, first + size),
+                                     memory_order_acquire);
+
+            diff = (vi_ptrdiff_t)(sequence - (first + size + ready));
+
+            if (diff)
+            {
+                break;
+            }
+        }
+
+        if (size)
+        {
+            // При неудаче `first` получает текущую позицию, и подсчет повторяется.
+            if (atomic_compare_exchange_weak_explicit(index,
+                                                      &first,
+                                                      first + size,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed))
+            {
+                *position = first;
+                return size;
+            }
+        }
+        else if (diff < 0)
+        {
+            // Ячейка еще принадлежит предыдущему кругу: очередь заполнена или пуста.
+            return 0;
+        }
+        else
+        {
+            // Позицию уже заняли другие потоки.
+            first = atomic_load_explicit(index, memory_order_relaxed);
+        }
+    }
+}
+
+vi_mpmc_queue_t *
+vi_mpmc_queue_create(const vi_allocator_t *backing, vi_usize_t element_size, vi_usize_t capacity)
+{
+    if (!backing)
+    {
+        backing = vi_runtime_allocator_get();
+    }
+
+    if (!element_size || capacity < 2 || !vi_bit_is_single(capacity) ||
+        !vi_allocator_is_valid(backing))
+    {
+        return nullptr;
+    }
+
+    if (element_size > VI_USIZE_T_MAX - VI_MPMC_QUEUE_ELEMENT_OFFSET -
+                           VI_MPMC_QUEUE_CACHE_LINE_SIZE)
+    {
+        return nullptr;
+    }
+
+    const vi_usize_t slot_size =
+        (VI_MPMC_QUEUE_ELEMENT_OFFSET + element_size + VI_MPMC_QUEUE_CACHE_LINE_SIZE - 1) &
+        ~(vi_usize_t)(VI_MPMC_QUEUE_CACHE_LINE_SIZE - 1);
+
+    if (capacity > VI_USIZE_T_MAX / slot_size)
+    {
+        return nullptr;
+    }
+
+    vi_mpmc_queue_t *const queue = vi_allocator_aligned_allocate(backing,
+                                                                 sizeof(vi_mpmc_queue_t),
+                                                                 VI_MPMC_QUEUE_CACHE_LINE_SIZE);
+
+    if (!queue)
+    {
+        return nullptr;
+    }
+
+    queue->slots =
+        vi_allocator_aligned_allocate(backing, capacity * slot_size, VI_MPMC_QUEUE_CACHE_LINE_SIZE);
+
+    if (!queue->slots)
+    {
+        vi_allocator_aligned_free(backing,
+                                  queue,
+                                  sizeof(vi_mpmc_queue_t),
+                                  VI_MPMC_QUEUE_CACHE_LINE_SIZE);
+        return nullptr;
+    }
+
+    atomic_init(&queue->head.value, 0);
+    atomic_init(&queue->tail.value, 0);
+    queue->backing      = backing;
+    queue->element_size = element_size;
+    queue->capacity     = capacity;
+    queue->slot_size    = slot_size;
+
+    for (vi_usize_t i = 0; i < capacity; ++i)
+    {
+        atomic_init(vi_mpmc_queue_sequence(queue, i), i);
+    }
+    return queue;
+}
+
+void
+vi_mpmc_queue_destroy(vi_mpmc_queue_t *queue)
+{
+    if (!queue)
+    {
+        return;
+    }
+
+    const vi_allocator_t *const backing = queue->backing;
+
+    vi_allocator_aligned_free(backing,
+                              queue->slots,
+                              queue->capacity * queue->slot_size,
+                              VI_MPMC_QUEUE_CACHE_LINE_SIZE);
+    vi_allocator_aligned_free(backing,
+                              queue,
+                              sizeof(vi_mpmc_queue_t),
+                              VI_MPMC_QUEUE_CACHE_LINE_SIZE);
+}
+
+vi_usize_t
+vi_mpmc_queue_try_push_n(vi_mpmc_queue_t *queue, const vi_ptr_t elements, vi_usize_t count)
+{
+    const vi_u8_t *src = elements;
+    vi_usize_t first;
+    const vi_usize_t size = vi_mpmc_queue_claim(queue, &queue->tail.value, 0, count, &first);
+
+    for (vi_usize_t i = 0; i < size; ++i, src += queue->element_size)
+    {
+        vi_memory_copy_element(vi_mpmc_queue_element(queue, first + i), src, queue->element_size);
+
+        // Release публикует элемент для потребителя этой позиции.
+        atomic_store_explicit(vi_mpmc_queue_sequence(queue, first + i),
+                              first + i + 1,
+                              memory_order_release);
+    }
+    return size;
+}
+
+vi_usize_t
+vi_mpmc_queue_try_pop_n(vi_mpmc_queue_t *queue, vi_ptr_t elements, vi_usize_t count)
+{
+    vi_u8_t *dst = elements;
+    vi_usize_t first;
+    const vi_usize_t size = vi_mpmc_queue_claim(queue, &queue->head.value, 1, count, &first);
+
+    for (vi_usize_t i = 0; i < size; ++i, dst += queue->element_size)
+    {
+        vi_memory_copy_element(dst, vi_mpmc_queue_element(queue, first + i), queue->element_size);
+
+        // Release отдает ячейку производителю следующего круга.
+        atomic_store_explicit(vi_mpmc_queue_sequence(queue, first + i),
+                              first + i + queue->capacity,
+                              memory_order_release);
+    }
+    return size;
+}
+
+bool
+vi_mpmc_queue_try_push(vi_mpmc_queue_t *queue, const vi_ptr_t element)
+{
+    return vi_mpmc_queue_try_push_n(queue, element, 1) != 0;
+}
+
+bool
+vi_mpmc_queue_try_pop(vi_mpmc_queue_t *queue, vi_ptr_t element)
+{
+    return vi_mpmc_queue_try_pop_n(queue, element, 1) != 0;
+}
+
+void
+vi_mpmc_queue_push(vi_mpmc_queue_t *queue, const vi_ptr_t element)
+{
+    vi_u32_t attempt = 0;
+
+    while (!vi_mpmc_queue_try_push_n(queue, element, 1))
+    {
+        vi_mpmc_queue_backoff(&attempt);
+    }
+}
+
+void
+vi_mpmc_queue_pop(vi_mpmc_queue_t *queue, vi_ptr_t element)
+{
+    vi_u32_t attempt = 0;
+
+    while (!vi_mpmc_queue_try_pop_n(queue, element, 1))
+    {
+        vi_mpmc_queue_backoff(&attempt);
+    }
+}
+
+void
+vi_mpmc_queue_push_n(vi_mpmc_queue_t *queue, const vi_ptr_t elements, vi_usize_t count)
+{
+    const vi_u8_t *src = elements;
+    vi_u32_t attempt   = 0;
+
+    while (count)
+    {
+        const vi_usize_t size = vi_mpmc_queue_try_push_n(queue, src, count);
+
+        if (!size)
+        {
+            vi_mpmc_queue_backoff(&attempt);
+            continue;
+        }
+
+        src += size * queue->element_size;
+        count -= size;
+        attempt = 0;
+    }
+}
+
+vi_usize_t
+vi_mpmc_queue_pop_n(vi_mpmc_queue_t *queue, vi_ptr_t elements, vi_usize_t count)
+{
+    vi_u32_t attempt = 0;
+    vi_usize_t size  = vi_mpmc_queue_try_pop_n(queue, elements, count);
+
+    while (!size && count)
+    {
+        vi_mpmc_queue_backoff(&attempt);
+        size = vi_mpmc_queue_try_pop_n(queue, elements, count);
+    }
+    return size;
+}
+
+vi_usize_t
+vi_mpmc_queue_size(const vi_mpmc_queue_t *queue)
+{
+    if (!queue)
+    {
+        return 0;
+    }
+
+    // Начало читается первым: между чтениями оно может только вырасти,
+    // поэтому разность не становится отрицательной, но может превысить емкость.
+    const vi_usize_t head = atomic_load_explicit(&queue->head.value, memory_order_acquire);
+    const vi_usize_t tail = atomic_load_explicit(&queue->tail.value, memory_order_acquire);
+    const vi_usize_t size = tail - head;
+
+    return size < queue->capacity ? size : queue->capacity;
+}
+
+vi_usize_t
+vi_mpmc_queue_capacity(const vi_mpmc_queue_t *queue)
+{
+    return queue ? queue->capacity : 0;
+}
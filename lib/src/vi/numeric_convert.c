@@ -0,0 +1,422 @@
+#include <vi/numeric_convert.h>
+/* Дополнительные модули */
+#include "memory_load.h"
+#include <vi/bool.h>
+#include <vi/nullptr.h>
+#include <vi/bit_traits.h>
+#include <vi/numeric_fixed_limits.h>
+
+/**
+ * @def VI_NUMERIC_ZEROS
+ * @brief Восемь символов '0', упакованных в 64-битное слово.
+ */
+#define VI_NUMERIC_ZEROS 0x3030303030303030ULL
+
+/**
+ * @brief Степени десяти от 10^0 до 10^19.
+ */
+static const vi_u64_t vi_numeric_powers10[] = {
+    1ULL,
+    10ULL,
+    100ULL,
+    1000ULL,
+    10000ULL,
+    100000ULL,
+    1000000ULL,
+    10000000ULL,
+    100000000ULL,
+    1000000000ULL,
+    10000000000ULL,
+    100000000000ULL,
+    1000000000000ULL,
+    10000000000000ULL,
+    100000000000000ULL,
+    1000000000000000ULL,
+    10000000000000000ULL,
+    100000000000000000ULL,
+    1000000000000000000ULL,
+    10000000000000000000ULL,
+};
+
+/**
+ * @brief Пары цифр "00" ... "99"; пара числа `n` начинается с символа `2 * n`.
+ */
+static const char vi_numeric_digit_pairs[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+/**
+ * @brief Копирует пару цифр числа `pair` (от 0 до 99) по адресу `dst`.
+ */
+static inline void
+vi_numeric_write_pair(vi_char_t *dst, vi_usize_t pair)
+{
+    dst[0] = (vi_char_t)vi_numeric_digit_pairs[2 * pair];
+    dst[1] = (vi_char_t)vi_numeric_digit_pairs[2 * pair + 1];
+}
+
+/**
+ * @brief Записывает цифры числа так, что последняя цифра оказывается перед `end`.
+ *
+ * Пока число не помещается в 32 бита, используется 64-битное деление на 100,
+ * затем более быстрое 32-битное.
+ */
+static inline void
+vi_numeric_write_u64(vi_char_t *end, vi_u64_t value)
+{
+    while (value > VI_U32_T_MAX)
+    {
+        const vi_u64_t quotient = value / 100;
+
+        end -= 2;
+        vi_numeric_write_pair(end, (vi_usize_t)(value - quotient * 100));
+        value = quotient;
+    }
+
+    vi_u32_t small = (vi_u32_t)value;
+
+    while (small >= 100)
+    {
+        const vi_u32_t quotient = small / 100;
+
+        end -= 2;
+        vi_numeric_write_pair(end, small - quotient * 100);
+        small = quotient;
+    }
+
+    if (small >= 10)
+    {
+        vi_numeric_write_pair(end - 2, small);
+    }
+    else
+    {
+        end[-1] = (vi_char_t)('0' + small);
+    }
+}
+
+/**
+ * @brief Возвращает слово, в котором ненулевы байты, соответствующие нецифровым символам.
+ *
+ * Для цифры 0x30 ... 0x39 старшая тетрада равна 3 и остается равной 3 после
+ * прибавления 6, поэтому объединение старшей тетрады байта со старшей тетрадой
+ * суммы, сдвинутой на место младшей, равно 0x33. Перенос из байта возникает только
+ * у байтов 0xFA ... 0xFF, которые сами отмечаются как нецифровые, поэтому младший
+ * отмеченный байт всегда определяется верно.
+ */
+static inline vi_u64_t
+vi_numeric_non_digits(vi_u64_t word)
+{
+    const vi_u64_t high = 0xF0F0F0F0F0F0F0F0ULL;
+
+    return ((word & high) | (((word + 0x0606060606060606ULL) & high) >> 4)) ^
+           0x3333333333333333ULL;
+}
+
+/**
+ * @brief Переводит 8 цифр слова в число; первая цифра находится в младшем байте.
+ *
+ * Первое умножение объединяет соседние цифры в двузначные числа, второе — пары
+ * двузначных чисел в четырехзначные, третье — четырехзначные в результат.
+ */
+static inline vi_u32_t
+vi_numeric_parse_eight(vi_u64_t word)
+{
+    const vi_u64_t mask  = 0x000000FF000000FFULL;
+    const vi_u64_t mul_1 = 100 + (1000000ULL << 32);
+    const vi_u64_t mul_2 = 1 + (10000ULL << 32);
+
+    word -= VI_NUMERIC_ZEROS;
+    word = word * 10 + (word >> 8);
+    word = ((word & mask) * mul_1 + ((word >> 16) & mask) * mul_2) >> 32;
+
+    return (vi_u32_t)word;
+}
+
+/**
+ * @brief Возвращает `true`, если символ является десятичной цифрой.
+ */
+static inline bool
+vi_numeric_is_digit(vi_char_t ch)
+{
+    return (vi_u8_t)(ch - '0') <= 9;
+}
+
+/**
+ * @brief Разбирает цифры в начале участка как число, не превышающее `max`.
+ *
+ * Пока количество разобранных символов меньше количества цифр `max`, число
+ * не может переполниться, и цифры разбираются словами по 8 символов. Слово,
+ * в котором число заканчивается, дополняется слева нулями и разбирается целиком.
+ * Конец участка короче 8 символов разбирается по одной цифре, а проверка
+ * предела выполняется только для последних цифр самого длинного числа.
+ *
+ * @param str Указатель на начало участка; не равен `nullptr`.
+ * @param size Длина участка.
+ * @param max Наибольшее допустимое значение.
+ * @param value Указатель на результат; изменяется только при успехе.
+ * @param end Указатель на количество разобранных символов.
+ */
+static vi_return_t
+vi_numeric_parse_digits(const vi_char_t *str,
+                        vi_usize_t size,
+                        vi_u64_t max,
+                        vi_u64_t *value,
+                        vi_usize_t *end)
+{
+    const vi_usize_t safe = vi_numeric_digits_u64(max) - 1;
+    vi_u64_t result       = 0;
+    vi_usize_t i          = 0;
+
+    if (size == 0 || !vi_numeric_is_digit(str[0]))
+    {
+        *end = 0;
+        return VI_NUMERIC_INVALID;
+    }
+
+    while (i + 8 <= size)
+    {
+        vi_u64_t word             = vi_memory_load_le64((const vi_u8_t *)(str + i));
+        const vi_u64_t non_digits = vi_numeric_non_digits(word);
+        const vi_usize_t count    = non_digits ? vi_bit_ctz64(non_digits) >> 3 : 8;
+
+        if (count == 0 || i + count > safe)
+        {
+            break;
+        }
+
+        if (count < 8)
+        {
+            const vi_usize_t shift = (8 - count) * 8;
+
+            word = (word << shift) | (VI_NUMERIC_ZEROS >> (64 - shift));
+        }
+
+        result = result * vi_numeric_powers10[count] + vi_numeric_parse_eight(word);
+        i += count;
+
+        if (count < 8)
+        {
+            *value = result;
+            *end   = i;
+            return VI_NUMERIC_SUCCESS;
+        }
+    }
+
+    // Число из менее чем `safe + 1` цифр не может переполниться.
+    for (; i < size && i < safe && vi_numeric_is_digit(str[i]); ++i)
+    {
+        result = result * 10 + (vi_u64_t)(str[i] - '0');
+    }
+
+    const vi_u64_t limit       = max / 10;
+    const vi_u64_t limit_digit = max % 10;
+
+    for (; i < size && vi_numeric_is_digit(str[i]); ++i)
+    {
+        const vi_u64_t digit = (vi_u64_t)(str[i] - '0');
+
+        if (result > limit || (result == limit && digit > limit_digit))
+        {
+            while (i < size && vi_numeric_is_digit(str[i]))
+            {
+                ++i;
+            }
+
+            *end = i;
+            return VI_NUMERIC_OVERFLOW;
+        }
+
+        result = result * 10 + digit;
+    }
+
+    *value = result;
+    *end   = i;
+    return VI_NUMERIC_SUCCESS;
+}
+
+/**
+ * @brief Разбирает беззнаковое число, не превышающее `max`.
+ */
+static vi_return_t
+vi_numeric_parse_unsigned(const vi_char_t *str,
+                          vi_usize_t size,
+                          vi_u64_t max,
+                          vi_u64_t *value,
+                          vi_usize_t *end)
+{
+    vi_usize_t parsed = 0;
+    vi_return_t code  = VI_NUMERIC_INVALID;
+
+    if (str && value)
+    {
+        code = vi_numeric_parse_digits(str, size, max, value, &parsed);
+    }
+
+    if (end)
+    {
+        *end = parsed;
+    }
+
+    return code;
+}
+
+/**
+ * @brief Разбирает знаковое число с модулем не больше `max` или `max + 1` для отрицательного.
+ *
+ * @param magnitude Указатель на модуль результата; изменяется только при успехе.
+ * @param negative Указатель на признак отрицательного числа.
+ */
+static vi_return_t
+vi_numeric_parse_signed(const vi_char_t *str,
+                        vi_usize_t size,
+                        vi_u64_t max,
+                        vi_u64_t *magnitude,
+                        bool *negative,
+                        vi_usize_t *end)
+{
+    vi_usize_t parsed = 0;
+    vi_return_t code  = VI_NUMERIC_INVALID;
+
+    if (str && magnitude)
+    {
+        const vi_usize_t sign = size > 0 && (str[0] == '-' || str[0] == '+');
+
+        *negative = sign && str[0] == '-';
+        max += *negative;
+        code   = vi_numeric_parse_digits(str + sign, size - sign, max, magnitude, &parsed);
+        parsed = parsed ? parsed + sign : 0;
+    }
+
+    if (end)
+    {
+        *end = parsed;
+    }
+
+    return code;
+}
+
+/**
+ * @brief Переводит модуль и знак в знаковое число, не вычисляя `-(max + 1)` в знаковом типе.
+ */
+static inline vi_s64_t
+vi_numeric_apply_sign(vi_u64_t magnitude, bool negative)
+{
+    return negative && magnitude ? -(vi_s64_t)(magnitude - 1) - 1 : (vi_s64_t)magnitude;
+}
+
+vi_usize_t
+vi_numeric_digits_u64(vi_u64_t value)
+{
+    // 1233 / 4096 приближает log10(2) снизу, поэтому оценка по номеру старшего бита
+    // меньше количества цифр не более чем на 1. Для степеней десяти, начиная с 10,
+    // `value | 1` не меняет результат сравнения, а для 0 дает одну цифру.
+    const vi_usize_t estimate = ((vi_usize_t)(vi_bit_log2_64(value | 1) + 1) * 1233) >> 12;
+
+    return estimate + ((value | 1) >= vi_numeric_powers10[estimate]);
+}
+
+vi_usize_t
+vi_numeric_format_u64(vi_char_t *buffer, vi_usize_t size, vi_u64_t value)
+{
+    const vi_usize_t length = vi_numeric_digits_u64(value);
+
+    if (!buffer || size <= length)
+    {
+        return 0;
+    }
+
+    vi_numeric_write_u64(buffer + length, value);
+    buffer[length] = '\0';
+
+    return length;
+}
+
+vi_usize_t
+vi_numeric_format_s64(vi_char_t *buffer, vi_usize_t size, vi_s64_t value)
+{
+    const bool negative      = value < 0;
+    const vi_u64_t magnitude = negative ? 0 - (vi_u64_t)value : (vi_u64_t)value;
+    const vi_usize_t length  = vi_numeric_digits_u64(magnitude) + negative;
+
+    if (!buffer || size <= length)
+    {
+        return 0;
+    }
+
+    if (negative)
+    {
+        buffer[0] = '-';
+    }
+
+    vi_numeric_write_u64(buffer + length, magnitude);
+    buffer[length] = '\0';
+
+    return length;
+}
+
+vi_return_t
+vi_numeric_parse_u32(const vi_char_t *str, vi_usize_t size, vi_u32_t *value, vi_usize_t *end)
+{
+    vi_u64_t result;
+    const vi_return_t code = vi_numeric_parse_unsigned(str,
+                                                       size,
+                                                       VI_U32_T_MAX,
+                                                       value ? &result : nullptr,
+                                                       end);
+
+    if (code == VI_NUMERIC_SUCCESS)
+    {
+        *value = (vi_u32_t)result;
+    }
+
+    return code;
+}
+
+vi_return_t
+vi_numeric_parse_u64(const vi_char_t *str, vi_usize_t size, vi_u64_t *value, vi_usize_t *end)
+{
+    return vi_numeric_parse_unsigned(str, size, VI_U64_T_MAX, value, end);
+}
+
+vi_return_t
+vi_numeric_parse_s32(const vi_char_t *str, vi_usize_t size, vi_s32_t *value, vi_usize_t *end)
+{
+    vi_u64_t magnitude;
+    bool negative;
+    const vi_return_t code = vi_numeric_parse_signed(str,
+                                                     size,
+                                                     VI_S32_T_MAX,
+                                                     value ? &magnitude : nullptr,
+                                                     &negative,
+                                                     end);
+
+    if (code == VI_NUMERIC_SUCCESS)
+    {
+        *value = (vi_s32_t)vi_numeric_apply_sign(magnitude, negative);
+    }
+
+    return code;
+}
+
+vi_return_t
+vi_numeric_parse_s64(const vi_char_t *str, vi_usize_t size, vi_s64_t *value, vi_usize_t *end)
+{
+    vi_u64_t magnitude;
+    bool negative;
+    const vi_return_t code = vi_numeric_parse_signed(str,
+                                                     size,
+                                                     VI_S64_T_MAX,
+                                                     value ? &magnitude : nullptr,
+                                                     &negative,
+                                                     end);
+
+    if (code == VI_NUMERIC_SUCCESS)
+    {
+        *value = vi_numeric_apply_sign(magnitude, negative);
+    }
+
+    return code;
+}
@@ -0,0 +1,709 @@
+#include <vi/pool.h>
+/* Дополнительные модули */
+#include <vi/nullptr.h>
+#include <vi/ptr_traits.h>
+#include <vi/memory_set.h>
+#include <vi/runtime_allocator.h>
+
+#include <stdatomic.h>
+
+#if !defined(__STDC_NO_THREADS__)
+#    include <threads.h>
+#endif // !defined(__STDC_NO_THREADS__)
+
+#if VI_COMPILER_SIMD_SSE2
+#    include <emmintrin.h>
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if defined(VI_OPTION_THREAD_LOCAL_VARIABLES) && !defined(__STDC_NO_THREADS__)
+/**
+ * @def VI_POOL_THREAD_CACHES
+ * @brief Признак кэшей потоков: нужны переменные потоков и деструктор `tss_t`,
+ *        возвращающий номер кэша при завершении потока.
+ */
+#    define VI_POOL_THREAD_CACHES 1
+#else
+/**
+ * @def VI_POOL_THREAD_CACHES
+ * @brief Признак кэшей потоков: все потоки используют общий кэш.
+ */
+#    define VI_POOL_THREAD_CACHES 0
+#endif // defined(VI_OPTION_THREAD_LOCAL_VARIABLES) && !defined(__STDC_NO_THREADS__)
+
+/**
+ * @def VI_POOL_ALIGNMENT
+ * @brief Выравнивание объектов и шаг округления их размера.
+ */
+#define VI_POOL_ALIGNMENT (sizeof(vi_ptr_t) * 2)
+
+/**
+ * @def VI_POOL_CACHE_LINE_SIZE
+ * @brief Размер строки кэша, по которому выравниваются кэши потоков.
+ */
+#define VI_POOL_CACHE_LINE_SIZE 64
+
+/**
+ * @def VI_POOL_SPIN_LIMIT
+ * @brief Количество неудачных попыток взять блокировку, после которых поток уступает
+ *        процессор вместо паузы.
+ */
+#define VI_POOL_SPIN_LIMIT 8
+
+/**
+ * @brief Свободный объект пула.
+ */
+typedef struct vi_pool_node_t
+{
+    /**
+     * @brief Следующий свободный объект в списке.
+     */
+    struct vi_pool_node_t *next;
+
+    /**
+     * @brief Следующий пакет в общем хранилище (только у первого объекта пакета).
+     */
+    struct vi_pool_node_t *batch;
+} vi_pool_node_t;
+
+/**
+ * @brief Заголовок слэба. Объекты следуют за ним со смещением `VI_POOL_ALIGNMENT`.
+ */
+typedef struct vi_pool_slab_t
+{
+    struct vi_pool_slab_t *next;
+} vi_pool_slab_t;
+
+/**
+ * @brief Кэш свободных объектов, занимающий отдельную строку кэша процессора.
+ */
+typedef union vi_pool_cache_t
+{
+    struct
+    {
+        /**
+         * @brief Первый свободный объект.
+         */
+        vi_pool_node_t *head;
+
+        /**
+         * @brief Количество свободных объектов; читается другими потоками для статистики.
+         */
+        _Atomic(vi_usize_t) count;
+    };
+
+    vi_u8_t padding[VI_POOL_CACHE_LINE_SIZE];
+} vi_pool_cache_t;
+
+struct vi_pool_t
+{
+    /**
+     * @brief Кэши потоков. Расположены первыми, чтобы начинаться с границы строки кэша.
+     */
+    vi_pool_cache_t caches[VI_POOL_THREAD_CACHE_MAX];
+
+    /**
+     * @brief Общий кэш для потоков без собственного кэша; используется под блокировкой.
+     */
+    vi_pool_cache_t shared;
+
+    const vi_allocator_t *backing;
+    vi_usize_t object_size;
+    vi_usize_t slab_size;
+    vi_usize_t slab_objects;
+
+    /**
+     * @brief Блокировка полей ниже.
+     */
+    atomic_flag lock;
+
+    vi_pool_slab_t *slabs;
+    vi_usize_t slab_count;
+
+    /**
+     * @brief Неразмеченная часть последнего слэба.
+     */
+    vi_u8_t *carve;
+    vi_u8_t *carve_end;
+
+    /**
+     * @brief Общее хранилище: список пакетов по `VI_POOL_BATCH_SIZE` объектов.
+     */
+    vi_pool_node_t *depot;
+    vi_usize_t depot_batches;
+
+    /**
+     * @brief Следующий пул в списке существующих пулов.
+     */
+    struct vi_pool_t *next;
+};
+
+/**
+ * @brief Ждет перед повторной попыткой взять блокировку: сначала паузой процессора,
+ *        удваивая ее с каждой попыткой, а затем уступая процессор другим потокам.
+ */
+static void
+vi_pool_backoff(vi_u32_t *attempt)
+{
+    if (*attempt < VI_POOL_SPIN_LIMIT)
+    {
+        for (vi_u32_t i = 0; i < (1U << *attempt); ++i)
+        {
+#if VI_COMPILER_SIMD_SSE2
+            _mm_pause();
+#endif // VI_COMPILER_SIMD_SSE2
+        }
+
+        ++*attempt;
+        return;
+    }
+
+#if !defined(__STDC_NO_THREADS__)
+    thrd_yield();
+#endif // !defined(__STDC_NO_THREADS__)
+}
+
+static inline void
+vi_pool_lock(vi_pool_t *pool)
+{
+    vi_u32_t attempt = 0;
+
+    while (atomic_flag_test_and_set_explicit(&pool->lock, memory_order_acquire))
+    {
+        vi_pool_backoff(&attempt);
+    }
+}
+
+static inline void
+vi_pool_unlock(vi_pool_t *pool)
+{
+    atomic_flag_clear_explicit(&pool->lock, memory_order_release);
+}
+
+static inline vi_usize_t
+vi_pool_cache_count(const vi_pool_cache_t *cache)
+{
+    return atomic_load_explicit(&cache->count, memory_order_relaxed);
+}
+
+static inline void
+vi_pool_cache_set_count(vi_pool_cache_t *cache, vi_usize_t count)
+{
+    atomic_store_explicit(&cache->count, count, memory_order_relaxed);
+}
+
+/**
+ * @brief Выделяет новый слэб и делает его неразмеченной частью пула.
+ *
+ * Вызывается под блокировкой.
+ */
+static bool
+vi_pool_grow_locked(vi_pool_t *pool)
+{
+    vi_pool_slab_t *const slab = pool->backing->aligned_allocate(pool->backing->context,
+                                                                 pool->slab_size,
+                                                                 VI_POOL_SLAB_SIZE);
+
+    if (!slab)
+    {
+        return false;
+    }
+
+    slab->next      = pool->slabs;
+    pool->slabs     = slab;
+    pool->carve     = (vi_u8_t *)slab + VI_POOL_ALIGNMENT;
+    pool->carve_end = pool->carve + pool->slab_objects * pool->object_size;
+    ++pool->slab_count;
+    return true;
+}
+
+/**
+ * @brief Заполняет пустой кэш пакетом из хранилища или новыми объектами слэба.
+ *
+ * Вызывается под блокировкой.
+ */
+static bool
+vi_pool_refill_locked(vi_pool_t *pool, vi_pool_cache_t *cache)
+{
+    if (pool->depot)
+    {
+        vi_pool_node_t *const batch = pool->depot;
+        pool->depot                 = batch->batch;
+        --pool->depot_batches;
+
+        cache->head = batch;
+        vi_pool_cache_set_count(cache, VI_POOL_BATCH_SIZE);
+        return true;
+    }
+
+    if (pool->carve == pool->carve_end && !vi_pool_grow_locked(pool))
+    {
+        return false;
+    }
+
+    const vi_usize_t remaining = vi_addr_diff(pool->carve_end, pool->carve) / pool->object_size;
+    const vi_usize_t count     = remaining < VI_POOL_BATCH_SIZE ? remaining : VI_POOL_BATCH_SIZE;
+
+    vi_pool_node_t *head = nullptr;
+
+    for (vi_usize_t i = count; i; --i)
+    {
+        vi_pool_node_t *const node = (vi_pool_node_t *)(pool->carve + (i - 1) * pool->object_size);
+        node->next                 = head;
+        head                       = node;
+    }
+
+    pool->carve += count * pool->object_size;
+    cache->head = head;
+    vi_pool_cache_set_count(cache, count);
+    return true;
+}
+
+/**
+ * @brief Переносит `VI_POOL_BATCH_SIZE` объектов из начала кэша в хранилище.
+ *
+ * Вызывается под блокировкой; кэш должен содержать не меньше пакета объектов.
+ */
+static void
+vi_pool_flush_locked(vi_pool_t *pool, vi_pool_cache_t *cache)
+{
+    vi_pool_node_t *const first = cache->head;
+    vi_pool_node_t *last        = first;
+
+    for (vi_usize_t i = 1; i < VI_POOL_BATCH_SIZE; ++i)
+    {
+        last = last->next;
+    }
+
+    cache->head = last->next;
+    vi_pool_cache_set_count(cache, vi_pool_cache_count(cache) - VI_POOL_BATCH_SIZE);
+
+    last->next   = nullptr;
+    first->batch = pool->depot;
+    pool->depot  = first;
+    ++pool->depot_batches;
+}
+
+static vi_ptr_t
+vi_pool_cache_pop(vi_pool_t *pool, vi_pool_cache_t *cache, bool locked)
+{
+    if (!cache->head)
+    {
+        if (!locked)
+        {
+            vi_pool_lock(pool);
+        }
+
+        const bool refilled = vi_pool_refill_locked(pool, cache);
+
+        if (!locked)
+        {
+            vi_pool_unlock(pool);
+        }
+
+        if (!refilled)
+        {
+            return nullptr;
+        }
+    }
+
+    vi_pool_node_t *const node = cache->head;
+    cache->head                = node->next;
+    vi_pool_cache_set_count(cache, vi_pool_cache_count(cache) - 1);
+    return node;
+}
+
+static void
+vi_pool_cache_push(vi_pool_t *pool, vi_pool_cache_t *cache, vi_pool_node_t *node, bool locked)
+{
+    const vi_usize_t count = vi_pool_cache_count(cache) + 1;
+
+    node->next  = cache->head;
+    cache->head = node;
+    vi_pool_cache_set_count(cache, count);
+
+    if (count < VI_POOL_BATCH_SIZE * 2)
+    {
+        return;
+    }
+
+    if (!locked)
+    {
+        vi_pool_lock(pool);
+    }
+
+    vi_pool_flush_locked(pool, cache);
+
+    if (!locked)
+    {
+        vi_pool_unlock(pool);
+    }
+}
+
+#if VI_POOL_THREAD_CACHES
+/**
+ * @def VI_POOL_THREAD_NO_CACHE
+ * @brief Номер кэша потока, которому не хватило свободного номера.
+ */
+#    define VI_POOL_THREAD_NO_CACHE VI_USIZE_T_MAX
+
+/**
+ * @brief Признак однократной инициализации списков ниже.
+ */
+static once_flag vi_pool_registry_once = ONCE_FLAG_INIT;
+
+/**
+ * @brief Признак успешной инициализации; без нее все потоки используют общий кэш.
+ */
+static bool vi_pool_registry_ready = false;
+
+/**
+ * @brief Блокировка списка пулов и списка свободных номеров кэшей.
+ */
+static mtx_t vi_pool_registry_lock;
+
+/**
+ * @brief Ключ, деструктор которого возвращает номер кэша при завершении потока.
+ */
+static tss_t vi_pool_thread_key;
+
+/**
+ * @brief Существующие пулы; при завершении потока его кэш сбрасывается в каждом из них.
+ */
+static vi_pool_t *vi_pool_registry = nullptr;
+
+/**
+ * @brief Стек свободных номеров кэшей и его размер.
+ */
+static vi_usize_t vi_pool_free_slots[VI_POOL_THREAD_CACHE_MAX];
+static vi_usize_t vi_pool_free_count = 0;
+
+/**
+ * @brief Номер кэша текущего потока, увеличенный на 1; 0 — номер еще не получен.
+ */
+static VI_ATTRIBUTE(THREAD_LOCAL) vi_usize_t vi_pool_thread_index = 0;
+
+/**
+ * @brief Переносит объекты кэша завершившегося потока в общий кэш и хранилище пула.
+ *
+ * Вызывается под блокировкой пула.
+ */
+static void
+vi_pool_cache_drain_locked(vi_pool_t *pool, vi_pool_cache_t *cache)
+{
+    while (cache->head)
+    {
+        vi_pool_node_t *const node = cache->head;
+        cache->head                = node->next;
+        vi_pool_cache_push(pool, &pool->shared, node, true);
+    }
+
+    vi_pool_cache_set_count(cache, 0);
+}
+
+/**
+ * @brief Деструктор `vi_pool_thread_key`: сбрасывает кэш потока во всех пулах
+ *        и возвращает его номер в список свободных.
+ */
+static void
+vi_pool_thread_exit(void *value)
+{
+    const vi_usize_t slot = (vi_usize_t)value - 1;
+
+    mtx_lock(&vi_pool_registry_lock);
+
+    for (vi_pool_t *pool = vi_pool_registry; pool; pool = pool->next)
+    {
+        vi_pool_lock(pool);
+        vi_pool_cache_drain_locked(pool, &pool->caches[slot]);
+        vi_pool_unlock(pool);
+    }
+
+    vi_pool_free_slots[vi_pool_free_count++] = slot;
+    mtx_unlock(&vi_pool_registry_lock);
+    vi_pool_thread_index = 0;
+}
+
+static void
+vi_pool_registry_init(void)
+{
+    if (mtx_init(&vi_pool_registry_lock, mtx_plain) != thrd_success)
+    {
+        return;
+    }
+
+    if (tss_create(&vi_pool_thread_key, vi_pool_thread_exit) != thrd_success)
+    {
+        mtx_destroy(&vi_pool_registry_lock);
+        return;
+    }
+
+    // Номера выдаются по возрастанию, поэтому первыми заняты начальные кэши.
+    for (vi_usize_t i = 0; i < VI_POOL_THREAD_CACHE_MAX; ++i)
+    {
+        vi_pool_free_slots[i] = VI_POOL_THREAD_CACHE_MAX - 1 - i;
+    }
+
+    vi_pool_free_count     = VI_POOL_THREAD_CACHE_MAX;
+    vi_pool_registry_ready = true;
+}
+
+/**
+ * @brief Получает свободный номер кэша для текущего потока.
+ *
+ * Поток, которому номера не хватило, до завершения использует общий кэш.
+ */
+static vi_usize_t
+vi_pool_thread_acquire(void)
+{
+    vi_usize_t index = VI_POOL_THREAD_NO_CACHE;
+
+    mtx_lock(&vi_pool_registry_lock);
+
+    if (vi_pool_free_count)
+    {
+        index = vi_pool_free_slots[--vi_pool_free_count] + 1;
+
+        if (tss_set(vi_pool_thread_key, (void *)index) != thrd_success)
+        {
+            vi_pool_free_slots[vi_pool_free_count++] = index - 1;
+            index                                    = VI_POOL_THREAD_NO_CACHE;
+        }
+    }
+
+    mtx_unlock(&vi_pool_registry_lock);
+    return index;
+}
+
+/**
+ * @brief Возвращает кэш текущего потока или `nullptr`, если свободных номеров нет.
+ */
+static inline vi_pool_cache_t *
+vi_pool_thread_cache(vi_pool_t *pool)
+{
+    if (!vi_pool_thread_index)
+    {
+        // Пул уже зарегистрирован, поэтому инициализация выполнена.
+        vi_pool_thread_index = vi_pool_registry_ready ? vi_pool_thread_acquire()
+                                                      : VI_POOL_THREAD_NO_CACHE;
+    }
+
+    if (vi_pool_thread_index == VI_POOL_THREAD_NO_CACHE)
+    {
+        return nullptr;
+    }
+    return &pool->caches[vi_pool_thread_index - 1];
+}
+
+/**
+ * @brief Добавляет пул в список существующих пулов.
+ */
+static void
+vi_pool_register(vi_pool_t *pool)
+{
+    call_once(&vi_pool_registry_once, vi_pool_registry_init);
+
+    if (!vi_pool_registry_ready)
+    {
+        return;
+    }
+
+    mtx_lock(&vi_pool_registry_lock);
+    pool->next       = vi_pool_registry;
+    vi_pool_registry = pool;
+    mtx_unlock(&vi_pool_registry_lock);
+}
+
+/**
+ * @brief Удаляет пул из списка существующих пулов.
+ */
+static void
+vi_pool_unregister(vi_pool_t *pool)
+{
+    if (!vi_pool_registry_ready)
+    {
+        return;
+    }
+
+    mtx_lock(&vi_pool_registry_lock);
+
+    for (vi_pool_t **link = &vi_pool_registry; *link; link = &(*link)->next)
+    {
+        if (*link == pool)
+        {
+            *link = pool->next;
+            break;
+        }
+    }
+
+    mtx_unlock(&vi_pool_registry_lock);
+}
+#else
+static inline vi_pool_cache_t *
+vi_pool_thread_cache(vi_pool_t *pool)
+{
+    (void)pool;
+    return nullptr;
+}
+
+static inline void
+vi_pool_register(vi_pool_t *pool)
+{
+    (void)pool;
+}
+
+static inline void
+vi_pool_unregister(vi_pool_t *pool)
+{
+    (void)pool;
+}
+#endif // VI_POOL_THREAD_CACHES
+
+vi_pool_t *
+vi_pool_create(const vi_allocator_t *backing, vi_usize_t object_size)
+{
+    if (!backing)
+    {
+        backing = vi_runtime_allocator_get();
+    }
+
+    if (!object_size || object_size > VI_USIZE_T_MAX / 2 || !vi_allocator_is_valid(backing))
+    {
+        return nullptr;
+    }
+
+    vi_pool_t *const pool = backing->aligned_allocate(backing->context,
+                                                      sizeof(vi_pool_t),
+                                                      VI_POOL_CACHE_LINE_SIZE);
+
+    if (!pool)
+    {
+        return nullptr;
+    }
+
+    vi_memory_zero_unsafe(pool, sizeof(vi_pool_t));
+
+    object_size = object_size < sizeof(vi_pool_node_t) ? sizeof(vi_pool_node_t) : object_size;
+    object_size = (object_size + VI_POOL_ALIGNMENT - 1) & ~(VI_POOL_ALIGNMENT - 1);
+
+    vi_usize_t slab_size = VI_POOL_SLAB_SIZE;
+
+    while ((slab_size - VI_POOL_ALIGNMENT) / object_size < VI_POOL_SLAB_MIN_OBJECTS)
+    {
+        slab_size *= 2;
+    }
+
+    pool->backing      = backing;
+    pool->object_size  = object_size;
+    pool->slab_size    = slab_size;
+    pool->slab_objects = (slab_size - VI_POOL_ALIGNMENT) / object_size;
+    atomic_flag_clear(&pool->lock);
+    vi_pool_register(pool);
+    return pool;
+}
+
+void
+vi_pool_destroy(vi_pool_t *pool)
+{
+    if (!pool)
+    {
+        return;
+    }
+
+    const vi_allocator_t *const backing = pool->backing;
+
+    vi_pool_unregister(pool);
+
+    for (vi_pool_slab_t *slab = pool->slabs; slab;)
+    {
+        vi_pool_slab_t *const next = slab->next;
+        backing->aligned_free(backing->context, slab, pool->slab_size, VI_POOL_SLAB_SIZE);
+        slab = next;
+    }
+
+    backing->aligned_free(backing->context, pool, sizeof(vi_pool_t), VI_POOL_CACHE_LINE_SIZE);
+}
+
+vi_ptr_t
+vi_pool_allocate(vi_pool_t *pool)
+{
+    if (!pool)
+    {
+        return nullptr;
+    }
+
+    vi_pool_cache_t *const cache = vi_pool_thread_cache(pool);
+    vi_ptr_t ptr;
+
+    if (cache)
+    {
+        ptr = vi_pool_cache_pop(pool, cache, false);
+    }
+    else
+    {
+        vi_pool_lock(pool);
+        ptr = vi_pool_cache_pop(pool, &pool->shared, true);
+        vi_pool_unlock(pool);
+    }
+
+#ifdef VI_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
+    if (ptr)
+    {
+        vi_memory_zero_unsafe(ptr, pool->object_size);
+    }
+#endif // VI_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
+
+    return ptr;
+}
+
+void
+vi_pool_free(vi_pool_t *pool, vi_ptr_t ptr)
+{
+    if (!pool || !ptr)
+    {
+        return;
+    }
+
+    vi_pool_cache_t *const cache = vi_pool_thread_cache(pool);
+
+    if (cache)
+    {
+        vi_pool_cache_push(pool, cache, ptr, false);
+    }
+    else
+    {
+        vi_pool_lock(pool);
+        vi_pool_cache_push(pool, &pool->shared, ptr, true);
+        vi_pool_unlock(pool);
+    }
+}
+
+bool
+vi_pool_stats(vi_pool_t *pool, vi_pool_stats_t *stats)
+{
+    if (!pool || !stats)
+    {
+        return false;
+    }
+
+    vi_pool_lock(pool);
+
+    vi_usize_t available = pool->depot_batches * VI_POOL_BATCH_SIZE +
+                           vi_addr_diff(pool->carve_end, pool->carve) / pool->object_size +
+                           vi_pool_cache_count(&pool->shared);
+
+    stats->object_size = pool->object_size;
+    stats->slab_size   = pool->slab_size;
+    stats->slab_count  = pool->slab_count;
+    stats->capacity    = pool->slab_count * pool->slab_objects;
+
+    vi_pool_unlock(pool);
+
+    for (vi_usize_t i = 0; i < VI_POOL_THREAD_CACHE_MAX; ++i)
+    {
+        available += vi_pool_cache_count(&pool->caches[i]);
+    }
+
+    stats->available = available < stats->capacity ? available : stats->capacity;
+    stats->in_use    = stats->capacity - stats->available;
+    return true;
+}
@@ -0,0 +1,74 @@
+#include <vi/runtime_allocator.h>
+/* Дополнительные модули */
+#include <vi/nullptr.h>
+
+#include <stdatomic.h>
+
+/**
+ * @brief Текущий распределитель времени выполнения.
+ *
+ * Запись с семантикой освобождения и чтение с семантикой захвата гарантируют,
+ * что поток, увидевший новый указатель, видит и заполненную таблицу функций.
+ */
+static _Atomic(const vi_allocator_t *) vi_runtime_allocator = nullptr;
+
+#ifdef VI_OPTION_RUNTIME_ALLOCATOR_INIT_STDLIB
+vi_compiler_constructor(vi_runtime_allocator_init)
+{
+    atomic_store_explicit(&vi_runtime_allocator, vi_allocator_stdlib(), memory_order_release);
+}
+#endif // VI_OPTION_RUNTIME_ALLOCATOR_INIT_STDLIB
+
+const vi_allocator_t *
+vi_runtime_allocator_get(void)
+{
+    return atomic_load_explicit(&vi_runtime_allocator, memory_order_acquire);
+}
+
+bool
+vi_runtime_allocator_set(const vi_allocator_t *allocator)
+{
+    if (!vi_allocator_is_valid(allocator))
+    {
+        return false;
+    }
+
+    atomic_store_explicit(&vi_runtime_allocator, allocator, memory_order_release);
+    return true;
+}
+
+vi_ptr_t
+vi_runtime_allocator_allocate(vi_usize_t size)
+{
+    return vi_allocator_allocate(vi_runtime_allocator_get(), size);
+}
+
+vi_ptr_t
+vi_runtime_allocator_allocate_zeroed(vi_usize_t size)
+{
+    return vi_allocator_allocate_zeroed(vi_runtime_allocator_get(), size);
+}
+
+vi_ptr_t
+vi_runtime_allocator_reallocate(vi_ptr_t ptr, vi_usize_t old_size, vi_usize_t new_size)
+{
+    return vi_allocator_reallocate(vi_runtime_allocator_get(), ptr, old_size, new_size);
+}
+
+void
+vi_runtime_allocator_free(vi_ptr_t ptr, vi_usize_t size)
+{
+    vi_allocator_free(vi_runtime_allocator_get(), ptr, size);
+}
+
+vi_ptr_t
+vi_runtime_allocator_aligned_allocate(vi_usize_t size, vi_usize_t alignment)
+{
+    return vi_allocator_aligned_allocate(vi_runtime_allocator_get(), size, alignment);
+}
+
+void
+vi_runtime_allocator_aligned_free(vi_ptr_t ptr, vi_usize_t size, vi_usize_t alignment)
+{
+    vi_allocator_aligned_free(vi_runtime_allocator_get(), ptr, size, alignment);
+}
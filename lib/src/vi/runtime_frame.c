@@ -0,0 +1,107 @@
+#include <vi/runtime_frame.h>
+/* Дополнительные модули */
+#include <vi/nullptr.h>
+
+#include <stdlib.h>
+
+#if defined(VI_OPTION_THREAD_LOCAL_VARIABLES) &&                                                   \
+    ((VI_COMPILER_TYPE == VI_COMPILER_TYPE_GCC) || (VI_COMPILER_TYPE == VI_COMPILER_TYPE_CLANG))
+/**
+ * @def VI_RUNTIME_FRAME_TLS_MODEL
+ * @brief Модель доступа к стеку кадров потока.
+ *
+ * В разделяемой библиотеке по умолчанию каждый доступ к переменной потока вызывает
+ * `__tls_get_addr`, что удваивает стоимость пары `vi_runtime_frame_try`/`pop`.
+ * Модель initial-exec заменяет вызов чтением смещения; стек кадров занимает
+ * 16 байт, поэтому помещается в резерв статического TLS и при загрузке через `dlopen`.
+ */
+#    define VI_RUNTIME_FRAME_TLS_MODEL __attribute__((tls_model("initial-exec")))
+#else
+/**
+ * @def VI_RUNTIME_FRAME_TLS_MODEL
+ * @brief Модель доступа к стеку кадров потока по умолчанию.
+ */
+#    define VI_RUNTIME_FRAME_TLS_MODEL
+#endif // defined(VI_OPTION_THREAD_LOCAL_VARIABLES) && ...
+
+/**
+ * @brief Стек кадров одного потока.
+ */
+typedef struct vi_runtime_frame_stack_t
+{
+    /**
+     * @brief Последний добавленный кадр или `nullptr`.
+     */
+    vi_runtime_frame_t *top;
+
+    /**
+     * @brief Количество кадров в стеке.
+     */
+    vi_usize_t depth;
+} vi_runtime_frame_stack_t;
+
+/**
+ * @brief Стек кадров текущего потока (или общий, если переменные потоков отключены).
+ */
+static VI_ATTRIBUTE(THREAD_LOCAL) vi_runtime_frame_stack_t
+    vi_runtime_frame_stack VI_RUNTIME_FRAME_TLS_MODEL;
+
+bool
+vi_runtime_frame_push(vi_runtime_frame_t *frame)
+{
+    vi_runtime_frame_stack_t *const stack = &vi_runtime_frame_stack;
+
+    if (stack->depth == VI_RUNTIME_FRAME_STATE_MAX)
+    {
+        frame->code = VI_RUNTIME_FRAME_OVERFLOW;
+        return false;
+    }
+
+    frame->code     = 0;
+    frame->previous = stack->top;
+    stack->top      = frame;
+    ++stack->depth;
+    return true;
+}
+
+void
+vi_runtime_frame_pop(const vi_runtime_frame_t *frame)
+{
+    vi_runtime_frame_stack_t *const stack = &vi_runtime_frame_stack;
+
+    if (stack->top != frame)
+    {
+        // Кадр, оставшийся выше, указывает на завершившуюся функцию: следующий
+        // переход в него испортил бы стек вызовов.
+        abort();
+    }
+
+    stack->top = frame->previous;
+    --stack->depth;
+}
+
+void
+vi_runtime_frame_throw(vi_return_t code)
+{
+    vi_runtime_frame_stack_t *const stack = &vi_runtime_frame_stack;
+    vi_runtime_frame_t *const frame       = stack->top;
+
+    if (!frame)
+    {
+        // Вернуть управление некуда: продолжение выполнения после ошибки,
+        // которую вызывающий код считает невосстановимой, опаснее завершения.
+        abort();
+    }
+
+    stack->top = frame->previous;
+    --stack->depth;
+
+    frame->code = code;
+    longjmp(frame->state, 1);
+}
+
+vi_usize_t
+vi_runtime_frame_depth(void)
+{
+    return vi_runtime_frame_stack.depth;
+}
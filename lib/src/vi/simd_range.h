@@ -0,0 +1,33 @@
+/**
+ * @file simd_range.h
+ * @brief Внутренние макросы проверки попадания байтов в диапазон для SSE2 и AVX2.
+ *
+ * Этот файл не входит в публичный интерфейс. Макросы раскрываются в вызовы
+ * интринсиков, поэтому заголовки `<emmintrin.h>`/`<immintrin.h>` подключает
+ * модуль, который их использует.
+ */
+
+#ifndef VI_SIMD_RANGE_H
+#define VI_SIMD_RANGE_H
+
+/**
+ * @def vi_simd_range_sse2
+ * @brief Маска байтов `x`, попадающих в диапазон [`lo`, `lo + n`).
+ *
+ * После вычитания `lo` значения из диапазона становятся меньше `n`,
+ * что проверяется беззнаковым минимумом.
+ */
+#define vi_simd_range_sse2(x, lo, n)                                                               \
+    _mm_cmpeq_epi8(_mm_min_epu8(_mm_sub_epi8((x), _mm_set1_epi8(lo)), _mm_set1_epi8((n) - 1)),    \
+                   _mm_sub_epi8((x), _mm_set1_epi8(lo)))
+
+/**
+ * @def vi_simd_range_avx2
+ * @brief 32-байтовый вариант `vi_simd_range_sse2`.
+ */
+#define vi_simd_range_avx2(x, lo, n)                                                               \
+    _mm256_cmpeq_epi8(                                                                             \
+        _mm256_min_epu8(_mm256_sub_epi8((x), _mm256_set1_epi8(lo)), _mm256_set1_epi8((n) - 1)),    \
+        _mm256_sub_epi8((x), _mm256_set1_epi8(lo)))
+
+#endif // VI_SIMD_RANGE_H
@@ -0,0 +1,330 @@
+#include <vi/spsc_ring.h>
+/* Дополнительные модули */
+#include "memory_copy_element.h"
+#include <vi/nullptr.h>
+#include <vi/bit_traits.h>
+#include <vi/memory_copy.h>
+#include <vi/runtime_allocator.h>
+
+#include <stdatomic.h>
+
+/**
+ * @def VI_SPSC_RING_CACHE_LINE_SIZE
+ * @brief Размер строки кэша, по которому разделяются индексы производителя и потребителя.
+ */
+#define VI_SPSC_RING_CACHE_LINE_SIZE 64
+
+/**
+ * @def VI_SPSC_RING_HEADER_SIZE
+ * @brief Смещение элементов от начала буфера.
+ *
+ * Округляется до строки кэша, чтобы запись первых элементов не вытесняла
+ * у другой стороны строку с неизменяемыми полями буфера.
+ */
+#define VI_SPSC_RING_HEADER_SIZE                                                                   \
+    ((sizeof(vi_spsc_ring_t) + VI_SPSC_RING_CACHE_LINE_SIZE - 1) &                                 \
+     ~(vi_usize_t)(VI_SPSC_RING_CACHE_LINE_SIZE - 1))
+
+/**
+ * @brief Индекс одной из сторон буфера, занимающий отдельную строку кэша.
+ */
+typedef union vi_spsc_ring_index_t
+{
+    struct
+    {
+        /**
+         * @brief Собственный индекс стороны; изменяется только ею.
+         */
+        _Atomic(vi_usize_t) value;
+
+        /**
+         * @brief Индекс другой стороны, прочитанный в последний раз.
+         */
+        vi_usize_t cached;
+    };
+
+    vi_u8_t padding[VI_SPSC_RING_CACHE_LINE_SIZE];
+} vi_spsc_ring_index_t;
+
+struct vi_spsc_ring_t
+{
+    /**
+     * @brief Индекс начала очереди (потребитель) и копия индекса конца.
+     */
+    vi_spsc_ring_index_t head;
+
+    /**
+     * @brief Индекс конца очереди (производитель) и копия индекса начала.
+     */
+    vi_spsc_ring_index_t tail;
+
+    const vi_allocator_t *backing;
+    vi_usize_t element_size;
+    vi_usize_t capacity;
+
+    /**
+     * @brief Элементы буфера; находятся в той же области памяти
+     *        со смещением `VI_SPSC_RING_HEADER_SIZE`.
+     */
+    vi_u8_t *data;
+};
+
+/**
+ * @brief Возвращает наименьшее из двух значений.
+ */
+static inline vi_usize_t
+vi_spsc_ring_min(vi_usize_t lhs, vi_usize_t rhs)
+{
+    return lhs < rhs ? lhs : rhs;
+}
+
+vi_spsc_ring_t *
+vi_spsc_ring_create(const vi_allocator_t *backing, vi_usize_t element_size, vi_usize_t capacity)
+{
+    if (!backing)
+    {
+        backing = vi_runtime_allocator_get();
+    }
+
+    if (!element_size || !vi_bit_is_single(capacity) || !vi_allocator_is_valid(backing))
+    {
+        return nullptr;
+    }
+
+    if (capacity > (VI_USIZE_T_MAX - VI_SPSC_RING_HEADER_SIZE) / element_size)
+    {
+        return nullptr;
+    }
+
+    vi_spsc_ring_t *const ring =
+        vi_allocator_aligned_allocate(backing,
+                                      VI_SPSC_RING_HEADER_SIZE + capacity * element_size,
+                                      VI_SPSC_RING_CACHE_LINE_SIZE);
+
+    if (!ring)
+    {
+        return nullptr;
+    }
+
+    atomic_init(&ring->head.value, 0);
+    atomic_init(&ring->tail.value, 0);
+    ring->head.cached  = 0;
+    ring->tail.cached  = 0;
+    ring->backing      = backing;
+    ring->element_size = element_size;
+    ring->capacity     = capacity;
+    ring->data         = (vi_u8_t *)ring + VI_SPSC_RING_HEADER_SIZE;
+    return ring;
+}
+
+void
+vi_spsc_ring_destroy(vi_spsc_ring_t *ring)
+{
+    if (!ring)
+    {
+        return;
+    }
+
+    vi_allocator_aligned_free(ring->backing,
+                              ring,
+                              VI_SPSC_RING_HEADER_SIZE + ring->capacity * ring->element_size,
+                              VI_SPSC_RING_CACHE_LINE_SIZE);
+}
+
+/**
+ * @brief Возвращает непрерывный участок свободных элементов (см. `vi_spsc_ring_acquire_write`).
+ */
+static inline vi_usize_t
+vi_spsc_ring_writable(vi_spsc_ring_t *ring, vi_u8_t **span, vi_usize_t count)
+{
+    const vi_usize_t tail = atomic_load_explicit(&ring->tail.value, memory_order_relaxed);
+    vi_usize_t free       = ring->capacity - (tail - ring->tail.cached);
+
+    if (free < count)
+    {
+        // Acquire гарантирует, что потребитель закончил чтение освобожденных элементов
+        // до того, как производитель начнет их перезаписывать.
+        ring->tail.cached = atomic_load_explicit(&ring->head.value, memory_order_acquire);
+        free              = ring->capacity - (tail - ring->tail.cached);
+    }
+
+    const vi_usize_t offset = tail & (ring->capacity - 1);
+
+    *span = ring->data + offset * ring->element_size;
+    return vi_spsc_ring_min(vi_spsc_ring_min(free, count), ring->capacity - offset);
+}
+
+/**
+ * @brief Публикует записанные элементы (см. `vi_spsc_ring_commit_write`).
+ */
+static inline void
+vi_spsc_ring_publish(vi_spsc_ring_t *ring, vi_usize_t count)
+{
+    const vi_usize_t tail = atomic_load_explicit(&ring->tail.value, memory_order_relaxed);
+    atomic_store_explicit(&ring->tail.value, tail + count, memory_order_release);
+}
+
+/**
+ * @brief Возвращает непрерывный участок готовых элементов (см. `vi_spsc_ring_acquire_read`).
+ */
+static inline vi_usize_t
+vi_spsc_ring_readable(vi_spsc_ring_t *ring, vi_u8_t **span, vi_usize_t count)
+{
+    const vi_usize_t head = atomic_load_explicit(&ring->head.value, memory_order_relaxed);
+    vi_usize_t ready      = ring->head.cached - head;
+
+    if (ready < count)
+    {
+        // Acquire гарантирует, что элементы, опубликованные производителем, видны целиком.
+        ring->head.cached = atomic_load_explicit(&ring->tail.value, memory_order_acquire);
+        ready             = ring->head.cached - head;
+    }
+
+    const vi_usize_t offset = head & (ring->capacity - 1);
+
+    *span = ring->data + offset * ring->element_size;
+    return vi_spsc_ring_min(vi_spsc_ring_min(ready, count), ring->capacity - offset);
+}
+
+/**
+ * @brief Освобождает прочитанные элементы (см. `vi_spsc_ring_release_read`).
+ */
+static inline void
+vi_spsc_ring_consume(vi_spsc_ring_t *ring, vi_usize_t count)
+{
+    const vi_usize_t head = atomic_load_explicit(&ring->head.value, memory_order_relaxed);
+    atomic_store_explicit(&ring->head.value, head + count, memory_order_release);
+}
+
+vi_usize_t
+vi_spsc_ring_acquire_write(vi_spsc_ring_t *ring, vi_ptr_t *span, vi_usize_t count)
+{
+    vi_u8_t *begin;
+    const vi_usize_t size = vi_spsc_ring_writable(ring, &begin, count);
+
+    *span = begin;
+    return size;
+}
+
+void
+vi_spsc_ring_commit_write(vi_spsc_ring_t *ring, vi_usize_t count)
+{
+    vi_spsc_ring_publish(ring, count);
+}
+
+vi_usize_t
+vi_spsc_ring_acquire_read(vi_spsc_ring_t *ring, vi_ptr_t *span, vi_usize_t count)
+{
+    vi_u8_t *begin;
+    const vi_usize_t size = vi_spsc_ring_readable(ring, &begin, count);
+
+    *span = begin;
+    return size;
+}
+
+void
+vi_spsc_ring_release_read(vi_spsc_ring_t *ring, vi_usize_t count)
+{
+    vi_spsc_ring_consume(ring, count);
+}
+
+bool
+vi_spsc_ring_push(vi_spsc_ring_t *ring, const vi_ptr_t element)
+{
+    vi_u8_t *span;
+
+    if (!vi_spsc_ring_writable(ring, &span, 1))
+    {
+        return false;
+    }
+
+    vi_memory_copy_element(span, element, ring->element_size);
+    vi_spsc_ring_publish(ring, 1);
+    return true;
+}
+
+bool
+vi_spsc_ring_pop(vi_spsc_ring_t *ring, vi_ptr_t element)
+{
+    vi_u8_t *span;
+
+    if (!vi_spsc_ring_readable(ring, &span, 1))
+    {
+        return false;
+    }
+
+    vi_memory_copy_element(element, span, ring->element_size);
+    vi_spsc_ring_consume(ring, 1);
+    return true;
+}
+
+vi_usize_t
+vi_spsc_ring_push_n(vi_spsc_ring_t *ring, const vi_ptr_t elements, vi_usize_t count)
+{
+    const vi_u8_t *src = elements;
+    vi_usize_t total   = 0;
+    vi_u8_t *span;
+
+    // Свободное место может состоять из двух участков: до конца массива и от его начала.
+    for (vi_u32_t part = 0; part < 2 && total < count; ++part)
+    {
+        const vi_usize_t size = vi_spsc_ring_writable(ring, &span, count - total);
+
+        if (!size)
+        {
+            break;
+        }
+
+        vi_memory_copy_unsafe(span, src, size * ring->element_size);
+        src += size * ring->element_size;
+        total += size;
+
+        // Публикация после каждого участка нужна, чтобы следующий участок
+        // начинался с продвинутого индекса конца.
+        vi_spsc_ring_publish(ring, size);
+    }
+    return total;
+}
+
+vi_usize_t
+vi_spsc_ring_pop_n(vi_spsc_ring_t *ring, vi_ptr_t elements, vi_usize_t count)
+{
+    vi_u8_t *dst     = elements;
+    vi_usize_t total = 0;
+    vi_u8_t *span;
+
+    for (vi_u32_t part = 0; part < 2 && total < count; ++part)
+    {
+        const vi_usize_t size = vi_spsc_ring_readable(ring, &span, count - total);
+
+        if (!size)
+        {
+            break;
+        }
+
+        vi_memory_copy_unsafe(dst, span, size * ring->element_size);
+        dst += size * ring->element_size;
+        total += size;
+        vi_spsc_ring_consume(ring, size);
+    }
+    return total;
+}
+
+vi_usize_t
+vi_spsc_ring_size(const vi_spsc_ring_t *ring)
+{
+    if (!ring)
+    {
+        return 0;
+    }
+
+    const vi_usize_t head = atomic_load_explicit(&ring->head.value, memory_order_acquire);
+    const vi_usize_t tail = atomic_load_explicit(&ring->tail.value, memory_order_acquire);
+    return tail - head;
+}
+
+vi_usize_t
+vi_spsc_ring_capacity(const vi_spsc_ring_t *ring)
+{
+    return ring ? ring->capacity : 0;
+}
@@ -1 +1,649 @@
-#include <vi/str_raw.h>
\ No newline at end of file
+#include <vi/str_raw.h>
+/* Дополнительные модули */
+#include <vi/cpu.h>
+#include <vi/nullptr.h>
+#include <vi/bit_traits.h>
+#include <vi/ptr_traits.h>
+#include <vi/memory_word.h>
+#include <vi/memory_compare.h>
+
+#if VI_COMPILER_SIMD_SSE2
+#    include <emmintrin.h>
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_AVX2
+#    include <immintrin.h>
+#endif // VI_COMPILER_SIMD_AVX2
+
+/**
+ * @def VI_STR_RAW_PAGE_SIZE
+ * @brief Наименьший размер страницы памяти, в пределах которой допускается чтение блоком.
+ */
+#define VI_STR_RAW_PAGE_SIZE 4096
+
+/**
+ * @def vi_str_raw_block_is_readable
+ * @brief Проверяет, что блок из `size` байт по адресу `ptr` не пересекает границу страницы.
+ */
+#define vi_str_raw_block_is_readable(ptr, size)                                                    \
+    (vi_ptr_to_addr(ptr) % VI_STR_RAW_PAGE_SIZE <= VI_STR_RAW_PAGE_SIZE - (size))
+
+/**
+ * @brief Тип указателя на реализацию поиска символа или завершающего нуля.
+ */
+typedef const vi_u8_t *(*vi_str_raw_scan_fn_t)(const vi_u8_t *str, vi_u8_t ch, vi_usize_t max);
+
+/**
+ * @brief Тип указателя на реализацию сравнения строк.
+ */
+typedef vi_return_t (*vi_str_raw_compare_fn_t)(const vi_u8_t *lhs,
+                                               const vi_u8_t *rhs,
+                                               vi_usize_t size);
+
+#if !VI_COMPILER_SIMD_SSE2
+/**
+ * @brief Ищет символ `ch` или завершающий нуль машинными словами.
+ *
+ * Невыровненное начало проверяется побайтово, дальше строка читается выровненными
+ * словами `vi_memory_word_t`, которые не могут пересечь границу страницы.
+ *
+ * @return Указатель на первый символ, равный `ch` или нулю, но не дальше `str + max`.
+ */
+static const vi_u8_t *
+vi_str_raw_scan_word(const vi_u8_t *str, vi_u8_t ch, vi_usize_t max)
+{
+    const vi_u8_t *it = str;
+    vi_usize_t head   = vi_addr_diff(vi_ptr_align_up(it, nullptr, VI_MEMORY_WORD_SIZE), it);
+
+    for (head = head < max ? head : max; head; --head, ++it)
+    {
+        if (*it == ch || *it == 0)
+        {
+            return it;
+        }
+    }
+
+    const vi_u64_t pattern = vi_numeric_repeat64(ch);
+
+    for (; (vi_usize_t)(it - str) < max; it += VI_MEMORY_WORD_SIZE)
+    {
+        const vi_u64_t word = *(const vi_memory_word_t *)it;
+
+        if (vi_numeric_has_zero_byte64(word) || vi_numeric_has_zero_byte64(word ^ pattern))
+        {
+            break;
+        }
+    }
+
+    for (; (vi_usize_t)(it - str) < max; ++it)
+    {
+        if (*it == ch || *it == 0)
+        {
+            return it;
+        }
+    }
+    return str + max;
+}
+
+/**
+ * @brief Сравнивает строки машинными словами.
+ *
+ * Если строки одинаково выровнены, середина сравнивается выровненными словами
+ * до первого различия или нулевого байта, после чего сравнение продолжается побайтово.
+ */
+static vi_return_t
+vi_str_raw_compare_word(const vi_u8_t *lhs, const vi_u8_t *rhs, vi_usize_t size)
+{
+    if (vi_numeric_has_zero_remainder(vi_addr_diff(lhs, rhs), VI_MEMORY_WORD_SIZE))
+    {
+        for (; size && !vi_ptr_is_aligned(lhs, VI_MEMORY_WORD_SIZE); --size, ++lhs, ++rhs)
+        {
+            if (*lhs != *rhs || *lhs == 0)
+            {
+                return (vi_return_t)*lhs - (vi_return_t)*rhs;
+            }
+        }
+
+        for (; size >= VI_MEMORY_WORD_SIZE; size -= VI_MEMORY_WORD_SIZE)
+        {
+            const vi_u64_t lhs_word = *(const vi_memory_word_t *)lhs;
+            const vi_u64_t rhs_word = *(const vi_memory_word_t *)rhs;
+
+            if (lhs_word != rhs_word || vi_numeric_has_zero_byte64(lhs_word))
+            {
+                break;
+            }
+
+            lhs += VI_MEMORY_WORD_SIZE;
+            rhs += VI_MEMORY_WORD_SIZE;
+        }
+    }
+
+    for (; size; --size, ++lhs, ++rhs)
+    {
+        if (*lhs != *rhs || *lhs == 0)
+        {
+            return (vi_return_t)*lhs - (vi_return_t)*rhs;
+        }
+    }
+    return 0;
+}
+#endif // !VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_SSE2
+/**
+ * @brief Возвращает маску байтов 16-байтного блока, равных нулю или `pattern`.
+ *
+ * Байт `x ^ pattern` равен нулю при совпадении с `pattern`, поэтому минимум
+ * из него и `x` равен нулю ровно для искомых байтов.
+ */
+#    define vi_str_raw_mask_sse2(block, pattern)                                                   \
+        ((vi_u32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(                                               \
+            _mm_min_epu8(_mm_xor_si128(block, pattern), block), _mm_setzero_si128())))
+
+/**
+ * @brief Ищет символ `ch` или завершающий нуль регистрами SSE2.
+ *
+ * Первый блок читается с выровненного вниз адреса, а байты перед `str` отбрасываются
+ * сдвигом маски. Все чтения выровнены по 16 байт и не пересекают границу страницы.
+ *
+ * @return Указатель на первый символ, равный `ch` или нулю, но не дальше `str + max`.
+ */
+static const vi_u8_t *
+vi_str_raw_scan_sse2(const vi_u8_t *str, vi_u8_t ch, vi_usize_t max)
+{
+    const __m128i pattern = _mm_set1_epi8((char)ch);
+    const vi_usize_t skip = vi_ptr_to_addr(str) % sizeof(__m128i);
+    const __m128i *it     = (const __m128i *)(str - skip);
+
+    __m128i block   = _mm_load_si128(it);
+    vi_u32_t mask   = vi_str_raw_mask_sse2(block, pattern);
+    vi_usize_t done = 0;
+    vi_usize_t next = sizeof(__m128i) - skip;
+
+    for (mask >>= skip; !mask; next += sizeof(__m128i))
+    {
+        if (next >= max)
+        {
+            return str + max;
+        }
+
+        done  = next;
+        block = _mm_load_si128(++it);
+        mask  = vi_str_raw_mask_sse2(block, pattern);
+    }
+
+    done += vi_bit_ctz32(mask);
+    return str + (done < max ? done : max);
+}
+
+/**
+ * @brief Сравнивает строки регистрами SSE2.
+ *
+ * Блоки по 16 байт читаются невыровненно, если ни один из них не пересекает
+ * границу страницы. Иначе выполняется шаг на один символ, после которого проверка
+ * повторяется, поэтому побайтово обрабатываются не более 15 символов у каждой границы.
+ */
+static vi_return_t
+vi_str_raw_compare_sse2(const vi_u8_t *lhs, const vi_u8_t *rhs, vi_usize_t size)
+{
+    const __m128i zero = _mm_setzero_si128();
+
+    while (size)
+    {
+        if (size >= sizeof(__m128i) && vi_str_raw_block_is_readable(lhs, sizeof(__m128i)) &&
+            vi_str_raw_block_is_readable(rhs, sizeof(__m128i)))
+        {
+            const __m128i l     = _mm_loadu_si128((const __m128i *)lhs);
+            const __m128i r     = _mm_loadu_si128((const __m128i *)rhs);
+            const vi_u32_t diff = (vi_u32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(l, r)) ^ 0xFFFF;
+            const vi_u32_t nul  = (vi_u32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(l, zero));
+
+            if (diff | nul)
+            {
+                const vi_u32_t index = vi_bit_ctz32(diff | nul);
+                return (vi_return_t)lhs[index] - (vi_return_t)rhs[index];
+            }
+
+            lhs += sizeof(__m128i);
+            rhs += sizeof(__m128i);
+            size -= sizeof(__m128i);
+            continue;
+        }
+
+        if (*lhs != *rhs || *lhs == 0)
+        {
+            return (vi_return_t)*lhs - (vi_return_t)*rhs;
+        }
+
+        ++lhs;
+        ++rhs;
+        --size;
+    }
+    return 0;
+}
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_AVX2
+/**
+ * @brief Возвращает маску байтов 32-байтного блока, равных нулю или `pattern`.
+ */
+#    define vi_str_raw_mask_avx2(block, pattern)                                                   \
+        ((vi_u32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(                                         \
+            _mm256_min_epu8(_mm256_xor_si256(block, pattern), block), _mm256_setzero_si256())))
+
+/**
+ * @brief Ищет символ `ch` или завершающий нуль регистрами AVX2.
+ *
+ * Аналогична `vi_str_raw_scan_sse2`, но читает выровненные блоки по 32 байта.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static const vi_u8_t *
+vi_str_raw_scan_avx2(const vi_u8_t *str, vi_u8_t ch, vi_usize_t max)
+{
+    const __m256i pattern = _mm256_set1_epi8((char)ch);
+    const vi_usize_t skip = vi_ptr_to_addr(str) % sizeof(__m256i);
+    const __m256i *it     = (const __m256i *)(str - skip);
+
+    __m256i block   = _mm256_load_si256(it);
+    vi_u32_t mask   = vi_str_raw_mask_avx2(block, pattern);
+    vi_usize_t done = 0;
+    vi_usize_t next = sizeof(__m256i) - skip;
+
+    for (mask >>= skip; !mask; next += sizeof(__m256i))
+    {
+        if (next >= max)
+        {
+            return str + max;
+        }
+
+        done  = next;
+        block = _mm256_load_si256(++it);
+        mask  = vi_str_raw_mask_avx2(block, pattern);
+    }
+
+    done += vi_bit_ctz32(mask);
+    return str + (done < max ? done : max);
+}
+
+/**
+ * @brief Сравнивает строки регистрами AVX2.
+ *
+ * Аналогична `vi_str_raw_compare_sse2`, но читает блоки по 32 байта.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static vi_return_t
+vi_str_raw_compare_avx2(const vi_u8_t *lhs, const vi_u8_t *rhs, vi_usize_t size)
+{
+    const __m256i zero = _mm256_setzero_si256();
+
+    while (size)
+    {
+        if (size >= sizeof(__m256i) && vi_str_raw_block_is_readable(lhs, sizeof(__m256i)) &&
+            vi_str_raw_block_is_readable(rhs, sizeof(__m256i)))
+        {
+            const __m256i l     = _mm256_loadu_si256((const __m256i *)lhs);
+            const __m256i r     = _mm256_loadu_si256((const __m256i *)rhs);
+            const vi_u32_t diff = ~(vi_u32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(l, r));
+            const vi_u32_t nul  = (vi_u32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(l, zero));
+
+            if (diff | nul)
+            {
+                const vi_u32_t index = vi_bit_ctz32(diff | nul);
+                return (vi_return_t)lhs[index] - (vi_return_t)rhs[index];
+            }
+
+            lhs += sizeof(__m256i);
+            rhs += sizeof(__m256i);
+            size -= sizeof(__m256i);
+            continue;
+        }
+
+        if (*lhs != *rhs || *lhs == 0)
+        {
+            return (vi_return_t)*lhs - (vi_return_t)*rhs;
+        }
+
+        ++lhs;
+        ++rhs;
+        --size;
+    }
+    return 0;
+}
+#endif // VI_COMPILER_SIMD_AVX2
+
+/**
+ * @brief Реализации, выбираемые при загрузке библиотеки.
+ */
+#if VI_COMPILER_SIMD_SSE2
+static vi_str_raw_scan_fn_t vi_str_raw_scan              = vi_str_raw_scan_sse2;
+static vi_str_raw_compare_fn_t vi_str_raw_compare_vector = vi_str_raw_compare_sse2;
+#else
+static vi_str_raw_scan_fn_t vi_str_raw_scan              = vi_str_raw_scan_word;
+static vi_str_raw_compare_fn_t vi_str_raw_compare_vector = vi_str_raw_compare_word;
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_AVX2
+vi_compiler_constructor(vi_str_raw_init)
+{
+    if (vi_cpu_has(VI_CPU_FEATURE_AVX2))
+    {
+        vi_str_raw_scan           = vi_str_raw_scan_avx2;
+        vi_str_raw_compare_vector = vi_str_raw_compare_avx2;
+    }
+}
+#endif // VI_COMPILER_SIMD_AVX2
+
+/**
+ * @brief Ищет подстроку в участке памяти алгоритмом Two-Way.
+ *
+ * Реализация следует алгоритму Крошмора—Перрена: подстрока разбивается по критической
+ * позиции на две части, правая часть сравнивается слева направо, левая — справа налево,
+ * а известный период подстроки позволяет не сравнивать повторно уже совпавшие символы.
+ * Дополнительно последний символ окна проверяется по таблице сдвигов, что позволяет
+ * пропускать участки, не содержащие символов подстроки.
+ *
+ * @param it Указатель на начало участка, в котором выполняется поиск.
+ * @param end Указатель на конец участка.
+ * @param substr Указатель на подстроку.
+ * @param size Длина подстроки, не меньше 2.
+ *
+ * @return Указатель на найденное вхождение или `nullptr`.
+ */
+static const vi_u8_t *
+vi_str_raw_find_two_way(const vi_u8_t *it,
+                        const vi_u8_t *end,
+                        const vi_u8_t *substr,
+                        vi_usize_t size)
+{
+    vi_u64_t byteset[4] = {0};
+    vi_usize_t shift[256];
+    vi_usize_t i, ip, jp, k, p, ms, p0, mem, mem0;
+
+    // Таблица символов подстроки и сдвигов по последнему символу окна.
+    for (i = 0; i < size; ++i)
+    {
+        vi_bit_set_by_index(byteset[substr[i] >> 6], substr[i] & 63);
+        shift[substr[i]] = i + 1;
+    }
+
+    // Максимальный суффикс для прямого порядка символов.
+    ip = (vi_usize_t)-1;
+    jp = 0;
+    k = p = 1;
+
+    while (jp + k < size)
+    {
+        if (substr[ip + k] == substr[jp + k])
+        {
+            if (k == p)
+            {
+                jp += p;
+                k = 1;
+            }
+            else
+            {
+                ++k;
+            }
+        }
+        else if (substr[ip + k] > substr[jp + k])
+        {
+            jp += k;
+            k = 1;
+            p = jp - ip;
+        }
+        else
+        {
+            ip = jp++;
+            k = p = 1;
+        }
+    }
+
+    ms = ip;
+    p0 = p;
+
+    // Максимальный суффикс для обратного порядка символов.
+    ip = (vi_usize_t)-1;
+    jp = 0;
+    k = p = 1;
+
+    while (jp + k < size)
+    {
+        if (substr[ip + k] == substr[jp + k])
+        {
+            if (k == p)
+            {
+                jp += p;
+                k = 1;
+            }
+            else
+            {
+                ++k;
+            }
+        }
+        else if (substr[ip + k] < substr[jp + k])
+        {
+            jp += k;
+            k = 1;
+            p = jp - ip;
+        }
+        else
+        {
+            ip = jp++;
+            k = p = 1;
+        }
+    }
+
+    if (ip + 1 > ms + 1)
+    {
+        ms = ip;
+    }
+    else
+    {
+        p = p0;
+    }
+
+    // Для непериодической подстроки память о совпавшем префиксе не используется.
+    if (vi_memory_compare_unsafe(substr, substr + p, ms + 1))
+    {
+        mem0 = 0;
+        p    = (ms > size - ms - 1 ? ms : size - ms - 1) + 1;
+    }
+    else
+    {
+        mem0 = size - p;
+    }
+
+    mem = 0;
+
+    while ((vi_usize_t)(end - it) >= size)
+    {
+        const vi_u8_t last = it[size - 1];
+
+        if (!vi_bit_check_by_index(byteset[last >> 6], last & 63))
+        {
+            it += size;
+            mem = 0;
+            continue;
+        }
+
+        k = size - shift[last];
+
+        if (k)
+        {
+            it += k < mem ? mem : k;
+            mem = 0;
+            continue;
+        }
+
+        // Сравнение правой части.
+        for (k = ms + 1 > mem ? ms + 1 : mem; k < size && substr[k] == it[k]; ++k)
+        {
+        }
+
+        if (k < size)
+        {
+            it += k - ms;
+            mem = 0;
+            continue;
+        }
+
+        // Сравнение левой части.
+        for (k = ms + 1; k > mem && substr[k - 1] == it[k - 1]; --k)
+        {
+        }
+
+        if (k <= mem)
+        {
+            return it;
+        }
+
+        it += p;
+        mem = mem0;
+    }
+    return nullptr;
+}
+
+vi_usize_t
+vi_str_raw_length(const vi_str_raw_t str)
+{
+    if (!str)
+    {
+        return 0;
+    }
+
+    const vi_u8_t *const begin = (const vi_u8_t *)str;
+    return vi_addr_diff(vi_str_raw_scan(begin, 0, VI_USIZE_T_MAX), begin);
+}
+
+vi_usize_t
+vi_str_raw_length_n(const vi_str_raw_t str, vi_usize_t max)
+{
+    if (!str)
+    {
+        return 0;
+    }
+
+    const vi_u8_t *const begin = (const vi_u8_t *)str;
+    return vi_addr_diff(vi_str_raw_scan(begin, 0, max), begin);
+}
+
+vi_return_t
+vi_str_raw_compare(const vi_str_raw_t lhs, const vi_str_raw_t rhs)
+{
+    return vi_str_raw_compare_n(lhs, rhs, VI_USIZE_T_MAX);
+}
+
+vi_return_t
+vi_str_raw_compare_n(const vi_str_raw_t lhs, const vi_str_raw_t rhs, vi_usize_t size)
+{
+    if (lhs == rhs)
+    {
+        return 0;
+    }
+
+    if (!lhs || !rhs)
+    {
+        return lhs ? 1 : -1;
+    }
+    return vi_str_raw_compare_vector((const vi_u8_t *)lhs, (const vi_u8_t *)rhs, size);
+}
+
+vi_str_raw_t
+vi_str_raw_find_char(const vi_str_raw_t str, vi_char_t ch)
+{
+    if (!str)
+    {
+        return nullptr;
+    }
+
+    const vi_u8_t *const it = vi_str_raw_scan((const vi_u8_t *)str, (vi_u8_t)ch, VI_USIZE_T_MAX);
+    return *it == (vi_u8_t)ch ? (vi_str_raw_t)it : nullptr;
+}
+
+vi_str_raw_t
+vi_str_raw_find(const vi_str_raw_t str, const vi_str_raw_t substr)
+{
+    if (!str || !substr)
+    {
+        return nullptr;
+    }
+
+    if (!substr[0])
+    {
+        return (vi_str_raw_t)str;
+    }
+
+    // Пропускаем начало строки до первого вхождения первого символа подстроки.
+    const vi_u8_t *const it = (const vi_u8_t *)vi_str_raw_find_char(str, substr[0]);
+
+    if (!it || !substr[1])
+    {
+        return (vi_str_raw_t)it;
+    }
+
+    const vi_usize_t size = vi_str_raw_length(substr);
+    const vi_u8_t *end    = vi_str_raw_scan(it, 0, VI_USIZE_T_MAX);
+
+    return (vi_str_raw_t)vi_str_raw_find_two_way(it, end, (const vi_u8_t *)substr, size);
+}
+
+vi_usize_t
+vi_str_raw_span(const vi_str_raw_t str, const vi_str_raw_t accept)
+{
+    if (!str || !accept || !accept[0])
+    {
+        return 0;
+    }
+
+    const vi_u8_t *it = (const vi_u8_t *)str;
+
+    if (!accept[1])
+    {
+        for (; *it == (vi_u8_t)accept[0]; ++it)
+        {
+        }
+        return vi_addr_diff(it, str);
+    }
+
+    vi_u64_t set[4] = {0};
+
+    for (const vi_u8_t *a = (const vi_u8_t *)accept; *a; ++a)
+    {
+        vi_bit_set_by_index(set[*a >> 6], *a & 63);
+    }
+
+    for (; vi_bit_check_by_index(set[*it >> 6], *it & 63); ++it)
+    {
+    }
+    return vi_addr_diff(it, str);
+}
+
+vi_usize_t
+vi_str_raw_cspan(const vi_str_raw_t str, const vi_str_raw_t reject)
+{
+    if (!str)
+    {
+        return 0;
+    }
+
+    const vi_u8_t *it = (const vi_u8_t *)str;
+
+    if (!reject || !reject[0] || !reject[1])
+    {
+        const vi_u8_t ch = reject ? (vi_u8_t)reject[0] : 0;
+        return vi_addr_diff(vi_str_raw_scan(it, ch, VI_USIZE_T_MAX), it);
+    }
+
+    vi_u64_t set[4] = {1};
+
+    for (const vi_u8_t *r = (const vi_u8_t *)reject; *r; ++r)
+    {
+        vi_bit_set_by_index(set[*r >> 6], *r & 63);
+    }
+
+    for (; !vi_bit_check_by_index(set[*it >> 6], *it & 63); ++it)
+    {
+    }
+    return vi_addr_diff(it, str);
+}
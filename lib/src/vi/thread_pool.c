@@ -0,0 +1,979 @@
+#include <vi/thread_pool.h>
+/* Дополнительные модули */
+#include <vi/cpu.h>
+#include <vi/nullptr.h>
+#include <vi/mpmc_queue.h>
+#include <vi/runtime_allocator.h>
+
+#include <stdatomic.h>
+
+#if !defined(__STDC_NO_THREADS__)
+#    include <threads.h>
+#endif // !defined(__STDC_NO_THREADS__)
+
+#if VI_COMPILER_SIMD_SSE2
+#    include <emmintrin.h>
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if !defined(__STDC_NO_THREADS__)
+
+#ifndef VI_THREAD_POOL_DEQUE_CAPACITY
+/**
+ * @def VI_THREAD_POOL_DEQUE_CAPACITY
+ * @brief Емкость дека каждого рабочего потока; степень двойки.
+ */
+#    define VI_THREAD_POOL_DEQUE_CAPACITY 1024
+#endif // VI_THREAD_POOL_DEQUE_CAPACITY
+
+#ifndef VI_THREAD_POOL_QUEUE_CAPACITY
+/**
+ * @def VI_THREAD_POOL_QUEUE_CAPACITY
+ * @brief Емкость общей очереди задач, добавленных вне рабочих потоков; степень двойки.
+ */
+#    define VI_THREAD_POOL_QUEUE_CAPACITY 4096
+#endif // VI_THREAD_POOL_QUEUE_CAPACITY
+
+/**
+ * @def VI_THREAD_POOL_CACHE_LINE_SIZE
+ * @brief Размер строки кэша, по которому разделяются изменяемые разными потоками поля.
+ */
+#define VI_THREAD_POOL_CACHE_LINE_SIZE 64
+
+/**
+ * @def VI_THREAD_POOL_SPIN_LIMIT
+ * @brief Количество неудачных поисков задачи, после которых рабочий поток засыпает.
+ *
+ * Пауза между поисками удваивается с каждой попыткой, как в `vi_mpmc_queue_t`;
+ * первые попытки избавляют от пробуждения потока, если задачи идут плотным потоком.
+ */
+#define VI_THREAD_POOL_SPIN_LIMIT 8
+
+/**
+ * @def VI_THREAD_POOL_GRAIN_PARTS
+ * @brief Количество частей на рабочий поток, на которое делится диапазон при `grain`, равном 0.
+ */
+#define VI_THREAD_POOL_GRAIN_PARTS 8
+
+/**
+ * @brief Параллельный цикл; размещается в стеке вызвавшего его потока.
+ */
+typedef struct vi_thread_pool_loop_t
+{
+    vi_thread_pool_range_fn_t fn;
+    vi_ptr_t arg;
+    vi_usize_t grain;
+
+    /**
+     * @brief Количество еще не обработанных индексов.
+     */
+    _Atomic(vi_usize_t) remaining;
+} vi_thread_pool_loop_t;
+
+/**
+ * @brief Задача: функция с аргументом или часть диапазона параллельного цикла.
+ */
+typedef struct vi_thread_pool_task_t
+{
+    vi_thread_pool_task_fn_t fn;
+    vi_ptr_t arg;
+
+    /**
+     * @brief Цикл, к которому относится часть `[begin, end)`, или `nullptr`.
+     */
+    vi_thread_pool_loop_t *loop;
+    vi_usize_t begin;
+    vi_usize_t end;
+} vi_thread_pool_task_t;
+
+/**
+ * @brief Ячейка дека.
+ *
+ * Поток, перехватывающий задачу, читает ячейку одновременно с тем, как владелец
+ * может ее перезаписывать; прочитанное значение используется, только если затем
+ * удалось занять позицию. Поэтому поля атомарны и читаются без упорядочения.
+ */
+typedef struct vi_thread_pool_slot_t
+{
+    _Atomic(vi_thread_pool_task_fn_t) fn;
+    _Atomic(vi_ptr_t) arg;
+    _Atomic(vi_thread_pool_loop_t *) loop;
+    _Atomic(vi_usize_t) begin;
+    _Atomic(vi_usize_t) end;
+} vi_thread_pool_slot_t;
+
+/**
+ * @brief Позиция дека, занимающая отдельную строку кэша.
+ */
+typedef union vi_thread_pool_index_t
+{
+    _Atomic(vi_ssize_t) value;
+    vi_u8_t padding[VI_THREAD_POOL_CACHE_LINE_SIZE];
+} vi_thread_pool_index_t;
+
+/**
+ * @brief Счетчик пула, занимающий отдельную строку кэша.
+ */
+typedef union vi_thread_pool_counter_t
+{
+    _Atomic(vi_usize_t) value;
+    vi_u8_t padding[VI_THREAD_POOL_CACHE_LINE_SIZE];
+} vi_thread_pool_counter_t;
+
+/**
+ * @brief Рабочий поток и его дек.
+ *
+ * Размер структуры кратен строке кэша, поэтому в массиве рабочих потоков,
+ * выровненном по строке кэша, позиции деков разных потоков не делят строки.
+ */
+typedef struct vi_thread_pool_worker_t
+{
+    /**
+     * @brief Позиция, с которой задачи перехватываются другими потоками.
+     */
+    vi_thread_pool_index_t top;
+
+    /**
+     * @brief Позиция, с которой владелец добавляет и забирает задачи.
+     */
+    vi_thread_pool_index_t bottom;
+
+    union
+    {
+        struct
+        {
+            struct vi_thread_pool_t *pool;
+            vi_thread_pool_slot_t *slots;
+            vi_usize_t index;
+
+            /**
+             * @brief Состояние генератора, выбирающего поток для перехвата.
+             */
+            vi_u64_t random;
+            thrd_t thread;
+        };
+        vi_u8_t padding[VI_THREAD_POOL_CACHE_LINE_SIZE];
+    };
+} vi_thread_pool_worker_t;
+
+struct vi_thread_pool_t
+{
+    /**
+     * @brief Количество добавленных и еще не выполненных задач.
+     */
+    vi_thread_pool_counter_t pending;
+
+    /**
+     * @brief Номер поколения задач; увеличивается при каждом добавлении задачи.
+     *
+     * Поток, не нашедший задач, засыпает, только если поколение не изменилось
+     * с начала поиска, поэтому задача, добавленная во время поиска, не теряется.
+     */
+    vi_thread_pool_counter_t epoch;
+
+    /**
+     * @brief Количество спящих рабочих потоков.
+     */
+    _Atomic(vi_usize_t) sleepers;
+
+    /**
+     * @brief Не равно 0, когда рабочие потоки должны завершиться.
+     */
+    _Atomic(vi_u32_t) stopping;
+
+    mtx_t lock;
+
+    /**
+     * @brief Условие, на котором спят рабочие потоки без задач.
+     */
+    cnd_t wake;
+
+    /**
+     * @brief Условие, на котором `vi_thread_pool_wait` ждет завершения задач.
+     */
+    cnd_t idle;
+
+    const vi_allocator_t *backing;
+    vi_mpmc_queue_t *queue;
+    vi_thread_pool_worker_t *workers;
+    vi_usize_t worker_count;
+};
+
+/**
+ * @brief Рабочий поток, выполняющийся в текущем потоке, или `nullptr`.
+ */
+static VI_ATTRIBUTE(THREAD_LOCAL) vi_thread_pool_worker_t *vi_thread_pool_current = nullptr;
+
+/**
+ * @brief Возвращает рабочий поток пула `pool`, выполняющийся в текущем потоке, или `nullptr`.
+ */
+static vi_thread_pool_worker_t *
+vi_thread_pool_self(const vi_thread_pool_t *pool)
+{
+#ifdef VI_OPTION_THREAD_LOCAL_VARIABLES
+    vi_thread_pool_worker_t *const worker = vi_thread_pool_current;
+    return worker && worker->pool == pool ? worker : nullptr;
+#else
+    // Без переменных потока указатель общий для всех потоков,
+    // поэтому рабочий поток ищется по идентификатору.
+    const thrd_t current = thrd_current();
+
+    for (vi_usize_t i = 0; i < pool->worker_count; ++i)
+    {
+        if (thrd_equal(pool->workers[i].thread, current))
+        {
+            return &pool->workers[i];
+        }
+    }
+    return nullptr;
+#endif // VI_OPTION_THREAD_LOCAL_VARIABLES
+}
+
+/**
+ * @brief Ждет перед повторным поиском задачи: сначала паузой процессора, удваивая ее
+ *        с каждой попыткой, а затем уступая процессор другим потокам.
+ */
+static void
+vi_thread_pool_backoff(vi_u32_t *attempt)
+{
+    if (*attempt < VI_THREAD_POOL_SPIN_LIMIT)
+    {
+        for (vi_u32_t i = 0; i < (1U << *attempt); ++i)
+        {
+#if VI_COMPILER_SIMD_SSE2
+            _mm_pause();
+#endif // VI_COMPILER_SIMD_SSE2
+        }
+
+        ++*attempt;
+        return;
+    }
+    thrd_yield();
+}
+
+/**
+ * @brief Будит один спящий рабочий поток после добавления задачи.
+ */
+static void
+vi_thread_pool_notify(vi_thread_pool_t *pool)
+{
+    atomic_fetch_add(&pool->epoch.value, 1);
+
+    if (atomic_load(&pool->sleepers))
+    {
+        mtx_lock(&pool->lock);
+        cnd_signal(&pool->wake);
+        mtx_unlock(&pool->lock);
+    }
+}
+
+/**
+ * @brief Возвращает количество задач в деке; вызывается владельцем дека.
+ */
+static inline vi_ssize_t
+vi_thread_pool_deque_size(vi_thread_pool_worker_t *worker)
+{
+    return atomic_load_explicit(&worker->bottom.value, memory_order_relaxed) -
+           atomic_load_explicit(&worker->top.value, memory_order_relaxed);
+}
+
+/**
+ * @brief Добавляет задачу в нижний конец дека; вызывается владельцем дека.
+ *
+ * @return `true` при успехе или `false`, если дек заполнен.
+ */
+static bool
+vi_thread_pool_deque_push(vi_thread_pool_worker_t *worker, const vi_thread_pool_task_t *task)
+{
+    const vi_ssize_t bottom = atomic_load_explicit(&worker->bottom.value, memory_order_relaxed);
+    const vi_ssize_t top    = atomic_load_explicit(&worker->top.value, memory_order_acquire);
+
+    if (bottom - top >= VI_THREAD_POOL_DEQUE_CAPACITY)
+    {
+        return false;
+    }
+
+    vi_thread_pool_slot_t *const slot =
+        &worker->slots[bottom & (VI_THREAD_POOL_DEQUE_CAPACITY - 1)];
+
+    atomic_store_explicit(&slot->fn, task->fn, memory_order_relaxed);
+    atomic_store_explicit(&slot->arg, task->arg, memory_order_relaxed);
+    atomic_store_explicit(&slot->loop, task->loop, memory_order_relaxed);
+    atomic_store_explicit(&slot->begin, task->begin, memory_order_relaxed);
+    atomic_store_explicit(&slot->end, task->end, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&worker->bottom.value, bottom + 1, memory_order_relaxed);
+    return true;
+}
+
+/**
+ * @brief Читает задачу из ячейки дека.
+ */
+static inline void
+vi_thread_pool_slot_load(vi_thread_pool_slot_t *slot, vi_thread_pool_task_t *task)
+{
+    task->fn    = atomic_load_explicit(&slot->fn, memory_order_relaxed);
+    task->arg   = atomic_load_explicit(&slot->arg, memory_order_relaxed);
+    task->loop  = atomic_load_explicit(&slot->loop, memory_order_relaxed);
+    task->begin = atomic_load_explicit(&slot->begin, memory_order_relaxed);
+    task->end   = atomic_load_explicit(&slot->end, memory_order_relaxed);
+}
+
+/**
+ * @brief Забирает задачу из нижнего конца дека; вызывается владельцем дека.
+ *
+ * @return `true`, если задача получена, или `false`, если дек пуст.
+ */
+static bool
+vi_thread_pool_deque_pop(vi_thread_pool_worker_t *worker, vi_thread_pool_task_t *task)
+{
+    const vi_ssize_t bottom =
+        atomic_load_explicit(&worker->bottom.value, memory_order_relaxed) - 1;
+
+    atomic_store_explicit(&worker->bottom.value, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    vi_ssize_t top = atomic_load_explicit(&worker->top.value, memory_order_relaxed);
+
+    if (top > bottom)
+    {
+        atomic_store_explicit(&worker->bottom.value, bottom + 1, memory_order_relaxed);
+        return false;
+    }
+
+    vi_thread_pool_slot_load(&worker->slots[bottom & (VI_THREAD_POOL_DEQUE_CAPACITY - 1)], task);
+
+    if (top < bottom)
+    {
+        return true;
+    }
+
+    // Последняя задача: владелец соревнуется за нее с перехватывающими потоками.
+    const bool taken = atomic_compare_exchange_strong_explicit(
+        &worker->top.value, &top, top + 1, memory_order_seq_cst, memory_order_relaxed);
+
+    atomic_store_explicit(&worker->bottom.value, bottom + 1, memory_order_relaxed);
+    return taken;
+}
+
+/**
+ * @brief Перехватывает задачу из верхнего конца дека другого потока.
+ *
+ * @return `true`, если задача получена, или `false`, если дек пуст
+ *         или задачу одновременно забрал другой поток.
+ */
+static bool
+vi_thread_pool_deque_steal(vi_thread_pool_worker_t *victim, vi_thread_pool_task_t *task)
+{
+    vi_ssize_t top = atomic_load_explicit(&victim->top.value, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    const vi_ssize_t bottom = atomic_load_explicit(&victim->bottom.value, memory_order_acquire);
+
+    if (top >= bottom)
+    {
+        return false;
+    }
+
+    vi_thread_pool_slot_load(&victim->slots[top & (VI_THREAD_POOL_DEQUE_CAPACITY - 1)], task);
+
+    return atomic_compare_exchange_strong_explicit(
+        &victim->top.value, &top, top + 1, memory_order_seq_cst, memory_order_relaxed);
+}
+
+/**
+ * @brief Ищет задачу: в собственном деке, затем в деках других потоков, начиная
+ *        со случайного, затем в общей очереди.
+ *
+ * @param worker Рабочий поток, выполняющий поиск, или `nullptr` для потока вне пула.
+ */
+static bool
+vi_thread_pool_find(vi_thread_pool_t *pool,
+                    vi_thread_pool_worker_t *worker,
+                    vi_thread_pool_task_t *task)
+{
+    vi_usize_t start = 0;
+
+    if (worker)
+    {
+        if (vi_thread_pool_deque_pop(worker, task))
+        {
+            return true;
+        }
+
+        // xorshift64: выбор случайного первого потока распределяет перехваты
+        // равномерно и не дает всем потокам грабить один и тот же дек.
+        worker->random ^= worker->random << 13;
+        worker->random ^= worker->random >> 7;
+        worker->random ^= worker->random << 17;
+        start = (vi_usize_t)(worker->random % pool->worker_count);
+    }
+
+    for (vi_usize_t i = 0; i < pool->worker_count; ++i)
+    {
+        vi_usize_t index = start + i;
+        index            = index < pool->worker_count ? index : index - pool->worker_count;
+
+        if (&pool->workers[index] != worker &&
+            vi_thread_pool_deque_steal(&pool->workers[index], task))
+        {
+            return true;
+        }
+    }
+    return vi_mpmc_queue_try_pop(pool->queue, task);
+}
+
+/**
+ * @brief Возвращает `true`, если часть диапазона стоит отделить для других потоков.
+ *
+ * Часть отделяется, только когда прежние отделенные части уже забраны:
+ * дек рабочего потока или общая очередь для потока вне пула пусты.
+ */
+static inline bool
+vi_thread_pool_should_split(vi_thread_pool_t *pool, vi_thread_pool_worker_t *worker)
+{
+    return worker ? vi_thread_pool_deque_size(worker) <= 0 : vi_mpmc_queue_size(pool->queue) == 0;
+}
+
+/**
+ * @brief Добавляет задачу в дек рабочего потока или в общую очередь без ожидания.
+ *
+ * @return `true` при успехе или `false`, если места нет.
+ */
+static bool
+vi_thread_pool_try_push(vi_thread_pool_t *pool,
+                        vi_thread_pool_worker_t *worker,
+                        const vi_thread_pool_task_t *task)
+{
+    atomic_fetch_add(&pool->pending.value, 1);
+
+    if (worker ? vi_thread_pool_deque_push(worker, task)
+               : vi_mpmc_queue_try_push(pool->queue, (const vi_ptr_t)task))
+    {
+        vi_thread_pool_notify(pool);
+        return true;
+    }
+
+    atomic_fetch_sub(&pool->pending.value, 1);
+    return false;
+}
+
+/**
+ * @brief Обрабатывает часть `[begin, end)` параллельного цикла.
+ *
+ * Часть обрабатывается кусками по `grain` индексов; перед каждым куском
+ * вторая половина оставшейся части отделяется для других потоков, если
+ * `vi_thread_pool_should_split` считает, что они простаивают.
+ */
+static void
+vi_thread_pool_run_range(vi_thread_pool_t *pool,
+                         vi_thread_pool_worker_t *worker,
+                         vi_thread_pool_loop_t *loop,
+                         vi_usize_t begin,
+                         vi_usize_t end)
+{
+    vi_usize_t done = 0;
+
+    while (begin < end)
+    {
+        while (end - begin > loop->grain && vi_thread_pool_should_split(pool, worker))
+        {
+            const vi_usize_t middle = begin + (end - begin) / 2;
+            vi_thread_pool_task_t task;
+
+            task.fn    = nullptr;
+            task.arg   = nullptr;
+            task.loop  = loop;
+            task.begin = middle;
+            task.end   = end;
+
+            if (!vi_thread_pool_try_push(pool, worker, &task))
+            {
+                break;
+            }
+            end = middle;
+        }
+
+        const vi_usize_t step = end - begin < loop->grain ? end - begin : loop->grain;
+
+        loop->fn(loop->arg, begin, begin + step);
+        begin += step;
+        done += step;
+    }
+
+    // Отделенные части вычитают свои индексы сами. Это последнее обращение к циклу:
+    // после обнуления счетчика вызвавший цикл поток освобождает его.
+    atomic_fetch_sub(&loop->remaining, done);
+}
+
+/**
+ * @brief Выполняет задачу и отмечает ее завершение.
+ */
+static void
+vi_thread_pool_run(vi_thread_pool_t *pool,
+                   vi_thread_pool_worker_t *worker,
+                   const vi_thread_pool_task_t *task)
+{
+    if (task->loop)
+    {
+        vi_thread_pool_run_range(pool, worker, task->loop, task->begin, task->end);
+    }
+    else
+    {
+        task->fn(task->arg);
+    }
+
+    if (atomic_fetch_sub(&pool->pending.value, 1) == 1)
+    {
+        mtx_lock(&pool->lock);
+        cnd_broadcast(&pool->idle);
+        mtx_unlock(&pool->lock);
+    }
+}
+
+/**
+ * @brief Цикл рабочего потока: выполняет задачи, пока пул не будет остановлен.
+ */
+static int
+vi_thread_pool_worker_main(vi_ptr_t arg)
+{
+    vi_thread_pool_worker_t *const worker = arg;
+    vi_thread_pool_t *const pool          = worker->pool;
+    vi_thread_pool_task_t task;
+    vi_u32_t attempt = 0;
+
+    vi_thread_pool_current = worker;
+
+    // Создающий поток держит блокировку, пока не запустит все потоки и не запишет
+    // их идентификаторы, которые нужны `vi_thread_pool_self` без переменных потока.
+    mtx_lock(&pool->lock);
+    mtx_unlock(&pool->lock);
+
+    for (;;)
+    {
+        const vi_usize_t epoch = atomic_load(&pool->epoch.value);
+
+        if (vi_thread_pool_find(pool, worker, &task))
+        {
+            vi_thread_pool_run(pool, worker, &task);
+            attempt = 0;
+            continue;
+        }
+
+        if (atomic_load(&pool->stopping))
+        {
+            break;
+        }
+
+        if (attempt < VI_THREAD_POOL_SPIN_LIMIT)
+        {
+            vi_thread_pool_backoff(&attempt);
+            continue;
+        }
+
+        mtx_lock(&pool->lock);
+        atomic_fetch_add(&pool->sleepers, 1);
+
+        while (atomic_load(&pool->epoch.value) == epoch && !atomic_load(&pool->stopping))
+        {
+            cnd_wait(&pool->wake, &pool->lock);
+        }
+
+        atomic_fetch_sub(&pool->sleepers, 1);
+        mtx_unlock(&pool->lock);
+        attempt = 0;
+    }
+
+    vi_thread_pool_current = nullptr;
+    return 0;
+}
+
+/**
+ * @brief Освобождает память пула; любой из указателей может быть `nullptr`.
+ */
+static void
+vi_thread_pool_free(const vi_allocator_t *backing,
+                    vi_thread_pool_t *pool,
+                    vi_thread_pool_worker_t *workers,
+                    vi_thread_pool_slot_t *slots,
+                    vi_mpmc_queue_t *queue,
+                    vi_usize_t worker_count)
+{
+    vi_mpmc_queue_destroy(queue);
+    vi_allocator_aligned_free(backing,
+                              slots,
+                              worker_count * VI_THREAD_POOL_DEQUE_CAPACITY *
+                                  sizeof(vi_thread_pool_slot_t),
+                              VI_THREAD_POOL_CACHE_LINE_SIZE);
+    vi_allocator_aligned_free(backing,
+                              workers,
+                              worker_count * sizeof(vi_thread_pool_worker_t),
+                              VI_THREAD_POOL_CACHE_LINE_SIZE);
+    vi_allocator_aligned_free(backing,
+                              pool,
+                              sizeof(vi_thread_pool_t),
+                              VI_THREAD_POOL_CACHE_LINE_SIZE);
+}
+
+/**
+ * @brief Останавливает и дожидается первых `count` рабочих потоков,
+ *        затем уничтожает примитивы синхронизации и освобождает память пула.
+ */
+static void
+vi_thread_pool_release(vi_thread_pool_t *pool, vi_usize_t count)
+{
+    mtx_lock(&pool->lock);
+    atomic_store(&pool->stopping, 1);
+    cnd_broadcast(&pool->wake);
+    mtx_unlock(&pool->lock);
+
+    for (vi_usize_t i = 0; i < count; ++i)
+    {
+        thrd_join(pool->workers[i].thread, nullptr);
+    }
+
+    cnd_destroy(&pool->idle);
+    cnd_destroy(&pool->wake);
+    mtx_destroy(&pool->lock);
+    vi_thread_pool_free(pool->backing,
+                        pool,
+                        pool->workers,
+                        pool->workers[0].slots,
+                        pool->queue,
+                        pool->worker_count);
+}
+
+vi_thread_pool_t *
+vi_thread_pool_create(const vi_allocator_t *backing, vi_usize_t worker_count)
+{
+    if (!backing)
+    {
+        backing = vi_runtime_allocator_get();
+    }
+
+    if (!vi_allocator_is_valid(backing))
+    {
+        return nullptr;
+    }
+
+    worker_count = worker_count ? worker_count : vi_cpu_processor_count();
+
+    if (worker_count >
+        VI_USIZE_T_MAX / VI_THREAD_POOL_DEQUE_CAPACITY / sizeof(vi_thread_pool_slot_t))
+    {
+        return nullptr;
+    }
+
+    vi_thread_pool_t *const pool = vi_allocator_aligned_allocate(
+        backing, sizeof(vi_thread_pool_t), VI_THREAD_POOL_CACHE_LINE_SIZE);
+    vi_thread_pool_worker_t *const workers =
+        vi_allocator_aligned_allocate(backing,
+                                      worker_count * sizeof(vi_thread_pool_worker_t),
+                                      VI_THREAD_POOL_CACHE_LINE_SIZE);
+    vi_thread_pool_slot_t *const slots =
+        vi_allocator_aligned_allocate(backing,
+                                      worker_count * VI_THREAD_POOL_DEQUE_CAPACITY *
+                                          sizeof(vi_thread_pool_slot_t),
+                                      VI_THREAD_POOL_CACHE_LINE_SIZE);
+    vi_mpmc_queue_t *const queue =
+        vi_mpmc_queue_create(backing, sizeof(vi_thread_pool_task_t), VI_THREAD_POOL_QUEUE_CAPACITY);
+
+    if (!pool || !workers || !slots || !queue)
+    {
+        vi_thread_pool_free(backing, pool, workers, slots, queue, worker_count);
+        return nullptr;
+    }
+
+    if (mtx_init(&pool->lock, mtx_plain) != thrd_success)
+    {
+        vi_thread_pool_free(backing, pool, workers, slots, queue, worker_count);
+        return nullptr;
+    }
+
+    if (cnd_init(&pool->wake) != thrd_success)
+    {
+        mtx_destroy(&pool->lock);
+        vi_thread_pool_free(backing, pool, workers, slots, queue, worker_count);
+        return nullptr;
+    }
+
+    if (cnd_init(&pool->idle) != thrd_success)
+    {
+        cnd_destroy(&pool->wake);
+        mtx_destroy(&pool->lock);
+        vi_thread_pool_free(backing, pool, workers, slots, queue, worker_count);
+        return nullptr;
+    }
+
+    atomic_init(&pool->pending.value, 0);
+    atomic_init(&pool->epoch.value, 0);
+    atomic_init(&pool->sleepers, 0);
+    atomic_init(&pool->stopping, 0);
+    pool->backing      = backing;
+    pool->queue        = queue;
+    pool->workers      = workers;
+    pool->worker_count = worker_count;
+
+    for (vi_usize_t i = 0; i < worker_count; ++i)
+    {
+        atomic_init(&workers[i].top.value, 0);
+        atomic_init(&workers[i].bottom.value, 0);
+        workers[i].pool   = pool;
+        workers[i].slots  = slots + i * VI_THREAD_POOL_DEQUE_CAPACITY;
+        workers[i].index  = i;
+        workers[i].random = 0x9E3779B97F4A7C15ULL * (i + 1);
+    }
+
+    mtx_lock(&pool->lock);
+
+    for (vi_usize_t i = 0; i < worker_count; ++i)
+    {
+        if (thrd_create(&workers[i].thread, vi_thread_pool_worker_main, &workers[i]) !=
+            thrd_success)
+        {
+            mtx_unlock(&pool->lock);
+            vi_thread_pool_release(pool, i);
+            return nullptr;
+        }
+    }
+
+    mtx_unlock(&pool->lock);
+    return pool;
+}
+
+void
+vi_thread_pool_destroy(vi_thread_pool_t *pool)
+{
+    if (!pool)
+    {
+        return;
+    }
+
+    vi_thread_pool_wait(pool);
+    vi_thread_pool_release(pool, pool->worker_count);
+}
+
+bool
+vi_thread_pool_submit(vi_thread_pool_t *pool, vi_thread_pool_task_fn_t fn, vi_ptr_t arg)
+{
+    if (!fn)
+    {
+        return false;
+    }
+
+    if (!pool)
+    {
+        fn(arg);
+        return true;
+    }
+
+    vi_thread_pool_worker_t *const worker = vi_thread_pool_self(pool);
+    vi_thread_pool_task_t task;
+
+    task.fn    = fn;
+    task.arg   = arg;
+    task.loop  = nullptr;
+    task.begin = 0;
+    task.end   = 0;
+
+    if (worker)
+    {
+        // Ожидание места в общей очереди из рабочего потока могло бы остановить
+        // все потоки пула, поэтому задача, не поместившаяся в дек, выполняется сразу.
+        if (!vi_thread_pool_try_push(pool, worker, &task))
+        {
+            fn(arg);
+        }
+        return true;
+    }
+
+    atomic_fetch_add(&pool->pending.value, 1);
+    vi_mpmc_queue_push(pool->queue, (const vi_ptr_t)&task);
+    vi_thread_pool_notify(pool);
+    return true;
+}
+
+void
+vi_thread_pool_wait(vi_thread_pool_t *pool)
+{
+    if (!pool)
+    {
+        return;
+    }
+
+    vi_thread_pool_task_t task;
+
+    while (vi_thread_pool_find(pool, nullptr, &task))
+    {
+        vi_thread_pool_run(pool, nullptr, &task);
+    }
+
+    mtx_lock(&pool->lock);
+
+    while (atomic_load(&pool->pending.value))
+    {
+        cnd_wait(&pool->idle, &pool->lock);
+    }
+
+    mtx_unlock(&pool->lock);
+}
+
+void
+vi_thread_pool_parallel_for(vi_thread_pool_t *pool,
+                            vi_usize_t begin,
+                            vi_usize_t end,
+                            vi_usize_t grain,
+                            vi_thread_pool_range_fn_t fn,
+                            vi_ptr_t arg)
+{
+    if (!fn || begin >= end)
+    {
+        return;
+    }
+
+    if (!pool)
+    {
+        fn(arg, begin, end);
+        return;
+    }
+
+    vi_thread_pool_worker_t *const worker = vi_thread_pool_self(pool);
+    vi_thread_pool_loop_t loop;
+    vi_thread_pool_task_t task;
+    vi_u32_t attempt = 0;
+
+    if (!grain)
+    {
+        grain = (end - begin) / (pool->worker_count * VI_THREAD_POOL_GRAIN_PARTS);
+        grain = grain ? grain : 1;
+    }
+
+    loop.fn    = fn;
+    loop.arg   = arg;
+    loop.grain = grain;
+    atomic_init(&loop.remaining, end - begin);
+
+    vi_thread_pool_run_range(pool, worker, &loop, begin, end);
+
+    // Пока другие потоки обрабатывают отделенные части, вызвавший поток
+    // выполняет задачи пула, в том числе части этого же цикла.
+    while (atomic_load(&loop.remaining))
+    {
+        if (vi_thread_pool_find(pool, worker, &task))
+        {
+            vi_thread_pool_run(pool, worker, &task);
+            attempt = 0;
+        }
+        else
+        {
+            vi_thread_pool_backoff(&attempt);
+        }
+    }
+}
+
+vi_usize_t
+vi_thread_pool_size(const vi_thread_pool_t *pool)
+{
+    return pool ? pool->worker_count : 0;
+}
+
+vi_usize_t
+vi_thread_pool_worker_index(const vi_thread_pool_t *pool)
+{
+    const vi_thread_pool_worker_t *const worker = pool ? vi_thread_pool_self(pool) : nullptr;
+    return worker ? worker->index : VI_THREAD_POOL_NPOS;
+}
+
+#else
+
+vi_thread_pool_t *
+vi_thread_pool_create(const vi_allocator_t *backing, vi_usize_t worker_count)
+{
+    (void)backing;
+    (void)worker_count;
+    return nullptr;
+}
+
+void
+vi_thread_pool_destroy(vi_thread_pool_t *pool)
+{
+    (void)pool;
+}
+
+bool
+vi_thread_pool_submit(vi_thread_pool_t *pool, vi_thread_pool_task_fn_t fn, vi_ptr_t arg)
+{
+    (void)pool;
+
+    if (!fn)
+    {
+        return false;
+    }
+
+    fn(arg);
+    return true;
+}
+
+void
+vi_thread_pool_wait(vi_thread_pool_t *pool)
+{
+    (void)pool;
+}
+
+void
+vi_thread_pool_parallel_for(vi_thread_pool_t *pool,
+                            vi_usize_t begin,
+                            vi_usize_t end,
+                            vi_usize_t grain,
+                            vi_thread_pool_range_fn_t fn,
+                            vi_ptr_t arg)
+{
+    (void)pool;
+    (void)grain;
+
+    if (fn && begin < end)
+    {
+        fn(arg, begin, end);
+    }
+}
+
+vi_usize_t
+vi_thread_pool_size(const vi_thread_pool_t *pool)
+{
+    (void)pool;
+    return 0;
+}
+
+vi_usize_t
+vi_thread_pool_worker_index(const vi_thread_pool_t *pool)
+{
+    (void)pool;
+    return VI_THREAD_POOL_NPOS;
+}
+
+#endif // !defined(__STDC_NO_THREADS__)
+
+/**
+ * @brief Общий пул библиотеки или `nullptr`.
+ */
+static vi_thread_pool_t *vi_thread_pool_global_instance = nullptr;
+
+#ifdef VI_OPTION_THREAD_POOL_GLOBAL
+vi_compiler_constructor(vi_thread_pool_global_init)
+{
+    // Порядок конструкторов разных модулей не определен, поэтому распределитель
+    // времени выполнения может быть еще не задан; пул использует распределитель stdlib.
+    vi_thread_pool_global_instance =
+        vi_thread_pool_create(vi_allocator_stdlib(), VI_THREAD_POOL_GLOBAL_WORKERS);
+}
+
+vi_compiler_destructor(vi_thread_pool_global_deinit)
+{
+    vi_thread_pool_destroy(vi_thread_pool_global_instance);
+    vi_thread_pool_global_instance = nullptr;
+}
+#endif // VI_OPTION_THREAD_POOL_GLOBAL
+
+vi_thread_pool_t *
+vi_thread_pool_global(void)
+{
+    return vi_thread_pool_global_instance;
+}
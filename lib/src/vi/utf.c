@@ -0,0 +1,1113 @@
+#include <vi/utf.h>
+/* Дополнительные модули */
+#include <vi/cpu.h>
+#include <vi/nullptr.h>
+#include <vi/bit_traits.h>
+
+#if VI_COMPILER_SIMD_SSE2
+#    include <emmintrin.h>
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_SSSE3 || VI_COMPILER_SIMD_AVX2
+#    include <immintrin.h>
+#endif // VI_COMPILER_SIMD_SSSE3 || VI_COMPILER_SIMD_AVX2
+
+/**
+ * @def vi_utf8_is_continuation
+ * @brief Проверяет, что байт является продолжением последовательности (10xxxxxx).
+ */
+#define vi_utf8_is_continuation(byte) (((byte) & 0xC0) == 0x80)
+
+/**
+ * @def vi_utf16_is_surrogate
+ * @brief Проверяет, что единица является суррогатом (U+D800–U+DFFF).
+ */
+#define vi_utf16_is_surrogate(unit) (((unit) & 0xF800) == 0xD800)
+
+/**
+ * @def VI_UTF_SCALAR_WINDOW
+ * @brief Количество единиц, разбираемых по одному символу после участка ASCII.
+ *
+ * В тексте, где символы ASCII перемежаются другими (пробелы и знаки препинания
+ * в нелатинском тексте), короткие участки ASCII разбираются вместе с соседними
+ * символами, а не отдельным вызовом векторной реализации.
+ */
+#define VI_UTF_SCALAR_WINDOW 16
+
+/**
+ * @brief Тип указателя на реализацию проверки начала текста UTF-8.
+ *
+ * Реализация возвращает границу последовательности, до которой текст корректен;
+ * остаток проверяется по одной последовательности, что и определяет смещение ошибки.
+ */
+typedef vi_usize_t (*vi_utf8_validate_fn_t)(const vi_u8_t *src, vi_usize_t size);
+
+/**
+ * @brief Типы указателей на реализации перевода начального участка ASCII.
+ *
+ * Реализация переводит символы до первого символа вне ASCII и возвращает их количество.
+ */
+typedef vi_usize_t (*vi_utf8_widen16_fn_t)(vi_uchar16_t *dst, const vi_u8_t *src, vi_usize_t size);
+typedef vi_usize_t (*vi_utf8_widen32_fn_t)(vi_uchar32_t *dst, const vi_u8_t *src, vi_usize_t size);
+typedef vi_usize_t (*vi_utf16_narrow_fn_t)(vi_u8_t *dst, const vi_uchar16_t *src, vi_usize_t size);
+
+/**
+ * @brief Тип указателя на реализацию подсчета первых байтов последовательностей.
+ *
+ * Реализация возвращает количество байтов, не являющихся продолжением,
+ * и записывает в `four` количество первых байтов четырехбайтовых последовательностей.
+ */
+typedef vi_usize_t (*vi_utf8_count_fn_t)(const vi_u8_t *src, vi_usize_t size, vi_usize_t *four);
+
+/**
+ * @brief Тип указателя на реализацию подсчета байтов UTF-8 для единиц UTF-16.
+ */
+typedef vi_usize_t (*vi_utf16_count_fn_t)(const vi_uchar16_t *src, vi_usize_t size);
+
+/**
+ * @brief Разбирает последовательность UTF-8 в начале участка.
+ *
+ * Диапазон второго байта зависит от первого: так отклоняются избыточно длинные
+ * записи (E0, F0), суррогаты (ED) и значения больше U+10FFFF (F4).
+ *
+ * @param src Указатель на первый байт последовательности.
+ * @param size Количество байтов до конца входа; не меньше 1.
+ * @param code Указатель на кодовую точку.
+ *
+ * @return Длина последовательности, `VI_UTF_BAD_SEQUENCE` или `VI_UTF_TRUNCATED`.
+ */
+static inline vi_return_t
+vi_utf8_decode(const vi_u8_t *src, vi_usize_t size, vi_u32_t *code)
+{
+    const vi_u32_t lead = src[0];
+    vi_u32_t low        = 0x80;
+    vi_u32_t high       = 0xBF;
+    vi_return_t length;
+
+    if (lead < 0x80)
+    {
+        *code = lead;
+        return 1;
+    }
+
+    if (lead < 0xC2 || lead > 0xF4)
+    {
+        return VI_UTF_BAD_SEQUENCE;
+    }
+
+    if (lead < 0xE0)
+    {
+        length = 2;
+    }
+    else if (lead < 0xF0)
+    {
+        length = 3;
+        low    = lead == 0xE0 ? 0xA0 : low;
+        high   = lead == 0xED ? 0x9F : high;
+    }
+    else
+    {
+        length = 4;
+        low    = lead == 0xF0 ? 0x90 : low;
+        high   = lead == 0xF4 ? 0x8F : high;
+    }
+
+    vi_u32_t value = lead & (0x7FU >> length);
+
+    for (vi_return_t i = 1; i < length; ++i)
+    {
+        if ((vi_usize_t)i >= size)
+        {
+            return VI_UTF_TRUNCATED;
+        }
+
+        const vi_u32_t byte = src[i];
+
+        if (byte < low || byte > high)
+        {
+            return VI_UTF_BAD_SEQUENCE;
+        }
+
+        value = value << 6 | (byte & 0x3F);
+        low   = 0x80;
+        high  = 0xBF;
+    }
+
+    *code = value;
+    return length;
+}
+
+/**
+ * @brief Проверяет текст по одной последовательности.
+ *
+ * @return Смещение первой недопустимой последовательности или `size`.
+ */
+static vi_usize_t
+vi_utf8_validate_bytes(const vi_u8_t *src, vi_usize_t size, vi_return_t *status)
+{
+    vi_usize_t i = 0;
+
+    *status = VI_UTF_SUCCESS;
+
+    while (i < size)
+    {
+        vi_u32_t code;
+        const vi_return_t length = vi_utf8_decode(src + i, size - i, &code);
+
+        if (length < 0)
+        {
+            *status = length;
+            break;
+        }
+
+        i += (vi_usize_t)length;
+    }
+
+    return i;
+}
+
+/**
+ * @brief Возвращает начало последовательности, которая может продолжаться за `i`.
+ *
+ * Назад просматривается не больше трех байтов продолжения; если перед ними стоит
+ * первый байт многобайтовой последовательности, проверка возобновляется с него.
+ */
+static inline vi_usize_t
+vi_utf8_boundary(const vi_u8_t *src, vi_usize_t i)
+{
+    vi_usize_t p = i;
+
+    while (p > 0 && i - p < 3 && vi_utf8_is_continuation(src[p - 1]))
+    {
+        --p;
+    }
+
+    return (p > 0 && src[p - 1] >= 0xC0) ? p - 1 : p;
+}
+
+static vi_usize_t
+vi_utf8_validate_none(const vi_u8_t *src, vi_usize_t size)
+{
+    (void)src;
+    (void)size;
+    return 0;
+}
+
+static vi_usize_t
+vi_utf8_widen16_bytes(vi_uchar16_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    vi_usize_t i = 0;
+
+    for (; i < size && src[i] < 0x80; ++i)
+    {
+        dst[i] = src[i];
+    }
+
+    return i;
+}
+
+static vi_usize_t
+vi_utf8_widen32_bytes(vi_uchar32_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    vi_usize_t i = 0;
+
+    for (; i < size && src[i] < 0x80; ++i)
+    {
+        dst[i] = src[i];
+    }
+
+    return i;
+}
+
+static vi_usize_t
+vi_utf16_narrow_units(vi_u8_t *dst, const vi_uchar16_t *src, vi_usize_t size)
+{
+    vi_usize_t i = 0;
+
+    for (; i < size && src[i] < 0x80; ++i)
+    {
+        dst[i] = (vi_u8_t)src[i];
+    }
+
+    return i;
+}
+
+static vi_usize_t
+vi_utf8_count_bytes(const vi_u8_t *src, vi_usize_t size, vi_usize_t *four)
+{
+    vi_usize_t leads = 0;
+
+    for (vi_usize_t i = 0; i < size; ++i)
+    {
+        leads += !vi_utf8_is_continuation(src[i]);
+        *four += src[i] >= 0xF0;
+    }
+
+    return leads;
+}
+
+static vi_usize_t
+vi_utf16_count_units(const vi_uchar16_t *src, vi_usize_t size)
+{
+    vi_usize_t total = 0;
+
+    for (vi_usize_t i = 0; i < size; ++i)
+    {
+        const vi_uchar16_t unit = src[i];
+
+        total += 1 + (unit >= 0x80) + (unit >= 0x800) - vi_utf16_is_surrogate(unit);
+    }
+
+    return total;
+}
+
+#if VI_COMPILER_SIMD_SSE2
+/**
+ * @brief Переводит участок ASCII в UTF-16 по 16 байт за шаг SSE2.
+ *
+ * Блок со старшим битом в одном из байтов и остаток обрабатываются по одному байту.
+ */
+static vi_usize_t
+vi_utf8_widen16_sse2(vi_uchar16_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    const __m128i zero = _mm_setzero_si128();
+    vi_usize_t i       = 0;
+
+    for (; size - i >= 16; i += 16)
+    {
+        const __m128i x = _mm_loadu_si128((const __m128i *)(src + i));
+
+        if (_mm_movemask_epi8(x))
+        {
+            break;
+        }
+
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_unpacklo_epi8(x, zero));
+        _mm_storeu_si128((__m128i *)(dst + i + 8), _mm_unpackhi_epi8(x, zero));
+    }
+
+    return i + vi_utf8_widen16_bytes(dst + i, src + i, size - i);
+}
+
+/**
+ * @brief Переводит участок ASCII в UTF-32 по 16 байт за шаг SSE2.
+ */
+static vi_usize_t
+vi_utf8_widen32_sse2(vi_uchar32_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    const __m128i zero = _mm_setzero_si128();
+    vi_usize_t i       = 0;
+
+    for (; size - i >= 16; i += 16)
+    {
+        const __m128i x = _mm_loadu_si128((const __m128i *)(src + i));
+
+        if (_mm_movemask_epi8(x))
+        {
+            break;
+        }
+
+        const __m128i low  = _mm_unpacklo_epi8(x, zero);
+        const __m128i high = _mm_unpackhi_epi8(x, zero);
+
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128((__m128i *)(dst + i + 4), _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128((__m128i *)(dst + i + 8), _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128((__m128i *)(dst + i + 12), _mm_unpackhi_epi16(high, zero));
+    }
+
+    return i + vi_utf8_widen32_bytes(dst + i, src + i, size - i);
+}
+
+/**
+ * @brief Переводит участок ASCII из UTF-16 по 16 единиц за шаг SSE2.
+ *
+ * Единицы проверяются маской 0xFF80 и упаковываются `packus`.
+ */
+static vi_usize_t
+vi_utf16_narrow_sse2(vi_u8_t *dst, const vi_uchar16_t *src, vi_usize_t size)
+{
+    const __m128i mask = _mm_set1_epi16((short)0xFF80);
+    vi_usize_t i       = 0;
+
+    for (; size - i >= 16; i += 16)
+    {
+        const __m128i first  = _mm_loadu_si128((const __m128i *)(src + i));
+        const __m128i second = _mm_loadu_si128((const __m128i *)(src + i + 8));
+        const __m128i high   = _mm_and_si128(_mm_or_si128(first, second), mask);
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) != 0xFFFF)
+        {
+            break;
+        }
+
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(first, second));
+    }
+
+    return i + vi_utf16_narrow_units(dst + i, src + i, size - i);
+}
+
+/**
+ * @brief Считает первые байты последовательностей по 16 байт за шаг SSE2.
+ *
+ * Байт не является продолжением, если как знаковое число он больше -65 (0xBF).
+ * Блок ASCII целиком состоит из первых байтов.
+ */
+static vi_usize_t
+vi_utf8_count_sse2(const vi_u8_t *src, vi_usize_t size, vi_usize_t *four)
+{
+    const __m128i continuation = _mm_set1_epi8(-65);
+    const __m128i four_lead    = _mm_set1_epi8((char)0xF0);
+    vi_usize_t leads           = 0;
+    vi_usize_t i               = 0;
+
+    for (; size - i >= 16; i += 16)
+    {
+        const __m128i x = _mm_loadu_si128((const __m128i *)(src + i));
+
+        if (!_mm_movemask_epi8(x))
+        {
+            leads += 16;
+            continue;
+        }
+
+        const __m128i lead = _mm_cmpgt_epi8(x, continuation);
+        const __m128i wide = _mm_cmpeq_epi8(_mm_max_epu8(x, four_lead), x);
+
+        leads += (vi_usize_t)vi_bit_popcount32(_mm_movemask_epi8(lead));
+        *four += (vi_usize_t)vi_bit_popcount32(_mm_movemask_epi8(wide));
+    }
+
+    return leads + vi_utf8_count_bytes(src + i, size - i, four);
+}
+
+/**
+ * @brief Считает байты UTF-8 для единиц UTF-16 по 8 единиц за шаг SSE2.
+ *
+ * Каждая единица занимает 3 байта за вычетом единицы для значений до 0x7F,
+ * до 0x7FF и для суррогатов. Маски 16-битных сравнений дают по два бита
+ * `movemask` на единицу.
+ */
+static vi_usize_t
+vi_utf16_count_sse2(const vi_uchar16_t *src, vi_usize_t size)
+{
+    const __m128i zero      = _mm_setzero_si128();
+    const __m128i one_byte  = _mm_set1_epi16(0x7F);
+    const __m128i two_bytes = _mm_set1_epi16(0x7FF);
+    const __m128i high_mask = _mm_set1_epi16((short)0xF800);
+    const __m128i surrogate = _mm_set1_epi16((short)0xD800);
+    vi_usize_t total        = 0;
+    vi_usize_t i            = 0;
+
+    for (; size - i >= 8; i += 8)
+    {
+        const __m128i x     = _mm_loadu_si128((const __m128i *)(src + i));
+        const __m128i ascii = _mm_cmpeq_epi16(_mm_subs_epu16(x, one_byte), zero);
+
+        if (_mm_movemask_epi8(ascii) == 0xFFFF)
+        {
+            total += 8;
+            continue;
+        }
+
+        const __m128i short_ = _mm_cmpeq_epi16(_mm_subs_epu16(x, two_bytes), zero);
+        const __m128i pair   = _mm_cmpeq_epi16(_mm_and_si128(x, high_mask), surrogate);
+        const vi_u32_t bits  = (vi_u32_t)vi_bit_popcount32(_mm_movemask_epi8(ascii)) +
+                              (vi_u32_t)vi_bit_popcount32(_mm_movemask_epi8(short_)) +
+                              (vi_u32_t)vi_bit_popcount32(_mm_movemask_epi8(pair));
+
+        total += 24 - bits / 2;
+    }
+
+    return total + vi_utf16_count_units(src + i, size - i);
+}
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_SSSE3
+/* Признаки ошибок таблиц проверки UTF-8; каждый описывает пару байтов "предыдущий текущий" */
+#define VI_UTF8_TOO_SHORT 0x01  // 11______ 0_______ или 11______ 11______
+#define VI_UTF8_TOO_LONG 0x02   // 0_______ 10______
+#define VI_UTF8_OVERLONG_3 0x04 // 11100000 100_____
+#define VI_UTF8_TOO_LARGE 0x08  // 11110100 1001____ и старше
+#define VI_UTF8_SURROGATE 0x10  // 11101101 101_____
+#define VI_UTF8_OVERLONG_2 0x20 // 1100000_ 10______
+#define VI_UTF8_TOO_LARGE_1000 0x40 // 11110101 1000____ и старше
+#define VI_UTF8_OVERLONG_4 0x40     // 11110000 1000____
+#define VI_UTF8_TWO_CONTS 0x80      // 10______ 10______
+#define VI_UTF8_CARRY (VI_UTF8_TOO_SHORT | VI_UTF8_TOO_LONG | VI_UTF8_TWO_CONTS)
+
+/**
+ * @brief Признаки ошибок по старшей тетраде предыдущего байта.
+ */
+static const vi_u8_t vi_utf8_prev_high[16] = {
+    VI_UTF8_TOO_LONG,
+    VI_UTF8_TOO_LONG,
+    VI_UTF8_TOO_LONG,
+    VI_UTF8_TOO_LONG,
+    VI_UTF8_TOO_LONG,
+    VI_UTF8_TOO_LONG,
+    VI_UTF8_TOO_LONG,
+    VI_UTF8_TOO_LONG,
+    VI_UTF8_TWO_CONTS,
+    VI_UTF8_TWO_CONTS,
+    VI_UTF8_TWO_CONTS,
+    VI_UTF8_TWO_CONTS,
+    VI_UTF8_TOO_SHORT | VI_UTF8_OVERLONG_2,
+    VI_UTF8_TOO_SHORT,
+    VI_UTF8_TOO_SHORT | VI_UTF8_OVERLONG_3 | VI_UTF8_SURROGATE,
+    VI_UTF8_TOO_SHORT | VI_UTF8_TOO_LARGE | VI_UTF8_TOO_LARGE_1000 | VI_UTF8_OVERLONG_4,
+};
+
+/**
+ * @brief Признаки ошибок по младшей тетраде предыдущего байта.
+ */
+static const vi_u8_t vi_utf8_prev_low[16] = {
+    VI_UTF8_CARRY | VI_UTF8_OVERLONG_3 | VI_UTF8_OVERLONG_2 | VI_UTF8_OVERLONG_4,
+    VI_UTF8_CARRY | VI_UTF8_OVERLONG_2,
+    VI_UTF8_CARRY,
+    VI_UTF8_CARRY,
+    VI_UTF8_CARRY | VI_UTF8_TOO_LARGE,
+    VI_UTF8_CARRY | VI_UTF8_TOO_LARGE | VI_UTF8_TOO_LARGE_1000,
+    VI_UTF8_CARRY | VI_UTF8_TOO_LARGE | VI_UTF8_TOO_LARGE_1000,
+    VI_UTF8_CARRY | VI_UTF8_TOO_LARGE | VI_UTF8_TOO_LARGE_1000,
+    VI_UTF8_CARRY | VI_UTF8_TOO_LARGE | VI_UTF8_TOO_LARGE_1000,
+    VI_UTF8_CARRY | VI_UTF8_TOO_LARGE | VI_UTF8_TOO_LARGE_1000,
+    VI_UTF8_CARRY | VI_UTF8_TOO_LARGE | VI_UTF8_TOO_LARGE_1000,
+    VI_UTF8_CARRY | VI_UTF8_TOO_LARGE | VI_UTF8_TOO_LARGE_1000,
+    VI_UTF8_CARRY | VI_UTF8_TOO_LARGE | VI_UTF8_TOO_LARGE_1000,
+    VI_UTF8_CARRY | VI_UTF8_TOO_LARGE | VI_UTF8_TOO_LARGE_1000 | VI_UTF8_SURROGATE,
+    VI_UTF8_CARRY | VI_UTF8_TOO_LARGE | VI_UTF8_TOO_LARGE_1000,
+    VI_UTF8_CARRY | VI_UTF8_TOO_LARGE | VI_UTF8_TOO_LARGE_1000,
+};
+
+/**
+ * @brief Признаки ошибок по старшей тетраде текущего байта.
+ */
+static const vi_u8_t vi_utf8_current_high[16] = {
+    VI_UTF8_TOO_SHORT,
+    VI_UTF8_TOO_SHORT,
+    VI_UTF8_TOO_SHORT,
+    VI_UTF8_TOO_SHORT,
+    VI_UTF8_TOO_SHORT,
+    VI_UTF8_TOO_SHORT,
+    VI_UTF8_TOO_SHORT,
+    VI_UTF8_TOO_SHORT,
+    VI_UTF8_TOO_LONG | VI_UTF8_OVERLONG_2 | VI_UTF8_TWO_CONTS | VI_UTF8_OVERLONG_3 |
+        VI_UTF8_TOO_LARGE_1000 | VI_UTF8_OVERLONG_4,
+    VI_UTF8_TOO_LONG | VI_UTF8_OVERLONG_2 | VI_UTF8_TWO_CONTS | VI_UTF8_OVERLONG_3 |
+        VI_UTF8_TOO_LARGE,
+    VI_UTF8_TOO_LONG | VI_UTF8_OVERLONG_2 | VI_UTF8_TWO_CONTS | VI_UTF8_SURROGATE |
+        VI_UTF8_TOO_LARGE,
+    VI_UTF8_TOO_LONG | VI_UTF8_OVERLONG_2 | VI_UTF8_TWO_CONTS | VI_UTF8_SURROGATE |
+        VI_UTF8_TOO_LARGE,
+    VI_UTF8_TOO_SHORT,
+    VI_UTF8_TOO_SHORT,
+    VI_UTF8_TOO_SHORT,
+    VI_UTF8_TOO_SHORT,
+};
+
+/**
+ * @brief Наибольшие значения последних трех байтов блока, после которых
+ *        последовательность не может быть оборвана; остальные байты не ограничены.
+ */
+static const vi_u8_t vi_utf8_incomplete[32] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1,
+};
+
+/**
+ * @brief Проверяет 16 байт с учетом трех последних байтов предыдущего блока.
+ *
+ * Пары соседних байтов проверяются пересечением признаков трех таблиц: ошибка есть,
+ * если признак установлен во всех трех. Третий и четвертый байты длинных
+ * последовательностей выглядят как ошибка `VI_UTF8_TWO_CONTS`, поэтому старший бит
+ * признаков инвертируется там, где байт обязан быть таким продолжением.
+ *
+ * @return Ненулевые байты отмечают ошибки.
+ */
+VI_COMPILER_SIMD_TARGET("ssse3")
+static inline __m128i
+vi_utf8_check_ssse3(__m128i input, __m128i previous)
+{
+    const __m128i mask  = _mm_set1_epi8(0x0F);
+    const __m128i prev1 = _mm_alignr_epi8(input, previous, 15);
+    const __m128i prev2 = _mm_alignr_epi8(input, previous, 14);
+    const __m128i prev3 = _mm_alignr_epi8(input, previous, 13);
+
+    const __m128i prev_high    = _mm_shuffle_epi8(
+        _mm_loadu_si128((const __m128i *)vi_utf8_prev_high),
+        _mm_and_si128(_mm_srli_epi16(prev1, 4), mask));
+    const __m128i prev_low     = _mm_shuffle_epi8(
+        _mm_loadu_si128((const __m128i *)vi_utf8_prev_low), _mm_and_si128(prev1, mask));
+    const __m128i current_high = _mm_shuffle_epi8(
+        _mm_loadu_si128((const __m128i *)vi_utf8_current_high),
+        _mm_and_si128(_mm_srli_epi16(input, 4), mask));
+    const __m128i special      = _mm_and_si128(_mm_and_si128(prev_high, prev_low), current_high);
+
+    const __m128i third  = _mm_subs_epu8(prev2, _mm_set1_epi8((char)(0xE0 - 0x80)));
+    const __m128i fourth = _mm_subs_epu8(prev3, _mm_set1_epi8((char)(0xF0 - 0x80)));
+    const __m128i must   = _mm_and_si128(_mm_or_si128(third, fourth), _mm_set1_epi8((char)0x80));
+
+    return _mm_xor_si128(special, must);
+}
+
+/**
+ * @brief Проверяет текст по 16 байт за шаг SSSE3.
+ *
+ * Блок ASCII проверяется только на последовательность, оборванную в конце
+ * предыдущего блока. При ошибке и в конце входа возвращается граница
+ * последовательности, с которой проверка продолжается по одному символу.
+ */
+VI_COMPILER_SIMD_TARGET("ssse3")
+static vi_usize_t
+vi_utf8_validate_ssse3(const vi_u8_t *src, vi_usize_t size)
+{
+    const __m128i limit = _mm_loadu_si128((const __m128i *)(vi_utf8_incomplete + 16));
+    const __m128i zero  = _mm_setzero_si128();
+    __m128i previous    = zero;
+    __m128i incomplete  = zero;
+    vi_usize_t i        = 0;
+
+    for (; size - i >= 16; i += 16)
+    {
+        const __m128i input = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i error       = incomplete;
+
+        if (_mm_movemask_epi8(input))
+        {
+            error      = vi_utf8_check_ssse3(input, previous);
+            incomplete = _mm_subs_epu8(input, limit);
+        }
+        else
+        {
+            incomplete = zero;
+        }
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, zero)) != 0xFFFF)
+        {
+            break;
+        }
+
+        previous = input;
+    }
+
+    return vi_utf8_boundary(src, i);
+}
+#endif // VI_COMPILER_SIMD_SSSE3
+
+#if VI_COMPILER_SIMD_AVX2
+/**
+ * @brief Проверяет 32 байта с учетом трех последних байтов предыдущего блока.
+ *
+ * Аналогична `vi_utf8_check_ssse3`; сдвиг на байты предыдущего блока через границу
+ * 128-битных половин выполняется `alignr` с перестановкой половин.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static inline __m256i
+vi_utf8_check_avx2(__m256i input, __m256i previous)
+{
+    const __m256i mask    = _mm256_set1_epi8(0x0F);
+    const __m256i shifted = _mm256_permute2x128_si256(previous, input, 0x21);
+    const __m256i prev1   = _mm256_alignr_epi8(input, shifted, 15);
+    const __m256i prev2   = _mm256_alignr_epi8(input, shifted, 14);
+    const __m256i prev3   = _mm256_alignr_epi8(input, shifted, 13);
+
+    const __m256i prev_high    = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)vi_utf8_prev_high)),
+        _mm256_and_si256(_mm256_srli_epi16(prev1, 4), mask));
+    const __m256i prev_low     = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)vi_utf8_prev_low)),
+        _mm256_and_si256(prev1, mask));
+    const __m256i current_high = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)vi_utf8_current_high)),
+        _mm256_and_si256(_mm256_srli_epi16(input, 4), mask));
+    const __m256i special      = _mm256_and_si256(_mm256_and_si256(prev_high, prev_low),
+                                                  current_high);
+
+    const __m256i third  = _mm256_subs_epu8(prev2, _mm256_set1_epi8((char)(0xE0 - 0x80)));
+    const __m256i fourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8((char)(0xF0 - 0x80)));
+    const __m256i must   = _mm256_and_si256(_mm256_or_si256(third, fourth),
+                                            _mm256_set1_epi8((char)0x80));
+
+    return _mm256_xor_si256(special, must);
+}
+
+/**
+ * @brief Проверяет текст по 32 байта за шаг AVX2.
+ *
+ * Аналогична `vi_utf8_validate_ssse3`.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static vi_usize_t
+vi_utf8_validate_avx2(const vi_u8_t *src, vi_usize_t size)
+{
+    const __m256i limit = _mm256_loadu_si256((const __m256i *)vi_utf8_incomplete);
+    const __m256i zero  = _mm256_setzero_si256();
+    __m256i previous    = zero;
+    __m256i incomplete  = zero;
+    vi_usize_t i        = 0;
+
+    for (; size - i >= 32; i += 32)
+    {
+        const __m256i input = _mm256_loadu_si256((const __m256i *)(src + i));
+        __m256i error       = incomplete;
+
+        if (_mm256_movemask_epi8(input))
+        {
+            error      = vi_utf8_check_avx2(input, previous);
+            incomplete = _mm256_subs_epu8(input, limit);
+        }
+        else
+        {
+            incomplete = zero;
+        }
+
+        if (!_mm256_testz_si256(error, error))
+        {
+            break;
+        }
+
+        previous = input;
+    }
+
+    return vi_utf8_boundary(src, i);
+}
+
+/**
+ * @brief Переводит участок ASCII в UTF-16 по 32 байта за шаг AVX2.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static vi_usize_t
+vi_utf8_widen16_avx2(vi_uchar16_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    vi_usize_t i = 0;
+
+    for (; size - i >= 32; i += 32)
+    {
+        const __m256i x = _mm256_loadu_si256((const __m256i *)(src + i));
+
+        if (_mm256_movemask_epi8(x))
+        {
+            break;
+        }
+
+        _mm256_storeu_si256((__m256i *)(dst + i),
+                            _mm256_cvtepu8_epi16(_mm256_castsi256_si128(x)));
+        _mm256_storeu_si256((__m256i *)(dst + i + 16),
+                            _mm256_cvtepu8_epi16(_mm256_extracti128_si256(x, 1)));
+    }
+
+    return i + vi_utf8_widen16_sse2(dst + i, src + i, size - i);
+}
+
+/**
+ * @brief Переводит участок ASCII в UTF-32 по 32 байта за шаг AVX2.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static vi_usize_t
+vi_utf8_widen32_avx2(vi_uchar32_t *dst, const vi_u8_t *src, vi_usize_t size)
+{
+    vi_usize_t i = 0;
+
+    for (; size - i >= 32; i += 32)
+    {
+        const __m256i x = _mm256_loadu_si256((const __m256i *)(src + i));
+
+        if (_mm256_movemask_epi8(x))
+        {
+            break;
+        }
+
+        const __m128i low  = _mm256_castsi256_si128(x);
+        const __m128i high = _mm256_extracti128_si256(x, 1);
+
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_cvtepu8_epi32(low));
+        _mm256_storeu_si256((__m256i *)(dst + i + 8),
+                            _mm256_cvtepu8_epi32(_mm_srli_si128(low, 8)));
+        _mm256_storeu_si256((__m256i *)(dst + i + 16), _mm256_cvtepu8_epi32(high));
+        _mm256_storeu_si256((__m256i *)(dst + i + 24),
+                            _mm256_cvtepu8_epi32(_mm_srli_si128(high, 8)));
+    }
+
+    return i + vi_utf8_widen32_sse2(dst + i, src + i, size - i);
+}
+
+/**
+ * @brief Переводит участок ASCII из UTF-16 по 32 единицы за шаг AVX2.
+ *
+ * `packus` упаковывает половины регистров по отдельности, поэтому 64-битные
+ * части результата переставляются в порядок 0, 2, 1, 3.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static vi_usize_t
+vi_utf16_narrow_avx2(vi_u8_t *dst, const vi_uchar16_t *src, vi_usize_t size)
+{
+    const __m256i mask = _mm256_set1_epi16((short)0xFF80);
+    vi_usize_t i       = 0;
+
+    for (; size - i >= 32; i += 32)
+    {
+        const __m256i first  = _mm256_loadu_si256((const __m256i *)(src + i));
+        const __m256i second = _mm256_loadu_si256((const __m256i *)(src + i + 16));
+
+        if (!_mm256_testz_si256(_mm256_or_si256(first, second), mask))
+        {
+            break;
+        }
+
+        _mm256_storeu_si256(
+            (__m256i *)(dst + i),
+            _mm256_permute4x64_epi64(_mm256_packus_epi16(first, second), 0xD8));
+    }
+
+    return i + vi_utf16_narrow_sse2(dst + i, src + i, size - i);
+}
+
+/**
+ * @brief Считает первые байты последовательностей по 32 байта за шаг AVX2.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static vi_usize_t
+vi_utf8_count_avx2(const vi_u8_t *src, vi_usize_t size, vi_usize_t *four)
+{
+    const __m256i continuation = _mm256_set1_epi8(-65);
+    const __m256i four_lead    = _mm256_set1_epi8((char)0xF0);
+    vi_usize_t leads           = 0;
+    vi_usize_t i               = 0;
+
+    for (; size - i >= 32; i += 32)
+    {
+        const __m256i x = _mm256_loadu_si256((const __m256i *)(src + i));
+
+        if (!_mm256_movemask_epi8(x))
+        {
+            leads += 32;
+            continue;
+        }
+
+        const __m256i lead = _mm256_cmpgt_epi8(x, continuation);
+        const __m256i wide = _mm256_cmpeq_epi8(_mm256_max_epu8(x, four_lead), x);
+
+        leads += (vi_usize_t)vi_bit_popcount32(_mm256_movemask_epi8(lead));
+        *four += (vi_usize_t)vi_bit_popcount32(_mm256_movemask_epi8(wide));
+    }
+
+    return leads + vi_utf8_count_sse2(src + i, size - i, four);
+}
+
+/**
+ * @brief Считает байты UTF-8 для единиц UTF-16 по 16 единиц за шаг AVX2.
+ */
+VI_COMPILER_SIMD_TARGET("avx2")
+static vi_usize_t
+vi_utf16_count_avx2(const vi_uchar16_t *src, vi_usize_t size)
+{
+    const __m256i zero      = _mm256_setzero_si256();
+    const __m256i one_byte  = _mm256_set1_epi16(0x7F);
+    const __m256i two_bytes = _mm256_set1_epi16(0x7FF);
+    const __m256i high_mask = _mm256_set1_epi16((short)0xF800);
+    const __m256i surrogate = _mm256_set1_epi16((short)0xD800);
+    vi_usize_t total        = 0;
+    vi_usize_t i            = 0;
+
+    for (; size - i >= 16; i += 16)
+    {
+        const __m256i x     = _mm256_loadu_si256((const __m256i *)(src + i));
+        const __m256i ascii = _mm256_cmpeq_epi16(_mm256_subs_epu16(x, one_byte), zero);
+
+        if (_mm256_movemask_epi8(ascii) == -1)
+        {
+            total += 16;
+            continue;
+        }
+
+        const __m256i short_ = _mm256_cmpeq_epi16(_mm256_subs_epu16(x, two_bytes), zero);
+        const __m256i pair   = _mm256_cmpeq_epi16(_mm256_and_si256(x, high_mask), surrogate);
+        const vi_u32_t bits  = (vi_u32_t)vi_bit_popcount32(_mm256_movemask_epi8(ascii)) +
+                              (vi_u32_t)vi_bit_popcount32(_mm256_movemask_epi8(short_)) +
+                              (vi_u32_t)vi_bit_popcount32(_mm256_movemask_epi8(pair));
+
+        total += 48 - bits / 2;
+    }
+
+    return total + vi_utf16_count_sse2(src + i, size - i);
+}
+#endif // VI_COMPILER_SIMD_AVX2
+
+/**
+ * @brief Реализации, выбираемые при загрузке библиотеки.
+ */
+static vi_utf8_validate_fn_t vi_utf8_validate_vector = vi_utf8_validate_none;
+#if VI_COMPILER_SIMD_SSE2
+static vi_utf8_widen16_fn_t vi_utf8_widen16_vector = vi_utf8_widen16_sse2;
+static vi_utf8_widen32_fn_t vi_utf8_widen32_vector = vi_utf8_widen32_sse2;
+static vi_utf16_narrow_fn_t vi_utf16_narrow_vector = vi_utf16_narrow_sse2;
+static vi_utf8_count_fn_t vi_utf8_count_vector     = vi_utf8_count_sse2;
+static vi_utf16_count_fn_t vi_utf16_count_vector   = vi_utf16_count_sse2;
+#else
+static vi_utf8_widen16_fn_t vi_utf8_widen16_vector = vi_utf8_widen16_bytes;
+static vi_utf8_widen32_fn_t vi_utf8_widen32_vector = vi_utf8_widen32_bytes;
+static vi_utf16_narrow_fn_t vi_utf16_narrow_vector = vi_utf16_narrow_units;
+static vi_utf8_count_fn_t vi_utf8_count_vector     = vi_utf8_count_bytes;
+static vi_utf16_count_fn_t vi_utf16_count_vector   = vi_utf16_count_units;
+#endif // VI_COMPILER_SIMD_SSE2
+
+#if VI_COMPILER_SIMD_SSSE3
+vi_compiler_constructor(vi_utf_init)
+{
+    if (vi_cpu_has(VI_CPU_FEATURE_SSSE3))
+    {
+        vi_utf8_validate_vector = vi_utf8_validate_ssse3;
+    }
+
+#    if VI_COMPILER_SIMD_AVX2
+    if (vi_cpu_has(VI_CPU_FEATURE_AVX2))
+    {
+        vi_utf8_validate_vector = vi_utf8_validate_avx2;
+        vi_utf8_widen16_vector  = vi_utf8_widen16_avx2;
+        vi_utf8_widen32_vector  = vi_utf8_widen32_avx2;
+        vi_utf16_narrow_vector  = vi_utf16_narrow_avx2;
+        vi_utf8_count_vector    = vi_utf8_count_avx2;
+        vi_utf16_count_vector   = vi_utf16_count_avx2;
+    }
+#    endif // VI_COMPILER_SIMD_AVX2
+}
+#endif // VI_COMPILER_SIMD_SSSE3
+
+vi_return_t
+vi_utf8_validate(const vi_char_t *src, vi_usize_t size, vi_usize_t *offset)
+{
+    if (!src)
+    {
+        return VI_UTF_INVALID;
+    }
+
+    const vi_u8_t *const bytes = (const vi_u8_t *)src;
+    const vi_usize_t start     = vi_utf8_validate_vector(bytes, size);
+    vi_return_t status;
+    const vi_usize_t tail = vi_utf8_validate_bytes(bytes + start, size - start, &status);
+
+    if (offset)
+    {
+        *offset = start + tail;
+    }
+
+    return status;
+}
+
+vi_return_t
+vi_utf8_to_utf16(vi_uchar16_t *dst, const vi_char_t *src, vi_usize_t size, vi_usize_t *result)
+{
+    if (!dst || !src)
+    {
+        return VI_UTF_INVALID;
+    }
+
+    const vi_u8_t *const bytes = (const vi_u8_t *)src;
+    vi_return_t status         = VI_UTF_SUCCESS;
+    vi_return_t length         = 0;
+    vi_usize_t i               = 0;
+    vi_usize_t o               = 0;
+
+    while (i < size && status == VI_UTF_SUCCESS)
+    {
+        const vi_usize_t ascii = vi_utf8_widen16_vector(dst + o, bytes + i, size - i);
+
+        i += ascii;
+        o += ascii;
+
+        const vi_usize_t stop = size - i > VI_UTF_SCALAR_WINDOW ? i + VI_UTF_SCALAR_WINDOW : size;
+
+        for (; i < stop; i += (vi_usize_t)length)
+        {
+            vi_u32_t code;
+            length = vi_utf8_decode(bytes + i, size - i, &code);
+
+            if (length < 0)
+            {
+                status = length;
+                break;
+            }
+
+            if (code > 0xFFFF)
+            {
+                code -= 0x10000;
+                dst[o++] = (vi_uchar16_t)(0xD800 | code >> 10);
+                dst[o++] = (vi_uchar16_t)(0xDC00 | (code & 0x3FF));
+            }
+            else
+            {
+                dst[o++] = (vi_uchar16_t)code;
+            }
+        }
+    }
+
+    if (result)
+    {
+        *result = status == VI_UTF_SUCCESS ? o : i;
+    }
+
+    return status;
+}
+
+vi_return_t
+vi_utf8_to_utf32(vi_uchar32_t *dst, const vi_char_t *src, vi_usize_t size, vi_usize_t *result)
+{
+    if (!dst || !src)
+    {
+        return VI_UTF_INVALID;
+    }
+
+    const vi_u8_t *const bytes = (const vi_u8_t *)src;
+    vi_return_t status         = VI_UTF_SUCCESS;
+    vi_return_t length         = 0;
+    vi_usize_t i               = 0;
+    vi_usize_t o               = 0;
+
+    while (i < size && status == VI_UTF_SUCCESS)
+    {
+        const vi_usize_t ascii = vi_utf8_widen32_vector(dst + o, bytes + i, size - i);
+
+        i += ascii;
+        o += ascii;
+
+        const vi_usize_t stop = size - i > VI_UTF_SCALAR_WINDOW ? i + VI_UTF_SCALAR_WINDOW : size;
+
+        for (; i < stop; i += (vi_usize_t)length)
+        {
+            vi_u32_t code;
+            length = vi_utf8_decode(bytes + i, size - i, &code);
+
+            if (length < 0)
+            {
+                status = length;
+                break;
+            }
+
+            dst[o++] = code;
+        }
+    }
+
+    if (result)
+    {
+        *result = status == VI_UTF_SUCCESS ? o : i;
+    }
+
+    return status;
+}
+
+vi_return_t
+vi_utf16_to_utf8(vi_char_t *dst, const vi_uchar16_t *src, vi_usize_t size, vi_usize_t *result)
+{
+    if (!dst || !src)
+    {
+        return VI_UTF_INVALID;
+    }
+
+    vi_u8_t *const bytes = (vi_u8_t *)dst;
+    vi_return_t status   = VI_UTF_SUCCESS;
+    vi_usize_t i         = 0;
+    vi_usize_t o         = 0;
+
+    while (i < size && status == VI_UTF_SUCCESS)
+    {
+        const vi_usize_t ascii = vi_utf16_narrow_vector(bytes + o, src + i, size - i);
+
+        i += ascii;
+        o += ascii;
+
+        const vi_usize_t stop = size - i > VI_UTF_SCALAR_WINDOW ? i + VI_UTF_SCALAR_WINDOW : size;
+
+        while (i < stop)
+        {
+            const vi_u32_t unit = src[i];
+
+            if (unit < 0x80)
+            {
+                bytes[o++] = (vi_u8_t)unit;
+                ++i;
+                continue;
+            }
+
+            if (unit < 0x800)
+            {
+                bytes[o++] = (vi_u8_t)(0xC0 | unit >> 6);
+                bytes[o++] = (vi_u8_t)(0x80 | (unit & 0x3F));
+                ++i;
+                continue;
+            }
+
+            if (!vi_utf16_is_surrogate(unit))
+            {
+                bytes[o++] = (vi_u8_t)(0xE0 | unit >> 12);
+                bytes[o++] = (vi_u8_t)(0x80 | (unit >> 6 & 0x3F));
+                bytes[o++] = (vi_u8_t)(0x80 | (unit & 0x3F));
+                ++i;
+                continue;
+            }
+
+            if (unit >= 0xDC00)
+            {
+                status = VI_UTF_BAD_SEQUENCE;
+                break;
+            }
+
+            if (i + 1 == size)
+            {
+                status = VI_UTF_TRUNCATED;
+                break;
+            }
+
+            const vi_u32_t low = src[i + 1];
+
+            if ((low & 0xFC00) != 0xDC00)
+            {
+                status = VI_UTF_BAD_SEQUENCE;
+                break;
+            }
+
+            const vi_u32_t code = 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+
+            bytes[o++] = (vi_u8_t)(0xF0 | code >> 18);
+            bytes[o++] = (vi_u8_t)(0x80 | (code >> 12 & 0x3F));
+            bytes[o++] = (vi_u8_t)(0x80 | (code >> 6 & 0x3F));
+            bytes[o++] = (vi_u8_t)(0x80 | (code & 0x3F));
+            i += 2;
+        }
+    }
+
+    if (result)
+    {
+        *result = status == VI_UTF_SUCCESS ? o : i;
+    }
+
+    return status;
+}
+
+vi_usize_t
+vi_utf8_length(const vi_char_t *src, vi_usize_t size)
+{
+    vi_usize_t four = 0;
+
+    return src ? vi_utf8_count_vector((const vi_u8_t *)src, size, &four) : 0;
+}
+
+vi_usize_t
+vi_utf8_length_utf16(const vi_char_t *src, vi_usize_t size)
+{
+    vi_usize_t four = 0;
+
+    if (!src)
+    {
+        return 0;
+    }
+
+    return vi_utf8_count_vector((const vi_u8_t *)src, size, &four) + four;
+}
+
+vi_usize_t
+vi_utf16_length_utf8(const vi_uchar16_t *src, vi_usize_t size)
+{
+    return src ? vi_utf16_count_vector(src, size) : 0;
+}